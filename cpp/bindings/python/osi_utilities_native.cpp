@@ -0,0 +1,315 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+/**
+ * \file
+ * \brief Native Python extension module over the C++ trace file readers and writers.
+ *
+ * The module is an optional backend of the pure-Python package osi_utilities. It only
+ * moves serialized frames across the language boundary: frames are read with
+ * TraceFileReader::ReadRawMessage() and handed to Python as read-only memoryviews
+ * for parsing with the osi3 Python protobuf classes. File I/O, framing and MCAP
+ * chunk decompression run with the GIL released.
+ *
+ * A memoryview returned by read_raw() points into the reader's internal buffer without
+ * copying the frame. It keeps the reader alive, but is only valid until the next
+ * read_raw() or close() on the same reader, which reuse or free the buffer.
+ *
+ * The writers' close() raises OSError if the final flush failed (see
+ * TraceFileWriter::CloseFailed()), since the file is incomplete in that case.
+ *
+ * The columnar export functions run a whole trace through ColumnarExport.h without the
+ * GIL and return the columns as NumPy arrays that take ownership of the C++ vectors.
+ */
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <pybind11/stl/filesystem.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "osi-utilities/tracefile/ColumnarExport.h"
+#include "osi-utilities/tracefile/MessageTypeUtils.h"
+#include "osi-utilities/tracefile/Reader.h"
+#include "osi-utilities/tracefile/reader/MCAPTraceFileReader.h"
+#include "osi-utilities/tracefile/reader/SingleChannelBinaryTraceFileReader.h"
+#include "osi-utilities/tracefile/writer/MCAPTraceFileWriter.h"
+#include "osi-utilities/tracefile/writer/SingleChannelBinaryTraceFileWriter.h"
+
+namespace py = pybind11;
+
+namespace {
+
+/** @brief Python class name (e.g. "GroundTruth") of an OSI message type, empty for kUnknown. */
+auto MessageTypeName(const osi3::ReaderTopLevelMessage message_type) -> std::string {
+    const auto* descriptor = osi3::tracefile::GetMessageDescriptor(message_type);
+    return descriptor != nullptr ? descriptor->name() : std::string();
+}
+
+auto MessageTypeFromName(const std::string& name) -> osi3::ReaderTopLevelMessage {
+    const auto message_type = osi3::tracefile::GetMessageTypeFromFullName("osi3." + name);
+    if (message_type == osi3::ReaderTopLevelMessage::kUnknown) {
+        throw py::value_error("Unsupported OSI message type: " + name);
+    }
+    return message_type;
+}
+
+/**
+ * @brief Reads the next raw frame with the GIL released and converts it to a Python tuple.
+ *
+ * @return None at the end of the file, otherwise (data, message_type, channel_name, log_time, status, error_message)
+ *         where data is a read-only memoryview into the reader buffer (None unless status is ok) and status is the
+ *         ReadStatus value
+ */
+template <typename Reader>
+auto ReadRaw(const py::object& self) -> py::object {
+    auto& reader = self.cast<Reader&>();
+    std::optional<osi3::RawReadResult> result;
+    {
+        py::gil_scoped_release release;
+        if (reader.HasNext()) {
+            result = reader.ReadRawMessage();
+        }
+    }
+    if (!result) {
+        return py::none();
+    }
+
+    py::object data = py::none();
+    if (result->status == osi3::ReadStatus::kOk) {
+        data = py::memoryview::from_memory(static_cast<const void*>(result->data), static_cast<py::ssize_t>(result->size));
+        // keep_alive on the view itself, the returned tuple cannot be weakly referenced
+        py::detail::keep_alive_impl(data, self);
+    }
+    return py::make_tuple(std::move(data), MessageTypeName(result->message_type), result->channel_name, result->log_time, static_cast<int>(result->status),
+                          result->error_message);
+}
+
+template <typename Reader>
+auto HasNext(Reader& reader) -> bool {
+    py::gil_scoped_release release;
+    return reader.HasNext();
+}
+
+/** @brief Moves a column into a NumPy array without copying the values. */
+template <typename T>
+auto ToArray(std::vector<T>& column) -> py::array_t<T> {
+    auto* owned = new std::vector<T>(std::move(column));
+    py::capsule owner(owned, [](void* pointer) { delete static_cast<std::vector<T>*>(pointer); });
+    return py::array_t<T>(static_cast<py::ssize_t>(owned->size()), owned->data(), owner);
+}
+
+/**
+ * @brief Opens a trace file and runs a columnar extraction over it with the GIL released.
+ */
+template <typename Columns>
+auto ExtractColumns(const std::filesystem::path& file_path, const std::vector<std::string>& topics, const std::string& message_type,
+                    Columns (*extract)(osi3::TraceFileReader&)) -> Columns {
+    const auto type = message_type.empty() ? osi3::ReaderTopLevelMessage::kUnknown : MessageTypeFromName(message_type);
+    py::gil_scoped_release release;
+    auto reader = osi3::TraceFileReaderFactory::openReader(file_path, type);
+    if (!topics.empty()) {
+        auto* mcap_reader = dynamic_cast<osi3::MCAPTraceFileReader*>(reader.get());
+        if (mcap_reader == nullptr) {
+            throw std::invalid_argument("Topics can only be selected for MCAP trace files");
+        }
+        mcap_reader->SetTopics({topics.begin(), topics.end()});
+    }
+    return extract(*reader);
+}
+
+auto ExtractMovingObjectArrays(const std::filesystem::path& file_path, const std::vector<std::string>& topics, const std::string& message_type) -> py::dict {
+    auto columns = ExtractColumns(file_path, topics, message_type, &osi3::tracefile::ExtractMovingObjects);
+    py::dict result;
+    result["frame_index"] = ToArray(columns.frame_index);
+    result["timestamp"] = ToArray(columns.timestamp);
+    result["id"] = ToArray(columns.id);
+    result["position_x"] = ToArray(columns.position_x);
+    result["position_y"] = ToArray(columns.position_y);
+    result["position_z"] = ToArray(columns.position_z);
+    result["orientation_roll"] = ToArray(columns.orientation_roll);
+    result["orientation_pitch"] = ToArray(columns.orientation_pitch);
+    result["orientation_yaw"] = ToArray(columns.orientation_yaw);
+    result["velocity_x"] = ToArray(columns.velocity_x);
+    result["velocity_y"] = ToArray(columns.velocity_y);
+    result["velocity_z"] = ToArray(columns.velocity_z);
+    result["dimension_length"] = ToArray(columns.dimension_length);
+    result["dimension_width"] = ToArray(columns.dimension_width);
+    result["dimension_height"] = ToArray(columns.dimension_height);
+    return result;
+}
+
+auto ExtractDetectedObjectArrays(const std::filesystem::path& file_path, const std::vector<std::string>& topics, const std::string& message_type) -> py::dict {
+    auto columns = ExtractColumns(file_path, topics, message_type, &osi3::tracefile::ExtractDetectedObjects);
+    py::dict result;
+    result["frame_index"] = ToArray(columns.frame_index);
+    result["timestamp"] = ToArray(columns.timestamp);
+    result["id"] = ToArray(columns.id);
+    result["existence_probability"] = ToArray(columns.existence_probability);
+    result["position_x"] = ToArray(columns.position_x);
+    result["position_y"] = ToArray(columns.position_y);
+    result["position_z"] = ToArray(columns.position_z);
+    result["orientation_roll"] = ToArray(columns.orientation_roll);
+    result["orientation_pitch"] = ToArray(columns.orientation_pitch);
+    result["orientation_yaw"] = ToArray(columns.orientation_yaw);
+    result["velocity_x"] = ToArray(columns.velocity_x);
+    result["velocity_y"] = ToArray(columns.velocity_y);
+    result["velocity_z"] = ToArray(columns.velocity_z);
+    result["dimension_length"] = ToArray(columns.dimension_length);
+    result["dimension_width"] = ToArray(columns.dimension_width);
+    result["dimension_height"] = ToArray(columns.dimension_height);
+    return result;
+}
+
+// Closes a C++ writer with the GIL released and raises OSError if the final flush failed
+void CloseWriter(osi3::TraceFileWriter& writer) {
+    bool failed = false;
+    {
+        py::gil_scoped_release release;
+        writer.Close();
+        failed = writer.CloseFailed();
+    }
+    if (failed) {
+        PyErr_SetString(PyExc_OSError, "Failed to finish the trace file, it is incomplete");
+        throw py::error_already_set();
+    }
+}
+
+// Writes a serialized frame through the raw (non-parsing) write path of a C++ writer
+auto WriteRaw(osi3::TraceFileWriter& writer, const py::buffer& data, const std::string& message_type, const std::string& topic) -> bool {
+    const auto* descriptor = osi3::tracefile::GetMessageDescriptor(MessageTypeFromName(message_type));
+    const auto info = data.request();
+    py::gil_scoped_release release;
+    return writer.WriteRawMessage(static_cast<const char*>(info.ptr), static_cast<size_t>(info.size * info.itemsize), descriptor, topic);
+}
+
+class BinaryWriter {
+   public:
+    auto Open(const std::filesystem::path& file_path) -> bool {
+        py::gil_scoped_release release;
+        return writer_.Open(file_path);
+    }
+
+    auto Write(const py::buffer& data, const std::string& message_type) -> bool { return WriteRaw(writer_, data, message_type, ""); }
+
+    void Close() { CloseWriter(writer_); }
+
+   private:
+    osi3::SingleChannelBinaryTraceFileWriter writer_;
+};
+
+class MCAPWriter {
+   public:
+    auto Open(const std::filesystem::path& file_path, const std::string& compression, const uint64_t chunk_size) -> bool {
+        mcap::McapWriterOptions options("protobuf");
+        if (compression == "none") {
+            options.compression = mcap::Compression::None;
+        } else if (compression == "lz4") {
+            options.compression = mcap::Compression::Lz4;
+        } else if (compression == "zstd") {
+            options.compression = mcap::Compression::Zstd;
+        } else if (!compression.empty()) {
+            throw py::value_error("Unsupported compression: " + compression);
+        }
+        if (chunk_size != 0) {
+            options.chunkSize = chunk_size;
+        }
+        py::gil_scoped_release release;
+        return writer_.Open(file_path, options);
+    }
+
+    auto AddFileMetadata(const std::string& name, const std::unordered_map<std::string, std::string>& metadata) -> bool {
+        return writer_.AddFileMetadata(name, metadata);
+    }
+
+    auto AddChannel(const std::string& topic, const std::string& message_type, std::unordered_map<std::string, std::string> metadata) -> uint16_t {
+        return writer_.AddChannel(topic, osi3::tracefile::GetMessageDescriptor(MessageTypeFromName(message_type)), std::move(metadata));
+    }
+
+    auto Write(const py::buffer& data, const std::string& message_type, const std::string& topic) -> bool { return WriteRaw(writer_, data, message_type, topic); }
+
+    void Close() { CloseWriter(writer_); }
+
+   private:
+    osi3::MCAPTraceFileWriter writer_;
+};
+
+}  // namespace
+
+PYBIND11_MODULE(osi_utilities_native, module) {
+    module.doc() = "Native backend of osi_utilities over the C++ OSI trace file readers and writers";
+
+    module.def(
+        "is_supported_message_type", [](const std::string& name) { return osi3::tracefile::GetMessageTypeFromFullName("osi3." + name) != osi3::ReaderTopLevelMessage::kUnknown; },
+        py::arg("message_type"), "Check whether a message type name (e.g. 'GroundTruth') is supported by the native readers and writers");
+
+    module.def("extract_moving_objects", &ExtractMovingObjectArrays, py::arg("path"), py::arg("topics") = std::vector<std::string>{}, py::arg("message_type") = "",
+               "Extract the moving objects of all GroundTruth frames as a dict of NumPy arrays");
+    module.def("extract_detected_objects", &ExtractDetectedObjectArrays, py::arg("path"), py::arg("topics") = std::vector<std::string>{}, py::arg("message_type") = "",
+               "Extract the detected moving objects of all SensorData frames as a dict of NumPy arrays");
+
+    module.attr("READ_STATUS_OK") = static_cast<int>(osi3::ReadStatus::kOk);
+    module.attr("READ_STATUS_INCOMPATIBLE") = static_cast<int>(osi3::ReadStatus::kIncompatible);
+    module.attr("READ_STATUS_ERROR") = static_cast<int>(osi3::ReadStatus::kError);
+
+    py::class_<osi3::SingleChannelBinaryTraceFileReader>(module, "BinaryReader", "Reader for single-channel binary .osi trace files")
+        .def(py::init<>())
+        .def(
+            "open",
+            [](osi3::SingleChannelBinaryTraceFileReader& reader, const std::filesystem::path& file_path, const std::string& message_type) {
+                const auto type = MessageTypeFromName(message_type);
+                py::gil_scoped_release release;
+                return reader.Open(file_path, type);
+            },
+            py::arg("path"), py::arg("message_type"))
+        .def("read_raw", &ReadRaw<osi3::SingleChannelBinaryTraceFileReader>,
+             "Read the next frame as (data, message_type, topic, log_time, status, error_message), None at the end; "
+             "data is only valid until the next read_raw() or close()")
+        .def("has_next", &HasNext<osi3::SingleChannelBinaryTraceFileReader>)
+        .def("close", &osi3::SingleChannelBinaryTraceFileReader::Close);
+
+    py::class_<osi3::MCAPTraceFileReader>(module, "MCAPReader", "Reader for multi-channel .mcap trace files")
+        .def(py::init<>())
+        .def(
+            "open",
+            [](osi3::MCAPTraceFileReader& reader, const std::filesystem::path& file_path) {
+                py::gil_scoped_release release;
+                return reader.Open(file_path);
+            },
+            py::arg("path"))
+        .def(
+            "set_topics", [](osi3::MCAPTraceFileReader& reader, const std::vector<std::string>& topics) { reader.SetTopics({topics.begin(), topics.end()}); },
+            py::arg("topics"))
+        .def("set_skip_incompatible_messages", &osi3::MCAPTraceFileReader::SetSkipIncompatibleMessages, py::arg("skip"))
+        .def("set_log_incompatible_messages", &osi3::MCAPTraceFileReader::SetLogIncompatibleMessages, py::arg("log"))
+        .def("read_raw", &ReadRaw<osi3::MCAPTraceFileReader>,
+             "Read the next frame as (data, message_type, topic, log_time, status, error_message), None at the end; "
+             "data is only valid until the next read_raw() or close()")
+        .def("has_next", &HasNext<osi3::MCAPTraceFileReader>)
+        .def("close", &osi3::MCAPTraceFileReader::Close);
+
+    py::class_<BinaryWriter>(module, "BinaryWriter", "Writer for single-channel binary .osi trace files")
+        .def(py::init<>())
+        .def("open", &BinaryWriter::Open, py::arg("path"))
+        .def("write", &BinaryWriter::Write, py::arg("data"), py::arg("message_type"), "Write a serialized message")
+        .def("close", &BinaryWriter::Close, "Close the file; raises OSError if the final flush failed");
+
+    py::class_<MCAPWriter>(module, "MCAPWriter", "Writer for multi-channel .mcap trace files")
+        .def(py::init<>())
+        .def("open", &MCAPWriter::Open, py::arg("path"), py::arg("compression") = "", py::arg("chunk_size") = 0,
+             "Open a file; compression is 'none', 'lz4' or 'zstd', empty strings and zero keep the defaults")
+        .def("add_file_metadata", &MCAPWriter::AddFileMetadata, py::arg("name"), py::arg("metadata"))
+        .def("add_channel", &MCAPWriter::AddChannel, py::arg("topic"), py::arg("message_type"), py::arg("metadata") = std::unordered_map<std::string, std::string>{})
+        .def("write", &MCAPWriter::Write, py::arg("data"), py::arg("message_type"), py::arg("topic"), "Write a serialized message")
+        .def("close", &MCAPWriter::Close, "Close the file; raises OSError if the final flush failed");
+}
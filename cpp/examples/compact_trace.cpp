@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+/**
+ * \file
+ * \brief Compact an OSI trace file for archiving.
+ *
+ * Removes configurable unused sub-trees, unknown fields and default values from
+ * every frame and writes the frames in canonical (deterministic) encoding.
+ *
+ * Usage: compact_trace <input> <output> [--remove FIELD]... [--lane-boundary-range M] [--keep-unknown] [--keep-defaults] [--type T]
+ *
+ * Exit codes: 0 success, 2 error.
+ */
+
+#include <osi-utilities/tracefile/TraceCompaction.h>
+
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+constexpr int kExitSuccess = 0;
+constexpr int kExitError = 2;
+
+struct ProgramOptions {
+    std::filesystem::path input_path;
+    std::filesystem::path output_path;
+    osi3::tracefile::CompactionOptions compaction_options;
+};
+
+/** \brief Map CLI message type names to OSI enum values. */
+const std::unordered_map<std::string, osi3::ReaderTopLevelMessage> kValidTypes = {
+    {"GroundTruth", osi3::ReaderTopLevelMessage::kGroundTruth},         {"SensorData", osi3::ReaderTopLevelMessage::kSensorData},
+    {"SensorView", osi3::ReaderTopLevelMessage::kSensorView},           {"HostVehicleData", osi3::ReaderTopLevelMessage::kHostVehicleData},
+    {"TrafficCommand", osi3::ReaderTopLevelMessage::kTrafficCommand},   {"TrafficCommandUpdate", osi3::ReaderTopLevelMessage::kTrafficCommandUpdate},
+    {"TrafficUpdate", osi3::ReaderTopLevelMessage::kTrafficUpdate},     {"MotionRequest", osi3::ReaderTopLevelMessage::kMotionRequest},
+    {"StreamingUpdate", osi3::ReaderTopLevelMessage::kStreamingUpdate},
+};
+
+void PrintUsage() {
+    std::cerr << "Usage: compact_trace <input> <output> [options]\n"
+              << "\n"
+              << "Compacts a trace file (.osi, .mcap or .txth) for archiving and writes the\n"
+              << "frames in canonical encoding, so equal frames always have equal bytes.\n"
+              << "\n"
+              << "Options:\n"
+              << "  --remove <field>             Remove a field wherever it occurs, by name (e.g. model_reference)\n"
+              << "                               or full name (e.g. osi3.MovingObject.source_reference); repeatable\n"
+              << "  --lane-boundary-range <m>    Remove lane boundary points farther than m meters from the host vehicle\n"
+              << "  --keep-unknown               Keep fields unknown to the compiled OSI version\n"
+              << "  --keep-defaults              Keep fields explicitly set to their default value\n"
+              << "  --type <type>                Message type of .osi files if not stated in the filename\n"
+              << "\n"
+              << "Exit codes: 0 success, 2 error\n";
+}
+
+auto IsHelpRequested(const int argc, const char** argv) -> bool { return argc >= 2 && (std::string(argv[1]) == "--help" || std::string(argv[1]) == "-h"); }
+
+auto ParseArguments(const int argc, const char** argv) -> std::optional<ProgramOptions> {
+    if (argc < 3) {
+        PrintUsage();
+        return std::nullopt;
+    }
+
+    ProgramOptions options{argv[1], argv[2], {}};
+    for (int i = 3; i < argc; ++i) {
+        const std::string argument = argv[i];
+        if (argument == "--remove" && i + 1 < argc) {
+            options.compaction_options.removed_fields.emplace_back(argv[++i]);
+        } else if (argument == "--lane-boundary-range" && i + 1 < argc) {
+            options.compaction_options.lane_boundary_range = std::stod(argv[++i]);
+        } else if (argument == "--keep-unknown") {
+            options.compaction_options.remove_unknown_fields = false;
+        } else if (argument == "--keep-defaults") {
+            options.compaction_options.remove_default_values = false;
+        } else if (argument == "--type" && i + 1 < argc) {
+            const auto type_it = kValidTypes.find(argv[++i]);
+            if (type_it == kValidTypes.end()) {
+                std::cerr << "ERROR: Unknown message type: " << argv[i] << "\n";
+                return std::nullopt;
+            }
+            options.compaction_options.message_type = type_it->second;
+        } else {
+            std::cerr << "ERROR: Unknown or incomplete argument: " << argument << "\n";
+            return std::nullopt;
+        }
+    }
+
+    return options;
+}
+
+auto RunProgram(const int argc, const char** argv) -> int {
+    if (IsHelpRequested(argc, argv)) {
+        PrintUsage();
+        return kExitSuccess;
+    }
+
+    const auto options = ParseArguments(argc, argv);
+    if (!options) {
+        return kExitError;
+    }
+
+    const auto report = osi3::tracefile::CompactTraceFile(options->input_path, options->output_path, options->compaction_options);
+    std::cout << "Compacted " << report.frame_count << " frames from " << report.input_bytes << " to " << report.output_bytes << " bytes\n";
+    return kExitSuccess;
+}
+
+auto RunMainNoThrow(const int argc, const char** argv) noexcept -> int {
+    try {
+        return RunProgram(argc, argv);
+    } catch (const std::exception& error) {
+        std::fputs("ERROR: ", stderr);
+        std::fputs(error.what(), stderr);
+        std::fputc('\n', stderr);
+    } catch (...) {
+        std::fputs("ERROR: Unknown exception\n", stderr);
+    }
+
+    return kExitError;
+}
+
+}  // namespace
+
+auto main(const int argc, const char** argv) -> int { return RunMainNoThrow(argc, argv); }
@@ -0,0 +1,164 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+/**
+ * \file
+ * \brief Convert many OSI trace files in parallel.
+ *
+ * Converts every trace file of the given files and directories, e.g. a whole
+ * dataset after an OSI version bump, over a thread pool sized to the cores and
+ * memory budget. Outputs are written atomically; up-to-date outputs are skipped.
+ *
+ * Usage: convert_batch <input>... --output-dir <dir> [--to osi|mcap|txth] [--gt2sv] [--jobs N] [--memory-budget MiB] [--force] [--type T]
+ *
+ * Exit codes: 0 success, 1 some files failed, 2 error.
+ */
+
+#include <osi-utilities/tracefile/BatchConversion.h>
+
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+constexpr int kExitSuccess = 0;
+constexpr int kExitFailures = 1;
+constexpr int kExitError = 2;
+
+struct ProgramOptions {
+    std::vector<std::filesystem::path> inputs;
+    std::filesystem::path output_directory;
+    osi3::tracefile::BatchConversionOptions conversion_options;
+};
+
+/** \brief Map CLI message type names to OSI enum values. */
+const std::unordered_map<std::string, osi3::ReaderTopLevelMessage> kValidTypes = {
+    {"GroundTruth", osi3::ReaderTopLevelMessage::kGroundTruth},         {"SensorData", osi3::ReaderTopLevelMessage::kSensorData},
+    {"SensorView", osi3::ReaderTopLevelMessage::kSensorView},           {"HostVehicleData", osi3::ReaderTopLevelMessage::kHostVehicleData},
+    {"TrafficCommand", osi3::ReaderTopLevelMessage::kTrafficCommand},   {"TrafficCommandUpdate", osi3::ReaderTopLevelMessage::kTrafficCommandUpdate},
+    {"TrafficUpdate", osi3::ReaderTopLevelMessage::kTrafficUpdate},     {"MotionRequest", osi3::ReaderTopLevelMessage::kMotionRequest},
+    {"StreamingUpdate", osi3::ReaderTopLevelMessage::kStreamingUpdate},
+};
+
+void PrintUsage() {
+    std::cerr << "Usage: convert_batch <input>... --output-dir <dir> [options]\n"
+              << "\n"
+              << "Converts all trace files (.osi, .mcap, .txth) of the given files and directories\n"
+              << "in parallel, biggest files first. Outputs are written atomically and skipped\n"
+              << "if they are newer than their input.\n"
+              << "\n"
+              << "Options:\n"
+              << "  --output-dir <dir>       Directory the converted files are written to (required)\n"
+              << "  --to <format>            Output format: osi, mcap, txth (default: mcap)\n"
+              << "  --gt2sv                  Wrap GroundTruth frames in SensorView messages\n"
+              << "  --jobs <n>               Maximum number of concurrent conversions (default: number of cores)\n"
+              << "  --memory-budget <MiB>    Memory available to the concurrent conversions (default: unlimited)\n"
+              << "  --force                  Convert even if the output is up to date\n"
+              << "  --type <type>            Message type of .osi/.txth inputs if not stated in the filename\n"
+              << "\n"
+              << "Exit codes: 0 success, 1 some files failed, 2 error\n";
+}
+
+auto IsHelpRequested(const int argc, const char** argv) -> bool { return argc >= 2 && (std::string(argv[1]) == "--help" || std::string(argv[1]) == "-h"); }
+
+auto ParseArguments(const int argc, const char** argv) -> std::optional<ProgramOptions> {
+    ProgramOptions options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument = argv[i];
+        if (argument == "--output-dir" && i + 1 < argc) {
+            options.output_directory = argv[++i];
+        } else if (argument == "--to" && i + 1 < argc) {
+            options.conversion_options.output_extension = "." + std::string(argv[++i]);
+        } else if (argument == "--gt2sv") {
+            options.conversion_options.conversion = osi3::tracefile::TraceConversion::kGroundTruthToSensorView;
+        } else if (argument == "--jobs" && i + 1 < argc) {
+            options.conversion_options.thread_count = std::stoull(argv[++i]);
+        } else if (argument == "--memory-budget" && i + 1 < argc) {
+            options.conversion_options.memory_budget = std::stoull(argv[++i]) * 1024 * 1024;
+        } else if (argument == "--force") {
+            options.conversion_options.force = true;
+        } else if (argument == "--type" && i + 1 < argc) {
+            const auto type_it = kValidTypes.find(argv[++i]);
+            if (type_it == kValidTypes.end()) {
+                std::cerr << "ERROR: Unknown message type: " << argv[i] << "\n";
+                return std::nullopt;
+            }
+            options.conversion_options.message_type = type_it->second;
+        } else if (argument.rfind("--", 0) == 0) {
+            std::cerr << "ERROR: Unknown or incomplete argument: " << argument << "\n";
+            return std::nullopt;
+        } else {
+            options.inputs.emplace_back(argument);
+        }
+    }
+
+    if (options.inputs.empty() || options.output_directory.empty()) {
+        PrintUsage();
+        return std::nullopt;
+    }
+    return options;
+}
+
+void PrintResult(const osi3::tracefile::BatchConversionResult& result) {
+    switch (result.status) {
+        case osi3::tracefile::BatchConversionStatus::kConverted:
+            std::cout << "converted " << result.input_path.string() << " (" << result.frame_count << " frames, " << std::fixed << std::setprecision(2) << result.seconds
+                      << " s)\n";
+            break;
+        case osi3::tracefile::BatchConversionStatus::kSkipped:
+            std::cout << "up to date " << result.input_path.string() << "\n";
+            break;
+        case osi3::tracefile::BatchConversionStatus::kFailed:
+            std::cerr << "ERROR: " << result.input_path.string() << ": " << result.error_message << "\n";
+            break;
+    }
+}
+
+auto RunProgram(const int argc, const char** argv) -> int {
+    if (IsHelpRequested(argc, argv)) {
+        PrintUsage();
+        return kExitSuccess;
+    }
+
+    auto options = ParseArguments(argc, argv);
+    if (!options) {
+        return kExitError;
+    }
+
+    const auto input_paths = osi3::tracefile::CollectTraceFiles(options->inputs);
+    options->conversion_options.on_file_done = PrintResult;
+    const auto report = osi3::tracefile::ConvertTraceFiles(input_paths, options->output_directory, options->conversion_options);
+
+    constexpr double kMebibyte = 1024.0 * 1024.0;
+    std::cout << "\n"
+              << report.converted_count << " converted, " << report.skipped_count << " up to date, " << report.failed_count << " failed\n"
+              << std::fixed << std::setprecision(1) << static_cast<double>(report.input_bytes) / kMebibyte << " MiB, " << report.frame_count << " frames in "
+              << report.elapsed_seconds << " s on " << report.thread_count << " threads (" << report.ThroughputBytesPerSecond() / kMebibyte << " MiB/s)\n";
+    return report.failed_count > 0 ? kExitFailures : kExitSuccess;
+}
+
+auto RunMainNoThrow(const int argc, const char** argv) noexcept -> int {
+    try {
+        return RunProgram(argc, argv);
+    } catch (const std::exception& error) {
+        std::fputs("ERROR: ", stderr);
+        std::fputs(error.what(), stderr);
+        std::fputc('\n', stderr);
+    } catch (...) {
+        std::fputs("ERROR: Unknown exception\n", stderr);
+    }
+
+    return kExitError;
+}
+
+}  // namespace
+
+auto main(const int argc, const char** argv) -> int { return RunMainNoThrow(argc, argv); }
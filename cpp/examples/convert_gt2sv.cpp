@@ -8,11 +8,13 @@
  *
  * Supports .osi (binary) and .mcap input/output in any combination.
  * Each GroundTruth frame is wrapped in a SensorView message whose
- * global_ground_truth field contains the original data.
+ * global_ground_truth field contains the original data. The frames are
+ * wrapped on the wire-format level, without parsing the GroundTruth.
  *
  * Usage: convert_gt2sv <input.osi|.mcap> <output.osi|.mcap> [--topic <name>]
  */
 
+#include <osi-utilities/tracefile/MessageTypeUtils.h>
 #include <osi-utilities/tracefile/Reader.h>
 #include <osi-utilities/tracefile/reader/MCAPTraceFileReader.h>
 #include <osi-utilities/tracefile/reader/SingleChannelBinaryTraceFileReader.h>
@@ -29,7 +31,6 @@
 #include <stdexcept>
 #include <string>
 
-#include "osi_groundtruth.pb.h"
 #include "osi_sensorview.pb.h"
 
 namespace {
@@ -45,12 +46,12 @@ struct OutputContext {
     std::unique_ptr<osi3::MCAPTraceFileWriter> mcap_writer;
     std::string output_topic;
 
-    [[nodiscard]] auto WriteMessage(const osi3::SensorView& sensor_view) const -> bool {
+    [[nodiscard]] auto WriteMessage(const std::string& sensor_view) const -> bool {
         if (mcap_writer) {
-            return mcap_writer->WriteMessage(sensor_view, output_topic);
+            return mcap_writer->WriteRawMessage(sensor_view.data(), sensor_view.size(), osi3::SensorView::descriptor(), output_topic);
         }
 
-        return binary_writer->WriteMessage(sensor_view);
+        return binary_writer->WriteRawMessage(sensor_view.data(), sensor_view.size(), osi3::SensorView::descriptor());
     }
 
     void Close() const {
@@ -152,34 +153,25 @@ auto CreateOutputContext(const ProgramOptions& options) -> OutputContext {
     throw std::runtime_error("Unsupported output format: " + output_ext + " (use .osi or .mcap)");
 }
 
-auto BuildSensorViewMessage(const osi3::GroundTruth& ground_truth) -> osi3::SensorView {
-    osi3::SensorView sensor_view;
-    if (ground_truth.has_timestamp()) {
-        sensor_view.mutable_timestamp()->CopyFrom(ground_truth.timestamp());
-    }
-    if (ground_truth.has_host_vehicle_id()) {
-        sensor_view.mutable_host_vehicle_id()->CopyFrom(ground_truth.host_vehicle_id());
-    }
-    sensor_view.mutable_global_ground_truth()->CopyFrom(ground_truth);
-    return sensor_view;
-}
-
 auto ConvertFrames(osi3::TraceFileReader& reader, OutputContext& output_context) -> int {
     int frame_count = 0;
+    std::string sensor_view;
     while (reader.HasNext()) {
-        auto result = reader.ReadMessage();
-        if (!result) {
+        const auto result = reader.ReadRawMessage();
+        if (!result || result->status != osi3::ReadStatus::kOk) {
             std::cerr << "WARNING: Failed to read frame " << frame_count << ", skipping.\n";
             continue;
         }
 
-        auto* gt = dynamic_cast<osi3::GroundTruth*>(result->message.get());
-        if (gt == nullptr) {
+        if (result->message_type != osi3::ReaderTopLevelMessage::kGroundTruth) {
             std::cerr << "WARNING: Frame " << frame_count << " is not a GroundTruth, skipping.\n";
             continue;
         }
 
-        const auto sensor_view = BuildSensorViewMessage(*gt);
+        if (!osi3::tracefile::WrapGroundTruthInSensorView({result->data, result->size}, sensor_view)) {
+            std::cerr << "WARNING: Frame " << frame_count << " is not a valid GroundTruth, skipping.\n";
+            continue;
+        }
         if (!output_context.WriteMessage(sensor_view)) {
             throw std::runtime_error("Failed to write frame " + std::to_string(frame_count));
         }
@@ -153,6 +153,7 @@ struct ProgramOptions {
     size_t chunk_size = osi3::tracefile::config::kDefaultChunkSize;                   /**< MCAP chunk size in bytes. */
     mcap::Compression compression = mcap::Compression::Zstd;                          /**< MCAP compression type. */
     mcap::CompressionLevel compression_level = mcap::CompressionLevel::Default;       /**< MCAP compression level. */
+    osi3::tracefile::IoOptions io_options;                                            /**< I/O engine of reader and writer. */
 };
 
 /** \brief Map CLI message type names to OSI enum values. */
@@ -163,6 +164,10 @@ const std::unordered_map<std::string, osi3::ReaderTopLevelMessage> kValidTypes =
     {"TrafficUpdate", osi3::ReaderTopLevelMessage::kTrafficUpdate},    {"MotionRequest", osi3::ReaderTopLevelMessage::kMotionRequest},
     {"StreamingUpdate", osi3::ReaderTopLevelMessage::kStreamingUpdate}};
 
+/** \brief Map CLI I/O backend names to enum values. */
+const std::unordered_map<std::string, osi3::tracefile::IoBackend> kIoBackends = {
+    {"stream", osi3::tracefile::IoBackend::kStream}, {"pread", osi3::tracefile::IoBackend::kPread}, {"io_uring", osi3::tracefile::IoBackend::kIoUring}};
+
 /**
  * \brief Print CLI usage information.
  */
@@ -180,7 +185,8 @@ void printHelp() {
     std::cout << "\n  --chunk_size <size>     Chunk size in bytes (default: " << osi3::tracefile::config::kDefaultChunkSize << " = 16 MiB)\n"
               << "                          Lichtblick plays back well with 4-32 MiB chunks.\n"
               << "  --compression <type>    Compression type: none, lz4, zstd (default: zstd)\n"
-              << "  --compression_level <l> Compression level: fastest, fast, default (default: default)\n";
+              << "  --compression_level <l> Compression level: fastest, fast, default (default: default)\n"
+              << "  --io <backend>          I/O engine: stream, pread, io_uring (default: stream)\n";
 }
 
 /**
@@ -238,6 +244,13 @@ auto parseArgs(const int argc, const char** argv) -> std::optional<ProgramOption
                 options.compression = parseCompressionType(argv[++i]);
             } else if (arg == "--compression_level" && i + 1 < argc) {
                 options.compression_level = parseCompressionLevel(argv[++i]);
+            } else if (arg == "--io" && i + 1 < argc) {
+                const std::string backend_str = argv[++i];
+                const auto backend_it = kIoBackends.find(backend_str);
+                if (backend_it == kIoBackends.end()) {
+                    throw std::invalid_argument("Invalid I/O backend: " + backend_str);
+                }
+                options.io_options.backend = backend_it->second;
             } else {
                 throw std::invalid_argument("Invalid argument: " + arg);
             }
@@ -266,6 +279,7 @@ auto main(const int argc, const char** argv) -> int {
 
     // create single channel trace file (.osi) reader
     auto trace_file_reader = osi3::SingleChannelBinaryTraceFileReader();
+    trace_file_reader.SetIoOptions(options->io_options);
     if (!trace_file_reader.Open(options->input_file_path, options->message_type)) {
         std::cerr << "ERROR: Could not open input file " << options->input_file_path.string() << std::endl;
         return 1;
@@ -273,6 +287,7 @@ auto main(const int argc, const char** argv) -> int {
 
     // create MCAP writer
     auto trace_file_writer = osi3::MCAPTraceFileWriter();
+    trace_file_writer.SetIoOptions(options->io_options);
 
     // set MCAP options
     mcap::McapWriterOptions mcap_options("osi2mcap");
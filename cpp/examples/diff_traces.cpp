@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+/**
+ * \file
+ * \brief Compare two OSI trace files frame by frame.
+ *
+ * Every frame is reduced to a 64-bit hash without deserializing it. Frames are
+ * aligned by channel and log time and reported as identical, differing, missing
+ * or extra. A field-level diff can be requested for the differing frames only.
+ *
+ * Usage: diff_traces <reference> <candidate> [--canonical] [--field-diff] [--max-field-diffs N] [--type T]
+ *
+ * Exit codes: 0 traces are identical, 1 traces differ, 2 error.
+ */
+
+#include <osi-utilities/tracefile/TraceFileDiff.h>
+
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+constexpr int kExitIdentical = 0;
+constexpr int kExitDifferent = 1;
+constexpr int kExitError = 2;
+
+struct ProgramOptions {
+    std::filesystem::path reference_path;
+    std::filesystem::path candidate_path;
+    osi3::tracefile::TraceDiffOptions diff_options;
+};
+
+/** \brief Map CLI message type names to OSI enum values. */
+const std::unordered_map<std::string, osi3::ReaderTopLevelMessage> kValidTypes = {
+    {"GroundTruth", osi3::ReaderTopLevelMessage::kGroundTruth},         {"SensorData", osi3::ReaderTopLevelMessage::kSensorData},
+    {"SensorView", osi3::ReaderTopLevelMessage::kSensorView},           {"HostVehicleData", osi3::ReaderTopLevelMessage::kHostVehicleData},
+    {"TrafficCommand", osi3::ReaderTopLevelMessage::kTrafficCommand},   {"TrafficCommandUpdate", osi3::ReaderTopLevelMessage::kTrafficCommandUpdate},
+    {"TrafficUpdate", osi3::ReaderTopLevelMessage::kTrafficUpdate},     {"MotionRequest", osi3::ReaderTopLevelMessage::kMotionRequest},
+    {"StreamingUpdate", osi3::ReaderTopLevelMessage::kStreamingUpdate},
+};
+
+void PrintUsage() {
+    std::cerr << "Usage: diff_traces <reference> <candidate> [options]\n"
+              << "\n"
+              << "Compares two trace files (.osi or .mcap) frame by frame using 64-bit\n"
+              << "frame hashes. Frames are aligned by channel and log time.\n"
+              << "\n"
+              << "Options:\n"
+              << "  --canonical            Hash a deterministic re-serialization instead of the stored\n"
+              << "                         bytes (compares traces written by different serializers)\n"
+              << "  --field-diff           Print field-level differences of differing frames\n"
+              << "  --max-field-diffs <N>  Limit field-level diffs to the first N differing frames (default: 10)\n"
+              << "  --type <type>          Message type of .osi files if not stated in the filename\n"
+              << "\n"
+              << "Exit codes: 0 identical, 1 different, 2 error\n";
+}
+
+auto IsHelpRequested(const int argc, const char** argv) -> bool { return argc >= 2 && (std::string(argv[1]) == "--help" || std::string(argv[1]) == "-h"); }
+
+auto ParseArguments(const int argc, const char** argv) -> std::optional<ProgramOptions> {
+    if (argc < 3) {
+        PrintUsage();
+        return std::nullopt;
+    }
+
+    ProgramOptions options{argv[1], argv[2], {}};
+    for (int i = 3; i < argc; ++i) {
+        const std::string argument = argv[i];
+        if (argument == "--canonical") {
+            options.diff_options.mode = osi3::tracefile::FingerprintMode::kCanonical;
+        } else if (argument == "--field-diff") {
+            options.diff_options.field_diff = true;
+        } else if (argument == "--max-field-diffs" && i + 1 < argc) {
+            options.diff_options.max_field_diffs = std::stoul(argv[++i]);
+        } else if (argument == "--type" && i + 1 < argc) {
+            const auto type_it = kValidTypes.find(argv[++i]);
+            if (type_it == kValidTypes.end()) {
+                std::cerr << "ERROR: Unknown message type: " << argv[i] << "\n";
+                return std::nullopt;
+            }
+            options.diff_options.message_type = type_it->second;
+        } else {
+            std::cerr << "ERROR: Unknown or incomplete argument: " << argument << "\n";
+            return std::nullopt;
+        }
+    }
+
+    return options;
+}
+
+auto StatusToString(const osi3::tracefile::FrameDiffStatus status) -> const char* {
+    switch (status) {
+        case osi3::tracefile::FrameDiffStatus::kIdentical:
+            return "identical";
+        case osi3::tracefile::FrameDiffStatus::kDiffering:
+            return "differing";
+        case osi3::tracefile::FrameDiffStatus::kMissing:
+            return "missing";
+        case osi3::tracefile::FrameDiffStatus::kExtra:
+            return "extra";
+    }
+    return "unknown";
+}
+
+void PrintReport(const osi3::tracefile::TraceDiffReport& report) {
+    for (const auto& entry : report.entries) {
+        std::cout << StatusToString(entry.status) << "  t=" << entry.log_time;
+        if (!entry.channel_name.empty()) {
+            std::cout << "  channel=" << entry.channel_name;
+        }
+        if (entry.status != osi3::tracefile::FrameDiffStatus::kExtra) {
+            std::cout << "  reference_frame=" << entry.reference_index;
+        }
+        if (entry.status != osi3::tracefile::FrameDiffStatus::kMissing) {
+            std::cout << "  candidate_frame=" << entry.candidate_index;
+        }
+        std::cout << "\n";
+        if (!entry.field_diff.empty()) {
+            std::cout << entry.field_diff;
+        }
+    }
+    std::cout << "Summary: " << report.identical_count << " identical, " << report.differing_count << " differing, " << report.missing_count << " missing, "
+              << report.extra_count << " extra\n";
+}
+
+auto RunProgram(const int argc, const char** argv) -> int {
+    if (IsHelpRequested(argc, argv)) {
+        PrintUsage();
+        return kExitIdentical;
+    }
+
+    const auto options = ParseArguments(argc, argv);
+    if (!options) {
+        return kExitError;
+    }
+
+    const auto report = osi3::tracefile::DiffTraces(options->reference_path, options->candidate_path, options->diff_options);
+    PrintReport(report);
+    return report.IsIdentical() ? kExitIdentical : kExitDifferent;
+}
+
+auto RunMainNoThrow(const int argc, const char** argv) noexcept -> int {
+    try {
+        return RunProgram(argc, argv);
+    } catch (const std::exception& error) {
+        std::fputs("ERROR: ", stderr);
+        std::fputs(error.what(), stderr);
+        std::fputc('\n', stderr);
+    } catch (...) {
+        std::fputs("ERROR: Unknown exception\n", stderr);
+    }
+
+    return kExitError;
+}
+
+}  // namespace
+
+auto main(const int argc, const char** argv) -> int { return RunMainNoThrow(argc, argv); }
@@ -0,0 +1,158 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+/**
+ * \file
+ * \brief Slice or split an OSI trace file without decoding its frames.
+ *
+ * Extracts a time window or frame range, or splits a trace into equal parts or
+ * per-topic files, using the MCAP chunk index and the .osi frame offsets.
+ *
+ * Usage: slice_trace <input> <output> [--start-time NS] [--end-time NS] [--first-frame N] [--end-frame N] [--type T] [--no-attachments]
+ *        slice_trace <input> <output_directory> (--split N | --split-topics) [--type T] [--no-attachments]
+ *
+ * Exit codes: 0 success, 2 error.
+ */
+
+#include <osi-utilities/tracefile/TraceSlicing.h>
+
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+constexpr int kExitSuccess = 0;
+constexpr int kExitError = 2;
+
+struct ProgramOptions {
+    std::filesystem::path input_path;
+    std::filesystem::path output_path;
+    osi3::tracefile::SliceRange range;
+    osi3::tracefile::SliceOptions slice_options;
+    size_t split_count = 0;
+    bool split_topics = false;
+};
+
+/** \brief Map CLI message type names to OSI enum values. */
+const std::unordered_map<std::string, osi3::ReaderTopLevelMessage> kValidTypes = {
+    {"GroundTruth", osi3::ReaderTopLevelMessage::kGroundTruth},         {"SensorData", osi3::ReaderTopLevelMessage::kSensorData},
+    {"SensorView", osi3::ReaderTopLevelMessage::kSensorView},           {"HostVehicleData", osi3::ReaderTopLevelMessage::kHostVehicleData},
+    {"TrafficCommand", osi3::ReaderTopLevelMessage::kTrafficCommand},   {"TrafficCommandUpdate", osi3::ReaderTopLevelMessage::kTrafficCommandUpdate},
+    {"TrafficUpdate", osi3::ReaderTopLevelMessage::kTrafficUpdate},     {"MotionRequest", osi3::ReaderTopLevelMessage::kMotionRequest},
+    {"StreamingUpdate", osi3::ReaderTopLevelMessage::kStreamingUpdate},
+};
+
+void PrintUsage() {
+    std::cerr << "Usage: slice_trace <input> <output> [options]\n"
+              << "       slice_trace <input> <output_directory> (--split <n> | --split-topics) [options]\n"
+              << "\n"
+              << "Copies part of a trace file (.osi or .mcap) without decoding the frames.\n"
+              << "A frame is copied if it is inside both the time window and the frame range.\n"
+              << "\n"
+              << "Options:\n"
+              << "  --start-time <ns>    First log time to copy (inclusive)\n"
+              << "  --end-time <ns>      End of the log times to copy (exclusive)\n"
+              << "  --first-frame <n>    First frame to copy, counted from 0 (inclusive)\n"
+              << "  --end-frame <n>      End of the frames to copy (exclusive)\n"
+              << "  --split <n>          Split into n parts with equal numbers of frames\n"
+              << "  --split-topics       Split an MCAP file into one file per topic\n"
+              << "  --type <type>        Message type of .osi files if not stated in the filename\n"
+              << "  --no-attachments     Do not copy the attachments of MCAP files\n"
+              << "\n"
+              << "Exit codes: 0 success, 2 error\n";
+}
+
+auto IsHelpRequested(const int argc, const char** argv) -> bool { return argc >= 2 && (std::string(argv[1]) == "--help" || std::string(argv[1]) == "-h"); }
+
+auto ParseArguments(const int argc, const char** argv) -> std::optional<ProgramOptions> {
+    if (argc < 3) {
+        PrintUsage();
+        return std::nullopt;
+    }
+
+    ProgramOptions options{argv[1], argv[2], {}, {}};
+    for (int i = 3; i < argc; ++i) {
+        const std::string argument = argv[i];
+        if (argument == "--start-time" && i + 1 < argc) {
+            options.range.start_time = std::stoull(argv[++i]);
+        } else if (argument == "--end-time" && i + 1 < argc) {
+            options.range.end_time = std::stoull(argv[++i]);
+        } else if (argument == "--first-frame" && i + 1 < argc) {
+            options.range.first_frame = std::stoull(argv[++i]);
+        } else if (argument == "--end-frame" && i + 1 < argc) {
+            options.range.end_frame = std::stoull(argv[++i]);
+        } else if (argument == "--split" && i + 1 < argc) {
+            options.split_count = std::stoull(argv[++i]);
+        } else if (argument == "--split-topics") {
+            options.split_topics = true;
+        } else if (argument == "--no-attachments") {
+            options.slice_options.copy_attachments = false;
+        } else if (argument == "--type" && i + 1 < argc) {
+            const auto type_it = kValidTypes.find(argv[++i]);
+            if (type_it == kValidTypes.end()) {
+                std::cerr << "ERROR: Unknown message type: " << argv[i] << "\n";
+                return std::nullopt;
+            }
+            options.slice_options.message_type = type_it->second;
+        } else {
+            std::cerr << "ERROR: Unknown or incomplete argument: " << argument << "\n";
+            return std::nullopt;
+        }
+    }
+
+    if (options.split_count > 0 && options.split_topics) {
+        std::cerr << "ERROR: --split and --split-topics cannot be combined\n";
+        return std::nullopt;
+    }
+    return options;
+}
+
+auto RunProgram(const int argc, const char** argv) -> int {
+    if (IsHelpRequested(argc, argv)) {
+        PrintUsage();
+        return kExitSuccess;
+    }
+
+    const auto options = ParseArguments(argc, argv);
+    if (!options) {
+        return kExitError;
+    }
+
+    if (options->split_count > 0 || options->split_topics) {
+        std::filesystem::create_directories(options->output_path);
+        const auto files = options->split_topics ? osi3::tracefile::SplitTraceFileByTopic(options->input_path, options->output_path, options->slice_options)
+                                                 : osi3::tracefile::SplitTraceFile(options->input_path, options->output_path, options->split_count, options->slice_options);
+        for (const auto& file : files) {
+            std::cout << file.string() << "\n";
+        }
+        return kExitSuccess;
+    }
+
+    const auto frame_count = osi3::tracefile::SliceTraceFile(options->input_path, options->output_path, options->range, options->slice_options);
+    std::cout << "Copied " << frame_count << " frames to " << options->output_path.string() << "\n";
+    return kExitSuccess;
+}
+
+auto RunMainNoThrow(const int argc, const char** argv) noexcept -> int {
+    try {
+        return RunProgram(argc, argv);
+    } catch (const std::exception& error) {
+        std::fputs("ERROR: ", stderr);
+        std::fputs(error.what(), stderr);
+        std::fputc('\n', stderr);
+    } catch (...) {
+        std::fputs("ERROR: Unknown exception\n", stderr);
+    }
+
+    return kExitError;
+}
+
+}  // namespace
+
+auto main(const int argc, const char** argv) -> int { return RunMainNoThrow(argc, argv); }
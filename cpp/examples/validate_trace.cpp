@@ -0,0 +1,150 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+/**
+ * \file
+ * \brief Validate OSI trace files and print a machine-readable report.
+ *
+ * Checks required/recommended metadata, monotonic timestamps per channel,
+ * message parseability and filename convention consistency in a single
+ * streaming pass. Per-frame checks run on a worker pool.
+ *
+ * Usage: validate_trace <file>... [--jobs N] [--type T] [--no-recommended] [--max-issues N] [--io B]
+ *
+ * Prints one JSON report per line (JSON Lines) to stdout.
+ * Exit codes: 0 all files valid, 1 at least one file invalid, 2 usage error.
+ */
+
+#include <osi-utilities/tracefile/TraceFileValidator.h>
+
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+constexpr int kExitValid = 0;
+constexpr int kExitInvalid = 1;
+constexpr int kExitError = 2;
+
+struct ProgramOptions {
+    std::vector<std::filesystem::path> file_paths;
+    osi3::tracefile::ValidationOptions validation_options;
+};
+
+/** \brief Map CLI message type names to OSI enum values. */
+const std::unordered_map<std::string, osi3::ReaderTopLevelMessage> kValidTypes = {
+    {"GroundTruth", osi3::ReaderTopLevelMessage::kGroundTruth},         {"SensorData", osi3::ReaderTopLevelMessage::kSensorData},
+    {"SensorView", osi3::ReaderTopLevelMessage::kSensorView},           {"HostVehicleData", osi3::ReaderTopLevelMessage::kHostVehicleData},
+    {"TrafficCommand", osi3::ReaderTopLevelMessage::kTrafficCommand},   {"TrafficCommandUpdate", osi3::ReaderTopLevelMessage::kTrafficCommandUpdate},
+    {"TrafficUpdate", osi3::ReaderTopLevelMessage::kTrafficUpdate},     {"MotionRequest", osi3::ReaderTopLevelMessage::kMotionRequest},
+    {"StreamingUpdate", osi3::ReaderTopLevelMessage::kStreamingUpdate},
+};
+
+/** \brief Map CLI I/O backend names to enum values. */
+const std::unordered_map<std::string, osi3::tracefile::IoBackend> kIoBackends = {
+    {"stream", osi3::tracefile::IoBackend::kStream},
+    {"pread", osi3::tracefile::IoBackend::kPread},
+    {"io_uring", osi3::tracefile::IoBackend::kIoUring},
+};
+
+void PrintUsage() {
+    std::cerr << "Usage: validate_trace <file>... [options]\n"
+              << "\n"
+              << "Validates trace files (.osi, .mcap, .txth) against the OSI trace file\n"
+              << "specification and prints one JSON report per file to stdout.\n"
+              << "\n"
+              << "Options:\n"
+              << "  --jobs <N>          Number of worker threads for per-frame checks (default: all cores)\n"
+              << "  --type <type>       Message type of .osi files if not stated in the filename\n"
+              << "  --no-recommended    Do not warn about missing recommended metadata keys\n"
+              << "  --max-issues <N>    Maximum number of reported issues per check (default: 100)\n"
+              << "  --io <backend>      I/O engine: stream, pread, io_uring (default: stream)\n"
+              << "\n"
+              << "Exit codes: 0 all valid, 1 at least one file invalid, 2 usage error\n";
+}
+
+auto IsHelpRequested(const int argc, const char** argv) -> bool { return argc >= 2 && (std::string(argv[1]) == "--help" || std::string(argv[1]) == "-h"); }
+
+auto ParseArguments(const int argc, const char** argv) -> std::optional<ProgramOptions> {
+    ProgramOptions options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument = argv[i];
+        if (argument == "--jobs" && i + 1 < argc) {
+            options.validation_options.worker_count = std::stoul(argv[++i]);
+        } else if (argument == "--max-issues" && i + 1 < argc) {
+            options.validation_options.max_issues_per_check = std::stoul(argv[++i]);
+        } else if (argument == "--no-recommended") {
+            options.validation_options.check_recommended = false;
+        } else if (argument == "--type" && i + 1 < argc) {
+            const auto type_it = kValidTypes.find(argv[++i]);
+            if (type_it == kValidTypes.end()) {
+                std::cerr << "ERROR: Unknown message type: " << argv[i] << "\n";
+                return std::nullopt;
+            }
+            options.validation_options.message_type = type_it->second;
+        } else if (argument == "--io" && i + 1 < argc) {
+            const auto backend_it = kIoBackends.find(argv[++i]);
+            if (backend_it == kIoBackends.end()) {
+                std::cerr << "ERROR: Unknown I/O backend: " << argv[i] << "\n";
+                return std::nullopt;
+            }
+            options.validation_options.io.backend = backend_it->second;
+        } else if (argument.rfind("--", 0) == 0) {
+            std::cerr << "ERROR: Unknown or incomplete argument: " << argument << "\n";
+            return std::nullopt;
+        } else {
+            options.file_paths.emplace_back(argument);
+        }
+    }
+
+    if (options.file_paths.empty()) {
+        PrintUsage();
+        return std::nullopt;
+    }
+    return options;
+}
+
+auto RunProgram(const int argc, const char** argv) -> int {
+    if (IsHelpRequested(argc, argv)) {
+        PrintUsage();
+        return kExitValid;
+    }
+
+    const auto options = ParseArguments(argc, argv);
+    if (!options) {
+        return kExitError;
+    }
+
+    bool all_valid = true;
+    for (const auto& file_path : options->file_paths) {
+        const auto report = osi3::tracefile::ValidateTraceFile(file_path, options->validation_options);
+        std::cout << report.ToJson() << "\n";
+        all_valid = all_valid && report.IsValid();
+    }
+    return all_valid ? kExitValid : kExitInvalid;
+}
+
+auto RunMainNoThrow(const int argc, const char** argv) noexcept -> int {
+    try {
+        return RunProgram(argc, argv);
+    } catch (const std::exception& error) {
+        std::fputs("ERROR: ", stderr);
+        std::fputs(error.what(), stderr);
+        std::fputc('\n', stderr);
+    } catch (...) {
+        std::fputs("ERROR: Unknown exception\n", stderr);
+    }
+
+    return kExitError;
+}
+
+}  // namespace
+
+auto main(const int argc, const char** argv) -> int { return RunMainNoThrow(argc, argv); }
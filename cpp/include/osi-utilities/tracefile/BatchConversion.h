@@ -0,0 +1,166 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_BATCHCONVERSION_H_
+#define OSIUTILITIES_TRACEFILE_BATCHCONVERSION_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "osi-utilities/tracefile/BlockFileIo.h"
+#include "osi-utilities/tracefile/Reader.h"
+
+namespace osi3 {
+namespace tracefile {
+
+/**
+ * @brief Conversion applied to every frame of a trace file.
+ */
+enum class TraceConversion {
+    kCopy,                    /**< Copy the frames into the output format without decoding them, e.g. .osi to .mcap */
+    kGroundTruthToSensorView, /**< Wrap every GroundTruth frame in the global_ground_truth of a SensorView */
+};
+
+/**
+ * @brief Outcome of the conversion of one file in a batch.
+ */
+enum class BatchConversionStatus {
+    kConverted, /**< The output was written */
+    kSkipped,   /**< The output was up to date */
+    kFailed,    /**< The conversion failed; no output was written */
+};
+
+/**
+ * @brief Result of the conversion of one file in a batch.
+ */
+struct BatchConversionResult {
+    std::filesystem::path input_path;                               /**< Converted trace file */
+    std::filesystem::path output_path;                              /**< Written trace file */
+    BatchConversionStatus status = BatchConversionStatus::kSkipped; /**< Outcome of the conversion */
+    uint64_t frame_count = 0;                                       /**< Number of written frames */
+    uint64_t input_bytes = 0;                                       /**< Size of the input file */
+    uint64_t output_bytes = 0;                                      /**< Size of the output file */
+    double seconds = 0.0;                                           /**< Duration of the conversion */
+    std::string error_message;                                      /**< Error description (empty unless status == kFailed) */
+};
+
+/**
+ * @brief Options for converting many trace files.
+ */
+struct BatchConversionOptions {
+    TraceConversion conversion = TraceConversion::kCopy;                  /**< Conversion applied to every file */
+    std::string output_extension = ".mcap";                               /**< Output format: ".osi", ".mcap" or ".txth" */
+    ReaderTopLevelMessage message_type = ReaderTopLevelMessage::kUnknown; /**< Message type of .osi/.txth inputs (kUnknown: infer from filename) */
+    size_t thread_count = 0;                                              /**< Maximum number of concurrent conversions (0: number of cores) */
+    uint64_t memory_budget = 0;                                           /**< Memory available to the concurrent conversions in bytes (0: unlimited) */
+    bool force = false;                                                   /**< Convert even if the output is up to date, e.g. after an OSI version bump */
+    IoOptions io_options;                                                 /**< I/O engine of readers and writers */
+    std::function<void(const BatchConversionResult&)> on_file_done;       /**< Called after each file from the worker threads, serialized */
+};
+
+/**
+ * @brief Aggregated result of a batch conversion.
+ */
+struct BatchConversionReport {
+    std::vector<BatchConversionResult> results; /**< One result per input file, in input order */
+    size_t thread_count = 0;                    /**< Number of worker threads used */
+    size_t converted_count = 0;                 /**< Number of converted files */
+    size_t skipped_count = 0;                   /**< Number of up-to-date files */
+    size_t failed_count = 0;                    /**< Number of failed files */
+    uint64_t frame_count = 0;                   /**< Number of written frames */
+    uint64_t input_bytes = 0;                   /**< Size of the converted input files */
+    uint64_t output_bytes = 0;                  /**< Size of the written output files */
+    double elapsed_seconds = 0.0;               /**< Wall-clock duration of the batch */
+
+    /** @brief Input bytes converted per second of wall-clock time */
+    double ThroughputBytesPerSecond() const { return elapsed_seconds > 0.0 ? static_cast<double>(input_bytes) / elapsed_seconds : 0.0; }
+};
+
+/**
+ * @brief Converts one trace file
+ *
+ * The output is written to a temporary file next to output_path, which is renamed to
+ * output_path on success and removed on failure, including a failed final flush of the
+ * writer (see TraceFileWriter::CloseFailed()), so output_path never holds a partial
+ * trace. For MCAP to MCAP, file and channel metadata are kept, except for trace
+ * statistics, which are collected for the output instead.
+ *
+ * @param input_path Trace file to convert (.osi, .mcap or .txth)
+ * @param output_path Trace file to write; the format follows the extension
+ * @param conversion Conversion applied to every frame
+ * @param message_type Message type of .osi/.txth inputs (kUnknown: infer from filename)
+ * @param io_options I/O engine of reader and writer
+ * @return Number of written frames
+ * @throws std::invalid_argument if a format is not supported
+ * @throws std::runtime_error if a file cannot be read or written
+ */
+uint64_t ConvertTraceFile(const std::filesystem::path& input_path, const std::filesystem::path& output_path, TraceConversion conversion,
+                          ReaderTopLevelMessage message_type = ReaderTopLevelMessage::kUnknown, const IoOptions& io_options = {});
+
+/**
+ * @brief Collects the trace files of a list of files and directories
+ *
+ * Directories are searched recursively for .osi, .mcap and .txth files; files are taken as given.
+ *
+ * @param inputs Trace files and directories
+ * @return Trace files, sorted within each directory
+ * @throws std::runtime_error if an input does not exist
+ */
+std::vector<std::filesystem::path> CollectTraceFiles(const std::vector<std::filesystem::path>& inputs);
+
+/**
+ * @brief Gets the output path of a converted trace file
+ *
+ * The output is named after the input with the output extension; for
+ * TraceConversion::kGroundTruthToSensorView, the "_gt_" type tag of the name is
+ * replaced by "_sv_".
+ *
+ * @param input_path Trace file to convert
+ * @param output_directory Directory the output is written to
+ * @param options Batch options
+ * @return Path of the output file
+ */
+std::filesystem::path GetConversionOutputPath(const std::filesystem::path& input_path, const std::filesystem::path& output_directory, const BatchConversionOptions& options);
+
+/**
+ * @brief Gets the number of worker threads of a batch conversion
+ *
+ * The number of cores (or BatchConversionOptions::thread_count), limited by the memory
+ * budget divided by the estimated peak memory of one conversion (an uncompressed and a
+ * compressed MCAP chunk plus the I/O buffers of reader and writer).
+ *
+ * @param options Batch options
+ * @param file_count Number of files to convert
+ * @return Number of worker threads, at least 1
+ */
+size_t GetBatchThreadCount(const BatchConversionOptions& options, size_t file_count);
+
+/**
+ * @brief Converts many trace files concurrently
+ *
+ * The files are scheduled over a pool of GetBatchThreadCount() threads, biggest files
+ * first, so a big file started last does not prolong the batch. Outputs that are newer
+ * than their input are skipped unless BatchConversionOptions::force is set. Failures are
+ * reported per file and do not stop the batch. The outputs are named by
+ * GetConversionOutputPath(), so inputs with the same name, e.g. from different
+ * subdirectories, are rejected before any file is written.
+ *
+ * @param input_paths Trace files to convert, e.g. from CollectTraceFiles()
+ * @param output_directory Directory the outputs are written to; created if needed
+ * @param options Batch options
+ * @return Per-file results and aggregate throughput
+ * @throws std::invalid_argument if the output extension is not supported or two inputs have the same output path
+ */
+BatchConversionReport ConvertTraceFiles(const std::vector<std::filesystem::path>& input_paths, const std::filesystem::path& output_directory,
+                                        const BatchConversionOptions& options = {});
+
+}  // namespace tracefile
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_BATCHCONVERSION_H_
@@ -0,0 +1,342 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_BLOCKFILEIO_H_
+#define OSIUTILITIES_TRACEFILE_BLOCKFILEIO_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include "osi-utilities/tracefile/TraceFileConfig.h"
+
+namespace osi3 {
+namespace tracefile {
+
+/**
+ * @brief I/O engine of the binary and MCAP trace file readers and writers
+ */
+enum class IoBackend : uint8_t {
+    kStream = 0, /**< Blocking std::ifstream / std::ofstream (default) */
+    kPread,      /**< pread/pwrite of large blocks on worker threads (POSIX; kStream elsewhere) */
+    kIoUring,    /**< Linux io_uring with several blocks in flight (kPread if io_uring is unavailable) */
+};
+
+/**
+ * @brief I/O options of a reader or writer
+ *
+ * The asynchronous backends keep queue_depth blocks of block_size bytes in flight:
+ * readers read ahead of the consumer, writers write behind the producer. Decoding
+ * and serialization in the calling thread thereby overlap with the device I/O.
+ *
+ * The durability options only apply to writers. Setting any of them selects
+ * IoBackend::kPread instead of IoBackend::kStream on POSIX systems, since file
+ * streams cannot be synchronized; other platforms ignore them. Synchronization
+ * runs in the background like the block writes. See BlockFileWriter for what is
+ * recoverable after a crash.
+ */
+struct IoOptions {
+    IoBackend backend = IoBackend::kStream;            /**< I/O engine */
+    size_t block_size = config::kDefaultIoBlockSize;   /**< Size of one read or write request in bytes */
+    size_t queue_depth = config::kDefaultIoQueueDepth; /**< Number of blocks in flight */
+    uint64_t preallocate_size = 0;                     /**< Expected file size, reserved on Open() without changing the file size (Linux; 0: off) */
+    uint64_t sync_interval_bytes = 0;                  /**< Synchronize the file data to the device after this many written bytes (0: off) */
+    std::chrono::milliseconds sync_interval{0};        /**< Synchronize the file data at least this often while writing (0: off) */
+
+    /** @brief Whether any durability option is set */
+    bool HasDurabilityOptions() const { return preallocate_size > 0 || sync_interval_bytes > 0 || sync_interval.count() > 0; }
+};
+
+/**
+ * @brief Checks whether the kernel supports the io_uring operations used by IoBackend::kIoUring.
+ * @return true if io_uring can be used, false if IoBackend::kIoUring falls back to IoBackend::kPread
+ */
+bool IsIoUringAvailable();
+
+namespace detail {
+class IoQueue;
+
+/** @brief Releases block buffers allocated with config::kIoBufferAlignment */
+struct AlignedDelete {
+    void operator()(char* buffer) const;
+};
+
+/** @brief Block buffer aligned to config::kIoBufferAlignment */
+using AlignedBuffer = std::unique_ptr<char[], AlignedDelete>;
+}  // namespace detail
+
+/**
+ * @brief Content of a file that is not read from the file system, e.g. a trace file in a chunk store
+ *
+ * BlockFileReader::Open() reads such a source instead of a file; see ChunkStoreFileSource.
+ */
+class FileSource {
+   public:
+    /** @brief Virtual destructor */
+    virtual ~FileSource() = default;
+
+    /** @brief Size of the content in bytes */
+    virtual uint64_t Size() const = 0;
+
+    /**
+     * @brief Reads bytes of the content
+     * @param destination Buffer receiving the bytes
+     * @param offset Offset of the first byte
+     * @param size Number of bytes; offset + size does not exceed Size()
+     * @throws std::runtime_error if the bytes cannot be read
+     */
+    virtual void ReadAt(char* destination, uint64_t offset, size_t size) = 0;
+};
+
+/**
+ * @brief Sequential file reader with read-ahead of large blocks
+ *
+ * Serves Read() calls from blocks that were requested ahead of the read position.
+ * Seek() outside the buffered range discards the read-ahead and restarts it at
+ * the new position. A reader opened on a FileSource reads it directly; the source
+ * does its own buffering.
+ *
+ * @note Thread Safety: Not thread-safe. External synchronization required for concurrent access.
+ */
+class BlockFileReader {
+   public:
+    /** @brief Creates a closed reader */
+    BlockFileReader();
+
+    /** @brief Destructor, closes the file if still open */
+    ~BlockFileReader();
+
+    /** @brief Deleted copy constructor */
+    BlockFileReader(const BlockFileReader&) = delete;
+
+    /** @brief Deleted copy assignment operator */
+    BlockFileReader& operator=(const BlockFileReader&) = delete;
+
+    /** @brief Deleted move constructor */
+    BlockFileReader(BlockFileReader&&) = delete;
+
+    /** @brief Deleted move assignment operator */
+    BlockFileReader& operator=(BlockFileReader&&) = delete;
+
+    /**
+     * @brief Opens a file for reading and starts the read-ahead at offset 0
+     * @param file_path Path to the file
+     * @param options I/O options
+     * @return true if successful, false otherwise
+     */
+    bool Open(const std::filesystem::path& file_path, const IoOptions& options = {});
+
+    /**
+     * @brief Opens a file source for reading
+     * @param source Content to read
+     * @return true if successful, false otherwise
+     */
+    bool Open(std::unique_ptr<FileSource> source);
+
+    /** @brief Closes the file, waiting for outstanding requests */
+    void Close();
+
+    /** @brief Whether a file is open */
+    bool IsOpen() const;
+
+    /** @brief The backend in use after fallbacks (valid while open) */
+    IoBackend Backend() const { return backend_; }
+
+    /** @brief Size of the file in bytes */
+    uint64_t Size() const { return file_size_; }
+
+    /** @brief Current read position in bytes */
+    uint64_t Tell() const { return position_; }
+
+    /** @brief Whether the read position is at the end of the file */
+    bool AtEnd() const { return position_ >= file_size_; }
+
+    /**
+     * @brief Whether a read failed
+     *
+     * A failed read returns fewer bytes than requested, like a read at the end of the file.
+     */
+    bool HasError() const { return failed_; }
+
+    /**
+     * @brief Reads up to size bytes at the read position
+     * @param destination Buffer receiving the bytes
+     * @param size Number of bytes to read
+     * @return Number of bytes read; less than size at the end of the file or on error
+     */
+    size_t Read(char* destination, size_t size);
+
+    /**
+     * @brief Moves the read position
+     * @param offset New read position in bytes from the start of the file
+     */
+    void Seek(uint64_t offset);
+
+   private:
+    struct Block {
+        detail::AlignedBuffer data; /**< Block buffer of IoOptions::block_size bytes */
+        uint64_t offset = 0;        /**< File offset of the first byte */
+        size_t length = 0;          /**< Number of valid bytes */
+        bool pending = false;       /**< A read request into this block is in flight */
+    };
+
+    size_t Consume(char* destination, uint64_t size);
+    void StartReadAhead(uint64_t offset);
+    void SubmitNext(size_t index);
+    void WaitFor(size_t index);
+    void DrainPending();
+
+    IoOptions options_;                      /**< Options passed to Open() */
+    IoBackend backend_ = IoBackend::kStream; /**< Backend in use after fallbacks */
+    std::ifstream stream_;                   /**< File stream of the kStream backend */
+    int fd_ = -1;                            /**< File descriptor of the asynchronous backends */
+    std::unique_ptr<detail::IoQueue> queue_; /**< Request queue of the asynchronous backends */
+    std::unique_ptr<FileSource> source_;     /**< Content read instead of a file, see Open(std::unique_ptr<FileSource>) */
+    std::vector<Block> blocks_;              /**< Read-ahead ring, consumed in submission order */
+    size_t current_ = 0;                     /**< Index of the block holding the read position */
+    size_t block_position_ = 0;              /**< Read position within the current block */
+    uint64_t position_ = 0;                  /**< Read position in the file */
+    uint64_t next_offset_ = 0;               /**< File offset of the next block to request */
+    uint64_t file_size_ = 0;                 /**< File size, determined on Open() */
+    bool failed_ = false;                    /**< A read failed */
+};
+
+/**
+ * @brief Sequential file writer with write-behind of large blocks
+ *
+ * Write() copies into the current block; full blocks are written in the background
+ * while the next block is filled. Write() only blocks once queue_depth blocks are in flight.
+ * All writes start at a multiple of IoOptions::block_size: Flush() and Sync() write the
+ * partially filled block at its offset but keep it buffered, and rewrite it once it is full.
+ *
+ * Crash consistency: after a crash or power loss, only the first DurableSize() bytes are
+ * guaranteed to hold the written data. Beyond them, IoBackend::kPread and IoBackend::kIoUring
+ * may have completed the in-flight block writes out of order, so the file can contain
+ * holes (read as zeros) before later blocks; only IoBackend::kStream leaves a plain prefix.
+ * With synchronization enabled (see IoOptions), data written after the last completed
+ * synchronization may be lost, bounded by IoOptions::sync_interval_bytes plus the in-flight
+ * blocks, or by IoOptions::sync_interval (checked on Write(), covering the whole blocks
+ * written so far) plus one block. Preallocated space does not count towards the file size,
+ * so no zero-filled tail remains after a crash.
+ * Close() synchronizes all data if any synchronization interval is set.
+ *
+ * @note Thread Safety: Not thread-safe. External synchronization required for concurrent access.
+ */
+class BlockFileWriter {
+   public:
+    /** @brief Creates a closed writer */
+    BlockFileWriter();
+
+    /** @brief Destructor, closes the file if still open */
+    ~BlockFileWriter();
+
+    /** @brief Deleted copy constructor */
+    BlockFileWriter(const BlockFileWriter&) = delete;
+
+    /** @brief Deleted copy assignment operator */
+    BlockFileWriter& operator=(const BlockFileWriter&) = delete;
+
+    /** @brief Deleted move constructor */
+    BlockFileWriter(BlockFileWriter&&) = delete;
+
+    /** @brief Deleted move assignment operator */
+    BlockFileWriter& operator=(BlockFileWriter&&) = delete;
+
+    /**
+     * @brief Creates (or truncates) a file for writing
+     * @param file_path Path to the file
+     * @param options I/O options
+     * @return true if successful, false otherwise
+     */
+    bool Open(const std::filesystem::path& file_path, const IoOptions& options = {});
+
+    /**
+     * @brief Writes all buffered bytes and closes the file
+     * @return true if all bytes were written, false otherwise
+     */
+    bool Close();
+
+    /** @brief Whether a file is open */
+    bool IsOpen() const;
+
+    /** @brief The backend in use after fallbacks (valid while open) */
+    IoBackend Backend() const { return backend_; }
+
+    /** @brief Number of bytes written so far (including buffered bytes) */
+    uint64_t Size() const { return size_; }
+
+    /**
+     * @brief Appends bytes to the file
+     * @param data Bytes to write
+     * @param size Number of bytes
+     * @return false if this or an earlier background write failed
+     */
+    bool Write(const char* data, size_t size);
+
+    /**
+     * @brief Writes all buffered bytes and waits until they were handed to the operating system
+     * @return false if a write failed
+     */
+    bool Flush();
+
+    /**
+     * @brief Writes all buffered bytes and waits until they are stored on the device
+     *
+     * The synchronization runs on the I/O queue like the block writes. With
+     * IoBackend::kStream, this only flushes to the operating system.
+     *
+     * @return false if a write or the synchronization failed
+     */
+    bool Sync();
+
+    /** @brief Number of bytes known to be stored on the device (see Sync() and IoOptions::sync_interval_bytes) */
+    uint64_t DurableSize() const { return durable_size_; }
+
+   private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Block {
+        detail::AlignedBuffer data; /**< Block buffer of IoOptions::block_size bytes */
+        uint64_t offset = 0;        /**< File offset of the first byte */
+        size_t length = 0;          /**< Number of buffered bytes */
+        size_t flushed = 0;         /**< Number of leading bytes already written by Flush() */
+        bool pending = false;       /**< A write request from this block is in flight */
+    };
+
+    void SubmitCurrent();
+    void SubmitTail();
+    void WaitFor(size_t index);
+    void HandleCompletion(size_t tag, int64_t result);
+    void PollCompletions();
+    void RequestSync();
+    void SubmitSyncIfReady();
+    void Preallocate(const std::filesystem::path& file_path);
+
+    IoOptions options_;                      /**< Options passed to Open() */
+    IoBackend backend_ = IoBackend::kStream; /**< Backend in use after fallbacks */
+    std::ofstream stream_;                   /**< File stream of the kStream backend */
+    int fd_ = -1;                            /**< File descriptor of the asynchronous backends */
+    std::unique_ptr<detail::IoQueue> queue_; /**< Request queue of the asynchronous backends */
+    std::vector<Block> blocks_;              /**< Write-behind ring, filled in order */
+    size_t current_ = 0;                     /**< Index of the block being filled */
+    uint64_t size_ = 0;                      /**< Number of bytes written (including buffered bytes) */
+    uint64_t next_offset_ = 0;               /**< File offset of the next block to submit */
+    uint64_t sync_offset_ = 0;               /**< Bytes before this offset are covered by the requested synchronization */
+    uint64_t sync_target_ = 0;               /**< Bytes before this offset are covered by the running synchronization */
+    uint64_t durable_size_ = 0;              /**< Number of bytes stored on the device */
+    bool sync_requested_ = false;            /**< A synchronization waits for the writes before sync_offset_ */
+    bool sync_pending_ = false;              /**< A synchronization request is in flight */
+    Clock::time_point last_sync_;            /**< Time of the last synchronization request */
+    bool failed_ = false;                    /**< A write failed */
+};
+
+}  // namespace tracefile
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_BLOCKFILEIO_H_
@@ -0,0 +1,191 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_CAPI_H_
+#define OSIUTILITIES_TRACEFILE_CAPI_H_
+
+/**
+ * @file
+ * @brief C interface of the trace file readers and writers for use from other languages
+ *
+ * Frames are exchanged as serialized protobuf bytes. A frame returned by osiu_reader_next()
+ * points into memory owned by the reader (no copy) and stays valid until the next call to
+ * osiu_reader_next() or osiu_reader_close() on the same reader. Written frames are framed and
+ * stored without being parsed.
+ *
+ * Functions report failures with an osiu_status; osiu_last_error() then describes the error of
+ * the last failed call on the calling thread. No C++ exceptions cross this interface.
+ *
+ * @note Thread Safety: A reader or writer handle must not be used concurrently from several threads.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Version of this C interface, incremented on incompatible changes */
+#define OSIU_C_API_VERSION 2
+
+/** @brief Opaque trace file reader handle */
+typedef struct osiu_reader osiu_reader;
+
+/** @brief Opaque trace file writer handle */
+typedef struct osiu_writer osiu_writer;
+
+/** @brief Result code of the reader and writer functions (one of the OSIU_OK / OSIU_ERROR_* values) */
+typedef int32_t osiu_status;
+
+/** @brief Result codes */
+enum {
+    OSIU_OK = 0,                      /**< Success */
+    OSIU_END_OF_TRACE = 1,            /**< No frames left (osiu_reader_next() only) */
+    OSIU_ERROR_INVALID_ARGUMENT = -1, /**< Null handle or pointer, unknown message type or unsupported operation */
+    OSIU_ERROR_OPEN = -2,             /**< The trace file could not be opened or has an unsupported extension */
+    OSIU_ERROR_READ = -3,             /**< A frame could not be read */
+    OSIU_ERROR_WRITE = -4,            /**< A frame or record could not be written */
+};
+
+/** @brief OSI top-level message types (same values as osi3::ReaderTopLevelMessage) */
+enum {
+    OSIU_MESSAGE_TYPE_UNKNOWN = 0,                   /**< Unknown message type */
+    OSIU_MESSAGE_TYPE_GROUND_TRUTH = 1,              /**< osi3.GroundTruth */
+    OSIU_MESSAGE_TYPE_SENSOR_DATA = 2,               /**< osi3.SensorData */
+    OSIU_MESSAGE_TYPE_SENSOR_VIEW = 3,               /**< osi3.SensorView */
+    OSIU_MESSAGE_TYPE_SENSOR_VIEW_CONFIGURATION = 4, /**< osi3.SensorViewConfiguration */
+    OSIU_MESSAGE_TYPE_HOST_VEHICLE_DATA = 5,         /**< osi3.HostVehicleData */
+    OSIU_MESSAGE_TYPE_TRAFFIC_COMMAND = 6,           /**< osi3.TrafficCommand */
+    OSIU_MESSAGE_TYPE_TRAFFIC_COMMAND_UPDATE = 7,    /**< osi3.TrafficCommandUpdate */
+    OSIU_MESSAGE_TYPE_TRAFFIC_UPDATE = 8,            /**< osi3.TrafficUpdate */
+    OSIU_MESSAGE_TYPE_MOTION_REQUEST = 9,            /**< osi3.MotionRequest */
+    OSIU_MESSAGE_TYPE_STREAMING_UPDATE = 10,         /**< osi3.StreamingUpdate */
+};
+
+/** @brief Frame status (same values as osi3::ReadStatus) */
+enum {
+    OSIU_FRAME_OK = 0,           /**< data/size hold the serialized message */
+    OSIU_FRAME_INCOMPATIBLE = 1, /**< Non-OSI message of an MCAP file, data is NULL */
+};
+
+/**
+ * @brief One frame of a trace file as returned by osiu_reader_next()
+ *
+ * All pointers are owned by the reader and valid until the next osiu_reader_next() or osiu_reader_close().
+ */
+typedef struct osiu_frame {
+    const uint8_t* data;  /**< Serialized message bytes (NULL unless status is OSIU_FRAME_OK) */
+    size_t size;          /**< Number of serialized message bytes */
+    int32_t message_type; /**< OSIU_MESSAGE_TYPE_* of the message */
+    int32_t status;       /**< OSIU_FRAME_* status of the frame */
+    uint64_t log_time;    /**< Log time in nanoseconds (MCAP log time or the message timestamp) */
+    const char* topic;    /**< Null-terminated topic (channel) name, empty for single-channel formats */
+} osiu_frame;
+
+/** @brief Returns OSIU_C_API_VERSION of the linked library */
+uint32_t osiu_api_version(void);
+
+/**
+ * @brief Returns the error message of the last failed call on the calling thread
+ * @return Null-terminated message, empty if no call failed yet; valid until the next failing call on this thread
+ */
+const char* osiu_last_error(void);
+
+/**
+ * @brief Opens a trace file (.osi, .mcap or .txth) for reading
+ * @param path Null-terminated, UTF-8 encoded file path
+ * @param message_type OSIU_MESSAGE_TYPE_* of .osi/.txth files, or OSIU_MESSAGE_TYPE_UNKNOWN to infer it from the file name
+ * @param reader Receives the reader handle on success
+ * @return OSIU_OK, OSIU_ERROR_INVALID_ARGUMENT or OSIU_ERROR_OPEN
+ */
+osiu_status osiu_reader_open(const char* path, int32_t message_type, osiu_reader** reader);
+
+/**
+ * @brief Restricts an MCAP reader to the given topics (an empty list reads all topics)
+ * @param reader Reader handle of an .mcap file
+ * @param topics Array of null-terminated topic names
+ * @param topic_count Number of topic names
+ * @return OSIU_OK or OSIU_ERROR_INVALID_ARGUMENT (also for non-MCAP readers)
+ */
+osiu_status osiu_reader_set_topics(osiu_reader* reader, const char* const* topics, size_t topic_count);
+
+/**
+ * @brief Reads the next frame without copying or parsing it
+ * @param reader Reader handle
+ * @param frame Receives the frame
+ * @return OSIU_OK, OSIU_END_OF_TRACE, OSIU_ERROR_INVALID_ARGUMENT or OSIU_ERROR_READ
+ */
+osiu_status osiu_reader_next(osiu_reader* reader, osiu_frame* frame);
+
+/**
+ * @brief Closes the trace file and releases the reader handle
+ * @param reader Reader handle (NULL is ignored)
+ */
+void osiu_reader_close(osiu_reader* reader);
+
+/**
+ * @brief Creates a trace file (.osi, .mcap or .txth) for writing
+ * @param path Null-terminated, UTF-8 encoded file path
+ * @param writer Receives the writer handle on success
+ * @return OSIU_OK, OSIU_ERROR_INVALID_ARGUMENT or OSIU_ERROR_OPEN
+ */
+osiu_status osiu_writer_open(const char* path, osiu_writer** writer);
+
+/**
+ * @brief Adds a file metadata record to an MCAP file
+ *
+ * The OSI-required "net.asam.osi.trace" record is added automatically on the first write if not added before.
+ *
+ * @param writer Writer handle of an .mcap file
+ * @param name Null-terminated name of the metadata record
+ * @param keys Array of null-terminated keys
+ * @param values Array of null-terminated values, one per key
+ * @param entry_count Number of key-value pairs
+ * @return OSIU_OK, OSIU_ERROR_INVALID_ARGUMENT (also for non-MCAP writers) or OSIU_ERROR_WRITE
+ */
+osiu_status osiu_writer_add_file_metadata(osiu_writer* writer, const char* name, const char* const* keys, const char* const* values, size_t entry_count);
+
+/**
+ * @brief Registers a topic (channel) of an MCAP file
+ *
+ * Topics are also registered automatically on their first write.
+ *
+ * @param writer Writer handle of an .mcap file
+ * @param topic Null-terminated topic name
+ * @param message_type OSIU_MESSAGE_TYPE_* of the messages of the topic
+ * @return OSIU_OK or OSIU_ERROR_INVALID_ARGUMENT (also for non-MCAP writers and topics registered with another message type)
+ */
+osiu_status osiu_writer_add_channel(osiu_writer* writer, const char* topic, int32_t message_type);
+
+/**
+ * @brief Writes a serialized message without parsing it
+ *
+ * For MCAP files, the log time is read from the serialized timestamp, which must be present.
+ *
+ * @param writer Writer handle
+ * @param data Serialized message bytes
+ * @param size Number of serialized message bytes
+ * @param message_type OSIU_MESSAGE_TYPE_* of the message
+ * @param topic Null-terminated topic name (required for .mcap, ignored and may be NULL for .osi/.txth)
+ * @return OSIU_OK, OSIU_ERROR_INVALID_ARGUMENT or OSIU_ERROR_WRITE
+ */
+osiu_status osiu_writer_write(osiu_writer* writer, const uint8_t* data, size_t size, int32_t message_type, const char* topic);
+
+/**
+ * @brief Finalizes and closes the trace file and releases the writer handle
+ *
+ * The handle is released in any case. OSIU_ERROR_WRITE means the final flush failed and the file is incomplete.
+ *
+ * @param writer Writer handle (NULL is ignored)
+ * @return OSIU_OK or OSIU_ERROR_WRITE
+ */
+osiu_status osiu_writer_close(osiu_writer* writer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // OSIUTILITIES_TRACEFILE_CAPI_H_
@@ -0,0 +1,210 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_CHUNKSTORE_H_
+#define OSIUTILITIES_TRACEFILE_CHUNKSTORE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "osi-utilities/tracefile/BlockFileIo.h"
+#include "osi-utilities/tracefile/TraceFileConfig.h"
+
+namespace osi3 {
+namespace tracefile {
+
+/**
+ * @brief Local directory storing blocks of trace files once, keyed by their content
+ *
+ * A block is stored in "<root>/<first two key characters>/<key>". The key is the
+ * 128-bit hash (two XXH64 hashes with different seeds) of the block in hexadecimal, so
+ * identical blocks of different trace files are stored only once. Blocks are written to
+ * a temporary file first and renamed, so several processes can add to the same store.
+ *
+ * The hash is not cryptographic; the store is meant for trusted local datasets.
+ */
+class ChunkStore {
+   public:
+    /**
+     * @brief Opens a store, creating its directory if needed
+     * @param root Directory of the store
+     * @throws std::runtime_error if the directory cannot be created
+     */
+    explicit ChunkStore(std::filesystem::path root);
+
+    /** @brief Gets the directory of the store */
+    const std::filesystem::path& GetRoot() const { return root_; }
+
+    /**
+     * @brief Computes the key of a block
+     * @param block Block content
+     * @return 32 hexadecimal characters
+     */
+    static std::string ComputeKey(std::string_view block);
+
+    /**
+     * @brief Adds a block unless the store already has it
+     * @param block Block content
+     * @param key Set to the key of the block
+     * @return true if the block was added, false if it was already stored
+     * @throws std::runtime_error if the block cannot be written
+     */
+    bool Put(std::string_view block, std::string& key);
+
+    /**
+     * @brief Checks whether the store has a block
+     * @param key Key of the block
+     * @return true if the block is stored
+     */
+    bool Contains(const std::string& key) const;
+
+    /**
+     * @brief Reads a block and verifies its content against its key
+     * @param key Key of the block
+     * @param block Set to the block content
+     * @throws std::runtime_error if the block is missing or corrupt
+     */
+    void Get(const std::string& key, std::string& block) const;
+
+    /**
+     * @brief Gets the path of a block in the store
+     * @param key Key of the block
+     * @return Path of the block file, which only exists if the block is stored
+     */
+    std::filesystem::path GetBlockPath(const std::string& key) const;
+
+   private:
+    std::filesystem::path root_; /**< Directory of the store */
+};
+
+/**
+ * @brief Options for storing trace files in a chunk store.
+ */
+struct ChunkStoreOptions {
+    size_t average_block_frames = config::kDefaultAverageBlockFrames; /**< .osi files: average frames per block, a power of two */
+    size_t max_block_size = config::kDefaultChunkSize;                /**< .osi files: blocks end after the frame reaching this size */
+};
+
+/**
+ * @brief Block of a stored trace file, as listed in its manifest.
+ */
+struct ManifestEntry {
+    std::string key;   /**< Key of the block in the store */
+    uint64_t size = 0; /**< Size of the block in bytes */
+};
+
+/**
+ * @brief Manifest of a trace file stored in a chunk store.
+ *
+ * The manifest is a text file: config::kChunkManifestHeader, a "store <path>" line with
+ * the store directory (relative to the manifest if it is in the same tree) and one
+ * "<key> <size>" line per block. The trace file is the concatenation of the blocks.
+ */
+struct ChunkManifest {
+    std::filesystem::path store_root;   /**< Directory of the store, relative paths are resolved against the manifest directory */
+    std::vector<ManifestEntry> entries; /**< Blocks of the trace file, in file order */
+};
+
+/**
+ * @brief Reads a manifest
+ * @param manifest_path Path of the manifest
+ * @return The manifest, with store_root resolved against the manifest directory
+ * @throws std::runtime_error if the manifest cannot be read or is malformed
+ */
+ChunkManifest ReadChunkManifest(const std::filesystem::path& manifest_path);
+
+/**
+ * @brief Result of storing a trace file.
+ */
+struct ChunkStoreResult {
+    std::filesystem::path manifest_path; /**< Path of the written manifest */
+    size_t block_count = 0;              /**< Blocks of the trace file */
+    size_t added_block_count = 0;        /**< Blocks the store did not have yet */
+    uint64_t total_size = 0;             /**< Size of the trace file in bytes */
+    uint64_t added_size = 0;             /**< Bytes added to the store */
+};
+
+/**
+ * @brief Stores a trace file in a chunk store and writes its manifest
+ *
+ * The file is split so that shared content of related traces, e.g. of a parameter
+ * sweep, ends up in identical blocks:
+ * - .osi files are split at frame boundaries chosen by the content of the frames: a
+ *   block ends after a frame whose hash is divisible by average_block_frames. Traces
+ *   with an identical prefix share its blocks, and traces that converge again after
+ *   differing frames share blocks again from the next boundary on.
+ * - .mcap files are split at the records: every chunk record with its message index
+ *   records is a block, and the records in between form blocks. Traces written with the
+ *   same writer options share the chunks of identical prefixes and static channels.
+ *
+ * The trace file itself is left in place; remove it once the manifest is written.
+ *
+ * @param trace_path Trace file to store (.osi or .mcap)
+ * @param store Store to add the blocks to
+ * @param manifest_path Manifest to write, empty for trace_path with config::kChunkManifestExtension appended
+ * @param options Store options
+ * @return Counts of the stored and added blocks and bytes
+ * @throws std::invalid_argument if the format is not supported or the options are invalid
+ * @throws std::runtime_error if a file cannot be read or written
+ */
+ChunkStoreResult StoreTraceFile(const std::filesystem::path& trace_path, ChunkStore& store, const std::filesystem::path& manifest_path = {},
+                                const ChunkStoreOptions& options = {});
+
+/**
+ * @brief Content of a stored trace file, read from the store block by block
+ *
+ * Resolves the read offsets to the blocks listed in the manifest and loads each block from
+ * the store only when it is read, verifying it against its key. The last loaded block is
+ * kept, so sequential reads load every block once. Lets the binary and MCAP readers read a
+ * stored trace file without reconstructing it (see BlockFileReader::Open()).
+ *
+ * @note Thread Safety: Not thread-safe. External synchronization required for concurrent access.
+ */
+class ChunkStoreFileSource final : public FileSource {
+   public:
+    /**
+     * @brief Opens a stored trace file
+     * @param manifest_path Manifest of the trace file
+     * @throws std::runtime_error if the manifest cannot be read, or the store lacks a block or holds one of another size
+     */
+    explicit ChunkStoreFileSource(const std::filesystem::path& manifest_path);
+
+    /** @brief Size of the stored trace file in bytes */
+    uint64_t Size() const override { return offsets_.back(); }
+
+    /**
+     * @brief Reads bytes of the stored trace file, loading the blocks they lie in
+     * @param destination Buffer receiving the bytes
+     * @param offset Offset of the first byte
+     * @param size Number of bytes
+     * @throws std::runtime_error if the range exceeds the file, or a block is missing or corrupt
+     */
+    void ReadAt(char* destination, uint64_t offset, size_t size) override;
+
+   private:
+    ChunkManifest manifest_;        /**< Blocks of the trace file */
+    ChunkStore store_;              /**< Store holding the blocks */
+    std::vector<uint64_t> offsets_; /**< File offset of every block, followed by the file size */
+    size_t loaded_index_ = 0;       /**< Index of the block in loaded_block_ */
+    std::string loaded_block_;      /**< Content of the last loaded block */
+    bool has_loaded_block_ = false; /**< Whether loaded_block_ holds a block */
+};
+
+/**
+ * @brief Reconstructs a stored trace file from its manifest
+ * @param manifest_path Manifest of the trace file
+ * @param output_path Trace file to write, byte-identical to the stored one
+ * @throws std::runtime_error if a block is missing or corrupt, or a file cannot be read or written
+ */
+void RestoreTraceFile(const std::filesystem::path& manifest_path, const std::filesystem::path& output_path);
+
+}  // namespace tracefile
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_CHUNKSTORE_H_
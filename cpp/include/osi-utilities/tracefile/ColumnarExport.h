@@ -0,0 +1,124 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_COLUMNAREXPORT_H_
+#define OSIUTILITIES_TRACEFILE_COLUMNAREXPORT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "osi-utilities/tracefile/Reader.h"
+
+namespace osi3 {
+
+class GroundTruth;
+class SensorData;
+
+namespace tracefile {
+
+/**
+ * @brief Pose, motion and extent of moving objects, one row per object and frame.
+ *
+ * All columns have the same length. Values of unset sub-messages (e.g. a missing
+ * velocity) are NaN, so they can be told apart from zero.
+ */
+struct MovingObjectColumns {
+    std::vector<uint64_t> frame_index;     /**< Index of the frame among the extracted frames */
+    std::vector<uint64_t> timestamp;       /**< Log time of the frame in nanoseconds */
+    std::vector<uint64_t> id;              /**< Object id */
+    std::vector<double> position_x;        /**< Position of the bounding box center in m */
+    std::vector<double> position_y;        /**< Position of the bounding box center in m */
+    std::vector<double> position_z;        /**< Position of the bounding box center in m */
+    std::vector<double> orientation_roll;  /**< Orientation in rad */
+    std::vector<double> orientation_pitch; /**< Orientation in rad */
+    std::vector<double> orientation_yaw;   /**< Orientation in rad */
+    std::vector<double> velocity_x;        /**< Velocity in m/s */
+    std::vector<double> velocity_y;        /**< Velocity in m/s */
+    std::vector<double> velocity_z;        /**< Velocity in m/s */
+    std::vector<double> dimension_length;  /**< Bounding box length in m */
+    std::vector<double> dimension_width;   /**< Bounding box width in m */
+    std::vector<double> dimension_height;  /**< Bounding box height in m */
+
+    /** @brief Number of rows */
+    size_t Size() const { return id.size(); }
+};
+
+/**
+ * @brief Detected moving objects of SensorData frames, one row per object and frame.
+ *
+ * The pose and extent columns mirror MovingObjectColumns. Values of unset fields are NaN,
+ * an object without tracking id has id 0.
+ */
+struct DetectedObjectColumns {
+    std::vector<uint64_t> frame_index;         /**< Index of the frame among the extracted frames */
+    std::vector<uint64_t> timestamp;           /**< Log time of the frame in nanoseconds */
+    std::vector<uint64_t> id;                  /**< First tracking id of the object */
+    std::vector<double> existence_probability; /**< Existence probability in [0, 1] */
+    std::vector<double> position_x;            /**< Position of the bounding box center in m */
+    std::vector<double> position_y;            /**< Position of the bounding box center in m */
+    std::vector<double> position_z;            /**< Position of the bounding box center in m */
+    std::vector<double> orientation_roll;      /**< Orientation in rad */
+    std::vector<double> orientation_pitch;     /**< Orientation in rad */
+    std::vector<double> orientation_yaw;       /**< Orientation in rad */
+    std::vector<double> velocity_x;            /**< Velocity in m/s */
+    std::vector<double> velocity_y;            /**< Velocity in m/s */
+    std::vector<double> velocity_z;            /**< Velocity in m/s */
+    std::vector<double> dimension_length;      /**< Bounding box length in m */
+    std::vector<double> dimension_width;       /**< Bounding box width in m */
+    std::vector<double> dimension_height;      /**< Bounding box height in m */
+
+    /** @brief Number of rows */
+    size_t Size() const { return id.size(); }
+};
+
+/**
+ * @brief Append the moving objects of a GroundTruth frame to the columns.
+ *
+ * @param ground_truth The frame
+ * @param frame_index Value of the frame_index column for the appended rows
+ * @param timestamp Value of the timestamp column for the appended rows, in nanoseconds
+ * @param columns Columns to append to
+ */
+void AppendMovingObjects(const GroundTruth& ground_truth, uint64_t frame_index, uint64_t timestamp, MovingObjectColumns& columns);
+
+/**
+ * @brief Append the detected moving objects of a SensorData frame to the columns.
+ *
+ * @param sensor_data The frame
+ * @param frame_index Value of the frame_index column for the appended rows
+ * @param timestamp Value of the timestamp column for the appended rows, in nanoseconds
+ * @param columns Columns to append to
+ */
+void AppendDetectedObjects(const SensorData& sensor_data, uint64_t frame_index, uint64_t timestamp, DetectedObjectColumns& columns);
+
+/**
+ * @brief Extract the moving objects of all remaining GroundTruth frames of an opened reader.
+ *
+ * Frames are consumed through TraceFileReader::ReadRawMessage() and parsed into a single
+ * reused message. Frames of other types and incompatible messages are skipped; use
+ * MCAPTraceFileReader::SetTopics() to restrict the export to certain channels.
+ *
+ * @param reader An opened trace file reader
+ * @return Columns of all moving objects, in file order
+ * @throws std::runtime_error if a frame cannot be read or parsed
+ */
+MovingObjectColumns ExtractMovingObjects(TraceFileReader& reader);
+
+/**
+ * @brief Extract the detected moving objects of all remaining SensorData frames of an opened reader.
+ *
+ * Works like ExtractMovingObjects().
+ *
+ * @param reader An opened trace file reader
+ * @return Columns of all detected moving objects, in file order
+ * @throws std::runtime_error if a frame cannot be read or parsed
+ */
+DetectedObjectColumns ExtractDetectedObjects(TraceFileReader& reader);
+
+}  // namespace tracefile
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_COLUMNAREXPORT_H_
@@ -0,0 +1,127 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_FIELDPATH_H_
+#define OSIUTILITIES_TRACEFILE_FIELDPATH_H_
+
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace osi3 {
+namespace tracefile {
+
+/**
+ * @brief Type of the field a field path ends in, see CompiledFieldPath::GetValueType()
+ */
+enum class FieldValueType : uint8_t {
+    kDouble, /**< double or float */
+    kInt64,  /**< Signed integer or enum */
+    kUInt64, /**< Unsigned integer */
+    kBool,   /**< bool */
+};
+
+/**
+ * @brief Field path expression resolved against a message type once, to extract values from many messages
+ *
+ * Expressions are dotted field names relative to the top-level message, e.g.
+ * "host_vehicle_id.value" for GroundTruth. Repeated fields need an element selector,
+ * "[*]" for all elements or "[i]" for element i, e.g. "moving_object[*].base.position.x".
+ * The path must end in a numeric, enum or bool field.
+ *
+ * The fields are looked up by name when the path is compiled, so extracting values does
+ * not search descriptors. Values are appended to typed buffers, which can be reused
+ * across frames:
+ * - absent singular fields yield their default value, as the protobuf accessors do
+ * - "[*]" yields one value per element, "[i]" yields no value if there is no element i
+ *
+ * Example usage, e.g. for a plot of all object positions:
+ * @code
+ * const osi3::tracefile::CompiledFieldPath x(osi3::GroundTruth::descriptor(), "moving_object[*].base.position.x");
+ * std::vector<double> values;
+ * while (auto raw = reader->ReadRawMessage()) {
+ *     values.clear();
+ *     x.ExtractSerialized({raw->data, raw->size}, values);
+ *     ...
+ * }
+ * @endcode
+ *
+ * Extract() and ExtractSerialized() are provided for buffers of double, float, int64_t,
+ * uint64_t, int32_t, uint32_t and bool; values are converted with static_cast.
+ */
+class CompiledFieldPath {
+   public:
+    static constexpr int kSingular = -1;    /**< Element index of components of singular fields */
+    static constexpr int kAllElements = -2; /**< Element index of components with "[*]" */
+
+    /** @brief A component of the path, resolved to its field */
+    struct Component {
+        const google::protobuf::FieldDescriptor* field = nullptr; /**< Field of the component */
+        int index = kSingular;                                    /**< kSingular, kAllElements or the selected element */
+    };
+
+    /**
+     * @brief Compiles a field path expression
+     * @param descriptor Type of the messages to extract values from, e.g. osi3::GroundTruth::descriptor()
+     * @param expression Field path expression
+     * @throws std::runtime_error if the expression is malformed or does not resolve to a numeric, enum or bool field
+     */
+    CompiledFieldPath(const google::protobuf::Descriptor* descriptor, std::string_view expression);
+
+    /** @brief Gets the expression the path was compiled from */
+    const std::string& GetExpression() const { return expression_; }
+
+    /** @brief Gets the type of the messages the path applies to */
+    const google::protobuf::Descriptor* GetDescriptor() const { return descriptor_; }
+
+    /** @brief Gets the type of the extracted values, e.g. to choose a buffer type */
+    FieldValueType GetValueType() const { return value_type_; }
+
+    /** @brief Gets the resolved components of the path */
+    const std::vector<Component>& GetComponents() const { return components_; }
+
+    /**
+     * @brief Appends the values of the path in a message to a buffer
+     * @tparam T Type of the buffer elements
+     * @param message Message of the type the path was compiled for
+     * @param values Buffer to append to
+     * @return Number of appended values
+     * @throws std::runtime_error if the message has a different type
+     */
+    template <typename T>
+    size_t Extract(const google::protobuf::Message& message, std::vector<T>& values) const;
+
+    /**
+     * @brief Appends the values of the path in a serialized message to a buffer, without parsing the message
+     *
+     * Only the fields along the path are decoded, directly from the bytes, e.g. of
+     * TraceFileReader::ReadRawMessage(). Yields the same values as Extract() on the parsed
+     * message, also for fields that occur more than once: the last occurrence of a scalar
+     * wins and the occurrences of a singular message merge.
+     *
+     * @tparam T Type of the buffer elements
+     * @param serialized Serialized message of the type the path was compiled for
+     * @param values Buffer to append to, possibly with some values appended on malformed input
+     * @return false if the bytes along the path are malformed
+     */
+    template <typename T>
+    bool ExtractSerialized(std::string_view serialized, std::vector<T>& values) const;
+
+   private:
+    const google::protobuf::Descriptor* descriptor_;      /**< Type of the top-level message */
+    std::string expression_;                              /**< Source expression */
+    std::vector<Component> components_;                   /**< Resolved components, from the top-level message to the value */
+    FieldValueType value_type_ = FieldValueType::kDouble; /**< Type of the last field */
+};
+
+}  // namespace tracefile
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_FIELDPATH_H_
@@ -0,0 +1,187 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_FLATVIEWS_H_
+#define OSIUTILITIES_TRACEFILE_FLATVIEWS_H_
+
+#include <cstdint>
+#include <string_view>
+
+#include "osi-utilities/tracefile/WireFormatUtils.h"
+#include "osi_groundtruth.pb.h"
+#include "osi_sensordata.pb.h"
+
+namespace osi3 {
+namespace tracefile {
+
+/**
+ * @brief Flat copy of an osi3::Vector3d.
+ */
+struct Vector3dView {
+    double x = 0.0; /**< x coordinate */
+    double y = 0.0; /**< y coordinate */
+    double z = 0.0; /**< z coordinate */
+};
+
+/**
+ * @brief Flat copy of an osi3::Dimension3d.
+ */
+struct Dimension3dView {
+    double length = 0.0; /**< Length */
+    double width = 0.0;  /**< Width */
+    double height = 0.0; /**< Height */
+};
+
+/**
+ * @brief Flat copy of an osi3::Orientation3d.
+ */
+struct Orientation3dView {
+    double roll = 0.0;  /**< Roll angle */
+    double pitch = 0.0; /**< Pitch angle */
+    double yaw = 0.0;   /**< Yaw angle */
+};
+
+/**
+ * @brief Flat copy of the scalar parts of an osi3::BaseMoving (base_polygon is not decoded).
+ */
+struct BaseMovingView {
+    Dimension3dView dimension;                  /**< Bounding box dimension */
+    Vector3dView position;                      /**< Position of the bounding box center */
+    Orientation3dView orientation;              /**< Orientation of the bounding box */
+    Vector3dView velocity;                      /**< Velocity */
+    Vector3dView acceleration;                  /**< Acceleration */
+    Orientation3dView orientation_rate;         /**< Orientation rate */
+    Orientation3dView orientation_acceleration; /**< Orientation acceleration */
+};
+
+/**
+ * @brief Flat view of an osi3::MovingObject of a GroundTruth.
+ */
+struct MovingObjectView {
+    uint64_t id = 0;             /**< id.value */
+    int32_t type = 0;            /**< type, as osi3::MovingObject::Type value */
+    int32_t vehicle_type = 0;    /**< vehicle_classification.type, as osi3::MovingObject::VehicleClassification::Type value */
+    BaseMovingView base;         /**< base */
+    bool has_base = false;       /**< Whether base is set */
+    std::string_view serialized; /**< Serialized MovingObject, e.g. to parse fields that are not part of the view */
+};
+
+/**
+ * @brief Flat view of an osi3::DetectedMovingObject of a SensorData.
+ */
+struct DetectedMovingObjectView {
+    uint64_t tracking_id = 0;           /**< header.tracking_id.value */
+    uint64_t ground_truth_id = 0;       /**< header.ground_truth_id[0].value */
+    double existence_probability = 0.0; /**< header.existence_probability */
+    double age = 0.0;                   /**< header.age */
+    int32_t measurement_state = 0;      /**< header.measurement_state */
+    BaseMovingView base;                /**< base */
+    BaseMovingView base_rmse;           /**< base_rmse */
+    bool has_base = false;              /**< Whether base is set */
+    std::string_view serialized;        /**< Serialized DetectedMovingObject */
+};
+
+/**
+ * @brief Decodes a serialized osi3::BaseMoving into a flat view.
+ *
+ * Like protobuf parsing, an embedded message occurring several times is merged: later fields
+ * overwrite earlier ones and fields missing from a later occurrence keep their value.
+ * @param serialized Serialized BaseMoving bytes
+ * @param view Output view, reset before decoding
+ * @return false if the bytes are malformed
+ */
+bool DecodeBaseMoving(std::string_view serialized, BaseMovingView& view);
+
+/**
+ * @brief Decodes a serialized osi3::MovingObject into a flat view.
+ * @param serialized Serialized MovingObject bytes (must outlive view.serialized)
+ * @param view Output view, reset before decoding
+ * @return false if the bytes are malformed
+ */
+bool DecodeMovingObject(std::string_view serialized, MovingObjectView& view);
+
+/**
+ * @brief Decodes a serialized osi3::DetectedMovingObject into a flat view.
+ * @param serialized Serialized DetectedMovingObject bytes (must outlive view.serialized)
+ * @param view Output view, reset before decoding
+ * @return false if the bytes are malformed
+ */
+bool DecodeDetectedMovingObject(std::string_view serialized, DetectedMovingObjectView& view);
+
+/** @brief Field number of osi3::GroundTruth::moving_object. */
+constexpr uint32_t kGroundTruthMovingObjectFieldNumber = GroundTruth::kMovingObjectFieldNumber;
+
+/** @brief Field number of osi3::SensorData::moving_object. */
+constexpr uint32_t kSensorDataMovingObjectFieldNumber = SensorData::kMovingObjectFieldNumber;
+
+/**
+ * @brief Forward-only scanner decoding the elements of a repeated message field into flat views.
+ *
+ * Only the top-level fields of the containing message are scanned; the elements are decoded
+ * straight from the serialized bytes, without protobuf message objects or heap allocations.
+ *
+ * Example usage, e.g. on the bytes of TraceFileReader::ReadRawMessage():
+ * @code
+ * osi3::tracefile::MovingObjectScanner scanner({raw->data, raw->size});
+ * osi3::tracefile::MovingObjectView object;
+ * while (scanner.Next(object)) {
+ *     speeds[object.id] = std::hypot(object.base.velocity.x, object.base.velocity.y);
+ * }
+ * if (scanner.HasError()) { ... }
+ * @endcode
+ *
+ * @tparam View Flat view type of the elements
+ * @tparam kFieldNumber Field number of the repeated field in the containing message
+ * @tparam Decode Function decoding one element into the view
+ */
+template <typename View, uint32_t kFieldNumber, bool (*Decode)(std::string_view, View&)>
+class RepeatedMessageScanner {
+   public:
+    /**
+     * @brief Creates a scanner over a serialized message
+     * @param message Serialized containing message (must outlive the scanner and all returned views)
+     */
+    explicit RepeatedMessageScanner(const std::string_view message) : reader_(message) {}
+
+    /**
+     * @brief Decodes the next element of the repeated field
+     * @param view Output view, only valid if true is returned
+     * @return true if an element was decoded, false at the end of the message or on malformed input
+     */
+    bool Next(View& view) {
+        WireField field;
+        while (!error_ && reader_.Next(field)) {
+            if (field.number != kFieldNumber || field.type != WireType::kLengthDelimited) {
+                continue;
+            }
+            if (Decode(field.payload, view)) {
+                return true;
+            }
+            error_ = true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Checks whether scanning stopped because of malformed input
+     * @return true if the message or one of its elements is malformed
+     */
+    bool HasError() const { return error_ || reader_.HasError(); }
+
+   private:
+    WireFieldReader reader_; /**< Scanner over the top-level fields of the containing message */
+    bool error_ = false;     /**< Set once an element failed to decode */
+};
+
+/** @brief Scanner over GroundTruth::moving_object. */
+using MovingObjectScanner = RepeatedMessageScanner<MovingObjectView, kGroundTruthMovingObjectFieldNumber, DecodeMovingObject>;
+
+/** @brief Scanner over SensorData::moving_object. */
+using DetectedMovingObjectScanner = RepeatedMessageScanner<DetectedMovingObjectView, kSensorDataMovingObjectFieldNumber, DecodeDetectedMovingObject>;
+
+}  // namespace tracefile
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_FLATVIEWS_H_
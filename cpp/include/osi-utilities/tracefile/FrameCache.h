@@ -0,0 +1,230 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_FRAMECACHE_H_
+#define OSIUTILITIES_TRACEFILE_FRAMECACHE_H_
+
+#include <google/protobuf/message.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "osi-utilities/tracefile/Reader.h"
+#include "osi-utilities/tracefile/TraceFileConfig.h"
+
+namespace osi3 {
+namespace tracefile {
+
+/**
+ * @brief Options for a FrameCache.
+ */
+struct FrameCacheOptions {
+    size_t memory_budget = config::kDefaultFrameCacheMemoryBudget; /**< Memory of the cached messages in bytes, as estimated by SpaceUsedLong() */
+    size_t prefetch_count = config::kDefaultFramePrefetchCount;    /**< Frames loaded ahead in the scrub direction, 0 disables prefetching */
+    size_t worker_count = 2;                                       /**< Background threads loading prefetched frames */
+    tracefile::IoOptions io;                                       /**< I/O engine of the trace file readers */
+};
+
+/**
+ * @brief Decoded frame held by a FrameCache.
+ */
+struct CachedFrame {
+    std::unique_ptr<const google::protobuf::Message> message;             /**< The decoded message */
+    ReaderTopLevelMessage message_type = ReaderTopLevelMessage::kUnknown; /**< Type of the message */
+    uint64_t log_time = 0;                                                /**< Log time in nanoseconds */
+    size_t index = 0;                                                     /**< Index of the frame in its channel */
+    size_t memory_size = 0;                                               /**< Memory of the message in bytes, counted against the budget */
+};
+
+/**
+ * @brief Counters of a FrameCache.
+ */
+struct FrameCacheStatistics {
+    size_t hits = 0;          /**< Requests served from the cache, including prefetched frames */
+    size_t misses = 0;        /**< Requests that loaded the frame synchronously */
+    size_t prefetched = 0;    /**< Frames loaded by the background threads */
+    size_t evictions = 0;     /**< Frames dropped to stay within the memory budget */
+    size_t memory_usage = 0;  /**< Memory of the cached frames in bytes */
+    size_t cached_frames = 0; /**< Number of cached frames */
+};
+
+/**
+ * @brief Memory-bounded cache of decoded frames, shared by the views of trace files
+ *
+ * Interactive tools that scrub back and forth through a trace request the same frames
+ * again and again. The cache keeps decoded frames keyed by file, topic and frame index,
+ * and evicts the least recently used frames once the memory budget is exceeded. After
+ * each request, the next prefetch_count frames in the scrub direction (the direction of
+ * the previous request of the same channel) are loaded on background threads.
+ *
+ * The cache is thread-safe. Views of the same file share frames if they use the same
+ * cache instance, e.g. through a std::shared_ptr<FrameCache>; paths are compared after
+ * normalization. Frames are handed out as shared pointers, so a frame stays valid for
+ * its users after it is evicted.
+ *
+ * Supported are .osi files, whose single channel has the empty topic and whose message
+ * type is inferred from the filename, and .mcap files. On first access to a file, its
+ * frame index is built in one pass over the serialized frames, without decoding them.
+ * The file then stays open: loads of different frames share one reader, which seeks to
+ * the frames (.osi) or jumps to the chunks of their time window (.mcap), while the
+ * frames are decoded in parallel.
+ * Frames are located by their byte offset in .osi files and by their log time in MCAP
+ * files; timestamps are expected not to decrease, as for time windows of
+ * SliceTraceFile().
+ *
+ * Example usage:
+ * @code
+ * auto cache = std::make_shared<osi3::tracefile::FrameCache>();
+ * // in a view, while the user drags the time slider
+ * const auto frame = cache->GetFrameAt("drive.mcap", "ground_truth", slider_time);
+ * const auto& ground_truth = static_cast<const osi3::GroundTruth&>(*frame->message);
+ * @endcode
+ */
+class FrameCache {
+   public:
+    /**
+     * @brief Creates an empty cache and starts its background threads
+     * @param options Cache options
+     */
+    explicit FrameCache(const FrameCacheOptions& options = {});
+
+    /** @brief Stops the background threads */
+    ~FrameCache();
+
+    /** @brief Deleted copy constructor */
+    FrameCache(const FrameCache&) = delete;
+
+    /** @brief Deleted copy assignment operator */
+    FrameCache& operator=(const FrameCache&) = delete;
+
+    /** @brief Deleted move constructor */
+    FrameCache(FrameCache&&) = delete;
+
+    /** @brief Deleted move assignment operator */
+    FrameCache& operator=(FrameCache&&) = delete;
+
+    /**
+     * @brief Gets a frame by index, loading it on a miss
+     * @param file_path Trace file (.osi or .mcap)
+     * @param topic Topic of the channel, empty for .osi files
+     * @param index Index of the frame in the channel
+     * @return The frame, nullptr if the channel has no such frame
+     * @throws std::invalid_argument if the format is not supported
+     * @throws std::runtime_error if the file cannot be indexed or the frame cannot be read
+     */
+    std::shared_ptr<const CachedFrame> GetFrame(const std::filesystem::path& file_path, const std::string& topic, size_t index);
+
+    /**
+     * @brief Gets the last frame with a log time not after the given time, loading it on a miss
+     * @param file_path Trace file (.osi or .mcap)
+     * @param topic Topic of the channel, empty for .osi files
+     * @param log_time Log time in nanoseconds
+     * @return The frame, nullptr if the channel has no frame up to the given time
+     * @throws std::invalid_argument if the format is not supported
+     * @throws std::runtime_error if the file cannot be indexed or the frame cannot be read
+     */
+    std::shared_ptr<const CachedFrame> GetFrameAt(const std::filesystem::path& file_path, const std::string& topic, uint64_t log_time);
+
+    /**
+     * @brief Gets the log times of the frames of a channel, e.g. for a time slider
+     * @param file_path Trace file (.osi or .mcap)
+     * @param topic Topic of the channel, empty for .osi files
+     * @return Log times in nanoseconds by frame index, empty if the channel does not exist
+     * @throws std::invalid_argument if the format is not supported
+     * @throws std::runtime_error if the file cannot be indexed
+     */
+    std::vector<uint64_t> GetFrameTimes(const std::filesystem::path& file_path, const std::string& topic);
+
+    /** @brief Gets the counters of the cache */
+    FrameCacheStatistics GetStatistics() const;
+
+    /** @brief Drops all cached frames and pending prefetches, the file indexes are kept */
+    void Clear();
+
+   private:
+    class FileSource;
+
+    /** @brief Cache key: normalized file path, topic and frame index */
+    using FrameKey = std::tuple<std::string, std::string, size_t>;
+
+    /** @brief Frames of a channel to prefetch */
+    struct PrefetchTask {
+        std::shared_ptr<FileSource> source; /**< File of the frames */
+        std::string topic;                  /**< Topic of the channel */
+        size_t first = 0;                   /**< First frame (inclusive) */
+        size_t end = 0;                     /**< End of the frames (exclusive) */
+    };
+
+    /** @brief Cached frame with its position in the LRU list */
+    struct Entry {
+        std::shared_ptr<const CachedFrame> frame; /**< The frame */
+        std::list<FrameKey>::iterator lru;        /**< Position in lru_ */
+    };
+
+    /**
+     * @brief Gets the source of a file, building its frame index on first access
+     * @param file_path Trace file
+     * @return The source
+     */
+    std::shared_ptr<FileSource> GetSource(const std::filesystem::path& file_path);
+
+    /**
+     * @brief Gets a frame of a source, loading it on a miss, and schedules the prefetch
+     * @param source File of the frame
+     * @param topic Topic of the channel
+     * @param index Index of the frame in the channel
+     * @return The frame, nullptr if the channel has no such frame
+     */
+    std::shared_ptr<const CachedFrame> GetFrame(const std::shared_ptr<FileSource>& source, const std::string& topic, size_t index);
+
+    /**
+     * @brief Adds a loaded frame and evicts frames beyond the memory budget, called with mutex_ held
+     * @param key Key of the frame
+     * @param frame The frame
+     */
+    void Insert(const FrameKey& key, std::shared_ptr<const CachedFrame> frame);
+
+    /**
+     * @brief Replaces the pending prefetch of a channel, called with mutex_ held
+     * @param source File of the channel
+     * @param topic Topic of the channel
+     * @param index Requested frame
+     */
+    void SchedulePrefetch(const std::shared_ptr<FileSource>& source, const std::string& topic, size_t index);
+
+    /** @brief Loop of the background threads */
+    void RunWorker();
+
+    FrameCacheOptions options_;                                                          /**< Cache options */
+    mutable std::mutex mutex_;                                                           /**< Guards all members below */
+    std::condition_variable work_available_;                                             /**< Wakes the background threads */
+    std::condition_variable frame_loaded_;                                               /**< Wakes requests waiting for a frame a background thread is loading */
+    std::map<std::string, std::shared_ptr<FileSource>> sources_;                         /**< Indexed files by normalized path */
+    std::map<FrameKey, Entry> entries_;                                                  /**< Cached frames */
+    std::list<FrameKey> lru_;                                                            /**< Keys of the cached frames, most recently used first */
+    std::set<FrameKey> loading_;                                                         /**< Frames being loaded by background threads */
+    std::map<std::pair<std::string, std::string>, std::pair<size_t, bool>> scrub_state_; /**< Last requested frame and whether scrubbing backwards, by file and topic */
+    std::deque<PrefetchTask> tasks_;                                                     /**< Pending prefetches, at most one per channel */
+    FrameCacheStatistics statistics_;                                                    /**< Counters */
+    bool stopping_ = false;                                                              /**< Set to stop the background threads */
+    std::vector<std::thread> workers_;                                                   /**< Background threads */
+};
+
+}  // namespace tracefile
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_FRAMECACHE_H_
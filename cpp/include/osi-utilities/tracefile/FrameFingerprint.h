@@ -0,0 +1,80 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_FRAMEFINGERPRINT_H_
+#define OSIUTILITIES_TRACEFILE_FRAMEFINGERPRINT_H_
+
+#include <google/protobuf/message.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "osi-utilities/tracefile/Reader.h"
+
+namespace osi3 {
+namespace tracefile {
+
+/**
+ * @brief Input the frame hash is computed over.
+ */
+enum class FingerprintMode : uint8_t {
+    kRawBytes = 0,  /**< Hash the serialized bytes as stored in the trace (fastest, no parsing) */
+    kCanonical = 1, /**< Parse the frame and hash its deterministic re-serialization, so that
+                         traces written by different serializers compare equal */
+};
+
+/**
+ * @brief Fingerprint of a single frame of a trace file.
+ */
+struct FrameFingerprint {
+    std::string channel_name;                                             /**< Channel name (empty for single-channel formats) */
+    uint64_t log_time = 0;                                                /**< Log time in nanoseconds */
+    uint64_t hash = 0;                                                    /**< 64-bit hash of the frame */
+    size_t size = 0;                                                      /**< Number of hashed bytes */
+    size_t index = 0;                                                     /**< Position of the frame in the trace, counting OSI frames only */
+    ReaderTopLevelMessage message_type = ReaderTopLevelMessage::kUnknown; /**< Type of the frame */
+};
+
+/**
+ * @brief Compute a fast non-cryptographic 64-bit hash (XXH64) of a byte range.
+ *
+ * @param data Pointer to the bytes to hash
+ * @param size Number of bytes
+ * @param seed Optional seed
+ * @return 64-bit hash value, stable across platforms and library versions
+ */
+uint64_t HashBytes(const void* data, size_t size, uint64_t seed = 0);
+
+/**
+ * @brief Compute the canonical hash of a message.
+ *
+ * The message is serialized with deterministic serialization enabled, so map entries
+ * are ordered and two equal messages produce the same hash regardless of the field
+ * order they were originally serialized in.
+ *
+ * @param message The message to hash
+ * @return 64-bit hash of the deterministic serialization
+ */
+uint64_t HashMessageCanonical(const google::protobuf::Message& message);
+
+/**
+ * @brief Compute fingerprints for all remaining OSI frames of an opened reader.
+ *
+ * Frames are consumed through TraceFileReader::ReadRawMessage(), so in kRawBytes mode
+ * no message is ever deserialized. Incompatible (non-OSI) messages are skipped.
+ *
+ * @param reader An opened trace file reader
+ * @param mode Input the hash is computed over
+ * @return One fingerprint per frame, in file order
+ * @throws std::runtime_error if a frame cannot be read or parsed
+ */
+std::vector<FrameFingerprint> ComputeTraceFingerprints(TraceFileReader& reader, FingerprintMode mode = FingerprintMode::kRawBytes);
+
+}  // namespace tracefile
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_FRAMEFINGERPRINT_H_
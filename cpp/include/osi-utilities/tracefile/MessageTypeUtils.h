@@ -0,0 +1,65 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_MESSAGETYPEUTILS_H_
+#define OSIUTILITIES_TRACEFILE_MESSAGETYPEUTILS_H_
+
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "osi-utilities/tracefile/Reader.h"
+
+namespace osi3 {
+namespace tracefile {
+
+/**
+ * @brief Get the protobuf descriptor of an OSI top-level message type.
+ *
+ * @param message_type The OSI message type
+ * @return Descriptor of the corresponding osi3 message, or nullptr for kUnknown
+ */
+const google::protobuf::Descriptor* GetMessageDescriptor(ReaderTopLevelMessage message_type);
+
+/**
+ * @brief Get the OSI top-level message type for a fully-qualified message name.
+ *
+ * Accepts the names used as MCAP schema names, e.g. "osi3.GroundTruth".
+ *
+ * @param full_name Fully-qualified protobuf message name
+ * @return The message type, or kUnknown if the name is not an OSI top-level message
+ */
+ReaderTopLevelMessage GetMessageTypeFromFullName(std::string_view full_name);
+
+/**
+ * @brief Create an empty message instance of an OSI top-level message type.
+ *
+ * @param message_type The OSI message type
+ * @return Newly allocated message, or nullptr for kUnknown
+ */
+std::unique_ptr<google::protobuf::Message> CreateMessage(ReaderTopLevelMessage message_type);
+
+/**
+ * @brief Wrap a serialized GroundTruth in a serialized SensorView without parsing it.
+ *
+ * The SensorView gets the timestamp and host_vehicle_id of the GroundTruth and the
+ * GroundTruth bytes verbatim as global_ground_truth, i.e. the same message as setting
+ * these fields on a parsed osi3::SensorView. Only the top-level fields of the GroundTruth
+ * are scanned; the cost is a copy of the bytes instead of a parse, deep copy and
+ * serialization.
+ *
+ * @param ground_truth Serialized osi3::GroundTruth bytes
+ * @param sensor_view Output buffer, replaced by the serialized osi3::SensorView
+ * @return true on success, false if ground_truth is not a valid serialized message
+ */
+bool WrapGroundTruthInSensorView(std::string_view ground_truth, std::string& sensor_view);
+
+}  // namespace tracefile
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_MESSAGETYPEUTILS_H_
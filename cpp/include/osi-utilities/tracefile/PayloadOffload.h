@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_PAYLOADOFFLOAD_H_
+#define OSIUTILITIES_TRACEFILE_PAYLOADOFFLOAD_H_
+
+#include <google/protobuf/message.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace osi3 {
+namespace tracefile {
+
+/**
+ * @brief Fields whose payloads are moved out of the messages, e.g. camera images
+ *
+ * Field paths are dotted field names relative to the top-level message. Repeated
+ * sub-messages along the path are traversed element by element, and the last field may
+ * be a bytes field or a repeated field, e.g. "camera_sensor_view.image_data" or
+ * "lidar_sensor_view.reflection" for SensorView. Paths that do not exist in a message
+ * type are ignored, so one set of options can apply to channels of different types.
+ */
+struct PayloadOffloadOptions {
+    std::vector<std::string> field_paths; /**< Paths of the fields to offload */
+    size_t min_size = 1024;               /**< Payloads with fewer serialized bytes stay in the message */
+    size_t batch_size = 16 * 1024 * 1024; /**< Payload bytes of a channel collected into one attachment (0: one attachment per frame) */
+};
+
+/**
+ * @brief A payload removed from a message
+ */
+struct OffloadedPayload {
+    std::string path; /**< Field path with the indices of repeated elements, e.g. "camera_sensor_view[1].image_data" */
+    std::string data; /**< Serialized fragment of the message holding the field, containing only the field */
+};
+
+/**
+ * @brief Moves the configured fields out of a message
+ *
+ * The fields are cleared in the message. Each set field instance is returned as a payload
+ * that restores it when attached again with AttachPayload().
+ *
+ * @param message The message to remove the payloads from
+ * @param options Fields to offload
+ * @return The removed payloads, in field path order
+ */
+std::vector<OffloadedPayload> OffloadPayloads(google::protobuf::Message& message, const PayloadOffloadOptions& options);
+
+/**
+ * @brief Restores an offloaded payload in a message
+ *
+ * @param message The message the payload was removed from
+ * @param path Field path of the payload, see OffloadedPayload::path
+ * @param data Serialized payload, see OffloadedPayload::data
+ * @return false if the path does not exist in the message or the payload is malformed
+ */
+bool AttachPayload(google::protobuf::Message& message, std::string_view path, std::string_view data);
+
+/**
+ * @brief Appends an offloaded payload to a payload batch
+ *
+ * A batch collects the payloads of consecutive frames of one channel and is stored as one
+ * MCAP attachment. Each record holds the log time of the frame (little-endian, 64 bit),
+ * the sizes of path and data (little-endian, 32 bit each), the path and the data.
+ *
+ * @param batch The batch to extend
+ * @param log_time Log time of the message the payload was removed from, in nanoseconds
+ * @param payload The payload
+ */
+void AppendPayloadRecord(std::string& batch, uint64_t log_time, const OffloadedPayload& payload);
+
+/**
+ * @brief Restores the payloads of one frame from a payload batch
+ *
+ * @param message The message the payloads were removed from
+ * @param batch Payload batch, see AppendPayloadRecord()
+ * @param log_time Log time of the message in nanoseconds
+ * @return false if the batch is malformed or a payload cannot be attached
+ */
+bool AttachPayloads(google::protobuf::Message& message, std::string_view batch, uint64_t log_time);
+
+/**
+ * @brief Gets the name of the MCAP attachment holding a payload batch
+ *
+ * The name keys the batch by channel and by the log time range of its frames, e.g.
+ * "osi-payload:/sensor_view@1000000000-3000000000".
+ *
+ * @param topic Topic of the messages
+ * @param first_log_time Earliest log time of the frames in the batch, in nanoseconds
+ * @param last_log_time Latest log time of the frames in the batch, in nanoseconds
+ * @return Attachment name
+ */
+std::string GetPayloadAttachmentName(const std::string& topic, uint64_t first_log_time, uint64_t last_log_time);
+
+/**
+ * @brief Parses the name of an MCAP attachment holding a payload batch of a channel
+ *
+ * @param name Attachment name, see GetPayloadAttachmentName()
+ * @param topic Topic of the channel
+ * @return Earliest and latest log time of the batch, std::nullopt if the name is not a payload batch of the channel
+ */
+std::optional<std::pair<uint64_t, uint64_t>> ParsePayloadAttachmentName(std::string_view name, const std::string& topic);
+
+/**
+ * @brief Adds the offloaded field paths to channel metadata
+ *
+ * Uses the key config::kOsiChannelOffloadedFieldsKey, if any field is offloaded.
+ *
+ * @param options Fields to offload
+ * @param channel_metadata Channel metadata to extend
+ */
+void AddPayloadOffloadMetadata(const PayloadOffloadOptions& options, std::unordered_map<std::string, std::string>& channel_metadata);
+
+}  // namespace tracefile
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_PAYLOADOFFLOAD_H_
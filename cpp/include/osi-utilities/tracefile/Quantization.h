@@ -0,0 +1,86 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_QUANTIZATION_H_
+#define OSIUTILITIES_TRACEFILE_QUANTIZATION_H_
+
+#include <google/protobuf/message.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace osi3 {
+namespace tracefile {
+
+/**
+ * @brief Gets the pose fields quantized by default
+ *
+ * The position, orientation, dimension and their derivatives of osi3.BaseMoving, and the
+ * position, orientation and dimension of osi3.BaseStationary and the position and
+ * orientation of osi3.MountingPosition, e.g. "osi3.BaseMoving.position".
+ *
+ * @return Fully qualified field names
+ */
+std::vector<std::string> GetDefaultPoseFields();
+
+/**
+ * @brief Precision of the lossy quantization of positional data
+ *
+ * Only the listed pose fields are quantized, wherever their message occurs; other vectors,
+ * e.g. lane geometry or sensor-specific data, keep their full precision. Of a listed field,
+ * linear quantities are the fields of osi3.Vector3d, osi3.Vector2d and osi3.Dimension3d
+ * (positions, velocities, accelerations, dimensions), angular quantities the fields of
+ * osi3.Orientation3d (orientations and their rates). A precision of 0 leaves the
+ * corresponding fields unchanged.
+ */
+struct QuantizationOptions {
+    double linear_precision = 0.0;                                 /**< Precision of linear quantities, e.g. 0.001 for 1 mm */
+    double angular_precision = 0.0;                                /**< Precision of angular quantities, e.g. 0.001 for 0.001 rad */
+    std::vector<std::string> pose_fields = GetDefaultPoseFields(); /**< Fully qualified fields to quantize; unknown fields and fields of other types are ignored */
+
+    /** @brief Whether any quantization is applied */
+    bool Enabled() const { return linear_precision > 0.0 || angular_precision > 0.0; }
+};
+
+/**
+ * @brief Gets the quantization step used for a precision
+ *
+ * The step is the largest power of two not exceeding the precision, so that quantized
+ * values have zeroed low mantissa bits, which compress much better than the original ones.
+ * The quantization error is at most half a step.
+ *
+ * @param precision Requested precision (0: no quantization)
+ * @return Quantization step, 0 if the precision is not positive
+ */
+double GetQuantizationStep(double precision);
+
+/**
+ * @brief Rounds the pose fields of a message to the configured precision
+ *
+ * Walks the set fields of the message recursively, so it applies to any OSI message,
+ * e.g. GroundTruth and SensorView, and quantizes the fields listed in
+ * QuantizationOptions::pose_fields. Unset fields stay unset.
+ *
+ * @param message The message to quantize in place
+ * @param options Quantization precision
+ */
+void QuantizeMessage(google::protobuf::Message& message, const QuantizationOptions& options);
+
+/**
+ * @brief Adds the quantization steps to channel metadata
+ *
+ * Uses the keys config::kOsiChannelQuantizationLinearStepKey and
+ * config::kOsiChannelQuantizationAngularStepKey, for the enabled quantities only.
+ *
+ * @param options Quantization precision
+ * @param channel_metadata Channel metadata to extend
+ */
+void AddQuantizationMetadata(const QuantizationOptions& options, std::unordered_map<std::string, std::string>& channel_metadata);
+
+}  // namespace tracefile
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_QUANTIZATION_H_
@@ -8,11 +8,14 @@
 
 #include <google/protobuf/message.h>
 
+#include <cstdint>
 #include <filesystem>
 #include <memory>
 #include <optional>
 #include <string>
 
+#include "osi-utilities/tracefile/BlockFileIo.h"
+
 namespace osi3 {
 
 /**
@@ -78,11 +81,64 @@ inline const std::unordered_map<std::string, osi3::ReaderTopLevelMessage> kFileN
  * For incompatible messages (e.g. non-OSI in MCAP), status is kIncompatible
  * and message is nullptr. For errors, status is kError and error_message
  * describes the failure.
+ *
+ * In lazy decoding mode (see TraceFileReader::SetLazyDecoding()), a successful
+ * result holds the serialized bytes and message stays nullptr until the message
+ * is accessed through Decode() or DecodeAs(), so frames that are discarded after
+ * inspecting channel, time and type are never parsed.
  */
 struct ReadResult {
-    std::unique_ptr<google::protobuf::Message> message;                   /**< The parsed protobuf message (nullptr when status != kOk) */
+    std::unique_ptr<google::protobuf::Message> message;                   /**< The parsed protobuf message (nullptr when status != kOk or not decoded yet) */
+    ReaderTopLevelMessage message_type = ReaderTopLevelMessage::kUnknown; /**< Type of the message */
+    std::string channel_name;                                             /**< Channel name (only for MCAP format) */
+    uint64_t log_time = 0;                                                /**< Log time in nanoseconds (MCAP log time or the message timestamp; 0 for .txth) */
+    ReadStatus status = ReadStatus::kOk;                                  /**< Status of the read operation */
+    std::string error_message;                                            /**< Error description (empty when status == kOk) */
+    std::string serialized_message;                                       /**< Serialized message bytes (only in lazy decoding mode, kept after decoding) */
+
+    /**
+     * @brief Gets the message, parsing it from serialized_message on first access
+     *
+     * Results of eagerly decoding readers are returned as they are.
+     *
+     * @return The message, or nullptr if status != kOk (also if parsing fails, which sets status to kError)
+     */
+    const google::protobuf::Message* Decode();
+
+    /**
+     * @brief Gets the message as a specific type, parsing it on first access
+     * @tparam T Protobuf message type, e.g. osi3::GroundTruth
+     * @return The message, or nullptr if it is not of type T or cannot be decoded
+     */
+    template <typename T>
+    const T* DecodeAs() {
+        return dynamic_cast<const T*>(Decode());
+    }
+
+    /**
+     * @brief Checks whether the message has been parsed
+     * @return true if message is populated
+     */
+    bool IsDecoded() const { return message != nullptr; }
+};
+
+/**
+ * @brief Structure containing the result of a raw (undecoded) read operation
+ *
+ * Holds a view on the serialized protobuf bytes of a single message instead of a
+ * parsed message. The data pointer refers to memory owned by the reader and stays
+ * valid only until the next call to HasNext(), a read method or Close() on the same reader.
+ *
+ * For successful reads, status is kOk and data/size describe the message bytes.
+ * For incompatible messages (e.g. non-OSI in MCAP), status is kIncompatible and
+ * data is nullptr.
+ */
+struct RawReadResult {
+    const char* data = nullptr;                                           /**< Serialized message bytes (nullptr when status != kOk) */
+    size_t size = 0;                                                      /**< Number of serialized message bytes */
     ReaderTopLevelMessage message_type = ReaderTopLevelMessage::kUnknown; /**< Type of the message */
     std::string channel_name;                                             /**< Channel name (only for MCAP format) */
+    uint64_t log_time = 0;                                                /**< Log time in nanoseconds (MCAP log time or the message timestamp) */
     ReadStatus status = ReadStatus::kOk;                                  /**< Status of the read operation */
     std::string error_message;                                            /**< Error description (empty when status == kOk) */
 };
@@ -133,6 +189,18 @@ class TraceFileReader {
      */
     virtual std::optional<ReadResult> ReadMessage() = 0;
 
+    /**
+     * @brief Reads the next message from the trace file without deserializing it
+     *
+     * Binary (.osi) and MCAP readers override this with a zero-copy path that hands out
+     * the bytes straight from their internal read buffers. The default implementation
+     * reads a decoded message via ReadMessage() and serializes it again, so it works for
+     * any reader but has no performance benefit.
+     *
+     * @return Optional RawReadResult describing the message bytes if available
+     */
+    virtual std::optional<RawReadResult> ReadRawMessage();
+
     /**
      * @brief Closes the trace file
      */
@@ -148,6 +216,40 @@ class TraceFileReader {
      * @return true if there are more messages to read, false otherwise
      */
     virtual bool HasNext() = 0;
+
+    /**
+     * @brief Selects the I/O engine used by the next Open()
+     *
+     * The binary (.osi) and MCAP readers support the asynchronous backends of
+     * tracefile::IoBackend; other readers ignore the options.
+     *
+     * @param options I/O options
+     */
+    virtual void SetIoOptions(const tracefile::IoOptions& options) { (void)options; }
+
+    /**
+     * @brief Enables lazy decoding of the results of ReadMessage()
+     *
+     * The results hold a copy of the serialized bytes instead of a parsed message, see
+     * ReadResult::Decode(). The binary (.osi) and MCAP readers support lazy decoding; the
+     * .txth reader has to parse the text format anyway and ignores the setting.
+     *
+     * @param enabled Whether to defer parsing until the message is accessed
+     */
+    void SetLazyDecoding(const bool enabled) { lazy_decoding_ = enabled; }
+
+   protected:
+    /**
+     * @brief Creates the lazily decoded result of a raw read
+     * @param raw_result Raw read result; its bytes are copied
+     * @return Result holding the serialized bytes
+     */
+    static ReadResult MakeLazyResult(const RawReadResult& raw_result);
+
+    bool lazy_decoding_ = false; /**< Whether ReadMessage() defers parsing, see SetLazyDecoding() */
+
+   private:
+    std::string raw_message_buffer_; /**< Serialization buffer of the default ReadRawMessage() implementation */
 };
 
 /**
@@ -165,10 +267,23 @@ class TraceFileReaderFactory {
      * - .osi: Single channel binary format (SingleChannelBinaryTraceFileReader)
      * - .txth: Single channel human-readable format (TXTHTraceFileReader)
      * - .mcap: Multi channel binary format (MCAPTraceFileReader)
+     * - .manifest: Trace file stored in a chunk store (ChunkStoreTraceFileReader)
      *
      * @note It is still required to call Open(path) on the returned reader instance
      */
     static std::unique_ptr<TraceFileReader> createReader(const std::filesystem::path& file_path);
+
+    /**
+     * @brief Creates a reader instance based on the file extension and opens the file
+     * @param file_path Path to the trace file
+     * @param message_type Message type of single-channel files; kUnknown infers it from the filename
+     * @param io_options I/O options applied before opening (see TraceFileReader::SetIoOptions())
+     * @return Unique pointer to an opened TraceFileReader instance
+     * @throws std::invalid_argument if the file extension is not supported
+     * @throws std::runtime_error if the file cannot be opened
+     */
+    static std::unique_ptr<TraceFileReader> openReader(const std::filesystem::path& file_path, ReaderTopLevelMessage message_type = ReaderTopLevelMessage::kUnknown,
+                                                       const tracefile::IoOptions& io_options = {});
 };
 
 }  // namespace osi3
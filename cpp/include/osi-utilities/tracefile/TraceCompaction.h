@@ -0,0 +1,137 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_TRACECOMPACTION_H_
+#define OSIUTILITIES_TRACEFILE_TRACECOMPACTION_H_
+
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "osi-utilities/tracefile/Reader.h"
+
+namespace osi3 {
+namespace tracefile {
+
+/**
+ * @brief Options for compacting trace messages.
+ */
+struct CompactionOptions {
+    /**
+     * @brief Fields removed wherever they occur
+     *
+     * Either a field name, e.g. "model_reference" or "source_reference", which matches the
+     * field in all message types, or a full field name, e.g. "osi3.MovingObject.model_reference".
+     */
+    std::vector<std::string> removed_fields;
+    double lane_boundary_range = 0.0;                                     /**< Remove lane boundary points farther than this from the host vehicle in meters (0: keep all) */
+    bool remove_unknown_fields = true;                                    /**< Remove fields unknown to the compiled OSI version */
+    bool remove_default_values = true;                                    /**< Clear fields that are explicitly set to their default value */
+    ReaderTopLevelMessage message_type = ReaderTopLevelMessage::kUnknown; /**< Message type of single-channel input files (kUnknown: infer from filename) */
+};
+
+/**
+ * @brief Result of compacting a trace file.
+ */
+struct CompactionReport {
+    size_t frame_count = 0;    /**< Number of compacted frames */
+    uint64_t input_bytes = 0;  /**< Size of all input frames as stored (re-serialized for .txth input) */
+    uint64_t output_bytes = 0; /**< Serialized size of all output frames */
+};
+
+/**
+ * @brief Compacts messages with fixed options
+ *
+ * The options are prepared once on construction, so a compactor is meant to be kept
+ * and reused for all frames of a channel or file.
+ *
+ * @note Thread Safety: Compact() may be called concurrently on the same instance.
+ */
+class MessageCompactor {
+   public:
+    /**
+     * @brief Creates a compactor
+     * @param options Compaction options
+     */
+    explicit MessageCompactor(CompactionOptions options);
+
+    /**
+     * @brief Removes the configured fields, unknown fields and default values from a message
+     *
+     * Lane boundary points are trimmed relative to the host vehicle of every GroundTruth in
+     * the message, e.g. also of SensorView::global_ground_truth. A GroundTruth without host
+     * vehicle keeps all its points.
+     *
+     * @param message The message to compact in place
+     */
+    void Compact(google::protobuf::Message& message) const;
+
+    /** @brief Gets the compaction options */
+    const CompactionOptions& GetOptions() const { return options_; }
+
+   private:
+    /** @brief Compacts the fields of a message and its sub-messages */
+    void CompactFields(google::protobuf::Message& message) const;
+
+    /** @brief Checks whether a field is configured to be removed */
+    bool IsRemoved(const google::protobuf::FieldDescriptor& field) const;
+
+    CompactionOptions options_;                      /**< Compaction options */
+    std::unordered_set<std::string> removed_fields_; /**< Names of the removed fields, for lookup */
+};
+
+/**
+ * @brief Removes the configured fields, unknown fields and default values from a message
+ *
+ * Convenience function for a single message, see MessageCompactor::Compact(). To compact
+ * many messages with the same options, create a MessageCompactor once instead.
+ *
+ * @param message The message to compact in place
+ * @param options Compaction options
+ */
+void CompactMessage(google::protobuf::Message& message, const CompactionOptions& options);
+
+/**
+ * @brief Serializes a message deterministically
+ *
+ * Fields are written in field number order and map entries sorted by key, so equal
+ * messages always produce equal bytes, which keeps block-level deduplication effective.
+ *
+ * @param message The message to serialize
+ * @param buffer Receives the serialized bytes
+ * @return true if successful, false otherwise
+ */
+bool SerializeCanonical(const google::protobuf::Message& message, std::string& buffer);
+
+/**
+ * @brief Compacts all frames of a trace file into a new trace file
+ *
+ * Every OSI frame is compacted with CompactMessage() and written in canonical encoding.
+ * Input and output format follow the file extensions. For MCAP to MCAP, channels and
+ * file metadata are kept, except for trace statistics, which are collected for the
+ * compacted frames instead.
+ *
+ * The frames are written to a temporary file next to output_path, which is renamed to
+ * output_path only after the file was finished successfully, so a failed compaction
+ * never leaves a truncated output behind.
+ *
+ * @param input_path Trace file to compact
+ * @param output_path Trace file to create
+ * @param options Compaction options
+ * @return Sizes of the input and output frames
+ * @throws std::runtime_error if a file cannot be opened, a frame cannot be read or written or the output cannot be finished
+ */
+CompactionReport CompactTraceFile(const std::filesystem::path& input_path, const std::filesystem::path& output_path, const CompactionOptions& options = {});
+
+}  // namespace tracefile
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_TRACECOMPACTION_H_
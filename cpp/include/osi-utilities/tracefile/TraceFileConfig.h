@@ -54,6 +54,124 @@ constexpr uint64_t kMinChunkSize = 1024 * 1024;  // 1,048,576 bytes = 1 MiB
  */
 constexpr uint64_t kMaxChunkSize = 32 * 1024 * 1024;  // 33,554,432 bytes = 32 MiB
 
+/**
+ * @brief Default capacity up to which the MCAP serialization buffer is kept between messages (16 MiB).
+ *
+ * A larger buffer, e.g. after a camera frame, is released after the message was written,
+ * so the writer does not keep the memory of its largest message for its whole lifetime.
+ */
+constexpr size_t kDefaultRetainedBufferLimit = 16 * 1024 * 1024;  // 16,777,216 bytes = 16 MiB
+
+// ============================================================================
+// Block I/O Configuration
+// ============================================================================
+
+/**
+ * @brief Default size of the blocks read or written by the asynchronous I/O backends (4 MiB).
+ *
+ * Large enough that NVMe devices reach their sequential bandwidth with a few
+ * requests in flight, small enough to keep the buffer memory per file low.
+ */
+constexpr size_t kDefaultIoBlockSize = 4 * 1024 * 1024;  // 4,194,304 bytes = 4 MiB
+
+/** @brief Default number of blocks in flight per file for the asynchronous I/O backends. */
+constexpr size_t kDefaultIoQueueDepth = 4;
+
+/**
+ * @brief Alignment of the block buffers of the asynchronous I/O backends in bytes.
+ *
+ * Page-aligned buffers let the kernel transfer whole pages without realignment.
+ */
+constexpr size_t kIoBufferAlignment = 4096;
+
+// ============================================================================
+// Real-Time Recording Configuration
+// ============================================================================
+
+/**
+ * @brief Default size of the frame buffer of the real-time writer (64 MiB).
+ *
+ * Holds about one second of a large SensorView stream, enough to ride out
+ * a slow chunk compression or device stall without dropping frames.
+ */
+constexpr size_t kDefaultRealtimeBufferSize = 64 * 1024 * 1024;  // 67,108,864 bytes = 64 MiB
+
+/** @brief Default maximum number of topics of the real-time writer. */
+constexpr size_t kDefaultRealtimeMaxTopics = 64;
+
+// ============================================================================
+// MCAP Checkpoint Configuration
+// ============================================================================
+
+/**
+ * @brief Suffix of the checkpoint journal next to an MCAP trace file.
+ *
+ * The journal of "trace.mcap" is "trace.mcap.journal". It only exists while
+ * the file is written with checkpoints, or after the recording was interrupted.
+ */
+constexpr auto kCheckpointJournalSuffix = ".journal";
+
+// ============================================================================
+// MCAP Attachment Configuration
+// ============================================================================
+
+/**
+ * @brief Media type prefix of attachments holding a serialized protobuf message.
+ *
+ * The full name of the message type follows the prefix, e.g.
+ * "application/protobuf; proto=osi3.SensorViewConfiguration".
+ */
+constexpr auto kProtobufAttachmentMediaTypePrefix = "application/protobuf; proto=";
+
+/**
+ * @brief Media type of attachments holding payloads offloaded from messages.
+ *
+ * See tracefile::OffloadPayloads(). The attachment data is a batch of payload records of
+ * one channel, see tracefile::AppendPayloadRecord().
+ */
+constexpr auto kPayloadAttachmentMediaType = "application/x-osi-payload";
+
+/** @brief Name prefix of payload batch attachments, see tracefile::GetPayloadAttachmentName(). */
+constexpr auto kPayloadAttachmentNamePrefix = "osi-payload:";
+
+// ============================================================================
+// Chunk Store Configuration
+// ============================================================================
+
+/**
+ * @brief Extension appended to the name of a trace file stored in a chunk store.
+ *
+ * The manifest of "sweep_042_gt_.osi" is "sweep_042_gt_.osi.manifest", so the name of
+ * the original file, and with it the message type of .osi files, can be restored.
+ */
+constexpr auto kChunkManifestExtension = ".manifest";
+
+/** @brief First line of a chunk store manifest, naming the manifest format and its version. */
+constexpr auto kChunkManifestHeader = "osi-chunk-manifest 1";
+
+/**
+ * @brief Default average number of .osi frames per chunk store block.
+ *
+ * Must be a power of two. Smaller blocks find more duplicates in traces that diverge
+ * and converge again, at the cost of more block files.
+ */
+constexpr size_t kDefaultAverageBlockFrames = 64;
+
+// ============================================================================
+// Frame Cache Configuration
+// ============================================================================
+
+/**
+ * @brief Default memory budget of a frame cache.
+ *
+ * A GroundTruth frame of a busy highway scene with road network takes a few MiB when
+ * decoded, so the default holds some hundred frames.
+ */
+constexpr size_t kDefaultFrameCacheMemoryBudget = 512 * 1024 * 1024;  // 536,870,912 bytes = 512 MiB
+
+/** @brief Default number of frames a frame cache loads ahead in the scrub direction. */
+constexpr size_t kDefaultFramePrefetchCount = 8;
+
 // ============================================================================
 // Time Constants
 // ============================================================================
@@ -81,6 +199,21 @@ constexpr size_t kBinaryOsiMessageLengthPrefixSize = sizeof(uint32_t);
  */
 constexpr size_t kMaxExpectedMessageSize = 512 * 1024 * 1024;  // 512 MiB
 
+/**
+ * @brief Size of the chunks a message is parsed in by the streaming parse mode of the binary reader (64 KiB).
+ *
+ * Bounds the read buffer of a reader independently of the message size.
+ */
+constexpr size_t kStreamingParseChunkSize = 64 * 1024;  // 65,536 bytes = 64 KiB
+
+/**
+ * @brief Size of the chunks the binary writer serializes messages in (64 KiB).
+ *
+ * Messages are serialized straight into the output file through a buffer of this size,
+ * so writing does not need a copy of the whole serialized message.
+ */
+constexpr size_t kStreamingSerializeChunkSize = 64 * 1024;  // 65,536 bytes = 64 KiB
+
 // ============================================================================
 // TXTH Format Constants
 // ============================================================================
@@ -95,6 +228,9 @@ constexpr size_t kTxthReadBufferReserveSize = 4096;
 /** @brief Name of the OSI trace file-level metadata record. */
 constexpr auto kOsiTraceMetadataName = "net.asam.osi.trace";
 
+/** @brief Name of the metadata records holding the statistics of a channel, see tracefile::ToMetadata(). */
+constexpr auto kOsiTraceStatisticsMetadataName = "net.asam.osi.trace.statistics";
+
 /** @brief Required file-level metadata keys for net.asam.osi.trace. */
 constexpr std::array<const char*, 5> kOsiTraceRequiredMetadataKeys = {
     "version", "min_osi_version", "max_osi_version", "min_protobuf_version", "max_protobuf_version",
@@ -116,6 +252,24 @@ constexpr std::array<const char*, 1> kOsiChannelRecommendedMetadataKeys = {
     "net.asam.osi.trace.channel.description",
 };
 
+/** @brief Channel metadata key of the linear quantization step in meters, set if positions were quantized. */
+constexpr auto kOsiChannelQuantizationLinearStepKey = "net.asam.osi.trace.channel.quantization.linear_step";
+
+/** @brief Channel metadata key of the angular quantization step in radians, set if orientations were quantized. */
+constexpr auto kOsiChannelQuantizationAngularStepKey = "net.asam.osi.trace.channel.quantization.angular_step";
+
+/** @brief Channel metadata key of the comma-separated field paths whose payloads were offloaded to attachments. */
+constexpr auto kOsiChannelOffloadedFieldsKey = "net.asam.osi.trace.channel.offloaded_fields";
+
+/** @brief Channel metadata key of the topic a preview channel is derived from. */
+constexpr auto kOsiChannelPreviewSourceKey = "net.asam.osi.trace.channel.preview.source_topic";
+
+/** @brief Channel metadata key of the minimum log time between the frames of a preview channel in nanoseconds. */
+constexpr auto kOsiChannelPreviewIntervalKey = "net.asam.osi.trace.channel.preview.interval";
+
+/** @brief Suffix of the default topic of a preview channel, appended to its source topic. */
+constexpr auto kPreviewTopicSuffix = "/preview";
+
 }  // namespace config
 }  // namespace tracefile
 }  // namespace osi3
@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_TRACEFILEDIFF_H_
+#define OSIUTILITIES_TRACEFILE_TRACEFILEDIFF_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "osi-utilities/tracefile/FrameFingerprint.h"
+#include "osi-utilities/tracefile/Reader.h"
+
+namespace osi3 {
+namespace tracefile {
+
+/**
+ * @brief Options for comparing two trace files.
+ */
+struct TraceDiffOptions {
+    FingerprintMode mode = FingerprintMode::kRawBytes;                    /**< Input the frame hashes are computed over */
+    bool field_diff = false;                                              /**< Produce a field-level diff for differing frames */
+    size_t max_field_diffs = 10;                                          /**< Maximum number of differing frames that get a field-level diff */
+    ReaderTopLevelMessage message_type = ReaderTopLevelMessage::kUnknown; /**< Message type of single-channel files (kUnknown: infer from filename) */
+};
+
+/**
+ * @brief Comparison result of a single frame.
+ */
+enum class FrameDiffStatus : uint8_t {
+    kIdentical = 0, /**< Frame exists in both traces with equal hashes */
+    kDiffering = 1, /**< Frame exists in both traces but the hashes differ */
+    kMissing = 2,   /**< Frame exists only in the reference trace */
+    kExtra = 3,     /**< Frame exists only in the candidate trace */
+};
+
+/**
+ * @brief A single non-identical frame of a trace comparison.
+ */
+struct FrameDiffEntry {
+    FrameDiffStatus status = FrameDiffStatus::kIdentical; /**< Comparison result */
+    std::string channel_name;                             /**< Channel name (empty for single-channel formats) */
+    uint64_t log_time = 0;                                /**< Log time in nanoseconds */
+    size_t reference_index = 0;                           /**< Frame index in the reference trace (not set for kExtra) */
+    size_t candidate_index = 0;                           /**< Frame index in the candidate trace (not set for kMissing) */
+    std::string field_diff;                               /**< Field-level differences, only set for kDiffering if requested */
+};
+
+/**
+ * @brief Result of comparing two trace files.
+ */
+struct TraceDiffReport {
+    size_t identical_count = 0;         /**< Number of identical frames */
+    size_t differing_count = 0;         /**< Number of differing frames */
+    size_t missing_count = 0;           /**< Number of frames only in the reference trace */
+    size_t extra_count = 0;             /**< Number of frames only in the candidate trace */
+    std::vector<FrameDiffEntry> entries; /**< All non-identical frames, ordered by log time */
+
+    /**
+     * @brief Checks whether both traces contain the same frames
+     * @return true if no frame differs, is missing or is extra
+     */
+    bool IsIdentical() const { return differing_count == 0 && missing_count == 0 && extra_count == 0; }
+};
+
+/**
+ * @brief Compare two lists of frame fingerprints.
+ *
+ * Frames are aligned by channel name and log time. Several frames with the same channel
+ * and log time are matched in the order they appear in each trace.
+ *
+ * @param reference Fingerprints of the reference trace
+ * @param candidate Fingerprints of the candidate trace
+ * @return Comparison report without field-level diffs
+ */
+TraceDiffReport DiffFingerprints(const std::vector<FrameFingerprint>& reference, const std::vector<FrameFingerprint>& candidate);
+
+/**
+ * @brief Compare two trace files frame by frame.
+ *
+ * Both traces are fingerprinted without deserializing (see ComputeTraceFingerprints()).
+ * If a field-level diff is requested, only the differing frames are parsed, in a second
+ * pass over both files.
+ *
+ * @param reference_path Path to the reference trace file
+ * @param candidate_path Path to the candidate trace file
+ * @param options Comparison options
+ * @return Comparison report
+ * @throws std::invalid_argument if a file extension is not supported
+ * @throws std::runtime_error if a file cannot be opened or read
+ */
+TraceDiffReport DiffTraces(const std::filesystem::path& reference_path, const std::filesystem::path& candidate_path, const TraceDiffOptions& options = {});
+
+}  // namespace tracefile
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_TRACEFILEDIFF_H_
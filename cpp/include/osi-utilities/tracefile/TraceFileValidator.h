@@ -0,0 +1,113 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_TRACEFILEVALIDATOR_H_
+#define OSIUTILITIES_TRACEFILE_TRACEFILEVALIDATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "osi-utilities/tracefile/Reader.h"
+
+namespace osi3 {
+namespace tracefile {
+
+/**
+ * @brief Severity of a validation issue.
+ */
+enum class ValidationSeverity : uint8_t {
+    kWarning = 0, /**< Recommendation of the trace file specification is not met */
+    kError = 1,   /**< Requirement of the trace file specification is violated */
+};
+
+/**
+ * @brief Names of the checks performed by ValidateTraceFile().
+ *
+ * Used as the `check` identifier of a ValidationIssue, so report consumers can filter
+ * on stable strings.
+ */
+namespace validation_check {
+constexpr auto kRead = "read";                              /**< File could not be opened or read to the end */
+constexpr auto kFileMetadata = "file_metadata";             /**< net.asam.osi.trace metadata record and keys (MCAP only) */
+constexpr auto kChannelMetadata = "channel_metadata";       /**< OSI channel metadata keys (MCAP only) */
+constexpr auto kTimestampMonotonic = "timestamp_monotonic"; /**< Log times must not decrease within a channel */
+constexpr auto kMessageParse = "message_parse";             /**< Every frame must deserialize into its message type */
+constexpr auto kMessageTimestamp = "message_timestamp";     /**< Every frame should carry a timestamp matching its log time */
+constexpr auto kFilenameConvention = "filename_convention"; /**< Filename should follow the OSI naming convention and match the content */
+}  // namespace validation_check
+
+/**
+ * @brief A single finding of the validation.
+ */
+struct ValidationIssue {
+    ValidationSeverity severity = ValidationSeverity::kError; /**< Severity of the issue */
+    std::string check;                                         /**< Check identifier, see validation_check */
+    std::string message;                                       /**< Human-readable description */
+    std::string channel_name;                                  /**< Affected channel (empty if not channel-specific) */
+    std::optional<size_t> frame_index;                         /**< Affected frame, counting OSI frames only (empty if not frame-specific) */
+};
+
+/**
+ * @brief Options for ValidateTraceFile().
+ */
+struct ValidationOptions {
+    size_t worker_count = 0;                                              /**< Number of per-frame worker threads (0: hardware concurrency) */
+    size_t batch_size = 64;                                               /**< Number of frames handed to a worker at once */
+    size_t max_issues_per_check = 100;                                    /**< Maximum number of reported issues per check, the rest is only counted */
+    bool check_recommended = true;                                        /**< Report missing recommended metadata keys as warnings */
+    ReaderTopLevelMessage message_type = ReaderTopLevelMessage::kUnknown; /**< Message type of single-channel files (kUnknown: infer from filename) */
+    tracefile::IoOptions io;                                              /**< I/O engine of the trace file reader */
+};
+
+/**
+ * @brief Result of validating a trace file.
+ */
+struct ValidationReport {
+    std::string file_path;               /**< Validated file */
+    size_t frame_count = 0;              /**< Number of OSI frames read */
+    size_t error_count = 0;              /**< Number of errors, including suppressed ones */
+    size_t warning_count = 0;            /**< Number of warnings, including suppressed ones */
+    size_t suppressed_issue_count = 0;   /**< Number of issues dropped due to ValidationOptions::max_issues_per_check */
+    std::vector<ValidationIssue> issues; /**< Reported issues, file-level issues first, then ordered by frame */
+
+    /**
+     * @brief Checks whether the trace file passed validation
+     * @return true if no errors were found (warnings are allowed)
+     */
+    bool IsValid() const { return error_count == 0; }
+
+    /**
+     * @brief Serializes the report as JSON
+     * @return JSON document with summary counters and the list of issues
+     */
+    std::string ToJson() const;
+};
+
+/**
+ * @brief Validate a trace file against the OSI trace file specification in a single streaming pass.
+ *
+ * The file is read sequentially through TraceFileReader::ReadRawMessage(). File-level
+ * checks (metadata, filename, timestamp order) run on the reading thread, while the
+ * per-frame checks (deserialization, timestamp presence) are distributed in batches
+ * over a pool of worker threads. Memory use is bounded by a fixed number of batches
+ * in flight.
+ *
+ * Failures are reported as issues, not as exceptions: a file that cannot be opened
+ * yields a report with a single kRead error.
+ *
+ * @param file_path Path to the trace file (.osi, .mcap or .txth)
+ * @param options Validation options
+ * @return Validation report
+ */
+ValidationReport ValidateTraceFile(const std::filesystem::path& file_path, const ValidationOptions& options = {});
+
+}  // namespace tracefile
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_TRACEFILEVALIDATOR_H_
@@ -0,0 +1,100 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_TRACESLICING_H_
+#define OSIUTILITIES_TRACEFILE_TRACESLICING_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <vector>
+
+#include "osi-utilities/tracefile/Reader.h"
+
+namespace osi3 {
+namespace tracefile {
+
+/**
+ * @brief Part of a trace selected for slicing.
+ *
+ * Both a time window and a frame range can be given; a frame is selected if it is
+ * inside both. Frames are counted from 0 in log time order; for MCAP files all
+ * messages count as frames, including non-OSI messages.
+ */
+struct SliceRange {
+    uint64_t start_time = 0;                                  /**< First selected log time in nanoseconds (inclusive) */
+    uint64_t end_time = std::numeric_limits<uint64_t>::max(); /**< End of the selected log times in nanoseconds (exclusive) */
+    size_t first_frame = 0;                                   /**< First selected frame (inclusive) */
+    size_t end_frame = std::numeric_limits<size_t>::max();    /**< End of the selected frames (exclusive) */
+};
+
+/**
+ * @brief Options for slicing and splitting trace files.
+ */
+struct SliceOptions {
+    ReaderTopLevelMessage message_type = ReaderTopLevelMessage::kUnknown; /**< Message type of .osi files (kUnknown: infer from filename) */
+    bool copy_attachments = true;                                         /**< Copy the attachments of MCAP files into every output file */
+};
+
+/**
+ * @brief Copies the selected part of a trace file into a new trace file
+ *
+ * Frames are copied as serialized bytes and never deserialized. For .osi files, the
+ * frame offsets are collected from the length prefixes without reading the frames,
+ * the start of a time window is found by binary search (timestamps must not decrease),
+ * and the selected range is copied as one byte range. For MCAP files, the chunk index
+ * is used to seek to the first selected chunk; schemas, channels, file metadata and
+ * (optionally) attachments are kept, except for trace statistics, which are collected
+ * for the slice instead.
+ *
+ * @param input_path Trace file to slice (.osi or .mcap)
+ * @param output_path Trace file to create, in the format of the input
+ * @param range Selected part of the trace
+ * @param options Slice options
+ * @return Number of copied frames
+ * @throws std::invalid_argument if the format is not supported or input and output formats differ
+ * @throws std::runtime_error if a file cannot be read or written
+ */
+size_t SliceTraceFile(const std::filesystem::path& input_path, const std::filesystem::path& output_path, const SliceRange& range, const SliceOptions& options = {});
+
+/**
+ * @brief Splits a trace file into parts with equal numbers of frames
+ *
+ * The parts are named after the input file with "_part<i>" appended to the stem, so the
+ * message type of .osi files can still be inferred from the filename.
+ *
+ * @param input_path Trace file to split (.osi or .mcap)
+ * @param output_directory Directory the parts are written to
+ * @param part_count Number of parts
+ * @param options Slice options
+ * @return Paths of the written parts, in order
+ * @throws std::invalid_argument if the format is not supported or part_count is 0
+ * @throws std::runtime_error if a file cannot be read or written
+ */
+std::vector<std::filesystem::path> SplitTraceFile(const std::filesystem::path& input_path, const std::filesystem::path& output_directory, size_t part_count,
+                                                  const SliceOptions& options = {});
+
+/**
+ * @brief Splits an MCAP trace file into one file per topic in a single pass
+ *
+ * The files are named after the input file with "_<topic>" appended to the stem; characters
+ * of the topic that are not alphanumeric are replaced by '_'. If several topics map to the same
+ * name (e.g. "a/b" and "a.b"), the topics seen later get "_2", "_3", ... appended in the order
+ * their first messages appear.
+ *
+ * @param input_path MCAP trace file to split
+ * @param output_directory Directory the files are written to
+ * @param options Slice options
+ * @return Paths of the written files, ordered by topic
+ * @throws std::invalid_argument if the input is not an MCAP file
+ * @throws std::runtime_error if a file cannot be read or written
+ */
+std::vector<std::filesystem::path> SplitTraceFileByTopic(const std::filesystem::path& input_path, const std::filesystem::path& output_directory, const SliceOptions& options = {});
+
+}  // namespace tracefile
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_TRACESLICING_H_
@@ -0,0 +1,118 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_TRACESTATISTICS_H_
+#define OSIUTILITIES_TRACEFILE_TRACESTATISTICS_H_
+
+#include <google/protobuf/descriptor.h>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace osi3 {
+namespace tracefile {
+
+/**
+ * @brief Aggregates of the messages of one channel
+ *
+ * Frame sizes are the serialized sizes as stored in the trace file. The object and host
+ * speed aggregates are only collected for GroundTruth channels; the host speed is the
+ * norm of base.velocity of the moving object with the id host_vehicle_id.
+ */
+struct ChannelStatistics {
+    std::string topic;                                            /**< Topic of the channel */
+    std::string message_type;                                     /**< Full name of the message type, e.g. "osi3.GroundTruth" */
+    uint64_t message_count = 0;                                   /**< Number of messages */
+    uint64_t min_log_time = std::numeric_limits<uint64_t>::max(); /**< Earliest log time in nanoseconds */
+    uint64_t max_log_time = 0;                                    /**< Latest log time in nanoseconds */
+    uint64_t total_size = 0;                                      /**< Sum of the frame sizes in bytes */
+    uint64_t min_size = std::numeric_limits<uint64_t>::max();     /**< Smallest frame size in bytes */
+    uint64_t max_size = 0;                                        /**< Largest frame size in bytes */
+
+    /** @brief Frame counts by size, bucket i counts sizes in [2^i, 2^(i+1)), bucket 0 also empty frames */
+    std::array<uint64_t, 64> size_histogram{};
+
+    uint64_t object_count_frames = 0;                                 /**< Number of frames the object counts were taken from */
+    uint64_t min_object_count = std::numeric_limits<uint64_t>::max(); /**< Fewest moving objects in a frame */
+    uint64_t max_object_count = 0;                                    /**< Most moving objects in a frame */
+    uint64_t host_speed_count = 0;                                    /**< Number of frames with a host vehicle */
+    double min_host_speed = std::numeric_limits<double>::infinity();  /**< Lowest host speed in m/s */
+    double max_host_speed = 0.0;                                      /**< Highest host speed in m/s */
+    double host_speed_sum = 0.0;                                      /**< Sum of the host speeds in m/s, for the mean */
+
+    /** @brief Mean host speed in m/s, 0 without host vehicle */
+    double MeanHostSpeed() const { return host_speed_count > 0 ? host_speed_sum / static_cast<double>(host_speed_count) : 0.0; }
+};
+
+/**
+ * @brief Streaming statistics of the messages written to a trace file
+ *
+ * Each message is scanned once in its serialized form while it is written, without parsing
+ * it. The statistics are small and are stored in the trace file (see ToMetadata()), so
+ * catalog tools can, e.g., find drives exceeding a speed from the summary alone.
+ */
+class TraceStatistics {
+   public:
+    /**
+     * @brief Registers a channel, messages of unregistered topics are ignored
+     * @param topic Topic of the channel
+     * @param descriptor Message type of the channel
+     */
+    void AddChannel(const std::string& topic, const google::protobuf::Descriptor* descriptor);
+
+    /**
+     * @brief Adds a message to the statistics of its channel
+     * @param topic Topic of the message
+     * @param log_time Log time of the message in nanoseconds
+     * @param serialized Serialized message as written to the file
+     */
+    void Observe(const std::string& topic, uint64_t log_time, std::string_view serialized);
+
+    /** @brief Gets the statistics of the registered channels, in registration order */
+    const std::vector<ChannelStatistics>& GetChannels() const { return channels_; }
+
+   private:
+    /** @brief Registered channel */
+    struct ChannelEntry {
+        size_t index = 0;          /**< Index into channels_ */
+        bool ground_truth = false; /**< Whether the channel holds GroundTruth messages */
+    };
+
+    std::vector<ChannelStatistics> channels_;                     /**< Statistics by channel */
+    std::unordered_map<std::string, ChannelEntry> channel_index_; /**< Registered channels by topic */
+};
+
+/**
+ * @brief Converts the statistics of a channel to the entries of a metadata record
+ *
+ * The record is named config::kOsiTraceStatisticsMetadataName; a trace file holds one per
+ * channel. Keys are "topic", "message_type", "message_count", "min_log_time",
+ * "max_log_time", "total_size", "min_size", "max_size" and "size_histogram" (non-empty
+ * buckets as comma-separated "lower_bound:count" pairs), and for GroundTruth channels
+ * "min_object_count" and "max_object_count" as well as "host_speed_frames",
+ * "min_host_speed", "max_host_speed" and "mean_host_speed" (in m/s) if collected.
+ *
+ * @param statistics Statistics of the channel
+ * @return Metadata entries
+ */
+std::unordered_map<std::string, std::string> ToMetadata(const ChannelStatistics& statistics);
+
+/**
+ * @brief Restores the statistics of a channel from the entries of a metadata record
+ * @param metadata Entries of a config::kOsiTraceStatisticsMetadataName record, e.g. from MCAPTraceFileReader::GetFileMetadata()
+ * @return The statistics, std::nullopt if the entries are incomplete or malformed
+ */
+std::optional<ChannelStatistics> ParseStatisticsMetadata(const std::unordered_map<std::string, std::string>& metadata);
+
+}  // namespace tracefile
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_TRACESTATISTICS_H_
@@ -0,0 +1,330 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_WIREFORMATUTILS_H_
+#define OSIUTILITIES_TRACEFILE_WIREFORMATUTILS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "osi-utilities/tracefile/TraceFileConfig.h"
+
+namespace osi3 {
+namespace tracefile {
+
+/**
+ * @brief Protobuf wire types as defined by the protobuf encoding specification.
+ */
+enum class WireType : uint8_t {
+    kVarint = 0,          /**< int32, int64, uint32, uint64, sint32, sint64, bool, enum */
+    kFixed64 = 1,         /**< fixed64, sfixed64, double */
+    kLengthDelimited = 2, /**< string, bytes, embedded messages, packed repeated fields */
+    kStartGroup = 3,      /**< deprecated group start (not used by OSI) */
+    kEndGroup = 4,        /**< deprecated group end (not used by OSI) */
+    kFixed32 = 5,         /**< fixed32, sfixed32, float */
+};
+
+/**
+ * @brief A single field of a serialized protobuf message, as seen on the wire.
+ */
+struct WireField {
+    uint32_t number = 0;                /**< Field number */
+    WireType type = WireType::kVarint;  /**< Wire type of the field */
+    uint64_t value = 0;                 /**< Decoded varint or raw fixed32/fixed64 bits */
+    std::string_view payload;           /**< Payload bytes of length-delimited fields */
+    size_t begin = 0;                   /**< Offset of the field tag within the scanned buffer */
+    size_t end = 0;                     /**< Offset one past the last byte of the field */
+};
+
+/**
+ * @brief Forward-only scanner over the top-level fields of a serialized protobuf message.
+ *
+ * Decodes tags, varints and length prefixes without constructing any protobuf message
+ * objects. Nested messages are exposed as length-delimited payloads and can be scanned
+ * with another WireFieldReader. Groups are not supported (OSI does not use them) and
+ * are reported as malformed input.
+ *
+ * Example usage:
+ * @code
+ * osi3::tracefile::WireFieldReader reader(serialized_ground_truth);
+ * osi3::tracefile::WireField field;
+ * while (reader.Next(field)) {
+ *     if (field.number == 5 && field.type == osi3::tracefile::WireType::kLengthDelimited) {
+ *         // field.payload holds one serialized moving object
+ *     }
+ * }
+ * if (reader.HasError()) { ... }
+ * @endcode
+ */
+class WireFieldReader {
+   public:
+    /**
+     * @brief Creates a scanner over a serialized message
+     * @param buffer Serialized message bytes (must outlive the scanner and all returned payloads)
+     */
+    explicit WireFieldReader(const std::string_view buffer) : buffer_(buffer) {}
+
+    /**
+     * @brief Decodes the next field
+     * @param field Output field, only valid if true is returned
+     * @return true if a field was decoded, false at the end of the buffer or on malformed input
+     */
+    bool Next(WireField& field) {
+        if (position_ >= buffer_.size() || error_) {
+            return false;
+        }
+        field.begin = position_;
+        uint64_t tag = 0;
+        if (!ReadVarint(tag) || (tag >> 3U) == 0 || (tag >> 3U) > std::numeric_limits<uint32_t>::max()) {
+            return Fail();
+        }
+        field.number = static_cast<uint32_t>(tag >> 3U);
+        field.type = static_cast<WireType>(tag & 0x7U);
+        field.payload = {};
+        switch (field.type) {
+            case WireType::kVarint:
+                if (!ReadVarint(field.value)) {
+                    return Fail();
+                }
+                break;
+            case WireType::kFixed64:
+                if (!ReadFixed(field.value, sizeof(uint64_t))) {
+                    return Fail();
+                }
+                break;
+            case WireType::kFixed32:
+                if (!ReadFixed(field.value, sizeof(uint32_t))) {
+                    return Fail();
+                }
+                break;
+            case WireType::kLengthDelimited: {
+                uint64_t length = 0;
+                if (!ReadVarint(length) || length > buffer_.size() - position_) {
+                    return Fail();
+                }
+                field.value = length;
+                field.payload = buffer_.substr(position_, static_cast<size_t>(length));
+                position_ += static_cast<size_t>(length);
+                break;
+            }
+            default:
+                return Fail();
+        }
+        field.end = position_;
+        return true;
+    }
+
+    /**
+     * @brief Checks whether scanning stopped because of malformed input
+     * @return true if the buffer is not a valid serialized message
+     */
+    bool HasError() const { return error_; }
+
+    /**
+     * @brief Current read offset within the buffer
+     * @return Number of bytes consumed so far
+     */
+    size_t Position() const { return position_; }
+
+   private:
+    std::string_view buffer_; /**< Scanned bytes */
+    size_t position_ = 0;     /**< Current read offset */
+    bool error_ = false;      /**< Set once malformed input was detected */
+
+    bool Fail() {
+        error_ = true;
+        return false;
+    }
+
+    bool ReadVarint(uint64_t& value) {
+        value = 0;
+        for (unsigned shift = 0; shift < 64 && position_ < buffer_.size(); shift += 7) {
+            const auto byte = static_cast<uint8_t>(buffer_[position_++]);
+            value |= static_cast<uint64_t>(byte & 0x7FU) << shift;
+            if ((byte & 0x80U) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool ReadFixed(uint64_t& value, const size_t size) {
+        if (buffer_.size() - position_ < size) {
+            return false;
+        }
+        value = 0;
+        for (size_t i = 0; i < size; ++i) {
+            value |= static_cast<uint64_t>(static_cast<uint8_t>(buffer_[position_ + i])) << (8 * i);
+        }
+        position_ += size;
+        return true;
+    }
+};
+
+/**
+ * @brief Finds a length-delimited top-level field (e.g. a string or bytes field) in a serialized message.
+ *
+ * If the field occurs several times, the last occurrence is returned, matching the
+ * protobuf "last one wins" rule for singular scalar fields. Protobuf merges the
+ * occurrences of an embedded message instead; use FindMergedMessageField() for those.
+ *
+ * @param message Serialized message bytes
+ * @param field_number Field number to look for
+ * @return Payload of the field, or std::nullopt if absent or the message is malformed
+ */
+inline auto FindLengthDelimitedField(const std::string_view message, const uint32_t field_number) -> std::optional<std::string_view> {
+    WireFieldReader reader(message);
+    WireField field;
+    std::optional<std::string_view> result;
+    while (reader.Next(field)) {
+        if (field.number == field_number && field.type == WireType::kLengthDelimited) {
+            result = field.payload;
+        }
+    }
+    if (reader.HasError()) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+/**
+ * @brief Finds a singular embedded message field in a serialized message, merging its occurrences.
+ *
+ * Protobuf parses several occurrences of a singular message field as their merge, which is
+ * what parsing their concatenated payloads yields. A single occurrence is returned in place
+ * without copying; several occurrences are concatenated into merge_buffer.
+ *
+ * @param message Serialized message bytes
+ * @param field_number Field number to look for
+ * @param merge_buffer Receives the concatenated payloads if the field occurs more than once
+ * @return Serialized merged field, valid as long as message and merge_buffer, or std::nullopt if absent or the message is malformed
+ */
+inline auto FindMergedMessageField(const std::string_view message, const uint32_t field_number, std::string& merge_buffer) -> std::optional<std::string_view> {
+    WireFieldReader reader(message);
+    WireField field;
+    std::optional<std::string_view> first;
+    size_t occurrences = 0;
+    while (reader.Next(field)) {
+        if (field.number == field_number && field.type == WireType::kLengthDelimited) {
+            if (occurrences == 0) {
+                first = field.payload;
+            } else {
+                if (occurrences == 1) {
+                    merge_buffer.assign(first->data(), first->size());
+                }
+                merge_buffer.append(field.payload.data(), field.payload.size());
+            }
+            ++occurrences;
+        }
+    }
+    if (reader.HasError()) {
+        return std::nullopt;
+    }
+    if (occurrences > 1) {
+        return std::string_view(merge_buffer);
+    }
+    return first;
+}
+
+/** @brief Field number of osi3::Timestamp::seconds (see osi_common.proto). */
+constexpr uint32_t kTimestampSecondsFieldNumber = 1;
+
+/** @brief Field number of osi3::Timestamp::nanos (see osi_common.proto). */
+constexpr uint32_t kTimestampNanosFieldNumber = 2;
+
+/**
+ * @brief Decodes a serialized osi3::Timestamp into nanoseconds.
+ *
+ * Fields that occur several times keep their last value, so the concatenation of several
+ * serialized timestamps decodes to their merge.
+ *
+ * @param timestamp Serialized osi3::Timestamp bytes
+ * @return Timestamp in nanoseconds, or std::nullopt if malformed, negative or out of uint64 range
+ */
+inline auto DecodeTimestampNanoseconds(const std::string_view timestamp) -> std::optional<uint64_t> {
+    WireFieldReader reader(timestamp);
+    WireField field;
+    int64_t seconds = 0;
+    uint64_t nanos = 0;
+    while (reader.Next(field)) {
+        if (field.type != WireType::kVarint) {
+            continue;
+        }
+        if (field.number == kTimestampSecondsFieldNumber) {
+            seconds = static_cast<int64_t>(field.value);
+        } else if (field.number == kTimestampNanosFieldNumber) {
+            nanos = static_cast<uint32_t>(field.value);
+        }
+    }
+    if (reader.HasError() || seconds < 0) {
+        return std::nullopt;
+    }
+    const auto seconds_as_uint = static_cast<uint64_t>(seconds);
+    if (seconds_as_uint > (std::numeric_limits<uint64_t>::max() - nanos) / config::kNanosecondsPerSecond) {
+        return std::nullopt;
+    }
+    return seconds_as_uint * config::kNanosecondsPerSecond + nanos;
+}
+
+/**
+ * @brief Extracts the timestamp of a serialized OSI top-level message without parsing it.
+ *
+ * Only the top-level fields are scanned; all other sub-messages are skipped by their
+ * length prefix. Several occurrences of the timestamp are merged as when parsing, e.g. a
+ * message appended to a serialized message can set only the nanoseconds. The field number of the timestamp differs between OSI top-level
+ * messages, so it has to be resolved once from the message descriptor, e.g.
+ * `osi3::GroundTruth::descriptor()->FindFieldByName("timestamp")->number()`.
+ *
+ * @param message Serialized top-level message bytes
+ * @param timestamp_field_number Field number of the 'timestamp' field of the message type
+ * @return Timestamp in nanoseconds, or std::nullopt if absent, malformed or out of range
+ */
+inline auto PeekTimestampNanoseconds(const std::string_view message, const uint32_t timestamp_field_number) -> std::optional<uint64_t> {
+    std::string merge_buffer;
+    const auto timestamp = FindMergedMessageField(message, timestamp_field_number, merge_buffer);
+    if (!timestamp) {
+        return std::nullopt;
+    }
+    return DecodeTimestampNanoseconds(*timestamp);
+}
+
+/**
+ * @brief Appends a base-128 varint to a buffer.
+ *
+ * @param buffer Buffer to append to
+ * @param value Value to encode
+ */
+inline void AppendVarint(std::string& buffer, uint64_t value) {
+    while (value >= 0x80U) {
+        buffer.push_back(static_cast<char>((value & 0x7FU) | 0x80U));
+        value >>= 7U;
+    }
+    buffer.push_back(static_cast<char>(value));
+}
+
+/**
+ * @brief Appends a length-delimited field (e.g. an embedded message) to a serialized message.
+ *
+ * The payload is copied verbatim, so an already serialized sub-message can be embedded
+ * without parsing it.
+ *
+ * @param buffer Serialized message to append to
+ * @param field_number Field number of the field
+ * @param payload Payload bytes of the field
+ */
+inline void AppendLengthDelimitedField(std::string& buffer, const uint32_t field_number, const std::string_view payload) {
+    AppendVarint(buffer, (static_cast<uint64_t>(field_number) << 3U) | static_cast<uint64_t>(WireType::kLengthDelimited));
+    AppendVarint(buffer, payload.size());
+    buffer.append(payload.data(), payload.size());
+}
+
+}  // namespace tracefile
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_WIREFORMATUTILS_H_
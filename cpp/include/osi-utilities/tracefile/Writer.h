@@ -8,10 +8,13 @@
 
 #include <google/protobuf/message.h>
 
+#include <cstddef>
 #include <filesystem>
 #include <memory>
 #include <string>
 
+#include "osi-utilities/tracefile/BlockFileIo.h"
+
 namespace osi3 {
 
 /**
@@ -30,8 +33,11 @@ namespace osi3 {
  * @note Thread Safety: Instances are **not** thread-safe.
  * Concurrent calls on the same writer must be externally synchronized.
  *
+ * WriteRawMessage() accepts an already serialized message, the counterpart of
+ * TraceFileReader::ReadRawMessage() for copying frames or writing from other languages.
+ *
  * @note Error Strategy: `Open` returns `false` and logs to `std::cerr` on failure.
- * `WriteMessage` returns `false` on write errors.
+ * `WriteMessage` and `WriteRawMessage` return `false` on write errors.
  */
 class TraceFileWriter {
    public:
@@ -76,10 +82,49 @@ class TraceFileWriter {
      */
     virtual bool WriteMessage(const google::protobuf::Message& message, const std::string& topic = "") = 0;
 
+    /**
+     * @brief Writes an already serialized protobuf message to the trace file
+     *
+     * The bytes are stored as given and are not validated against the message type.
+     * The default implementation parses the bytes into a reused message of the given
+     * type and calls WriteMessage(). The binary and MCAP writers override it to write
+     * the bytes without parsing; the MCAP writer then takes the log time from the
+     * serialized timestamp, which must be present.
+     *
+     * @param data Serialized message bytes
+     * @param size Number of serialized message bytes
+     * @param descriptor Protobuf descriptor of the message type (selects the MCAP schema of auto-registered topics)
+     * @param topic Channel/topic name (required for MCAP, ignored for .osi/.txth)
+     * @return true if successful, false otherwise
+     */
+    virtual bool WriteRawMessage(const char* data, size_t size, const google::protobuf::Descriptor* descriptor, const std::string& topic = "");
+
     /**
      * @brief Closes the trace file
      */
     virtual void Close() = 0;
+
+    /**
+     * @brief Checks whether the last Close() failed to write buffered data
+     *
+     * Close() does not return a status; check this before publishing a closed file.
+     *
+     * @return true if the last closed file may be incomplete
+     */
+    virtual bool CloseFailed() const { return false; }
+
+    /**
+     * @brief Selects the I/O engine used by the next Open()
+     *
+     * The binary (.osi) and MCAP writers support the asynchronous backends of
+     * tracefile::IoBackend; other writers ignore the options.
+     *
+     * @param options I/O options
+     */
+    virtual void SetIoOptions(const tracefile::IoOptions& options) { (void)options; }
+
+   private:
+    std::unique_ptr<google::protobuf::Message> raw_message_; /**< Parse target of the default WriteRawMessage() implementation */
 };
 
 /**
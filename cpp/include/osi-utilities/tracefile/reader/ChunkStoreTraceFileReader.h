@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_READER_CHUNKSTORETRACEFILEREADER_H_
+#define OSIUTILITIES_TRACEFILE_READER_CHUNKSTORETRACEFILEREADER_H_
+
+#include <filesystem>
+#include <memory>
+
+#include "osi-utilities/tracefile/Reader.h"
+
+namespace osi3 {
+
+/**
+ * @brief Implementation of TraceFileReader for trace files stored in a chunk store
+ *
+ * Opens the manifest of a trace file stored with tracefile::StoreTraceFile() and reads it
+ * in place with the reader of its format, which is inferred from the manifest name, e.g.
+ * "sweep_042_gt_.osi.manifest" is read as the .osi file "sweep_042_gt_.osi". The blocks
+ * are loaded from the store as the reader reaches them (see tracefile::ChunkStoreFileSource),
+ * so nothing is reconstructed on disk and a stored trace can be read from its first frame
+ * on. Corrupt blocks are reported when they are read.
+ *
+ * @note Thread Safety: Instances are **not** thread-safe.
+ */
+class ChunkStoreTraceFileReader final : public osi3::TraceFileReader {
+   public:
+    /** @brief Destructor, closes the file if still open */
+    ~ChunkStoreTraceFileReader() override;
+
+    /**
+     * @brief Opens a stored trace file
+     * @param file_path Path to the manifest
+     * @return true if successful, false otherwise
+     */
+    bool Open(const std::filesystem::path& file_path) override;
+
+    /**
+     * @brief Opens a stored single-channel trace file with the specified message type
+     * @param file_path Path to the manifest
+     * @param message_type Expected message type in the file
+     * @return true if successful, false otherwise
+     */
+    bool Open(const std::filesystem::path& file_path, ReaderTopLevelMessage message_type);
+
+    /**
+     * @brief Reads the next message from the stored trace file
+     * @return Optional ReadResult containing the message if available
+     */
+    std::optional<ReadResult> ReadMessage() override;
+
+    /**
+     * @brief Reads the next message from the stored trace file without deserializing it
+     * @return Optional RawReadResult describing the message bytes if available
+     */
+    std::optional<RawReadResult> ReadRawMessage() override;
+
+    /**
+     * @brief Closes the trace file
+     */
+    void Close() override;
+
+    /**
+     * @brief Checks whether more messages are available
+     * @return true if there are more messages to read, false otherwise
+     */
+    bool HasNext() override;
+
+    /**
+     * @brief Gets the reader of the stored trace file, e.g. for MCAP channel metadata
+     * @return The reader, nullptr if no file is open
+     */
+    TraceFileReader* GetFormatReader() const { return reader_.get(); }
+
+   private:
+    std::unique_ptr<TraceFileReader> reader_; /**< Reader of the stored trace file */
+};
+
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_READER_CHUNKSTORETRACEFILEREADER_H_
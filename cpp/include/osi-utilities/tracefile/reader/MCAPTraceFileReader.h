@@ -6,7 +6,11 @@
 #ifndef OSIUTILITIES_TRACEFILE_READER_MCAPTRACEFILEREADER_H_
 #define OSIUTILITIES_TRACEFILE_READER_MCAPTRACEFILEREADER_H_
 
+#include <iostream>
+#include <limits>
+#include <memory>
 #include <mcap/reader.hpp>
+#include <string>
 #include <string_view>
 #include <unordered_set>
 #include <vector>
@@ -25,6 +29,16 @@
 
 namespace osi3 {
 
+/** @brief Attachment of an MCAP trace file as listed in its summary */
+struct McapAttachmentInfo {
+    std::string name;         /**< Name of the attachment */
+    std::string media_type;   /**< Media type of the attachment data */
+    uint64_t log_time = 0;    /**< Time of the attachment in nanoseconds */
+    uint64_t create_time = 0; /**< Creation time of the attachment in nanoseconds */
+    uint64_t data_size = 0;   /**< Number of attachment bytes */
+    uint64_t offset = 0;      /**< File offset of the attachment record */
+};
+
 /**
  * @brief Implementation of TraceFileReader for MCAP format files containing OSI messages
  *
@@ -63,6 +77,18 @@ class MCAPTraceFileReader final : public TraceFileReader {
      */
     std::optional<ReadResult> ReadMessage() override;
 
+    /**
+     * @brief Reads the next OSI message from the trace file without deserializing it
+     *
+     * The returned bytes point directly into the decompressed chunk of the MCAP reader.
+     * Advancing to the next record is deferred until the next call to HasNext() or a
+     * read method, so the bytes stay valid until then. Incompatible messages are
+     * handled the same way as in ReadMessage().
+     *
+     * @return Optional RawReadResult describing the message bytes if available
+     */
+    std::optional<RawReadResult> ReadRawMessage() override;
+
     /**
      * @brief Closes the trace file and releases reader resources
      */
@@ -74,6 +100,22 @@ class MCAPTraceFileReader final : public TraceFileReader {
      */
     bool HasNext() override;
 
+    /**
+     * @brief Selects the I/O engine used by the next Open()
+     * @param options I/O options
+     */
+    void SetIoOptions(const tracefile::IoOptions& options) override { io_options_ = options; }
+
+    /**
+     * @brief Makes the next Open() read a file source instead of the file
+     *
+     * The path passed to Open() then only names the content, and the I/O options do
+     * not apply. ChunkStoreTraceFileReader uses this to read stored trace files in place.
+     *
+     * @param source Content of the trace file
+     */
+    void SetFileSource(std::unique_ptr<tracefile::FileSource> source) { file_source_ = std::move(source); }
+
     /**
      * @brief Sets whether to skip incompatible messages during reading
      * @param skip If true, incompatible messages (non-OSI encoding/schema) will be silently skipped.
@@ -115,6 +157,18 @@ class MCAPTraceFileReader final : public TraceFileReader {
      */
     void SetTopics(const std::unordered_set<std::string>& topics);
 
+    /**
+     * @brief Replaces the read options, e.g. to jump to another time window
+     *
+     * Can be called before or after Open(). If the reader is already open, the message
+     * iteration restarts with the new options. The summary read on Open() is reused, so
+     * the chunks outside the time window are skipped through the chunk index without
+     * reopening the file. The topic filter of the options replaces the one of SetTopics().
+     *
+     * @param options Options for the MCAP reader
+     */
+    void SetReadOptions(const mcap::ReadMessageOptions& options);
+
     /**
      * @brief Get all available topics in the opened MCAP file.
      * @return Vector of topic names, empty if file not opened
@@ -148,12 +202,90 @@ class MCAPTraceFileReader final : public TraceFileReader {
      */
     std::optional<ReaderTopLevelMessage> GetMessageTypeForTopic(const std::string& topic) const;
 
+    /**
+     * @brief Lists the attachments of the opened MCAP file
+     *
+     * Only the summary is used, no attachment data is read.
+     *
+     * @return Attachments ordered by name, empty if file not opened
+     */
+    std::vector<McapAttachmentInfo> GetAttachments() const;
+
+    /**
+     * @brief Reads the data of an attachment
+     *
+     * Only the data range of the attachment is read, on demand. Message iteration
+     * continues where it was.
+     *
+     * @param attachment Attachment as returned by GetAttachments()
+     * @return Attachment bytes if successful, std::nullopt otherwise
+     */
+    std::optional<std::string> ReadAttachment(const McapAttachmentInfo& attachment);
+
+    /**
+     * @brief Reads the data of the first attachment with the given name
+     * @param name Name of the attachment
+     * @return Attachment bytes if found and read successfully, std::nullopt otherwise
+     */
+    std::optional<std::string> ReadAttachment(const std::string& name);
+
+    /**
+     * @brief Reads an attachment holding a serialized protobuf message, e.g. a SensorViewConfiguration
+     * @tparam T Type of the protobuf message
+     * @param name Name of the attachment
+     * @return The parsed message if found and parsed successfully, std::nullopt otherwise
+     */
+    template <typename T>
+    std::optional<T> ReadAttachmentMessage(const std::string& name) {
+        const auto data = ReadAttachment(name);
+        if (!data) {
+            return std::nullopt;
+        }
+        T message;
+        if (!message.ParseFromString(*data)) {
+            std::cerr << "ERROR: Failed to parse attachment " << name << " as " << T::descriptor()->full_name() << std::endl;
+            return std::nullopt;
+        }
+        return message;
+    }
+
+    /**
+     * @brief Restores the payloads offloaded from a message into attachments
+     *
+     * Looks up the payload batches of the message's channel whose log time range covers
+     * the message, written by MCAPTraceFileChannel::SetPayloadOffload(), and merges the
+     * payloads of the frame back into the message, decoding it first if it was read lazily.
+     * Messages without offloaded payloads are left unchanged. Only call this for frames that
+     * need the payloads; the others are read without touching the payload data. The last
+     * read batch is kept, so consecutive frames of a batch read it once.
+     *
+     * @param result A result of ReadMessage() from this reader
+     * @return false if the message is not available or a payload could not be read or attached
+     */
+    bool AttachOffloadedPayloads(ReadResult& result);
+
    private:
-    std::ifstream trace_file_;                                            /**< File stream for reading */
+    /** @brief Adapts the block file reader to the upstream MCAP reader */
+    class BlockReadable final : public mcap::IReadable {
+       public:
+        explicit BlockReadable(tracefile::BlockFileReader& file) : file_(file) {}
+        uint64_t size() const override { return file_.Size(); }
+        uint64_t read(std::byte** output, uint64_t offset, uint64_t size) override;
+
+       private:
+        tracefile::BlockFileReader& file_; /**< Underlying file */
+        std::vector<std::byte> buffer_;    /**< Bytes of the last read, valid until the next read */
+    };
+
+    tracefile::BlockFileReader trace_file_;                               /**< File reader */
+    tracefile::IoOptions io_options_;                                     /**< I/O options of the next Open() */
+    std::unique_ptr<tracefile::FileSource> file_source_;                  /**< Content read by the next Open() instead of the file, see SetFileSource() */
+    BlockReadable readable_{trace_file_};                                 /**< MCAP view of trace_file_ */
     mcap::McapReader mcap_reader_;                                        /**< Upstream MCAP reader object */
     std::unique_ptr<mcap::LinearMessageView> message_view_;               /**< Message view over MCAP records. */
     std::unique_ptr<mcap::LinearMessageView::Iterator> message_iterator_; /**< Iterator over the message view. */
 
+    bool advance_pending_ = false;          /**< Iterator still points at the message handed out by ReadRawMessage() */
     bool skip_incompatible_msgs_ = false;   /**< Flag to skip incompatible messages during reading */
     bool log_incompatible_msgs_ = true;     /**< Flag to log incompatible messages to stderr */
     mcap::ReadMessageOptions mcap_options_; /**< Options for the mcap reader */
@@ -213,12 +345,26 @@ class MCAPTraceFileReader final : public TraceFileReader {
     /** @brief Check whether a topic matches the configured filter. */
     auto TopicMatches(std::string_view topic) const noexcept -> bool;
 
+    /**
+     * @brief Look up the deserializer entry for a single MCAP message view.
+     * @param msg_view The MCAP message view
+     * @param reason Set to the incompatibility reason if no entry is found
+     * @return Pointer to the deserializer map entry, or nullptr if the message is incompatible
+     */
+    auto FindDeserializer(const mcap::MessageView& msg_view, std::string& reason) const -> const std::pair<DeserializeFunction, ReaderTopLevelMessage>*;
+
     /**
      * @brief Process a single MCAP message view and return a ReadResult.
      * @return ReadResult on success/error/incompatible, or std::nullopt if the message should be skipped
      */
     auto ProcessMessageView(const mcap::MessageView& msg_view) -> std::optional<ReadResult>;
 
+    /**
+     * @brief Process a single MCAP message view and return a RawReadResult without deserializing.
+     * @return RawReadResult on success/incompatible, or std::nullopt if the message should be skipped
+     */
+    auto ProcessRawMessageView(const mcap::MessageView& msg_view) -> std::optional<RawReadResult>;
+
     /**
      * @brief Handle an incompatible message (log, skip, or return kIncompatible).
      * @return ReadResult with kIncompatible status, or std::nullopt if skip is enabled
@@ -227,6 +373,9 @@ class MCAPTraceFileReader final : public TraceFileReader {
 
     /** @brief Stable topic filter storage used by the MCAP callback. */
     std::vector<std::string> filtered_topics_;
+
+    uint64_t payload_batch_offset_ = std::numeric_limits<uint64_t>::max(); /**< File offset of the attachment in payload_batch_ */
+    std::string payload_batch_;                                            /**< Last read payload batch, see AttachOffloadedPayloads() */
 };
 
 /** @brief Alias for MCAPTraceFileReader matching Python naming convention */
@@ -6,8 +6,8 @@
 #ifndef OSIUTILITIES_TRACEFILE_READER_SINGLECHANNELBINARYTRACEFILEREADER_H_
 #define OSIUTILITIES_TRACEFILE_READER_SINGLECHANNELBINARYTRACEFILEREADER_H_
 
-#include <fstream>
 #include <functional>
+#include <memory>
 
 #include "osi-utilities/tracefile/Reader.h"
 #include "osi_groundtruth.pb.h"
@@ -55,6 +55,16 @@ class SingleChannelBinaryTraceFileReader final : public osi3::TraceFileReader {
      */
     std::optional<ReadResult> ReadMessage() override;
 
+    /**
+     * @brief Reads the next message from the trace file without deserializing it
+     *
+     * The returned bytes point into the internal read buffer. The log time is taken
+     * from the message timestamp, which is extracted without parsing the message.
+     *
+     * @return Optional RawReadResult describing the message bytes if available
+     */
+    std::optional<RawReadResult> ReadRawMessage() override;
+
     /**
      * @brief Closes the trace file
      */
@@ -66,6 +76,39 @@ class SingleChannelBinaryTraceFileReader final : public osi3::TraceFileReader {
      */
     bool HasNext() override;
 
+    /**
+     * @brief Selects the I/O engine used by the next Open()
+     * @param options I/O options
+     */
+    void SetIoOptions(const tracefile::IoOptions& options) override;
+
+    /**
+     * @brief Makes the next Open() read a file source instead of the file
+     *
+     * The path passed to Open() then only names the content (its name selects the message type), and the I/O options do
+     * not apply. ChunkStoreTraceFileReader uses this to read stored trace files in place.
+     *
+     * @param source Content of the trace file
+     */
+    void SetFileSource(std::unique_ptr<tracefile::FileSource> source) { file_source_ = std::move(source); }
+
+    /**
+     * @brief Enables parsing messages straight from the file in bounded chunks
+     *
+     * By default, ReadMessage() reads each message completely into a buffer before parsing
+     * it, so a message needs about twice its size in memory. In streaming parse mode, the
+     * message is fed to the parser through a ZeroCopyInputStream in chunks of
+     * tracefile::config::kStreamingParseChunkSize bytes, so only the parsed message takes
+     * memory proportional to its size. This pays off for messages with large image or point
+     * cloud payloads. The log time is taken from the wire while the chunks pass through, like
+     * in the default mode. Large bytes fields are still copied into the parsed message; they
+     * are not exposed as file offsets. Lazy decoding (see SetLazyDecoding()) needs the
+     * serialized bytes and takes precedence.
+     *
+     * @param enabled Whether to parse messages in bounded chunks
+     */
+    void SetStreamingParse(const bool enabled) { streaming_parse_ = enabled; }
+
     /**
      * @brief Gets the current message type being read
      * @return The message type enum value
@@ -78,10 +121,15 @@ class SingleChannelBinaryTraceFileReader final : public osi3::TraceFileReader {
      */
     using MessageParserFunc = std::function<std::unique_ptr<google::protobuf::Message>(const std::vector<char>&)>;
 
-    std::ifstream trace_file_;                                            /**< File stream for reading */
+    tracefile::BlockFileReader trace_file_;                               /**< File reader */
+    tracefile::IoOptions io_options_;                                     /**< I/O options of the next Open() */
+    std::unique_ptr<tracefile::FileSource> file_source_;                  /**< Content read by the next Open() instead of the file, see SetFileSource() */
     MessageParserFunc parser_;                                            /**< Message parsing function */
     ReaderTopLevelMessage message_type_{ReaderTopLevelMessage::kUnknown}; /**< Current message type */
     std::vector<char> read_buffer_;                                       /**< Reusable read buffer to avoid per-message allocation */
+    uint32_t timestamp_field_number_ = 0;                                 /**< Field number of 'timestamp' in the current message type */
+    bool streaming_parse_ = false;                                        /**< Whether ReadMessage() parses in bounded chunks, see SetStreamingParse() */
+    std::vector<char> stream_buffer_;                                     /**< Chunk buffer of the streaming parse mode */
 
     /**
      * @brief Reads raw binary message data from file into the internal buffer
@@ -89,6 +137,13 @@ class SingleChannelBinaryTraceFileReader final : public osi3::TraceFileReader {
      */
     const std::vector<char>& ReadNextMessageFromFile();
 
+    /**
+     * @brief Reads and parses the next message in bounded chunks, see SetStreamingParse()
+     * @return Result holding the parsed message
+     * @throws std::runtime_error if the message cannot be read or parsed
+     */
+    ReadResult StreamNextMessageFromFile();
+
     /**
      * @brief Parses a binary buffer into the requested protobuf message type
      * @tparam T Protobuf message type to parse into
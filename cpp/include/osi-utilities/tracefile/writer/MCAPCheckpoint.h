@@ -0,0 +1,58 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_WRITER_MCAPCHECKPOINT_H_
+#define OSIUTILITIES_TRACEFILE_WRITER_MCAPCHECKPOINT_H_
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+
+namespace osi3 {
+
+/**
+ * @brief Checkpoint cadence of the MCAPTraceFileWriter
+ *
+ * At a checkpoint, the writer closes the current chunk, flushes the file (synchronizes
+ * it if durability options are set, see tracefile::IoOptions) and appends the index of
+ * the chunks written since the last checkpoint to a journal next to the trace file.
+ * Smaller intervals lose less data on a crash, but produce smaller chunks.
+ */
+struct McapCheckpointOptions {
+    uint64_t interval_bytes = 0;           /**< Checkpoint after this many message bytes (0: off) */
+    std::chrono::milliseconds interval{0}; /**< Checkpoint at least this often while writing (0: off) */
+
+    /** @brief Whether checkpoints are enabled */
+    bool Enabled() const { return interval_bytes > 0 || interval.count() > 0; }
+};
+
+namespace tracefile {
+
+/**
+ * @brief Gets the checkpoint journal path of an MCAP trace file
+ * @param trace_file_path Path to the MCAP trace file
+ * @return Trace file path with config::kCheckpointJournalSuffix appended
+ */
+std::filesystem::path GetCheckpointJournalPath(const std::filesystem::path& trace_file_path);
+
+/**
+ * @brief Finalizes an MCAP trace file whose recording was interrupted
+ *
+ * Truncates the file to the last checkpoint of its journal and appends the summary
+ * section and footer from the journal, so readers can use the index again instead of
+ * scanning the file. The work is proportional to the size of the index, not of the
+ * recorded data. Messages written after the last checkpoint are lost. The journal is
+ * removed on success. A file that was closed properly is left unchanged.
+ *
+ * @param trace_file_path Path to the MCAP trace file; its journal must exist
+ * @return true if the file is complete afterwards, false otherwise (the file is left unchanged
+ *         if the journal has no usable checkpoint)
+ */
+bool RecoverMcapTraceFile(const std::filesystem::path& trace_file_path);
+
+}  // namespace tracefile
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_WRITER_MCAPCHECKPOINT_H_
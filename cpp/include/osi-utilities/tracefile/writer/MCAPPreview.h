@@ -0,0 +1,51 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_WRITER_MCAPPREVIEW_H_
+#define OSIUTILITIES_TRACEFILE_WRITER_MCAPPREVIEW_H_
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+#include "osi-utilities/tracefile/TraceCompaction.h"
+
+namespace osi3 {
+
+/**
+ * @brief Gets compaction options that strip the static road network and objects of GroundTruth
+ *
+ * Removes the lanes, lane boundaries, logical lanes, reference lines, road markings,
+ * traffic signs and stationary objects. Moving objects and traffic lights are kept.
+ *
+ * @return Compaction options for preview messages
+ */
+inline tracefile::CompactionOptions GetDefaultPreviewCompaction() {
+    tracefile::CompactionOptions options;
+    options.removed_fields = {"osi3.GroundTruth.stationary_object",     "osi3.GroundTruth.lane_boundary",  "osi3.GroundTruth.lane",         "osi3.GroundTruth.logical_lane",
+                              "osi3.GroundTruth.logical_lane_boundary", "osi3.GroundTruth.reference_line", "osi3.GroundTruth.road_marking", "osi3.GroundTruth.traffic_sign"};
+    return options;
+}
+
+/**
+ * @brief Low-rate preview channel the MCAPTraceFileWriter derives from a full-rate channel
+ *
+ * The first frame of the source channel and then every frame at least interval after the
+ * last previewed one is compacted (see tracefile::CompactMessage()) and written to the
+ * preview channel. Preview messages are collected and written in batches into chunks of
+ * their own, so a viewer reading only the preview channel loads a few small chunks
+ * instead of decompressing the full-rate data.
+ */
+struct McapPreviewOptions {
+    std::string source_topic;                                                /**< Topic of the full-rate channel */
+    std::string topic;                                                       /**< Topic of the preview channel (empty: source_topic + tracefile::config::kPreviewTopicSuffix) */
+    std::chrono::milliseconds interval{1000};                                /**< Minimum log time between previewed frames */
+    size_t batch_size = 60;                                                  /**< Preview messages per chunk, pending ones are also written at checkpoints and Close() */
+    tracefile::CompactionOptions compaction = GetDefaultPreviewCompaction(); /**< Compaction of the previewed frames */
+};
+
+}  // namespace osi3
+
+#endif  // OSIUTILITIES_TRACEFILE_WRITER_MCAPPREVIEW_H_
@@ -8,7 +8,18 @@
 
 #include <google/protobuf/message.h>
 
+#include <cstdint>
+#include <limits>
 #include <mcap/mcap.hpp>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "osi-utilities/tracefile/PayloadOffload.h"
+#include "osi-utilities/tracefile/Quantization.h"
+#include "osi-utilities/tracefile/TraceCompaction.h"
+#include "osi-utilities/tracefile/TraceStatistics.h"
 
 namespace osi3 {
 
@@ -95,6 +106,21 @@ class MCAPTraceFileChannel {
     template <typename T>
     bool WriteMessage(const T& top_level_message, const std::string& topic);
 
+    /**
+     * @brief Writes an already serialized message to the file without parsing it
+     *
+     * The log time is read from the serialized timestamp, so the message must have one.
+     * If the topic has not been registered via AddChannel(), it is auto-registered
+     * using the given descriptor. The bytes are not validated against the message type.
+     *
+     * @param data Serialized message bytes
+     * @param size Number of serialized message bytes
+     * @param descriptor Protobuf descriptor of the OSI message type
+     * @param topic Topic name (must not be empty)
+     * @return true if successful, false otherwise
+     */
+    bool WriteRawMessage(const char* data, size_t size, const google::protobuf::Descriptor* descriptor, const std::string& topic);
+
     /**
      * @brief Adds a new OSI channel to the MCAP file
      *
@@ -125,12 +151,164 @@ class MCAPTraceFileChannel {
      */
     static std::string GetCurrentTimeAsString();
 
+    /**
+     * @brief Enables lossy quantization of positional data for channels added afterwards
+     *
+     * Messages of these channels are written with their pose fields rounded (see
+     * tracefile::QuantizeMessage()), which lets the chunk compression remove most of their
+     * size. The quantization steps are recorded in the channel metadata. Channels added
+     * before keep their setting. Pass default options to disable quantization again.
+     *
+     * @param options Quantization precision
+     */
+    void SetQuantization(const tracefile::QuantizationOptions& options) { transform_.quantization = options; }
+
+    /**
+     * @brief Enables compaction of the messages of channels added afterwards
+     *
+     * Messages of these channels are compacted (see tracefile::CompactMessage()) and
+     * serialized deterministically. Channels added before keep their setting.
+     *
+     * @param options Compaction options, std::nullopt disables compaction again
+     */
+    void SetCompaction(const std::optional<tracefile::CompactionOptions>& options) {
+        transform_.compaction = options ? std::make_shared<const tracefile::MessageCompactor>(*options) : nullptr;
+    }
+
+    /**
+     * @brief Offloads large payloads of channels added afterwards into MCAP attachments
+     *
+     * The configured fields, e.g. camera images, are removed from the messages of these
+     * channels (see tracefile::OffloadPayloads()) and written as attachments named by
+     * tracefile::GetPayloadAttachmentName(). Attachments are stored outside of the chunks,
+     * so reading the messages does not decompress the payloads. The offloaded field paths
+     * are recorded in the channel metadata. Channels added before keep their setting.
+     *
+     * Writing an attachment closes the current chunk, so the payloads of a channel are
+     * collected in memory up to tracefile::PayloadOffloadOptions::batch_size bytes and
+     * written as one attachment; smaller batches mean smaller chunks that compress worse.
+     * Call FlushPayloads() before closing the MCAP writer.
+     *
+     * @param options Fields to offload, std::nullopt disables offloading again
+     */
+    void SetPayloadOffload(const std::optional<tracefile::PayloadOffloadOptions>& options) { transform_.offload = options; }
+
+    /**
+     * @brief Writes the collected offloaded payloads of all channels as attachments
+     *
+     * Called by MCAPTraceFileWriter at checkpoints and on Close(); users of an external MCAP
+     * writer call it before closing that writer.
+     *
+     * @return true if successful, false otherwise
+     */
+    bool FlushPayloads();
+
+    /**
+     * @brief Sets the capacity up to which the serialization buffer is kept between messages
+     *
+     * Messages are serialized into a reusable buffer before they are handed to the MCAP
+     * writer. If a message needed a larger buffer, it is released after the message was
+     * written, together with the buffers of transformed messages, so the memory of a
+     * single large message is not retained for the lifetime of the writer.
+     *
+     * @param limit Capacity in bytes (default tracefile::config::kDefaultRetainedBufferLimit)
+     */
+    void SetRetainedBufferLimit(const size_t limit) { retained_buffer_limit_ = limit; }
+
+    /**
+     * @brief Collects statistics of the messages of channels added afterwards
+     *
+     * Each successfully written message is added to the statistics in its serialized form,
+     * as stored in the file (see tracefile::TraceStatistics::Observe()).
+     *
+     * @param statistics Statistics to update (must outlive the channel or be reset), nullptr to stop collecting
+     */
+    void SetStatistics(tracefile::TraceStatistics* statistics) { statistics_ = statistics; }
+
+    /** @brief Gets the schemas registered so far */
+    std::vector<mcap::Schema> GetSchemas() const;
+
+    /** @brief Gets the channels registered so far, in registration order */
+    const std::vector<mcap::Channel>& GetChannels() const { return channels_; }
+
+    /** @brief Gets the serialized size in bytes of the last successfully written message */
+    size_t GetLastMessageSize() const { return last_message_size_; }
+
    private:
     mcap::McapWriter& mcap_writer_;                           /**< Non-owning reference to external writer */
     std::unordered_map<std::string, mcap::Schema> schemas_;   /**< Registered schemas (keyed by descriptor full name) */
     std::map<std::string, uint16_t> topic_to_channel_id_;     /**< Topic to channel ID mapping */
     std::map<std::string, std::string> topic_to_schema_name_; /**< Topic to schema name mapping (for duplicate detection) */
+    std::vector<mcap::Channel> channels_;                     /**< Registered channels */
     std::string serialize_buffer_;                            /**< Reusable serialization buffer */
+    size_t last_message_size_ = 0;                            /**< Serialized size of the last written message */
+
+    /** @brief Capacity up to which serialize_buffer_ is kept, see SetRetainedBufferLimit() */
+    size_t retained_buffer_limit_ = tracefile::config::kDefaultRetainedBufferLimit;
+
+    /** @brief Statistics of the written messages, if collected, see SetStatistics() */
+    tracefile::TraceStatistics* statistics_ = nullptr;
+
+    /** @brief Transformation of the messages of a channel before they are written */
+    struct Transform {
+        tracefile::QuantizationOptions quantization;                   /**< Quantization of positional data */
+        std::shared_ptr<const tracefile::MessageCompactor> compaction; /**< Compaction, if enabled, shared by the channels added with it */
+        std::optional<tracefile::PayloadOffloadOptions> offload;       /**< Payload offloading, if enabled */
+
+        /** @brief Whether messages are transformed at all */
+        bool Enabled() const { return quantization.Enabled() || compaction != nullptr || offload.has_value(); }
+    };
+
+    Transform transform_; /**< Transformation of channels added next */
+
+    /** @brief Transformation of the transformed channels, by channel ID */
+    std::unordered_map<uint16_t, Transform> channel_transforms_;
+
+    /** @brief Payloads removed from the message being written, added to the batch of its channel after it */
+    std::vector<tracefile::OffloadedPayload> offloaded_payloads_;
+
+    /** @brief Offloaded payloads of a channel not written yet */
+    struct PayloadBatch {
+        std::string topic;                                              /**< Topic of the channel */
+        uint64_t first_log_time = std::numeric_limits<uint64_t>::max(); /**< Earliest log time of the collected frames */
+        uint64_t last_log_time = 0;                                     /**< Latest log time of the collected frames */
+        std::string records;                                            /**< Payload records, see tracefile::AppendPayloadRecord() */
+    };
+
+    /** @brief Collected payloads, by channel ID */
+    std::unordered_map<uint16_t, PayloadBatch> payload_batches_;
+
+    /** @brief Reusable messages to transform, by message type */
+    std::unordered_map<const google::protobuf::Descriptor*, std::unique_ptr<google::protobuf::Message>> transform_buffers_;
+
+    /**
+     * @brief Serializes a message into serialize_buffer_, transformed if the channel is
+     * @param message The message to serialize
+     * @param channel_id Channel the message is written to
+     * @return true if successful, false otherwise
+     */
+    bool SerializeMessage(const google::protobuf::Message& message, uint16_t channel_id);
+
+    /**
+     * @brief Writes a serialized message followed by its offloaded payloads
+     * @param msg The message to write
+     * @param topic Topic of the message
+     * @return true if successful, false otherwise
+     */
+    bool WriteSerialized(const mcap::Message& msg, const std::string& topic);
+
+    /**
+     * @brief Writes a payload batch as one attachment and empties it
+     * @param batch The batch to write
+     * @return true if successful, false otherwise
+     */
+    bool WritePayloadBatch(PayloadBatch& batch);
+
+    /** @brief Releases the serialization buffers if they grew beyond the retained buffer limit */
+    void ReleaseOversizedBuffers();
+
+    /** @brief Gets the reusable message to transform messages of a type, nullptr for unknown types */
+    google::protobuf::Message* GetTransformBuffer(const google::protobuf::Descriptor* descriptor);
 };
 
 }  // namespace osi3
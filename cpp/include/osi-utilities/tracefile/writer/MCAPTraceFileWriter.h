@@ -8,22 +8,37 @@
 
 #include <google/protobuf/message.h>
 
+#include <chrono>
 #include <mcap/mcap.hpp>
+#include <memory>
+#include <optional>
 
 #include "osi-utilities/tracefile/Writer.h"
+#include "osi-utilities/tracefile/writer/MCAPCheckpoint.h"
+#include "osi-utilities/tracefile/writer/MCAPPreview.h"
 #include "osi-utilities/tracefile/writer/MCAPTraceFileChannel.h"
 
 namespace osi3 {
+namespace mcap_utils {
+class CheckpointJournal;
+}  // namespace mcap_utils
+
 /**
  * @brief MCAP format implementation of the trace file writer
  *
  * Handles writing OSI messages to MCAP format files with support for
  * channels, schemas, and metadata.
  *
+ * With checkpoints enabled (see SetCheckpointOptions()), a recording that is
+ * interrupted by a crash can be finalized with tracefile::RecoverMcapTraceFile().
+ *
  * @note Thread Safety: Not thread-safe. External synchronization required for concurrent access.
  */
 class MCAPTraceFileWriter final : public osi3::TraceFileWriter {
    public:
+    /** @brief Creates a writer without an open file */
+    MCAPTraceFileWriter();
+
     /** @brief Destructor, closes the file if still open */
     ~MCAPTraceFileWriter() override;
     /**
@@ -45,6 +60,122 @@ class MCAPTraceFileWriter final : public osi3::TraceFileWriter {
      */
     bool Open(const std::filesystem::path& file_path, const mcap::McapWriterOptions& options);
 
+    /**
+     * @brief Sets the MCAP writer options used by the next Open(file_path)
+     *
+     * For wrappers that open the writer through the TraceFileWriter interface,
+     * e.g. RealtimeTraceFileWriter.
+     *
+     * @param options Options for the MCAP writer
+     */
+    void SetMcapOptions(const mcap::McapWriterOptions& options) { mcap_options_ = options; }
+
+    /**
+     * @brief Sets the checkpoint cadence used by the next Open()
+     *
+     * While checkpoints are enabled, the writer keeps a journal next to the trace
+     * file (see tracefile::GetCheckpointJournalPath()) and removes it on Close().
+     * Only channels added through this writer are journaled, not channels added
+     * directly to GetMcapWriter().
+     *
+     * @param options Checkpoint options
+     */
+    void SetCheckpointOptions(const McapCheckpointOptions& options) { checkpoint_options_ = options; }
+
+    /**
+     * @brief Sets the preview channel of files opened afterwards
+     *
+     * Derives a low-rate, compacted preview channel from a full-rate channel while
+     * recording, e.g. 1 Hz GroundTruth without the static road network, see
+     * McapPreviewOptions. The preview channel metadata names the source topic and the
+     * interval.
+     *
+     * @param options Preview options, std::nullopt disables the preview again
+     */
+    void SetPreviewOptions(const std::optional<McapPreviewOptions>& options) { preview_options_ = options; }
+
+    /**
+     * @brief Enables lossy quantization of positional data for channels added afterwards
+     *
+     * Intended for archives that do not need full double precision: rounded positions,
+     * orientations, velocities and dimensions compress much better in the MCAP chunks.
+     * The quantization steps are recorded in the channel metadata, see
+     * MCAPTraceFileChannel::SetQuantization().
+     *
+     * @param options Quantization precision, e.g. 0.001 m and 0.001 rad
+     */
+    void SetQuantization(const tracefile::QuantizationOptions& options) { channel_.SetQuantization(options); }
+
+    /**
+     * @brief Enables compaction of the messages of channels added afterwards
+     *
+     * Removes unused sub-trees, unknown fields and default values before writing and
+     * serializes deterministically, see MCAPTraceFileChannel::SetCompaction().
+     *
+     * @param options Compaction options, std::nullopt disables compaction again
+     */
+    void SetCompaction(const std::optional<tracefile::CompactionOptions>& options) { channel_.SetCompaction(options); }
+
+    /**
+     * @brief Offloads large payloads of channels added afterwards into attachments
+     *
+     * Removes the configured fields, e.g. camera images, from the messages and writes them
+     * as attachments outside of the chunks, see MCAPTraceFileChannel::SetPayloadOffload().
+     * The payloads of a channel are written in batches of PayloadOffloadOptions::batch_size
+     * bytes, at checkpoints and on Close(), since each attachment closes the current chunk.
+     * Readers restore them with MCAPTraceFileReader::AttachOffloadedPayloads().
+     *
+     * @param options Fields to offload, std::nullopt disables offloading again
+     */
+    void SetPayloadOffload(const std::optional<tracefile::PayloadOffloadOptions>& options) { channel_.SetPayloadOffload(options); }
+
+    /**
+     * @brief Sets the capacity up to which the serialization buffer is kept between messages
+     *
+     * See MCAPTraceFileChannel::SetRetainedBufferLimit(). Lower it for recorders of large
+     * messages, e.g. camera frames, to bound the memory kept after a large message.
+     *
+     * @param limit Capacity in bytes
+     */
+    void SetRetainedBufferLimit(const size_t limit) { channel_.SetRetainedBufferLimit(limit); }
+
+    /**
+     * @brief Enables statistics of the written messages for files opened afterwards
+     *
+     * Per channel, the message count, log time range, frame size histogram and, for
+     * GroundTruth, the moving object count range and host speed are aggregated while
+     * writing (see tracefile::TraceStatistics). Close() stores them as one
+     * tracefile::config::kOsiTraceStatisticsMetadataName metadata record per channel, so
+     * catalog tools can evaluate a trace from its summary alone.
+     *
+     * @param enabled Whether to collect the statistics
+     */
+    void SetStatisticsEnabled(const bool enabled) { statistics_enabled_ = enabled; }
+
+    /**
+     * @brief Gets the statistics of the current or last opened file
+     * @return The statistics, nullptr if they are not collected
+     */
+    const tracefile::TraceStatistics* GetStatistics() const { return statistics_.get(); }
+
+    /**
+     * @brief Gets the statistics of the current file, to add messages written through GetMcapWriter()
+     * @return The statistics, nullptr if they are not collected
+     */
+    tracefile::TraceStatistics* GetStatistics() { return statistics_.get(); }
+
+    /**
+     * @brief Writes a checkpoint now
+     *
+     * Writes pending preview and payload records, closes the current chunk and records the
+     * file as recoverable up to here. Called automatically according to the checkpoint
+     * options; the write that triggers a failed checkpoint returns false. If the records
+     * cannot be written, the journal is not advanced and CloseFailed() reports the failure.
+     *
+     * @return true if successful, false if checkpoints are disabled or writing failed
+     */
+    bool Checkpoint();
+
     /**
      * @brief Writes a protobuf message to the file (type-erased, virtual)
      *
@@ -58,6 +189,20 @@ class MCAPTraceFileWriter final : public osi3::TraceFileWriter {
      */
     bool WriteMessage(const google::protobuf::Message& message, const std::string& topic = "") override;
 
+    /**
+     * @brief Writes an already serialized message to the file without parsing it
+     *
+     * Topics and required file metadata are auto-registered as in WriteMessage().
+     * The log time is read from the serialized timestamp of the message.
+     *
+     * @param data Serialized message bytes
+     * @param size Number of serialized message bytes
+     * @param descriptor Protobuf descriptor of the message type
+     * @param topic Topic/channel name for the message
+     * @return true if successful, false otherwise
+     */
+    bool WriteRawMessage(const char* data, size_t size, const google::protobuf::Descriptor* descriptor, const std::string& topic = "") override;
+
     /**
      * @brief Writes a protobuf message to the file (compile-time typed)
      * @tparam T Type of the protobuf message
@@ -86,6 +231,47 @@ class MCAPTraceFileWriter final : public osi3::TraceFileWriter {
      */
     bool AddFileMetadata(const std::string& name, const std::unordered_map<std::string, std::string>& metadata_entries);
 
+    /**
+     * @brief Adds an attachment to the trace file
+     *
+     * Attachments hold static data that is needed once per recording instead of
+     * per frame, e.g. the OpenDRIVE road network or sensor configurations. They are
+     * written outside of the chunks and listed in the summary, so readers load them
+     * only on demand (see MCAPTraceFileReader::ReadAttachment()).
+     *
+     * @param name Name of the attachment, e.g. the original file name
+     * @param media_type Media type of the data, e.g. "application/xml"
+     * @param data Attachment bytes
+     * @param size Number of attachment bytes
+     * @param log_time Time of the attachment in nanoseconds
+     * @return true if successful, false otherwise
+     */
+    bool AddAttachment(const std::string& name, const std::string& media_type, const char* data, size_t size, uint64_t log_time = 0);
+
+    /**
+     * @brief Adds a serialized protobuf message as attachment, e.g. a SensorViewConfiguration
+     *
+     * The media type is tracefile::config::kProtobufAttachmentMediaTypePrefix followed by
+     * the full name of the message type.
+     *
+     * @param name Name of the attachment
+     * @param message The protobuf message to attach
+     * @param log_time Time of the attachment in nanoseconds
+     * @return true if successful, false otherwise
+     */
+    bool AddAttachment(const std::string& name, const google::protobuf::Message& message, uint64_t log_time = 0);
+
+    /**
+     * @brief Adds the content of a file as attachment, e.g. an OpenDRIVE file
+     *
+     * The attachment is named after the file name.
+     *
+     * @param file_path Path to the file to attach
+     * @param media_type Media type of the file, e.g. "application/xml"
+     * @return true if successful, false otherwise
+     */
+    bool AddAttachmentFromFile(const std::filesystem::path& file_path, const std::string& media_type);
+
     /**
      * @brief Prepares the required (by OSI spec.) metadata for the MCAP trace file.
      *
@@ -121,6 +307,18 @@ class MCAPTraceFileWriter final : public osi3::TraceFileWriter {
      */
     void Close() override;
 
+    /**
+     * @brief Checks whether the last Close() failed to write the preview, the statistics or buffered records
+     * @return true if the last closed file may be incomplete
+     */
+    bool CloseFailed() const override { return close_failed_; }
+
+    /**
+     * @brief Selects the I/O engine used by the next Open()
+     * @param options I/O options
+     */
+    void SetIoOptions(const tracefile::IoOptions& options) override { io_options_ = options; }
+
     /**
      * @brief Gets the underlying MCAP writer instance
      * @return Pointer to the internal McapWriter object
@@ -132,11 +330,80 @@ class MCAPTraceFileWriter final : public osi3::TraceFileWriter {
     mcap::McapWriter* GetMcapWriter() { return &mcap_writer_; }
 
    private:
-    std::ofstream trace_file_;                         /**< Trace file stream */
-    mcap::McapWriter mcap_writer_;                     /**< MCAP writer instance */
-    mcap::McapWriterOptions mcap_options_{"protobuf"}; /**< MCAP writer configuration */
-    MCAPTraceFileChannel channel_{mcap_writer_};       /**< Delegated channel/schema management */
-    bool required_metadata_added_ = false;             /**< Flag to track if required metadata has been added */
+    /** @brief Adapts the block file writer to the upstream MCAP writer and feeds the checkpoint journal */
+    class BlockWritable final : public mcap::IWritable {
+       public:
+        explicit BlockWritable(tracefile::BlockFileWriter& file) : file_(file) {}
+        void end() override { file_.Flush(); }
+        uint64_t size() const override { return file_.Size(); }
+        void SetJournal(mcap_utils::CheckpointJournal* journal) { journal_ = journal; }
+
+       protected:
+        void handleWrite(const std::byte* data, uint64_t size) override;
+
+       private:
+        tracefile::BlockFileWriter& file_;                 /**< Underlying file */
+        mcap_utils::CheckpointJournal* journal_ = nullptr; /**< Journal following the written records, if checkpoints are enabled */
+    };
+
+    /**
+     * @brief Counts the last written message and writes a checkpoint once an interval has passed
+     * @return false if a due checkpoint failed
+     */
+    bool CheckpointIfDue();
+
+    /**
+     * @brief Derives a preview message if the message is due for the preview channel
+     * @param message Message written to the topic
+     * @param topic Topic of the message
+     */
+    void PreviewIfDue(const google::protobuf::Message& message, const std::string& topic);
+
+    /**
+     * @brief Derives a preview message if the serialized message is due for the preview channel
+     * @param data Serialized message written to the topic
+     * @param size Size of the serialized message
+     * @param descriptor Message type
+     * @param topic Topic of the message
+     */
+    void PreviewIfDue(const char* data, size_t size, const google::protobuf::Descriptor* descriptor, const std::string& topic);
+
+    /** @brief Compacts the message in the preview state and adds it to the pending preview messages */
+    void AddPreview(uint64_t log_time);
+
+    /**
+     * @brief Writes the pending preview messages into chunks of their own
+     * @return true if successful, false otherwise
+     */
+    bool FlushPreview();
+
+    /** @brief Preview channel of the open file */
+    struct PreviewState {
+        McapPreviewOptions options;                               /**< Options, with the resolved topic */
+        uint64_t next_log_time = 0;                               /**< Earliest log time of the next previewed frame */
+        const google::protobuf::Descriptor* descriptor = nullptr; /**< Message type of the source channel, once known */
+        std::unique_ptr<google::protobuf::Message> message;       /**< Reusable message to derive the preview messages */
+        std::optional<tracefile::MessageCompactor> compactor;     /**< Compactor of the preview messages, built from options.compaction */
+        std::vector<std::string> pending;                         /**< Serialized preview messages not written yet */
+    };
+
+    tracefile::BlockFileWriter trace_file_;                  /**< Trace file */
+    tracefile::IoOptions io_options_;                        /**< I/O options of the next Open() */
+    BlockWritable writable_{trace_file_};                    /**< MCAP view of trace_file_ */
+    mcap::McapWriter mcap_writer_;                           /**< MCAP writer instance */
+    mcap::McapWriterOptions mcap_options_{"protobuf"};       /**< MCAP writer configuration */
+    MCAPTraceFileChannel channel_{mcap_writer_};             /**< Delegated channel/schema management */
+    bool required_metadata_added_ = false;                   /**< Flag to track if required metadata has been added */
+    McapCheckpointOptions checkpoint_options_;               /**< Checkpoint options of the next Open() */
+    std::unique_ptr<mcap_utils::CheckpointJournal> journal_; /**< Checkpoint journal while checkpoints are enabled */
+    std::filesystem::path journal_path_;                     /**< Path of journal_ */
+    uint64_t checkpoint_bytes_ = 0;                          /**< Message bytes since the last checkpoint */
+    std::chrono::steady_clock::time_point last_checkpoint_;  /**< Time of the last checkpoint */
+    bool statistics_enabled_ = false;                        /**< Whether the next Open() collects statistics */
+    std::unique_ptr<tracefile::TraceStatistics> statistics_; /**< Statistics of the current or last file, if collected */
+    std::optional<McapPreviewOptions> preview_options_;      /**< Preview options of the next Open() */
+    std::unique_ptr<PreviewState> preview_;                  /**< Preview channel of the open file, if enabled */
+    bool close_failed_ = false;                              /**< Whether Close() or a checkpoint failed to write records */
 };
 
 /** @brief Alias for MCAPTraceFileWriter matching Python naming convention */
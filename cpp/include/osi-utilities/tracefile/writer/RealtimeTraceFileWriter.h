@@ -0,0 +1,207 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_WRITER_REALTIMETRACEFILEWRITER_H_
+#define OSIUTILITIES_TRACEFILE_WRITER_REALTIMETRACEFILEWRITER_H_
+
+#include <google/protobuf/message.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "osi-utilities/tracefile/TraceFileConfig.h"
+#include "osi-utilities/tracefile/Writer.h"
+
+namespace osi3 {
+
+/**
+ * @brief Options of the RealtimeTraceFileWriter
+ */
+struct RealtimeWriterOptions {
+    size_t buffer_size = tracefile::config::kDefaultRealtimeBufferSize; /**< Size of the frame buffer in bytes (at most 4 GiB - 1), allocated on Open() */
+    size_t max_topics = tracefile::config::kDefaultRealtimeMaxTopics;   /**< Maximum number of topics */
+    std::chrono::microseconds max_wait{0};                              /**< Time a write waits for buffer space before dropping the frame (0: drop at once) */
+    double degrade_threshold = 0.5;                                     /**< Buffer fill ratio above which frames of droppable topics are dropped */
+};
+
+/**
+ * @brief Accounting of a RealtimeTraceFileWriter
+ */
+struct RealtimeWriterStatistics {
+    uint64_t frames_written = 0;                                 /**< Frames handed to the underlying writer */
+    uint64_t bytes_written = 0;                                  /**< Serialized bytes handed to the underlying writer */
+    uint64_t frames_dropped_full = 0;                            /**< Frames dropped because the buffer stayed full for max_wait */
+    uint64_t frames_dropped_degraded = 0;                        /**< Frames of droppable topics dropped above the degrade threshold */
+    uint64_t frames_dropped_oversize = 0;                        /**< Frames dropped because they are larger than the buffer */
+    uint64_t write_errors = 0;                                   /**< Frames the underlying writer failed to write */
+    size_t max_buffer_usage = 0;                                 /**< Highest buffer fill level in bytes */
+    std::chrono::nanoseconds max_write_time{0};                  /**< Longest time spent in WriteMessage() / WriteRawMessage() */
+    std::unordered_map<std::string, uint64_t> dropped_per_topic; /**< Dropped frames per topic (all reasons) */
+};
+
+/**
+ * @brief Bounded-latency writer for real-time recording (HIL, real-time SIL)
+ *
+ * Wraps a binary, MCAP or TXTH writer. WriteMessage() serializes the message directly
+ * into a buffer that is allocated on Open(), and WriteRawMessage() copies the bytes into
+ * it. A background thread hands the frames to the wrapped writer, so chunk compression,
+ * file I/O and device stalls never block the caller. After Open(), writes do not allocate
+ * memory, except once for each topic that was not registered with AddTopic().
+ *
+ * If the buffer cannot take a frame, the write waits up to max_wait and then drops the
+ * frame. Above the degrade threshold, frames of topics registered as droppable are
+ * dropped right away to keep room for the others. Drops are counted per reason and
+ * topic, see GetStatistics().
+ *
+ * @note Thread Safety: WriteMessage() and WriteRawMessage() must be called from one thread
+ * at a time (single producer). GetStatistics() may be called from any thread.
+ */
+class RealtimeTraceFileWriter final : public TraceFileWriter {
+   public:
+    /**
+     * @brief Creates a real-time writer around another writer
+     * @param writer Writer of the trace file format, not opened yet
+     * @param options Real-time options
+     * @throws std::invalid_argument if writer is null or the options are invalid
+     */
+    explicit RealtimeTraceFileWriter(std::unique_ptr<TraceFileWriter> writer, const RealtimeWriterOptions& options = {});
+
+    /** @brief Destructor, writes the buffered frames and closes the file if still open */
+    ~RealtimeTraceFileWriter() override;
+
+    /**
+     * @brief Opens the wrapped writer, allocates the buffer and starts the background thread
+     * @param file_path Path to the file to be created
+     * @return true if successful, false otherwise
+     */
+    bool Open(const std::filesystem::path& file_path) override;
+
+    /**
+     * @brief Serializes a message into the buffer
+     *
+     * Unregistered topics are registered with the descriptor of the message.
+     *
+     * @param message The protobuf message to write
+     * @param topic Topic/channel name (required for MCAP, empty for .osi/.txth)
+     * @return true if the frame was buffered, false if it was dropped
+     */
+    bool WriteMessage(const google::protobuf::Message& message, const std::string& topic = "") override;
+
+    /**
+     * @brief Copies an already serialized message into the buffer
+     * @param data Serialized message bytes
+     * @param size Number of serialized message bytes
+     * @param descriptor Protobuf descriptor of the message type
+     * @param topic Topic/channel name (required for MCAP, empty for .osi/.txth)
+     * @return true if the frame was buffered, false if it was dropped
+     */
+    bool WriteRawMessage(const char* data, size_t size, const google::protobuf::Descriptor* descriptor, const std::string& topic = "") override;
+
+    /**
+     * @brief Writes the buffered frames, stops the background thread and closes the file
+     */
+    void Close() override;
+
+    /**
+     * @brief Checks whether the wrapped writer failed to close the last file
+     * @return true if the last closed file may be incomplete
+     */
+    bool CloseFailed() const override { return writer_->CloseFailed(); }
+
+    /**
+     * @brief Forwards I/O options to the wrapped writer (before Open())
+     * @param options I/O options
+     */
+    void SetIoOptions(const tracefile::IoOptions& options) override { writer_->SetIoOptions(options); }
+
+    /**
+     * @brief Registers a topic
+     *
+     * Registering all topics before recording avoids the allocation of the first write.
+     *
+     * @param topic Topic/channel name
+     * @param descriptor Protobuf descriptor of the messages of the topic
+     * @param droppable Whether frames of this topic may be dropped above the degrade threshold (e.g. previews)
+     * @return false if max_topics topics are registered already or the topic is registered with another descriptor
+     */
+    bool AddTopic(const std::string& topic, const google::protobuf::Descriptor* descriptor, bool droppable = false);
+
+    /**
+     * @brief Blocks until the background thread handed all buffered frames to the wrapped writer
+     *
+     * Not meant for the real-time thread, e.g. use it before accessing GetWriter().
+     */
+    void Flush();
+
+    /** @brief Returns the accounting since Open() */
+    RealtimeWriterStatistics GetStatistics() const;
+
+    /**
+     * @brief Gets the wrapped writer, e.g. to add MCAP metadata or channels
+     *
+     * Only access it before Open(), or after Open() while no frames are buffered (see Flush()).
+     */
+    TraceFileWriter& GetWriter() { return *writer_; }
+
+   private:
+    /** @brief Registered topic, never moved after registration */
+    struct Topic {
+        std::string name;                                         /**< Topic name */
+        const google::protobuf::Descriptor* descriptor = nullptr; /**< Message type */
+        bool droppable = false;                                   /**< May be dropped above the degrade threshold */
+        std::atomic<uint64_t> dropped{0};                         /**< Dropped frames */
+    };
+
+    /** @brief Header of a frame in the buffer, followed by the serialized message */
+    struct FrameHeader {
+        uint32_t size;  /**< Number of serialized message bytes */
+        uint32_t topic; /**< Topic index, kPadding for unused space up to the end of the buffer */
+    };
+
+    static constexpr uint32_t kPadding = UINT32_MAX;
+
+    auto FindTopic(const std::string& topic, const google::protobuf::Descriptor* descriptor) -> Topic*;
+    auto Reserve(size_t size, Topic& topic, std::chrono::steady_clock::time_point start) -> char*;
+    void Commit();
+    void Drop(Topic& topic, std::atomic<uint64_t>& counter);
+    void RecordWriteTime(std::chrono::steady_clock::time_point start);
+    void Run();
+
+    std::unique_ptr<TraceFileWriter> writer_;   /**< Wrapped writer, used by the background thread while open */
+    RealtimeWriterOptions options_;             /**< Real-time options */
+    std::unique_ptr<Topic[]> topics_;           /**< Topic table of max_topics entries */
+    std::atomic<uint32_t> topic_count_{0};      /**< Number of registered topics */
+    std::unique_ptr<char[]> buffer_;            /**< Frame ring buffer */
+    size_t capacity_ = 0;                       /**< Size of buffer_ in bytes */
+    std::atomic<uint64_t> head_{0};             /**< Total bytes reserved by the producer */
+    std::atomic<uint64_t> tail_{0};             /**< Total bytes released by the background thread */
+    uint64_t reserved_ = 0;                     /**< Bytes of the frame being written, including padding */
+    std::thread thread_;                        /**< Background thread */
+    std::atomic<bool> stop_{false};             /**< Asks the background thread to finish */
+    std::atomic<bool> consumer_waiting_{false}; /**< The background thread sleeps on wake_ */
+    std::mutex mutex_;                          /**< Protects the waits on wake_ */
+    std::condition_variable wake_;              /**< Wakes the background thread */
+    std::condition_variable drained_;           /**< Signals Flush() that the buffer was emptied */
+
+    std::atomic<uint64_t> frames_written_{0};          /**< See RealtimeWriterStatistics */
+    std::atomic<uint64_t> bytes_written_{0};           /**< See RealtimeWriterStatistics */
+    std::atomic<uint64_t> frames_dropped_full_{0};     /**< See RealtimeWriterStatistics */
+    std::atomic<uint64_t> frames_dropped_degraded_{0}; /**< See RealtimeWriterStatistics */
+    std::atomic<uint64_t> frames_dropped_oversize_{0}; /**< See RealtimeWriterStatistics */
+    std::atomic<uint64_t> write_errors_{0};            /**< See RealtimeWriterStatistics */
+    std::atomic<size_t> max_buffer_usage_{0};          /**< See RealtimeWriterStatistics */
+    std::atomic<int64_t> max_write_time_ns_{0};        /**< See RealtimeWriterStatistics */
+};
+
+}  // namespace osi3
+#endif  // OSIUTILITIES_TRACEFILE_WRITER_REALTIMETRACEFILEWRITER_H_
@@ -6,7 +6,7 @@
 #ifndef OSIUTILITIES_TRACEFILE_WRITER_SINGLECHANNELBINARYTRACEFILEWRITER_H_
 #define OSIUTILITIES_TRACEFILE_WRITER_SINGLECHANNELBINARYTRACEFILEWRITER_H_
 
-#include <fstream>
+#include <vector>
 
 #include "osi-utilities/tracefile/Writer.h"
 
@@ -20,6 +20,10 @@ namespace osi3 {
  * Messages are separated by a length specification before each message.
  * The length is represented by a four-byte, little-endian, unsigned integer.
  *
+ * Messages are serialized straight into the file in chunks of
+ * tracefile::config::kStreamingSerializeChunkSize bytes after computing their size, so
+ * even very large messages (e.g. with camera images) are written without a serialized copy.
+ *
  * @note Thread Safety: Not thread-safe. External synchronization required for concurrent access.
  */
 class SingleChannelBinaryTraceFileWriter final : public TraceFileWriter {
@@ -38,6 +42,18 @@ class SingleChannelBinaryTraceFileWriter final : public TraceFileWriter {
      */
     void Close() override;
 
+    /**
+     * @brief Checks whether the last Close() failed to write buffered messages
+     * @return true if the last closed file may be incomplete
+     */
+    bool CloseFailed() const override { return close_failed_; }
+
+    /**
+     * @brief Selects the I/O engine used by the next Open()
+     * @param options I/O options
+     */
+    void SetIoOptions(const tracefile::IoOptions& options) override;
+
     /**
      * @brief Writes a protobuf message to the file (type-erased, virtual)
      *
@@ -49,6 +65,19 @@ class SingleChannelBinaryTraceFileWriter final : public TraceFileWriter {
      */
     bool WriteMessage(const google::protobuf::Message& message, const std::string& topic = "") override;
 
+    /**
+     * @brief Writes an already serialized message to the file without parsing it
+     *
+     * The bytes are framed with their length prefix and written as given.
+     *
+     * @param data Serialized message bytes
+     * @param size Number of serialized message bytes
+     * @param descriptor Ignored (the binary format stores no message type)
+     * @param topic Ignored (single-channel format)
+     * @return true if successful, false otherwise
+     */
+    bool WriteRawMessage(const char* data, size_t size, const google::protobuf::Descriptor* descriptor, const std::string& topic = "") override;
+
     /**
      * @brief Writes a protobuf message to the file (compile-time typed)
      * @tparam T Type of the protobuf message
@@ -59,7 +88,17 @@ class SingleChannelBinaryTraceFileWriter final : public TraceFileWriter {
     bool WriteMessage(const T& top_level_message);
 
    private:
-    std::ofstream trace_file_; /**< Output file stream. */
+    tracefile::BlockFileWriter trace_file_; /**< Output file. */
+    tracefile::IoOptions io_options_;       /**< I/O options of the next Open(). */
+    std::vector<char> stream_buffer_;       /**< Chunk buffer messages are serialized into. */
+    bool close_failed_ = false;             /**< Whether the last Close() failed. */
+
+    /**
+     * @brief Serializes a message with its length prefix straight into the file
+     * @param message The message to write
+     * @return true if successful, false otherwise
+     */
+    bool WriteSerialized(const google::protobuf::Message& message);
 };
 
 /** @brief Alias for SingleChannelBinaryTraceFileWriter matching Python naming convention */
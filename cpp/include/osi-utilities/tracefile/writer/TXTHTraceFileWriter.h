@@ -42,6 +42,12 @@ class [[deprecated("txth format is not reliably deserializable; use .osi or .mca
      */
     void Close() override;
 
+    /**
+     * @brief Checks whether the last Close() failed to write buffered messages
+     * @return true if the last closed file may be incomplete
+     */
+    bool CloseFailed() const override { return close_failed_; }
+
     /**
      * @brief Writes a protobuf message to the file (type-erased, virtual)
      *
@@ -63,7 +69,8 @@ class [[deprecated("txth format is not reliably deserializable; use .osi or .mca
     bool WriteMessage(const T& top_level_message);
 
    private:
-    std::ofstream trace_file_; /**< Output file stream. */
+    std::ofstream trace_file_;  /**< Output file stream. */
+    bool close_failed_ = false; /**< Whether the last Close() failed. */
 };
 
 /** @brief Alias for TXTHTraceFileWriter matching Python naming convention */
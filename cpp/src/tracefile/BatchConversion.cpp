@@ -0,0 +1,319 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/BatchConversion.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "osi-utilities/tracefile/MessageTypeUtils.h"
+#include "osi-utilities/tracefile/TraceFileConfig.h"
+#include "osi-utilities/tracefile/Writer.h"
+#include "osi-utilities/tracefile/reader/MCAPTraceFileReader.h"
+#include "osi-utilities/tracefile/writer/MCAPTraceFileWriter.h"
+#include "osi_sensorview.pb.h"
+
+namespace osi3::tracefile {
+
+namespace {
+
+const std::unordered_set<std::string> kTraceFileExtensions = {".osi", ".mcap", ".txth"};
+
+// Temporary output next to the final one, keeping the extension that selects the writer
+auto GetPartialPath(const std::filesystem::path& output_path) -> std::filesystem::path {
+    return output_path.parent_path() / (output_path.stem().string() + ".partial" + output_path.extension().string());
+}
+
+auto IsUpToDate(const std::filesystem::path& input_path, const std::filesystem::path& output_path) -> bool {
+    std::error_code error;
+    const auto output_time = std::filesystem::last_write_time(output_path, error);
+    if (error) {
+        return false;
+    }
+    const auto input_time = std::filesystem::last_write_time(input_path, error);
+    return !error && output_time >= input_time;
+}
+
+auto GetFileSize(const std::filesystem::path& path) -> uint64_t {
+    std::error_code error;
+    const auto size = std::filesystem::file_size(path, error);
+    return error ? 0 : size;
+}
+
+/** @brief Writes the frames of one reader to one writer, constructed before the writer is opened */
+class FrameConverter {
+   public:
+    FrameConverter(TraceFileReader& reader, TraceFileWriter& writer) : reader_(reader), writer_(writer) {
+        mcap_reader_ = dynamic_cast<MCAPTraceFileReader*>(&reader);
+        mcap_writer_ = dynamic_cast<MCAPTraceFileWriter*>(&writer);
+        if (mcap_reader_ != nullptr && mcap_writer_ != nullptr) {
+            file_metadata_ = mcap_reader_->GetFileMetadata();
+        }
+        // statistics describe the input, the writer collects them anew
+        if (std::any_of(file_metadata_.begin(), file_metadata_.end(), IsStatistics)) {
+            mcap_writer_->SetStatisticsEnabled(true);
+        }
+    }
+
+    // keeps file metadata between MCAP files, once the writer is open
+    void CopyFileMetadata() {
+        for (const auto& record : file_metadata_) {
+            if (!IsStatistics(record)) {
+                mcap_writer_->AddFileMetadata(record.first, record.second);
+            }
+        }
+    }
+
+    auto Copy() -> uint64_t {
+        uint64_t frame_count = 0;
+        while (reader_.HasNext()) {
+            const auto result = reader_.ReadRawMessage();
+            if (!result) {
+                break;
+            }
+            if (result->status == ReadStatus::kIncompatible) {
+                continue;
+            }
+            if (result->status != ReadStatus::kOk) {
+                throw std::runtime_error("Failed to read frame " + std::to_string(frame_count) + ": " + result->error_message);
+            }
+            const auto* descriptor = GetMessageDescriptor(result->message_type);
+            if (descriptor == nullptr) {
+                throw std::runtime_error("Unknown message type of frame " + std::to_string(frame_count));
+            }
+            const auto& topic = GetTopic(result->channel_name, descriptor, true);
+            if (!writer_.WriteRawMessage(result->data, result->size, descriptor, topic)) {
+                throw std::runtime_error("Failed to write frame " + std::to_string(frame_count));
+            }
+            ++frame_count;
+        }
+        return frame_count;
+    }
+
+    auto WrapGroundTruth() -> uint64_t {
+        uint64_t frame_count = 0;
+        std::string sensor_view;
+        while (reader_.HasNext()) {
+            const auto result = reader_.ReadRawMessage();
+            if (!result) {
+                break;
+            }
+            // other channels of MCAP files are not converted
+            if (result->status == ReadStatus::kIncompatible || (result->status == ReadStatus::kOk && result->message_type != ReaderTopLevelMessage::kGroundTruth)) {
+                continue;
+            }
+            if (result->status != ReadStatus::kOk || !WrapGroundTruthInSensorView({result->data, result->size}, sensor_view)) {
+                throw std::runtime_error("Failed to read frame " + std::to_string(frame_count) + ": " + result->error_message);
+            }
+            const auto& topic = GetTopic(result->channel_name, SensorView::descriptor(), false);
+            if (!writer_.WriteRawMessage(sensor_view.data(), sensor_view.size(), SensorView::descriptor(), topic)) {
+                throw std::runtime_error("Failed to write frame " + std::to_string(frame_count));
+            }
+            ++frame_count;
+        }
+        return frame_count;
+    }
+
+   private:
+    TraceFileReader& reader_;
+    TraceFileWriter& writer_;
+    MCAPTraceFileReader* mcap_reader_ = nullptr;
+    MCAPTraceFileWriter* mcap_writer_ = nullptr;
+    std::vector<std::pair<std::string, std::unordered_map<std::string, std::string>>> file_metadata_;
+    std::unordered_set<std::string> topics_;
+    std::string default_topic_;
+
+    static auto IsStatistics(const std::pair<std::string, std::unordered_map<std::string, std::string>>& record) -> bool {
+        return record.first == config::kOsiTraceStatisticsMetadataName;
+    }
+
+    // Output topic of a channel; MCAP channels are registered on first use, optionally keeping their metadata
+    auto GetTopic(const std::string& channel_name, const google::protobuf::Descriptor* descriptor, const bool keep_metadata) -> const std::string& {
+        if (channel_name.empty()) {
+            default_topic_ = descriptor->name();
+            return default_topic_;
+        }
+        if (mcap_writer_ != nullptr && topics_.insert(channel_name).second) {
+            const auto channel_metadata = mcap_reader_ != nullptr && keep_metadata ? mcap_reader_->GetChannelMetadata(channel_name) : std::nullopt;
+            mcap_writer_->AddChannel(channel_name, descriptor, channel_metadata.value_or(std::unordered_map<std::string, std::string>{}));
+        }
+        return channel_name;
+    }
+};
+
+auto ConvertToPath(const std::filesystem::path& input_path, const std::filesystem::path& output_path, const std::filesystem::path& writer_path,
+                   const TraceConversion conversion, const ReaderTopLevelMessage message_type, const IoOptions& io_options) -> uint64_t {
+    const auto reader = TraceFileReaderFactory::openReader(input_path, message_type, io_options);
+    const auto writer = TraceFileWriterFactory::createWriter(writer_path);
+    writer->SetIoOptions(io_options);
+    FrameConverter converter(*reader, *writer);
+    if (!writer->Open(output_path)) {
+        throw std::runtime_error("Failed to open output trace file " + output_path.string());
+    }
+    converter.CopyFileMetadata();
+    const auto frame_count = conversion == TraceConversion::kCopy ? converter.Copy() : converter.WrapGroundTruth();
+    reader->Close();
+    writer->Close();
+    if (writer->CloseFailed()) {
+        throw std::runtime_error("Failed to finish output trace file " + output_path.string());
+    }
+    return frame_count;
+}
+
+void ConvertOne(BatchConversionResult& result, const BatchConversionOptions& options) {
+    const auto start = std::chrono::steady_clock::now();
+    result.input_bytes = GetFileSize(result.input_path);
+    if (!options.force && IsUpToDate(result.input_path, result.output_path)) {
+        result.status = BatchConversionStatus::kSkipped;
+        return;
+    }
+    try {
+        result.frame_count = ConvertTraceFile(result.input_path, result.output_path, options.conversion, options.message_type, options.io_options);
+        result.output_bytes = GetFileSize(result.output_path);
+        result.status = BatchConversionStatus::kConverted;
+    } catch (const std::exception& error) {
+        result.status = BatchConversionStatus::kFailed;
+        result.error_message = error.what();
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+auto ConvertTraceFile(const std::filesystem::path& input_path, const std::filesystem::path& output_path, const TraceConversion conversion,
+                      const ReaderTopLevelMessage message_type, const IoOptions& io_options) -> uint64_t {
+    const auto partial_path = GetPartialPath(output_path);
+    try {
+        const auto frame_count = ConvertToPath(input_path, partial_path, output_path, conversion, message_type, io_options);
+        std::filesystem::rename(partial_path, output_path);
+        return frame_count;
+    } catch (...) {
+        std::error_code error;
+        std::filesystem::remove(partial_path, error);
+        throw;
+    }
+}
+
+auto CollectTraceFiles(const std::vector<std::filesystem::path>& inputs) -> std::vector<std::filesystem::path> {
+    std::vector<std::filesystem::path> trace_files;
+    for (const auto& input : inputs) {
+        if (std::filesystem::is_directory(input)) {
+            std::vector<std::filesystem::path> directory_files;
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(input)) {
+                if (entry.is_regular_file() && kTraceFileExtensions.count(entry.path().extension().string()) > 0) {
+                    directory_files.push_back(entry.path());
+                }
+            }
+            std::sort(directory_files.begin(), directory_files.end());
+            trace_files.insert(trace_files.end(), directory_files.begin(), directory_files.end());
+        } else if (std::filesystem::exists(input)) {
+            trace_files.push_back(input);
+        } else {
+            throw std::runtime_error("Input does not exist: " + input.string());
+        }
+    }
+    return trace_files;
+}
+
+auto GetConversionOutputPath(const std::filesystem::path& input_path, const std::filesystem::path& output_directory, const BatchConversionOptions& options)
+    -> std::filesystem::path {
+    auto stem = input_path.stem().string();
+    if (options.conversion == TraceConversion::kGroundTruthToSensorView) {
+        if (const auto position = stem.find("_gt_"); position != std::string::npos) {
+            stem.replace(position, 4, "_sv_");
+        }
+    }
+    return output_directory / (stem + options.output_extension);
+}
+
+auto GetBatchThreadCount(const BatchConversionOptions& options, const size_t file_count) -> size_t {
+    size_t thread_count = options.thread_count > 0 ? options.thread_count : std::max<size_t>(1, std::thread::hardware_concurrency());
+    if (options.memory_budget > 0) {
+        const uint64_t job_memory = 2 * config::kDefaultChunkSize + 2 * options.io_options.block_size * options.io_options.queue_depth;
+        thread_count = std::min<size_t>(thread_count, static_cast<size_t>(options.memory_budget / job_memory));
+    }
+    return std::max<size_t>(1, std::min(thread_count, file_count));
+}
+
+auto ConvertTraceFiles(const std::vector<std::filesystem::path>& input_paths, const std::filesystem::path& output_directory, const BatchConversionOptions& options)
+    -> BatchConversionReport {
+    if (kTraceFileExtensions.count(options.output_extension) == 0) {
+        throw std::invalid_argument("Unsupported output format: " + options.output_extension);
+    }
+    const auto start = std::chrono::steady_clock::now();
+
+    BatchConversionReport report;
+    report.results.resize(input_paths.size());
+    // concurrent conversions to the same output would overwrite each other, e.g. equal names in different subdirectories
+    std::unordered_map<std::string, size_t> outputs;
+    for (size_t i = 0; i < input_paths.size(); ++i) {
+        report.results[i].input_path = input_paths[i];
+        report.results[i].output_path = GetConversionOutputPath(input_paths[i], output_directory, options);
+        if (const auto [output, inserted] = outputs.emplace(report.results[i].output_path.lexically_normal().string(), i); !inserted) {
+            throw std::invalid_argument("Inputs " + input_paths[output->second].string() + " and " + input_paths[i].string() + " are both converted to " +
+                                        report.results[i].output_path.string());
+        }
+    }
+    std::filesystem::create_directories(output_directory);
+
+    // biggest files first, so the batch does not end with one thread converting a big file
+    std::vector<size_t> schedule(input_paths.size());
+    std::iota(schedule.begin(), schedule.end(), 0);
+    std::vector<uint64_t> sizes(input_paths.size());
+    std::transform(input_paths.begin(), input_paths.end(), sizes.begin(), GetFileSize);
+    std::stable_sort(schedule.begin(), schedule.end(), [&sizes](const size_t lhs, const size_t rhs) { return sizes[lhs] > sizes[rhs]; });
+
+    std::atomic<size_t> next_job{0};
+    std::mutex callback_mutex;
+    const auto work = [&] {
+        for (size_t job = next_job++; job < schedule.size(); job = next_job++) {
+            auto& result = report.results[schedule[job]];
+            ConvertOne(result, options);
+            if (options.on_file_done) {
+                const std::lock_guard<std::mutex> lock(callback_mutex);
+                options.on_file_done(result);
+            }
+        }
+    };
+    report.thread_count = GetBatchThreadCount(options, input_paths.size());
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < report.thread_count; ++i) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (const auto& result : report.results) {
+        switch (result.status) {
+            case BatchConversionStatus::kConverted:
+                ++report.converted_count;
+                report.frame_count += result.frame_count;
+                report.input_bytes += result.input_bytes;
+                report.output_bytes += result.output_bytes;
+                break;
+            case BatchConversionStatus::kSkipped:
+                ++report.skipped_count;
+                break;
+            case BatchConversionStatus::kFailed:
+                ++report.failed_count;
+                break;
+        }
+    }
+    report.elapsed_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return report;
+}
+
+}  // namespace osi3::tracefile
@@ -0,0 +1,967 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/BlockFileIo.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define OSIUTILITIES_HAVE_PREAD 1
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define OSIUTILITIES_HAVE_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+namespace osi3::tracefile {
+
+namespace detail {
+
+/**
+ * @brief Queue of positional read and write requests completing in any order
+ *
+ * A request completes once all bytes were transferred, at the end of the file or on error.
+ */
+class IoQueue {
+   public:
+    enum class Operation : uint8_t {
+        kRead,  /**< Read size bytes at offset into buffer */
+        kWrite, /**< Write size bytes from buffer at offset */
+        kSync,  /**< Synchronize the file data to the device (buffer, size and offset unused) */
+    };
+
+    struct Completion {
+        size_t tag = 0;     /**< Tag passed to Submit() */
+        int64_t result = 0; /**< Number of bytes transferred, or -errno */
+    };
+
+    virtual ~IoQueue() = default;
+
+    virtual void Submit(Operation operation, int fd, char* buffer, size_t size, uint64_t offset, size_t tag) = 0;
+
+    /** @brief Blocks until a request completed */
+    virtual Completion Wait() = 0;
+
+    /** @brief Returns a completed request without blocking, if any */
+    virtual std::optional<Completion> Poll() = 0;
+};
+
+void AlignedDelete::operator()(char* buffer) const { ::operator delete[](buffer, std::align_val_t{config::kIoBufferAlignment}); }
+
+}  // namespace detail
+
+namespace {
+
+using Operation = detail::IoQueue::Operation;
+
+#ifdef OSIUTILITIES_HAVE_PREAD
+
+// Flushes the file data (and the metadata needed to read it) to the device
+auto SyncData(const int fd) -> int {
+#ifdef __APPLE__
+    return ::fsync(fd);
+#else
+    return ::fdatasync(fd);
+#endif
+}
+
+// Positional reads and writes on worker threads, one request per worker at a time
+class ThreadPoolQueue final : public detail::IoQueue {
+   public:
+    explicit ThreadPoolQueue(const size_t thread_count) {
+        for (size_t i = 0; i < thread_count; ++i) {
+            workers_.emplace_back([this] { Run(); });
+        }
+    }
+
+    ~ThreadPoolQueue() override {
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        request_cv_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    ThreadPoolQueue(const ThreadPoolQueue&) = delete;
+    ThreadPoolQueue& operator=(const ThreadPoolQueue&) = delete;
+    ThreadPoolQueue(ThreadPoolQueue&&) = delete;
+    ThreadPoolQueue& operator=(ThreadPoolQueue&&) = delete;
+
+    void Submit(const Operation operation, const int fd, char* buffer, const size_t size, const uint64_t offset, const size_t tag) override {
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            requests_.push_back({operation, fd, buffer, size, offset, tag});
+        }
+        request_cv_.notify_one();
+    }
+
+    auto Wait() -> Completion override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        completion_cv_.wait(lock, [this] { return !completions_.empty(); });
+        const auto completion = completions_.front();
+        completions_.pop_front();
+        return completion;
+    }
+
+    auto Poll() -> std::optional<Completion> override {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        if (completions_.empty()) {
+            return std::nullopt;
+        }
+        const auto completion = completions_.front();
+        completions_.pop_front();
+        return completion;
+    }
+
+   private:
+    struct Request {
+        Operation operation;
+        int fd;
+        char* buffer;
+        size_t size;
+        uint64_t offset;
+        size_t tag;
+    };
+
+    void Run() {
+        while (true) {
+            Request request{};
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                request_cv_.wait(lock, [this] { return stop_ || !requests_.empty(); });
+                if (requests_.empty()) {
+                    return;
+                }
+                request = requests_.front();
+                requests_.pop_front();
+            }
+            const auto result = Transfer(request);
+            {
+                const std::lock_guard<std::mutex> lock(mutex_);
+                completions_.push_back({request.tag, result});
+            }
+            completion_cv_.notify_one();
+        }
+    }
+
+    static auto Transfer(const Request& request) -> int64_t {
+        if (request.operation == Operation::kSync) {
+            return SyncData(request.fd) == 0 ? 0 : -static_cast<int64_t>(errno);
+        }
+        size_t done = 0;
+        while (done < request.size) {
+            const auto offset = static_cast<off_t>(request.offset + done);
+            const auto transferred = request.operation == Operation::kWrite ? ::pwrite(request.fd, request.buffer + done, request.size - done, offset)
+                                                   : ::pread(request.fd, request.buffer + done, request.size - done, offset);
+            if (transferred < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return -static_cast<int64_t>(errno);
+            }
+            if (transferred == 0) {
+                break;  // end of file
+            }
+            done += static_cast<size_t>(transferred);
+        }
+        return static_cast<int64_t>(done);
+    }
+
+    std::mutex mutex_;
+    std::condition_variable request_cv_;
+    std::condition_variable completion_cv_;
+    std::deque<Request> requests_;
+    std::deque<Completion> completions_;
+    std::vector<std::thread> workers_;
+    bool stop_ = false;
+};
+
+#endif  // OSIUTILITIES_HAVE_PREAD
+
+#ifdef OSIUTILITIES_HAVE_IO_URING
+
+// io_uring through the raw system calls, so no liburing dependency is needed.
+// Submission and completion happen on the calling thread; the kernel transfers the blocks in the meantime.
+class IoUringQueue final : public detail::IoQueue {
+   public:
+    static auto Create(const unsigned entries) -> std::unique_ptr<IoUringQueue> {
+        auto queue = std::unique_ptr<IoUringQueue>(new IoUringQueue());
+        if (!queue->Setup(entries)) {
+            return nullptr;
+        }
+        return queue;
+    }
+
+    ~IoUringQueue() override {
+        if (sqes_ != nullptr) {
+            ::munmap(sqes_, sqes_size_);
+        }
+        if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+            ::munmap(cq_ring_, cq_ring_size_);
+        }
+        if (sq_ring_ != nullptr) {
+            ::munmap(sq_ring_, sq_ring_size_);
+        }
+        if (ring_fd_ >= 0) {
+            ::close(ring_fd_);
+        }
+    }
+
+    IoUringQueue(const IoUringQueue&) = delete;
+    IoUringQueue& operator=(const IoUringQueue&) = delete;
+    IoUringQueue(IoUringQueue&&) = delete;
+    IoUringQueue& operator=(IoUringQueue&&) = delete;
+
+    void Submit(const Operation operation, const int fd, char* buffer, const size_t size, const uint64_t offset, const size_t tag) override {
+        auto& request = requests_[tag];
+        request = {operation, fd, buffer, size, offset, 0};
+        Push(tag, request);
+    }
+
+    auto Wait() -> Completion override {
+        while (true) {
+            io_uring_cqe cqe{};
+            if (!PopCompletion(cqe)) {
+                Enter(0, 1, IORING_ENTER_GETEVENTS);
+                continue;
+            }
+            if (auto completion = Complete(cqe)) {
+                return *completion;
+            }
+        }
+    }
+
+    auto Poll() -> std::optional<Completion> override {
+        io_uring_cqe cqe{};
+        while (PopCompletion(cqe)) {
+            if (auto completion = Complete(cqe)) {
+                return completion;
+            }
+        }
+        return std::nullopt;
+    }
+
+   private:
+    struct Request {
+        Operation operation;
+        int fd;
+        char* buffer;
+        size_t size;
+        uint64_t offset;
+        size_t done;
+    };
+
+    IoUringQueue() = default;
+
+    // Finishes the request of a completion entry, or resubmits what is left of it
+    auto Complete(const io_uring_cqe& cqe) -> std::optional<Completion> {
+        const auto tag = static_cast<size_t>(cqe.user_data);
+        auto& request = requests_.at(tag);
+        if (cqe.res == -EINTR || cqe.res == -EAGAIN) {
+            Push(tag, request);
+            return std::nullopt;
+        }
+        if (cqe.res < 0) {
+            requests_.erase(tag);
+            return Completion{tag, cqe.res};
+        }
+        request.done += static_cast<size_t>(cqe.res);
+        if (cqe.res > 0 && request.done < request.size) {
+            Push(tag, request);  // short transfer, request the rest
+            return std::nullopt;
+        }
+        const auto done = static_cast<int64_t>(request.done);
+        requests_.erase(tag);
+        return Completion{tag, done};
+    }
+
+    auto Setup(const unsigned entries) -> bool {
+        io_uring_params params{};
+        ring_fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (ring_fd_ < 0) {
+            return false;
+        }
+        // IORING_OP_READ and IORING_OP_WRITE were introduced in the same kernel release (5.6) as this feature flag
+        if ((params.features & IORING_FEAT_RW_CUR_POS) == 0) {
+            return false;
+        }
+
+        sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single_mmap) {
+            sq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+        }
+        sq_ring_ = Map(sq_ring_size_, IORING_OFF_SQ_RING);
+        if (sq_ring_ == nullptr) {
+            return false;
+        }
+        cq_ring_ = single_mmap ? sq_ring_ : Map(cq_ring_size_, IORING_OFF_CQ_RING);
+        if (cq_ring_ == nullptr) {
+            return false;
+        }
+        sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = static_cast<io_uring_sqe*>(Map(sqes_size_, IORING_OFF_SQES));
+        if (sqes_ == nullptr) {
+            return false;
+        }
+
+        auto* sq_ring = static_cast<char*>(sq_ring_);
+        sq_tail_ = reinterpret_cast<unsigned*>(sq_ring + params.sq_off.tail);
+        sq_mask_ = *reinterpret_cast<unsigned*>(sq_ring + params.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<unsigned*>(sq_ring + params.sq_off.array);
+        auto* cq_ring = static_cast<char*>(cq_ring_);
+        cq_head_ = reinterpret_cast<unsigned*>(cq_ring + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq_ring + params.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<unsigned*>(cq_ring + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq_ring + params.cq_off.cqes);
+        return true;
+    }
+
+    auto Map(const size_t size, const off_t offset) const -> void* {
+        void* memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, offset);
+        return memory == MAP_FAILED ? nullptr : memory;
+    }
+
+    // Queues one submission for the remaining bytes of a request and hands it to the kernel
+    void Push(const size_t tag, const Request& request) {
+        // Requests never outnumber the submission queue entries and are submitted immediately,
+        // so the slot at the tail is always free. Only this thread writes the tail.
+        const unsigned tail = *sq_tail_;
+        const unsigned index = tail & sq_mask_;
+        auto& sqe = sqes_[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.fd = request.fd;
+        sqe.user_data = tag;
+        if (request.operation == Operation::kSync) {
+            sqe.opcode = IORING_OP_FSYNC;
+            sqe.fsync_flags = IORING_FSYNC_DATASYNC;
+        } else {
+            sqe.opcode = request.operation == Operation::kWrite ? IORING_OP_WRITE : IORING_OP_READ;
+            sqe.addr = reinterpret_cast<uint64_t>(request.buffer + request.done);
+            sqe.len = static_cast<uint32_t>(std::min<size_t>(request.size - request.done, kMaxRequestSize));
+            sqe.off = request.offset + request.done;
+        }
+        sq_array_[index] = index;
+        __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+        Enter(1, 0, 0);
+    }
+
+    auto PopCompletion(io_uring_cqe& cqe) -> bool {
+        const unsigned head = *cq_head_;
+        if (head == __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE)) {
+            return false;
+        }
+        cqe = cqes_[head & cq_mask_];
+        __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    void Enter(const unsigned to_submit, const unsigned min_complete, const unsigned flags) const {
+        while (::syscall(__NR_io_uring_enter, ring_fd_, to_submit, min_complete, flags, nullptr, 0) < 0) {
+            if (errno != EINTR) {
+                throw std::runtime_error(std::string("io_uring_enter failed: ") + std::strerror(errno));
+            }
+        }
+    }
+
+    static constexpr size_t kMaxRequestSize = 1U << 30U; /**< Larger requests are split, io_uring lengths are 32 bit */
+
+    int ring_fd_ = -1;
+    void* sq_ring_ = nullptr;
+    void* cq_ring_ = nullptr;
+    size_t sq_ring_size_ = 0;
+    size_t cq_ring_size_ = 0;
+    io_uring_sqe* sqes_ = nullptr;
+    size_t sqes_size_ = 0;
+    unsigned* sq_tail_ = nullptr;
+    unsigned sq_mask_ = 0;
+    unsigned* sq_array_ = nullptr;
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned cq_mask_ = 0;
+    io_uring_cqe* cqes_ = nullptr;
+    std::unordered_map<size_t, Request> requests_;
+};
+
+#endif  // OSIUTILITIES_HAVE_IO_URING
+
+// Creates the request queue of the requested backend; falls back from io_uring to pread and from pread to streams
+auto CreateQueue(IoBackend& backend, const size_t queue_depth) -> std::unique_ptr<detail::IoQueue> {
+#ifdef OSIUTILITIES_HAVE_IO_URING
+    if (backend == IoBackend::kIoUring) {
+        if (auto queue = IoUringQueue::Create(static_cast<unsigned>(queue_depth))) {
+            return queue;
+        }
+    }
+#endif
+    if (backend == IoBackend::kIoUring) {
+        backend = IoBackend::kPread;
+    }
+#ifdef OSIUTILITIES_HAVE_PREAD
+    if (backend == IoBackend::kPread) {
+        return std::make_unique<ThreadPoolQueue>(queue_depth);
+    }
+#endif
+    backend = IoBackend::kStream;
+    return nullptr;
+}
+
+auto ValidateOptions(const IoOptions& options) -> bool {
+    if (options.block_size == 0 || options.queue_depth == 0) {
+        std::cerr << "ERROR: I/O block size and queue depth must be greater than zero\n";
+        return false;
+    }
+    return true;
+}
+
+// Allocates uninitialized, page-aligned block buffers
+auto AllocateBlock(const size_t size) -> detail::AlignedBuffer { return detail::AlignedBuffer(new (std::align_val_t{config::kIoBufferAlignment}) char[size]); }
+
+}  // namespace
+
+auto IsIoUringAvailable() -> bool {
+#ifdef OSIUTILITIES_HAVE_IO_URING
+    static const bool available = IoUringQueue::Create(1) != nullptr;
+    return available;
+#else
+    return false;
+#endif
+}
+
+// ============================================================================
+// BlockFileReader
+// ============================================================================
+
+BlockFileReader::BlockFileReader() = default;
+
+BlockFileReader::~BlockFileReader() { Close(); }
+
+auto BlockFileReader::Open(const std::filesystem::path& file_path, const IoOptions& options) -> bool {
+    if (IsOpen()) {
+        std::cerr << "ERROR: Opening file " << file_path << ", reader has already a file opened" << std::endl;
+        return false;
+    }
+    if (!ValidateOptions(options)) {
+        return false;
+    }
+    options_ = options;
+    backend_ = options.backend;
+    failed_ = false;
+    position_ = 0;
+    queue_ = CreateQueue(backend_, options.queue_depth);
+
+    if (!queue_) {
+        stream_.open(file_path, std::ios::binary | std::ios::ate);
+        if (!stream_) {
+            stream_.close();
+            return false;
+        }
+        file_size_ = static_cast<uint64_t>(stream_.tellg());
+        stream_.seekg(0);
+        return true;
+    }
+
+#ifdef OSIUTILITIES_HAVE_PREAD
+    fd_ = ::open(file_path.c_str(), O_RDONLY | O_CLOEXEC);
+    struct stat file_status {};
+    if (fd_ < 0 || ::fstat(fd_, &file_status) != 0) {
+        Close();
+        return false;
+    }
+    file_size_ = static_cast<uint64_t>(file_status.st_size);
+    blocks_.resize(options_.queue_depth);
+    for (auto& block : blocks_) {
+        block.data = AllocateBlock(options_.block_size);
+    }
+    StartReadAhead(0);
+#endif
+    return true;
+}
+
+auto BlockFileReader::Open(std::unique_ptr<FileSource> source) -> bool {
+    if (IsOpen()) {
+        std::cerr << "ERROR: Opening a file source, reader has already a file opened" << std::endl;
+        return false;
+    }
+    if (!source) {
+        return false;
+    }
+    failed_ = false;
+    position_ = 0;
+    file_size_ = source->Size();
+    source_ = std::move(source);
+    return true;
+}
+
+void BlockFileReader::Close() {
+    source_.reset();
+    if (queue_) {
+        DrainPending();
+        queue_.reset();
+    }
+#ifdef OSIUTILITIES_HAVE_PREAD
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+#endif
+    if (stream_.is_open()) {
+        stream_.close();
+    }
+    blocks_.clear();
+    current_ = 0;
+    block_position_ = 0;
+    position_ = 0;
+    next_offset_ = 0;
+    file_size_ = 0;
+}
+
+auto BlockFileReader::IsOpen() const -> bool { return fd_ >= 0 || stream_.is_open() || source_ != nullptr; }
+
+auto BlockFileReader::Read(char* destination, const size_t size) -> size_t {
+    if (source_) {
+        if (failed_ || position_ >= file_size_) {
+            return 0;
+        }
+        const auto count = static_cast<size_t>(std::min<uint64_t>(size, file_size_ - position_));
+        try {
+            source_->ReadAt(destination, position_, count);
+        } catch (const std::exception& error) {
+            std::cerr << "ERROR: Failed to read from file: " << error.what() << '\n';
+            failed_ = true;
+            return 0;
+        }
+        position_ += count;
+        return count;
+    }
+    if (!queue_) {
+        if (!stream_.is_open()) {
+            return 0;
+        }
+        stream_.read(destination, static_cast<std::streamsize>(size));
+        const auto read = static_cast<size_t>(stream_.gcount());
+        if (read < size) {
+            failed_ = failed_ || !stream_.eof();
+            stream_.clear();
+        }
+        position_ += read;
+        return read;
+    }
+    return Consume(destination, size);
+}
+
+void BlockFileReader::Seek(const uint64_t offset) {
+    if (source_) {
+        position_ = offset;
+        return;
+    }
+    if (!queue_) {
+        stream_.clear();
+        stream_.seekg(static_cast<std::streamoff>(offset));
+        position_ = offset;
+        return;
+    }
+    if (offset == position_) {
+        return;
+    }
+    // Forward seeks into blocks that were already requested keep the read-ahead going
+    if (offset > position_ && offset < next_offset_ && !failed_) {
+        Consume(nullptr, offset - position_);
+        if (position_ == offset) {
+            return;
+        }
+    }
+    StartReadAhead(offset);
+}
+
+auto BlockFileReader::Consume(char* destination, const uint64_t size) -> size_t {
+    uint64_t total = 0;
+    try {
+        while (total < size && !failed_) {
+            WaitFor(current_);
+            auto& block = blocks_[current_];
+            if (failed_) {
+                break;
+            }
+            const size_t available = block.length - block_position_;
+            if (available == 0) {
+                if (block.length == 0) {
+                    break;  // end of file
+                }
+                // Block consumed: reuse its buffer for the next request and continue with the following block
+                SubmitNext(current_);
+                current_ = (current_ + 1) % blocks_.size();
+                block_position_ = 0;
+                continue;
+            }
+            const auto count = static_cast<size_t>(std::min<uint64_t>(available, size - total));
+            if (destination != nullptr) {
+                std::memcpy(destination + total, block.data.get() + block_position_, count);
+            }
+            total += count;
+            block_position_ += count;
+            position_ += count;
+        }
+    } catch (const std::exception& error) {
+        std::cerr << "ERROR: Failed to read from file: " << error.what() << '\n';
+        failed_ = true;
+    }
+    return static_cast<size_t>(total);
+}
+
+void BlockFileReader::StartReadAhead(const uint64_t offset) {
+    DrainPending();
+    position_ = offset;
+    next_offset_ = offset;
+    current_ = 0;
+    block_position_ = 0;
+    try {
+        for (size_t i = 0; i < blocks_.size(); ++i) {
+            SubmitNext(i);
+        }
+    } catch (const std::exception& error) {
+        std::cerr << "ERROR: Failed to read from file: " << error.what() << '\n';
+        failed_ = true;
+    }
+}
+
+void BlockFileReader::SubmitNext(const size_t index) {
+    auto& block = blocks_[index];
+    block.offset = next_offset_;
+    block.length = 0;
+    block.pending = false;
+    if (next_offset_ >= file_size_) {
+        return;
+    }
+    block.length = static_cast<size_t>(std::min<uint64_t>(options_.block_size, file_size_ - next_offset_));
+    block.pending = true;
+    next_offset_ += block.length;
+    queue_->Submit(Operation::kRead, fd_, block.data.get(), block.length, block.offset, index);
+}
+
+void BlockFileReader::WaitFor(const size_t index) {
+    while (blocks_[index].pending) {
+        const auto completion = queue_->Wait();
+        auto& block = blocks_[completion.tag];
+        block.pending = false;
+        // A short read means the file shrank after Open()
+        if (completion.result < 0 || static_cast<uint64_t>(completion.result) != block.length) {
+            failed_ = true;
+            block.length = 0;
+        }
+    }
+}
+
+void BlockFileReader::DrainPending() {
+    try {
+        for (size_t i = 0; i < blocks_.size(); ++i) {
+            WaitFor(i);
+        }
+    } catch (const std::exception& error) {
+        std::cerr << "ERROR: Failed to read from file: " << error.what() << '\n';
+        failed_ = true;
+        for (auto& block : blocks_) {
+            block.pending = false;
+        }
+    }
+}
+
+// ============================================================================
+// BlockFileWriter
+// ============================================================================
+
+BlockFileWriter::BlockFileWriter() = default;
+
+BlockFileWriter::~BlockFileWriter() { Close(); }
+
+auto BlockFileWriter::Open(const std::filesystem::path& file_path, const IoOptions& options) -> bool {
+    if (IsOpen()) {
+        std::cerr << "ERROR: Opening file " << file_path << ", writer has already a file opened" << std::endl;
+        return false;
+    }
+    if (!ValidateOptions(options)) {
+        return false;
+    }
+    options_ = options;
+    backend_ = options.backend;
+    failed_ = false;
+    size_ = 0;
+    next_offset_ = 0;
+    current_ = 0;
+    sync_offset_ = 0;
+    sync_target_ = 0;
+    durable_size_ = 0;
+    sync_requested_ = false;
+    sync_pending_ = false;
+    last_sync_ = Clock::now();
+#ifdef OSIUTILITIES_HAVE_PREAD
+    if (backend_ == IoBackend::kStream && options.HasDurabilityOptions()) {
+        backend_ = IoBackend::kPread;  // file streams cannot be synchronized
+    }
+#endif
+    queue_ = CreateQueue(backend_, options.queue_depth);
+
+    if (!queue_) {
+        stream_.open(file_path, std::ios::binary);
+        if (!stream_) {
+            stream_.close();
+            return false;
+        }
+        return true;
+    }
+
+#ifdef OSIUTILITIES_HAVE_PREAD
+    fd_ = ::open(file_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        queue_.reset();
+        return false;
+    }
+    Preallocate(file_path);
+    blocks_.resize(options_.queue_depth);
+    for (auto& block : blocks_) {
+        block.data = AllocateBlock(options_.block_size);
+    }
+#endif
+    return true;
+}
+
+auto BlockFileWriter::Close() -> bool {
+    if (!IsOpen()) {
+        return true;
+    }
+    const bool synchronize = options_.sync_interval_bytes > 0 || options_.sync_interval.count() > 0;
+    bool success = synchronize ? Sync() : Flush();
+    try {
+        while (queue_ && sync_pending_) {
+            const auto completion = queue_->Wait();
+            HandleCompletion(completion.tag, completion.result);
+        }
+    } catch (const std::exception& error) {
+        std::cerr << "ERROR: Failed to write to file: " << error.what() << '\n';
+        success = false;
+    }
+    queue_.reset();
+#ifdef OSIUTILITIES_HAVE_PREAD
+    if (fd_ >= 0) {
+        success = ::close(fd_) == 0 && success;
+        fd_ = -1;
+    }
+#endif
+    if (stream_.is_open()) {
+        stream_.close();
+        success = !stream_.fail() && success;
+    }
+    blocks_.clear();
+    return success;
+}
+
+auto BlockFileWriter::IsOpen() const -> bool { return fd_ >= 0 || stream_.is_open(); }
+
+auto BlockFileWriter::Write(const char* data, size_t size) -> bool {
+    if (!queue_) {
+        stream_.write(data, static_cast<std::streamsize>(size));
+        size_ += size;
+        return stream_.good();
+    }
+    try {
+        while (size > 0 && !failed_) {
+            auto& block = blocks_[current_];
+            const auto count = std::min(size, options_.block_size - block.length);
+            std::memcpy(block.data.get() + block.length, data, count);
+            block.length += count;
+            data += count;
+            size -= count;
+            size_ += count;
+            if (block.length == options_.block_size) {
+                SubmitCurrent();
+            }
+        }
+        if (options_.sync_interval.count() > 0 && Clock::now() - last_sync_ >= options_.sync_interval) {
+            RequestSync();  // whole blocks only, the partially filled block stays buffered to keep the writes block-aligned
+        }
+        if (sync_requested_ || sync_pending_) {
+            PollCompletions();
+        }
+    } catch (const std::exception& error) {
+        std::cerr << "ERROR: Failed to write to file: " << error.what() << '\n';
+        failed_ = true;
+    }
+    return !failed_;
+}
+
+auto BlockFileWriter::Flush() -> bool {
+    if (!queue_) {
+        stream_.flush();
+        return stream_.good();
+    }
+    try {
+        SubmitTail();
+        for (size_t i = 0; i < blocks_.size(); ++i) {
+            WaitFor(i);
+        }
+    } catch (const std::exception& error) {
+        std::cerr << "ERROR: Failed to write to file: " << error.what() << '\n';
+        failed_ = true;
+    }
+    return !failed_;
+}
+
+auto BlockFileWriter::Sync() -> bool {
+    if (!Flush()) {
+        return false;
+    }
+    if (!queue_) {
+        return true;  // file streams can only be flushed
+    }
+    try {
+        // a running synchronization may not cover the tail written by Flush()
+        while (sync_pending_) {
+            const auto completion = queue_->Wait();
+            HandleCompletion(completion.tag, completion.result);
+        }
+        const uint64_t end = next_offset_ + blocks_[current_].length;
+        if (!failed_ && durable_size_ < end) {
+            sync_requested_ = false;
+            sync_pending_ = true;
+            sync_target_ = end;
+            queue_->Submit(Operation::kSync, fd_, nullptr, 0, 0, blocks_.size());
+            while (sync_pending_) {
+                const auto completion = queue_->Wait();
+                HandleCompletion(completion.tag, completion.result);
+            }
+        }
+    } catch (const std::exception& error) {
+        std::cerr << "ERROR: Failed to synchronize file: " << error.what() << '\n';
+        failed_ = true;
+    }
+    sync_offset_ = next_offset_;
+    sync_requested_ = false;
+    last_sync_ = Clock::now();
+    return !failed_;
+}
+
+void BlockFileWriter::SubmitCurrent() {
+    auto& block = blocks_[current_];
+    if (block.length == 0) {
+        return;
+    }
+    block.offset = next_offset_;
+    block.pending = true;
+    queue_->Submit(Operation::kWrite, fd_, block.data.get(), block.length, block.offset, current_);
+    next_offset_ += block.length;
+    if (options_.sync_interval_bytes > 0 && next_offset_ - sync_offset_ >= options_.sync_interval_bytes) {
+        RequestSync();
+    }
+    // the next block to fill must have been written
+    current_ = (current_ + 1) % blocks_.size();
+    WaitFor(current_);
+    blocks_[current_].length = 0;
+    blocks_[current_].flushed = 0;
+}
+
+void BlockFileWriter::SubmitTail() {
+    auto& block = blocks_[current_];
+    if (block.length == block.flushed) {
+        return;
+    }
+    // written at the offset of the whole block, which stays buffered: once filled, SubmitCurrent() rewrites it at the same offset
+    block.offset = next_offset_;
+    block.flushed = block.length;
+    block.pending = true;
+    queue_->Submit(Operation::kWrite, fd_, block.data.get(), block.length, block.offset, current_);
+}
+
+void BlockFileWriter::WaitFor(const size_t index) {
+    while (blocks_[index].pending) {
+        const auto completion = queue_->Wait();
+        HandleCompletion(completion.tag, completion.result);
+    }
+}
+
+void BlockFileWriter::HandleCompletion(const size_t tag, const int64_t result) {
+    if (tag == blocks_.size()) {  // synchronization
+        sync_pending_ = false;
+        if (result < 0) {
+            std::cerr << "ERROR: Failed to synchronize file: " << std::strerror(static_cast<int>(-result)) << '\n';
+            failed_ = true;
+        } else {
+            durable_size_ = std::max(durable_size_, sync_target_);
+        }
+    } else {
+        auto& block = blocks_[tag];
+        block.pending = false;
+        if (result < 0 || static_cast<uint64_t>(result) != block.length) {
+            failed_ = true;
+        }
+    }
+    SubmitSyncIfReady();
+}
+
+void BlockFileWriter::PollCompletions() {
+    while (const auto completion = queue_->Poll()) {
+        HandleCompletion(completion->tag, completion->result);
+    }
+}
+
+void BlockFileWriter::RequestSync() {
+    last_sync_ = Clock::now();
+    if (next_offset_ == sync_offset_) {
+        return;
+    }
+    sync_offset_ = next_offset_;
+    sync_requested_ = true;
+    SubmitSyncIfReady();
+}
+
+void BlockFileWriter::SubmitSyncIfReady() {
+    if (!sync_requested_ || sync_pending_ || failed_) {
+        return;
+    }
+    // writes complete in any order; only synchronize once all writes before sync_offset_ completed
+    for (const auto& block : blocks_) {
+        if (block.pending && block.offset < sync_offset_) {
+            return;
+        }
+    }
+    sync_requested_ = false;
+    sync_pending_ = true;
+    sync_target_ = sync_offset_;
+    queue_->Submit(Operation::kSync, fd_, nullptr, 0, 0, blocks_.size());
+}
+
+void BlockFileWriter::Preallocate(const std::filesystem::path& file_path) {
+#if defined(__linux__)
+    // FALLOC_FL_KEEP_SIZE reserves the blocks without moving the end of the file
+    if (options_.preallocate_size > 0 && ::fallocate(fd_, FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(options_.preallocate_size)) != 0) {
+        std::cerr << "WARNING: Failed to preallocate " << options_.preallocate_size << " bytes for " << file_path << ": " << std::strerror(errno) << '\n';
+    }
+#else
+    (void)file_path;
+#endif
+}
+
+}  // namespace osi3::tracefile
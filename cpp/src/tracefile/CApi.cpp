@@ -0,0 +1,246 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/CApi.h"
+
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "osi-utilities/tracefile/MessageTypeUtils.h"
+#include "osi-utilities/tracefile/Reader.h"
+#include "osi-utilities/tracefile/Writer.h"
+#include "osi-utilities/tracefile/reader/MCAPTraceFileReader.h"
+#include "osi-utilities/tracefile/writer/MCAPTraceFileWriter.h"
+
+struct osiu_reader {
+    std::unique_ptr<osi3::TraceFileReader> reader;
+    std::optional<osi3::RawReadResult> frame; /**< Last frame, owns the topic string handed out by osiu_reader_next() */
+};
+
+struct osiu_writer {
+    std::unique_ptr<osi3::TraceFileWriter> writer;
+};
+
+namespace {
+
+thread_local std::string last_error;
+
+auto Fail(const osiu_status status, std::string message) -> osiu_status {
+    last_error = std::move(message);
+    return status;
+}
+
+// Maps an OSIU_MESSAGE_TYPE_* value to the C++ enum, both share the same values
+auto ToMessageType(const int32_t message_type, osi3::ReaderTopLevelMessage& result) -> bool {
+    if (message_type < OSIU_MESSAGE_TYPE_UNKNOWN || message_type > OSIU_MESSAGE_TYPE_STREAMING_UPDATE) {
+        return false;
+    }
+    result = static_cast<osi3::ReaderTopLevelMessage>(message_type);
+    return true;
+}
+
+auto ToDescriptor(const int32_t message_type) -> const google::protobuf::Descriptor* {
+    osi3::ReaderTopLevelMessage type = osi3::ReaderTopLevelMessage::kUnknown;
+    return ToMessageType(message_type, type) ? osi3::tracefile::GetMessageDescriptor(type) : nullptr;
+}
+
+}  // namespace
+
+extern "C" {
+
+auto osiu_api_version() -> uint32_t { return OSIU_C_API_VERSION; }
+
+auto osiu_last_error() -> const char* { return last_error.c_str(); }
+
+auto osiu_reader_open(const char* path, const int32_t message_type, osiu_reader** reader) -> osiu_status {
+    if (path == nullptr || reader == nullptr) {
+        return Fail(OSIU_ERROR_INVALID_ARGUMENT, "path and reader must not be NULL");
+    }
+    *reader = nullptr;
+    osi3::ReaderTopLevelMessage type = osi3::ReaderTopLevelMessage::kUnknown;
+    if (!ToMessageType(message_type, type)) {
+        return Fail(OSIU_ERROR_INVALID_ARGUMENT, "Unknown message type " + std::to_string(message_type));
+    }
+    try {
+        auto handle = std::make_unique<osiu_reader>();
+        handle->reader = osi3::TraceFileReaderFactory::openReader(std::filesystem::u8path(path), type);
+        *reader = handle.release();
+        return OSIU_OK;
+    } catch (const std::exception& error) {
+        return Fail(OSIU_ERROR_OPEN, error.what());
+    }
+}
+
+auto osiu_reader_set_topics(osiu_reader* reader, const char* const* topics, const size_t topic_count) -> osiu_status {
+    if (reader == nullptr || (topics == nullptr && topic_count > 0)) {
+        return Fail(OSIU_ERROR_INVALID_ARGUMENT, "reader and topics must not be NULL");
+    }
+    auto* mcap_reader = dynamic_cast<osi3::MCAPTraceFileReader*>(reader->reader.get());
+    if (mcap_reader == nullptr) {
+        return Fail(OSIU_ERROR_INVALID_ARGUMENT, "Topics can only be set for MCAP trace files");
+    }
+    try {
+        std::unordered_set<std::string> topic_set;
+        for (size_t i = 0; i < topic_count; ++i) {
+            if (topics[i] == nullptr) {
+                return Fail(OSIU_ERROR_INVALID_ARGUMENT, "Topic names must not be NULL");
+            }
+            topic_set.emplace(topics[i]);
+        }
+        mcap_reader->SetTopics(topic_set);
+        return OSIU_OK;
+    } catch (const std::exception& error) {
+        return Fail(OSIU_ERROR_INVALID_ARGUMENT, error.what());
+    }
+}
+
+auto osiu_reader_next(osiu_reader* reader, osiu_frame* frame) -> osiu_status {
+    if (reader == nullptr || frame == nullptr) {
+        return Fail(OSIU_ERROR_INVALID_ARGUMENT, "reader and frame must not be NULL");
+    }
+    try {
+        reader->frame.reset();
+        if (!reader->reader->HasNext()) {
+            return OSIU_END_OF_TRACE;
+        }
+        reader->frame = reader->reader->ReadRawMessage();
+        if (!reader->frame) {
+            return OSIU_END_OF_TRACE;
+        }
+    } catch (const std::exception& error) {
+        return Fail(OSIU_ERROR_READ, error.what());
+    }
+
+    const auto& raw = *reader->frame;
+    if (raw.status == osi3::ReadStatus::kError) {
+        return Fail(OSIU_ERROR_READ, raw.error_message);
+    }
+    frame->data = reinterpret_cast<const uint8_t*>(raw.data);
+    frame->size = raw.size;
+    frame->message_type = static_cast<int32_t>(raw.message_type);
+    frame->status = static_cast<int32_t>(raw.status);
+    frame->log_time = raw.log_time;
+    frame->topic = raw.channel_name.c_str();
+    return OSIU_OK;
+}
+
+void osiu_reader_close(osiu_reader* reader) {
+    if (reader == nullptr) {
+        return;
+    }
+    reader->frame.reset();
+    try {
+        reader->reader->Close();
+    } catch (const std::exception& error) {
+        last_error = error.what();
+    }
+    delete reader;  // NOLINT(cppcoreguidelines-owning-memory) handle allocated in osiu_reader_open()
+}
+
+auto osiu_writer_open(const char* path, osiu_writer** writer) -> osiu_status {
+    if (path == nullptr || writer == nullptr) {
+        return Fail(OSIU_ERROR_INVALID_ARGUMENT, "path and writer must not be NULL");
+    }
+    *writer = nullptr;
+    try {
+        const auto file_path = std::filesystem::u8path(path);
+        auto handle = std::make_unique<osiu_writer>();
+        handle->writer = osi3::TraceFileWriterFactory::createWriter(file_path);
+        if (!handle->writer->Open(file_path)) {
+            return Fail(OSIU_ERROR_OPEN, "Failed to open trace file: " + file_path.string());
+        }
+        *writer = handle.release();
+        return OSIU_OK;
+    } catch (const std::exception& error) {
+        return Fail(OSIU_ERROR_OPEN, error.what());
+    }
+}
+
+auto osiu_writer_add_file_metadata(osiu_writer* writer, const char* name, const char* const* keys, const char* const* values, const size_t entry_count) -> osiu_status {
+    if (writer == nullptr || name == nullptr || ((keys == nullptr || values == nullptr) && entry_count > 0)) {
+        return Fail(OSIU_ERROR_INVALID_ARGUMENT, "writer, name, keys and values must not be NULL");
+    }
+    auto* mcap_writer = dynamic_cast<osi3::MCAPTraceFileWriter*>(writer->writer.get());
+    if (mcap_writer == nullptr) {
+        return Fail(OSIU_ERROR_INVALID_ARGUMENT, "File metadata can only be added to MCAP trace files");
+    }
+    try {
+        std::unordered_map<std::string, std::string> entries;
+        for (size_t i = 0; i < entry_count; ++i) {
+            if (keys[i] == nullptr || values[i] == nullptr) {
+                return Fail(OSIU_ERROR_INVALID_ARGUMENT, "Metadata keys and values must not be NULL");
+            }
+            entries[keys[i]] = values[i];
+        }
+        if (!mcap_writer->AddFileMetadata(name, entries)) {
+            return Fail(OSIU_ERROR_WRITE, std::string("Failed to add file metadata ") + name);
+        }
+        return OSIU_OK;
+    } catch (const std::exception& error) {
+        return Fail(OSIU_ERROR_WRITE, error.what());
+    }
+}
+
+auto osiu_writer_add_channel(osiu_writer* writer, const char* topic, const int32_t message_type) -> osiu_status {
+    if (writer == nullptr || topic == nullptr) {
+        return Fail(OSIU_ERROR_INVALID_ARGUMENT, "writer and topic must not be NULL");
+    }
+    auto* mcap_writer = dynamic_cast<osi3::MCAPTraceFileWriter*>(writer->writer.get());
+    if (mcap_writer == nullptr) {
+        return Fail(OSIU_ERROR_INVALID_ARGUMENT, "Channels can only be added to MCAP trace files");
+    }
+    const auto* descriptor = ToDescriptor(message_type);
+    if (descriptor == nullptr) {
+        return Fail(OSIU_ERROR_INVALID_ARGUMENT, "Unknown message type " + std::to_string(message_type));
+    }
+    try {
+        mcap_writer->AddChannel(topic, descriptor);
+        return OSIU_OK;
+    } catch (const std::exception& error) {
+        return Fail(OSIU_ERROR_INVALID_ARGUMENT, error.what());
+    }
+}
+
+auto osiu_writer_write(osiu_writer* writer, const uint8_t* data, const size_t size, const int32_t message_type, const char* topic) -> osiu_status {
+    if (writer == nullptr || (data == nullptr && size > 0)) {
+        return Fail(OSIU_ERROR_INVALID_ARGUMENT, "writer and data must not be NULL");
+    }
+    const auto* descriptor = ToDescriptor(message_type);
+    if (descriptor == nullptr) {
+        return Fail(OSIU_ERROR_INVALID_ARGUMENT, "Unknown message type " + std::to_string(message_type));
+    }
+    try {
+        if (!writer->writer->WriteRawMessage(reinterpret_cast<const char*>(data), size, descriptor, topic != nullptr ? topic : "")) {
+            return Fail(OSIU_ERROR_WRITE, "Failed to write " + descriptor->full_name() + " message");
+        }
+        return OSIU_OK;
+    } catch (const std::exception& error) {
+        return Fail(OSIU_ERROR_WRITE, error.what());
+    }
+}
+
+auto osiu_writer_close(osiu_writer* writer) -> osiu_status {
+    if (writer == nullptr) {
+        return OSIU_OK;
+    }
+    osiu_status status = OSIU_OK;
+    try {
+        writer->writer->Close();
+        if (writer->writer->CloseFailed()) {
+            status = Fail(OSIU_ERROR_WRITE, "Failed to finish the trace file, it is incomplete");
+        }
+    } catch (const std::exception& error) {
+        status = Fail(OSIU_ERROR_WRITE, error.what());
+    }
+    delete writer;  // NOLINT(cppcoreguidelines-owning-memory) handle allocated in osiu_writer_open()
+    return status;
+}
+
+}  // extern "C"
@@ -0,0 +1,396 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/ChunkStore.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <mcap/mcap.hpp>
+#include <stdexcept>
+#include <thread>
+
+#include "osi-utilities/tracefile/BlockFileIo.h"
+#include "osi-utilities/tracefile/FrameFingerprint.h"
+
+namespace osi3::tracefile {
+
+namespace {
+
+// Seed of the second half of a block key
+constexpr uint64_t kSecondKeySeed = 0x9E3779B97F4A7C15ULL;
+constexpr size_t kKeyLength = 32;
+constexpr std::array<char, 8> kMcapMagic = {'\x89', 'M', 'C', 'A', 'P', '0', '\r', '\n'};
+// Opcode and length prefix of every MCAP record
+constexpr size_t kMcapRecordHeaderSize = 1 + 8;
+constexpr auto kStoreLinePrefix = "store ";
+
+auto IsValidKey(const std::string_view key) -> bool {
+    return key.size() == kKeyLength && std::all_of(key.begin(), key.end(), [](const char c) { return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'); });
+}
+
+void AppendHex(const uint64_t value, std::string& text) {
+    constexpr std::string_view kDigits = "0123456789abcdef";
+    for (int shift = 60; shift >= 0; shift -= 4) {
+        text += kDigits[(value >> shift) & 0xF];
+    }
+}
+
+// Name of a temporary file unique across the threads and processes adding to a store
+auto MakeTemporaryPath(const std::filesystem::path& path) -> std::filesystem::path {
+    static std::atomic<uint64_t> counter{0};
+    const auto thread = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    const auto time = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    std::string suffix = ".tmp.";
+    AppendHex(HashBytes(&time, sizeof(time), thread + counter.fetch_add(1)), suffix);
+    return path.string() + suffix;
+}
+
+void ReadExactly(BlockFileReader& file, char* destination, const size_t size, const std::filesystem::path& path) {
+    if (file.Read(destination, size) != size) {
+        throw std::runtime_error("Unexpected end of trace file " + path.string() + " at offset " + std::to_string(file.Tell()));
+    }
+}
+
+auto DecodeLittleEndian64(const char* data) -> uint64_t {
+    uint64_t value = 0;
+    for (int byte = 7; byte >= 0; --byte) {
+        value = (value << 8) | static_cast<uint8_t>(data[byte]);
+    }
+    return value;
+}
+
+/** @brief Adds the blocks of a trace file to a store and collects its manifest */
+class BlockSink {
+   public:
+    explicit BlockSink(ChunkStore& store) : store_(store) {}
+
+    // Stores the current block, if any, and starts a new one
+    void Flush() {
+        if (block_.empty()) {
+            return;
+        }
+        ManifestEntry entry;
+        entry.size = block_.size();
+        ++result_.block_count;
+        result_.total_size += block_.size();
+        if (store_.Put(block_, entry.key)) {
+            ++result_.added_block_count;
+            result_.added_size += block_.size();
+        }
+        entries_.push_back(std::move(entry));
+        block_.clear();
+    }
+
+    auto Block() -> std::string& { return block_; }
+    auto Entries() const -> const std::vector<ManifestEntry>& { return entries_; }
+    auto Result() -> ChunkStoreResult& { return result_; }
+
+   private:
+    ChunkStore& store_;
+    std::string block_;
+    std::vector<ManifestEntry> entries_;
+    ChunkStoreResult result_;
+};
+
+// Splits a .osi file after the frames whose hash is divisible by the average block frame count
+void SplitBinaryTraceFile(BlockFileReader& file, const std::filesystem::path& path, const ChunkStoreOptions& options, BlockSink& sink) {
+    const uint64_t boundary_mask = options.average_block_frames - 1;
+    auto& block = sink.Block();
+    while (!file.AtEnd()) {
+        uint32_t message_size = 0;
+        ReadExactly(file, reinterpret_cast<char*>(&message_size), sizeof(message_size), path);
+        if (message_size > config::kMaxExpectedMessageSize) {
+            throw std::runtime_error("Invalid frame size " + std::to_string(message_size) + " in " + path.string());
+        }
+        const size_t frame_offset = block.size() + sizeof(message_size);
+        block.append(reinterpret_cast<const char*>(&message_size), sizeof(message_size));
+        block.resize(frame_offset + message_size);
+        ReadExactly(file, block.data() + frame_offset, message_size, path);
+        if ((HashBytes(block.data() + frame_offset, message_size) & boundary_mask) == 0 || block.size() >= options.max_block_size) {
+            sink.Flush();
+        }
+    }
+}
+
+// Splits an MCAP file so that every chunk and attachment record is a block of its own
+void SplitMcapTraceFile(BlockFileReader& file, const std::filesystem::path& path, BlockSink& sink) {
+    auto& block = sink.Block();
+    block.resize(kMcapMagic.size());
+    ReadExactly(file, block.data(), kMcapMagic.size(), path);
+    if (!std::equal(kMcapMagic.begin(), kMcapMagic.end(), block.begin())) {
+        throw std::runtime_error("Missing MCAP magic in " + path.string());
+    }
+
+    bool in_own_block = false;
+    while (file.Size() - file.Tell() >= kMcapRecordHeaderSize) {
+        std::array<char, kMcapRecordHeaderSize> header{};
+        ReadExactly(file, header.data(), header.size(), path);
+        const auto opcode = static_cast<mcap::OpCode>(header[0]);
+        const uint64_t length = DecodeLittleEndian64(header.data() + 1);
+        if (length > file.Size() - file.Tell()) {
+            throw std::runtime_error("Invalid MCAP record length at offset " + std::to_string(file.Tell() - header.size()) + " of " + path.string());
+        }
+
+        const bool own_block = opcode == mcap::OpCode::Chunk || opcode == mcap::OpCode::Attachment;
+        // the message indexes of a chunk stay with it, they only differ if the chunk does
+        if (own_block || (in_own_block && opcode != mcap::OpCode::MessageIndex)) {
+            sink.Flush();
+        }
+        in_own_block = own_block || (in_own_block && opcode == mcap::OpCode::MessageIndex);
+
+        const size_t record_offset = block.size();
+        block.append(header.data(), header.size());
+        block.resize(record_offset + header.size() + length);
+        ReadExactly(file, block.data() + record_offset + header.size(), length, path);
+    }
+    // trailing magic
+    const auto rest = static_cast<size_t>(file.Size() - file.Tell());
+    const size_t rest_offset = block.size();
+    block.resize(rest_offset + rest);
+    ReadExactly(file, block.data() + rest_offset, rest, path);
+}
+
+// Opens the store of a manifest without creating it
+auto OpenManifestStore(const ChunkManifest& manifest, const std::filesystem::path& manifest_path) -> ChunkStore {
+    if (!std::filesystem::is_directory(manifest.store_root)) {
+        throw std::runtime_error("Missing chunk store " + manifest.store_root.string() + " of manifest " + manifest_path.string());
+    }
+    return ChunkStore(manifest.store_root);
+}
+
+void WriteManifest(const std::filesystem::path& manifest_path, const std::filesystem::path& store_root, const std::vector<ManifestEntry>& entries) {
+    // a relative store path keeps a dataset movable as a whole
+    std::error_code error;
+    auto store_path = std::filesystem::relative(store_root, manifest_path.parent_path().empty() ? "." : manifest_path.parent_path(), error);
+    if (error || store_path.empty()) {
+        store_path = std::filesystem::absolute(store_root);
+    }
+
+    const auto temporary_path = MakeTemporaryPath(manifest_path);
+    {
+        std::ofstream manifest(temporary_path, std::ios::binary | std::ios::trunc);
+        manifest << config::kChunkManifestHeader << '\n' << kStoreLinePrefix << store_path.generic_string() << '\n';
+        for (const auto& entry : entries) {
+            manifest << entry.key << ' ' << entry.size << '\n';
+        }
+        if (!manifest.flush()) {
+            throw std::runtime_error("Failed to write manifest " + manifest_path.string());
+        }
+    }
+    std::filesystem::rename(temporary_path, manifest_path, error);
+    if (error) {
+        std::filesystem::remove(temporary_path, error);
+        throw std::runtime_error("Failed to write manifest " + manifest_path.string());
+    }
+}
+
+}  // namespace
+
+ChunkStore::ChunkStore(std::filesystem::path root) : root_(std::move(root)) {
+    std::error_code error;
+    std::filesystem::create_directories(root_, error);
+    if (error || !std::filesystem::is_directory(root_)) {
+        throw std::runtime_error("Failed to create chunk store " + root_.string());
+    }
+}
+
+auto ChunkStore::ComputeKey(const std::string_view block) -> std::string {
+    std::string key;
+    key.reserve(kKeyLength);
+    AppendHex(HashBytes(block.data(), block.size()), key);
+    AppendHex(HashBytes(block.data(), block.size(), kSecondKeySeed), key);
+    return key;
+}
+
+auto ChunkStore::GetBlockPath(const std::string& key) const -> std::filesystem::path {
+    if (!IsValidKey(key)) {
+        throw std::runtime_error("Invalid chunk store key '" + key + "'");
+    }
+    return root_ / key.substr(0, 2) / key;
+}
+
+auto ChunkStore::Contains(const std::string& key) const -> bool {
+    std::error_code error;
+    return std::filesystem::is_regular_file(GetBlockPath(key), error);
+}
+
+auto ChunkStore::Put(const std::string_view block, std::string& key) -> bool {
+    key = ComputeKey(block);
+    const auto path = GetBlockPath(key);
+    std::error_code error;
+    if (std::filesystem::is_regular_file(path, error) && std::filesystem::file_size(path, error) == block.size()) {
+        return false;
+    }
+    std::filesystem::create_directories(path.parent_path(), error);
+
+    const auto temporary_path = MakeTemporaryPath(path);
+    {
+        std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+        file.write(block.data(), static_cast<std::streamsize>(block.size()));
+        if (!file.flush()) {
+            file.close();
+            std::filesystem::remove(temporary_path, error);
+            throw std::runtime_error("Failed to write block " + path.string());
+        }
+    }
+    // another process may have added the same block meanwhile, replacing it is harmless
+    std::filesystem::rename(temporary_path, path, error);
+    if (error) {
+        std::filesystem::remove(temporary_path, error);
+        throw std::runtime_error("Failed to write block " + path.string());
+    }
+    return true;
+}
+
+void ChunkStore::Get(const std::string& key, std::string& block) const {
+    const auto path = GetBlockPath(key);
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw std::runtime_error("Missing block " + key + " in chunk store " + root_.string());
+    }
+    block.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(block.data(), static_cast<std::streamsize>(block.size())) || ComputeKey(block) != key) {
+        throw std::runtime_error("Corrupt block " + key + " in chunk store " + root_.string());
+    }
+}
+
+auto ReadChunkManifest(const std::filesystem::path& manifest_path) -> ChunkManifest {
+    std::ifstream file(manifest_path);
+    if (!file) {
+        throw std::runtime_error("Failed to open manifest " + manifest_path.string());
+    }
+    std::string line;
+    if (!std::getline(file, line) || line != config::kChunkManifestHeader) {
+        throw std::runtime_error("Unsupported manifest format in " + manifest_path.string());
+    }
+    const std::string_view store_prefix = kStoreLinePrefix;
+    if (!std::getline(file, line) || line.compare(0, store_prefix.size(), store_prefix) != 0 || line.size() == store_prefix.size()) {
+        throw std::runtime_error("Missing store directory in manifest " + manifest_path.string());
+    }
+
+    ChunkManifest manifest;
+    manifest.store_root = std::filesystem::path(line.substr(store_prefix.size()));
+    if (manifest.store_root.is_relative()) {
+        manifest.store_root = manifest_path.parent_path() / manifest.store_root;
+    }
+    while (std::getline(file, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        const auto separator = line.find(' ');
+        ManifestEntry entry;
+        const char* const size_end = line.data() + line.size();
+        if (separator == std::string::npos || !IsValidKey(std::string_view(line).substr(0, separator)) ||
+            std::from_chars(line.data() + separator + 1, size_end, entry.size).ptr != size_end) {
+            throw std::runtime_error("Malformed entry '" + line + "' in manifest " + manifest_path.string());
+        }
+        entry.key = line.substr(0, separator);
+        manifest.entries.push_back(std::move(entry));
+    }
+    return manifest;
+}
+
+auto StoreTraceFile(const std::filesystem::path& trace_path, ChunkStore& store, const std::filesystem::path& manifest_path, const ChunkStoreOptions& options)
+    -> ChunkStoreResult {
+    const auto extension = trace_path.extension().string();
+    if (extension != ".osi" && extension != ".mcap") {
+        throw std::invalid_argument("Chunk stores support .osi and .mcap files, not " + trace_path.string());
+    }
+    if (options.average_block_frames == 0 || (options.average_block_frames & (options.average_block_frames - 1)) != 0) {
+        throw std::invalid_argument("The average block frame count must be a power of two");
+    }
+
+    BlockFileReader file;
+    if (!file.Open(trace_path)) {
+        throw std::runtime_error("Failed to open trace file " + trace_path.string());
+    }
+    BlockSink sink(store);
+    if (extension == ".osi") {
+        SplitBinaryTraceFile(file, trace_path, options, sink);
+    } else {
+        SplitMcapTraceFile(file, trace_path, sink);
+    }
+    sink.Flush();
+    if (file.HasError()) {
+        throw std::runtime_error("Failed to read trace file " + trace_path.string());
+    }
+
+    auto& result = sink.Result();
+    result.manifest_path = manifest_path.empty() ? std::filesystem::path(trace_path.string() + config::kChunkManifestExtension) : manifest_path;
+    WriteManifest(result.manifest_path, store.GetRoot(), sink.Entries());
+    return result;
+}
+
+ChunkStoreFileSource::ChunkStoreFileSource(const std::filesystem::path& manifest_path)
+    : manifest_(ReadChunkManifest(manifest_path)), store_(OpenManifestStore(manifest_, manifest_path)) {
+    offsets_.reserve(manifest_.entries.size() + 1);
+    offsets_.push_back(0);
+    std::error_code error;
+    for (const auto& entry : manifest_.entries) {
+        // only the presence is checked here, the content is verified when a block is loaded
+        const auto block_size = std::filesystem::file_size(store_.GetBlockPath(entry.key), error);
+        if (error || block_size != entry.size) {
+            throw std::runtime_error("Missing block " + entry.key + " of manifest " + manifest_path.string() + " in chunk store " + store_.GetRoot().string());
+        }
+        offsets_.push_back(offsets_.back() + entry.size);
+    }
+}
+
+void ChunkStoreFileSource::ReadAt(char* destination, uint64_t offset, size_t size) {
+    if (offset > Size() || size > Size() - offset) {
+        throw std::runtime_error("Read beyond the end of a stored trace file");
+    }
+    while (size > 0) {
+        // the block containing offset is the last one starting at or before it
+        const auto index = static_cast<size_t>(std::upper_bound(offsets_.begin(), offsets_.end(), offset) - offsets_.begin() - 1);
+        if (!has_loaded_block_ || loaded_index_ != index) {
+            has_loaded_block_ = false;
+            const auto& entry = manifest_.entries[index];
+            store_.Get(entry.key, loaded_block_);
+            if (loaded_block_.size() != entry.size) {
+                throw std::runtime_error("Block " + entry.key + " has " + std::to_string(loaded_block_.size()) + " bytes, the manifest lists " + std::to_string(entry.size));
+            }
+            loaded_index_ = index;
+            has_loaded_block_ = true;
+        }
+        const auto block_offset = static_cast<size_t>(offset - offsets_[index]);
+        const size_t count = std::min(size, loaded_block_.size() - block_offset);
+        std::memcpy(destination, loaded_block_.data() + block_offset, count);
+        destination += count;
+        offset += count;
+        size -= count;
+    }
+}
+
+void RestoreTraceFile(const std::filesystem::path& manifest_path, const std::filesystem::path& output_path) {
+    const auto manifest = ReadChunkManifest(manifest_path);
+    const auto store = OpenManifestStore(manifest, manifest_path);
+    BlockFileWriter output;
+    if (!output.Open(output_path)) {
+        throw std::runtime_error("Failed to create trace file " + output_path.string());
+    }
+    std::string block;
+    for (const auto& entry : manifest.entries) {
+        store.Get(entry.key, block);
+        if (block.size() != entry.size) {
+            throw std::runtime_error("Block " + entry.key + " has " + std::to_string(block.size()) + " bytes, the manifest lists " + std::to_string(entry.size));
+        }
+        if (!output.Write(block.data(), block.size())) {
+            throw std::runtime_error("Failed to write trace file " + output_path.string());
+        }
+    }
+    if (!output.Close()) {
+        throw std::runtime_error("Failed to write trace file " + output_path.string());
+    }
+}
+
+}  // namespace osi3::tracefile
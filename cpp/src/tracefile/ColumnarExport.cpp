@@ -0,0 +1,102 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/ColumnarExport.h"
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "osi_groundtruth.pb.h"
+#include "osi_sensordata.pb.h"
+
+namespace osi3::tracefile {
+
+namespace {
+
+constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+
+// Pose, motion and extent columns shared by MovingObjectColumns and DetectedObjectColumns
+template <typename Columns>
+void AppendBaseMoving(const BaseMoving& base, Columns& columns) {
+    const bool has_position = base.has_position();
+    columns.position_x.push_back(has_position ? base.position().x() : kNaN);
+    columns.position_y.push_back(has_position ? base.position().y() : kNaN);
+    columns.position_z.push_back(has_position ? base.position().z() : kNaN);
+
+    const bool has_orientation = base.has_orientation();
+    columns.orientation_roll.push_back(has_orientation ? base.orientation().roll() : kNaN);
+    columns.orientation_pitch.push_back(has_orientation ? base.orientation().pitch() : kNaN);
+    columns.orientation_yaw.push_back(has_orientation ? base.orientation().yaw() : kNaN);
+
+    const bool has_velocity = base.has_velocity();
+    columns.velocity_x.push_back(has_velocity ? base.velocity().x() : kNaN);
+    columns.velocity_y.push_back(has_velocity ? base.velocity().y() : kNaN);
+    columns.velocity_z.push_back(has_velocity ? base.velocity().z() : kNaN);
+
+    const bool has_dimension = base.has_dimension();
+    columns.dimension_length.push_back(has_dimension ? base.dimension().length() : kNaN);
+    columns.dimension_width.push_back(has_dimension ? base.dimension().width() : kNaN);
+    columns.dimension_height.push_back(has_dimension ? base.dimension().height() : kNaN);
+}
+
+// Parses every frame of the given type into one reused message and hands it to append
+template <typename Message, typename Columns, typename AppendFunction>
+auto Extract(TraceFileReader& reader, const ReaderTopLevelMessage message_type, AppendFunction append) -> Columns {
+    Columns columns;
+    Message message;
+    uint64_t frame_index = 0;
+
+    while (reader.HasNext()) {
+        const auto raw = reader.ReadRawMessage();
+        if (!raw) {
+            break;
+        }
+        if (raw->status == ReadStatus::kIncompatible || (raw->status == ReadStatus::kOk && raw->message_type != message_type)) {
+            continue;
+        }
+        if (raw->status == ReadStatus::kError) {
+            throw std::runtime_error("Failed to read frame " + std::to_string(frame_index) + ": " + raw->error_message);
+        }
+        if (!message.ParseFromArray(raw->data, static_cast<int>(raw->size))) {
+            throw std::runtime_error("Failed to parse frame " + std::to_string(frame_index) + " as " + Message::descriptor()->full_name());
+        }
+        append(message, frame_index, raw->log_time, columns);
+        ++frame_index;
+    }
+    return columns;
+}
+
+}  // namespace
+
+void AppendMovingObjects(const GroundTruth& ground_truth, const uint64_t frame_index, const uint64_t timestamp, MovingObjectColumns& columns) {
+    for (const auto& moving_object : ground_truth.moving_object()) {
+        columns.frame_index.push_back(frame_index);
+        columns.timestamp.push_back(timestamp);
+        columns.id.push_back(moving_object.id().value());
+        AppendBaseMoving(moving_object.base(), columns);
+    }
+}
+
+void AppendDetectedObjects(const SensorData& sensor_data, const uint64_t frame_index, const uint64_t timestamp, DetectedObjectColumns& columns) {
+    for (const auto& detected_object : sensor_data.moving_object()) {
+        const auto& header = detected_object.header();
+        columns.frame_index.push_back(frame_index);
+        columns.timestamp.push_back(timestamp);
+        columns.id.push_back(header.tracking_id_size() > 0 ? header.tracking_id(0).value() : 0);
+        columns.existence_probability.push_back(header.has_existence_probability() ? header.existence_probability() : kNaN);
+        AppendBaseMoving(detected_object.base(), columns);
+    }
+}
+
+auto ExtractMovingObjects(TraceFileReader& reader) -> MovingObjectColumns {
+    return Extract<GroundTruth, MovingObjectColumns>(reader, ReaderTopLevelMessage::kGroundTruth, AppendMovingObjects);
+}
+
+auto ExtractDetectedObjects(TraceFileReader& reader) -> DetectedObjectColumns {
+    return Extract<SensorData, DetectedObjectColumns>(reader, ReaderTopLevelMessage::kSensorData, AppendDetectedObjects);
+}
+
+}  // namespace osi3::tracefile
@@ -0,0 +1,353 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/FieldPath.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#include "osi-utilities/tracefile/WireFormatUtils.h"
+
+namespace osi3::tracefile {
+
+namespace {
+
+using google::protobuf::FieldDescriptor;
+using Component = CompiledFieldPath::Component;
+
+[[noreturn]] void ThrowInvalidPath(const std::string& expression, const std::string& reason) { throw std::runtime_error("Invalid field path '" + expression + "': " + reason); }
+
+auto GetFieldValueType(const FieldDescriptor* field) -> std::optional<FieldValueType> {
+    switch (field->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_DOUBLE:
+        case FieldDescriptor::CPPTYPE_FLOAT:
+            return FieldValueType::kDouble;
+        case FieldDescriptor::CPPTYPE_INT32:
+        case FieldDescriptor::CPPTYPE_INT64:
+        case FieldDescriptor::CPPTYPE_ENUM:
+            return FieldValueType::kInt64;
+        case FieldDescriptor::CPPTYPE_UINT32:
+        case FieldDescriptor::CPPTYPE_UINT64:
+            return FieldValueType::kUInt64;
+        case FieldDescriptor::CPPTYPE_BOOL:
+            return FieldValueType::kBool;
+        default:
+            return std::nullopt;
+    }
+}
+
+template <typename T>
+auto ReadValue(const google::protobuf::Message& message, const FieldDescriptor* field, const int index) -> T {
+    const auto* reflection = message.GetReflection();
+    const bool repeated = index >= 0;
+    switch (field->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_DOUBLE:
+            return static_cast<T>(repeated ? reflection->GetRepeatedDouble(message, field, index) : reflection->GetDouble(message, field));
+        case FieldDescriptor::CPPTYPE_FLOAT:
+            return static_cast<T>(repeated ? reflection->GetRepeatedFloat(message, field, index) : reflection->GetFloat(message, field));
+        case FieldDescriptor::CPPTYPE_INT32:
+            return static_cast<T>(repeated ? reflection->GetRepeatedInt32(message, field, index) : reflection->GetInt32(message, field));
+        case FieldDescriptor::CPPTYPE_INT64:
+            return static_cast<T>(repeated ? reflection->GetRepeatedInt64(message, field, index) : reflection->GetInt64(message, field));
+        case FieldDescriptor::CPPTYPE_UINT32:
+            return static_cast<T>(repeated ? reflection->GetRepeatedUInt32(message, field, index) : reflection->GetUInt32(message, field));
+        case FieldDescriptor::CPPTYPE_UINT64:
+            return static_cast<T>(repeated ? reflection->GetRepeatedUInt64(message, field, index) : reflection->GetUInt64(message, field));
+        case FieldDescriptor::CPPTYPE_ENUM:
+            return static_cast<T>(repeated ? reflection->GetRepeatedEnumValue(message, field, index) : reflection->GetEnumValue(message, field));
+        case FieldDescriptor::CPPTYPE_BOOL:
+            return static_cast<T>(repeated ? reflection->GetRepeatedBool(message, field, index) : reflection->GetBool(message, field));
+        default:
+            return T{};
+    }
+}
+
+template <typename T>
+void ExtractFromMessage(const google::protobuf::Message& message, const Component* component, const Component* end, std::vector<T>& values) {
+    const auto* field = component->field;
+    const bool is_value = component + 1 == end;
+    if (component->index == CompiledFieldPath::kSingular) {
+        if (is_value) {
+            values.push_back(ReadValue<T>(message, field, CompiledFieldPath::kSingular));
+        } else {
+            ExtractFromMessage(message.GetReflection()->GetMessage(message, field), component + 1, end, values);
+        }
+        return;
+    }
+    const int size = message.GetReflection()->FieldSize(message, field);
+    const int first = component->index == CompiledFieldPath::kAllElements ? 0 : component->index;
+    const int last = component->index == CompiledFieldPath::kAllElements ? size : std::min(size, component->index + 1);
+    for (int i = first; i < last; ++i) {
+        if (is_value) {
+            values.push_back(ReadValue<T>(message, field, i));
+        } else {
+            ExtractFromMessage(message.GetReflection()->GetRepeatedMessage(message, field, i), component + 1, end, values);
+        }
+    }
+}
+
+auto GetScalarWireType(const FieldDescriptor* field) -> WireType {
+    switch (field->type()) {
+        case FieldDescriptor::TYPE_DOUBLE:
+        case FieldDescriptor::TYPE_FIXED64:
+        case FieldDescriptor::TYPE_SFIXED64:
+            return WireType::kFixed64;
+        case FieldDescriptor::TYPE_FLOAT:
+        case FieldDescriptor::TYPE_FIXED32:
+        case FieldDescriptor::TYPE_SFIXED32:
+            return WireType::kFixed32;
+        default:
+            return WireType::kVarint;
+    }
+}
+
+// Converts the varint or the raw fixed32/fixed64 bits of a field to a value
+template <typename T>
+auto DecodeValue(const FieldDescriptor* field, const uint64_t raw) -> T {
+    switch (field->type()) {
+        case FieldDescriptor::TYPE_DOUBLE: {
+            double value = 0.0;
+            std::memcpy(&value, &raw, sizeof(value));
+            return static_cast<T>(value);
+        }
+        case FieldDescriptor::TYPE_FLOAT: {
+            const auto bits = static_cast<uint32_t>(raw);
+            float value = 0.0F;
+            std::memcpy(&value, &bits, sizeof(value));
+            return static_cast<T>(value);
+        }
+        case FieldDescriptor::TYPE_INT64:
+        case FieldDescriptor::TYPE_SFIXED64:
+            return static_cast<T>(static_cast<int64_t>(raw));
+        case FieldDescriptor::TYPE_INT32:
+        case FieldDescriptor::TYPE_SFIXED32:
+        case FieldDescriptor::TYPE_ENUM:
+            return static_cast<T>(static_cast<int32_t>(raw));
+        case FieldDescriptor::TYPE_UINT32:
+        case FieldDescriptor::TYPE_FIXED32:
+            return static_cast<T>(static_cast<uint32_t>(raw));
+        case FieldDescriptor::TYPE_SINT32:
+            return static_cast<T>(static_cast<int32_t>(static_cast<uint32_t>(raw >> 1U) ^ (0U - static_cast<uint32_t>(raw & 1U))));
+        case FieldDescriptor::TYPE_SINT64:
+            return static_cast<T>(static_cast<int64_t>((raw >> 1U) ^ (0U - (raw & 1U))));
+        case FieldDescriptor::TYPE_BOOL:
+            return static_cast<T>(raw != 0);
+        default:
+            return static_cast<T>(raw);
+    }
+}
+
+template <typename T>
+auto GetDefaultValue(const FieldDescriptor* field) -> T {
+    switch (field->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_DOUBLE:
+            return static_cast<T>(field->default_value_double());
+        case FieldDescriptor::CPPTYPE_FLOAT:
+            return static_cast<T>(field->default_value_float());
+        case FieldDescriptor::CPPTYPE_INT32:
+            return static_cast<T>(field->default_value_int32());
+        case FieldDescriptor::CPPTYPE_INT64:
+            return static_cast<T>(field->default_value_int64());
+        case FieldDescriptor::CPPTYPE_UINT32:
+            return static_cast<T>(field->default_value_uint32());
+        case FieldDescriptor::CPPTYPE_UINT64:
+            return static_cast<T>(field->default_value_uint64());
+        case FieldDescriptor::CPPTYPE_ENUM:
+            return static_cast<T>(field->default_value_enum()->number());
+        case FieldDescriptor::CPPTYPE_BOOL:
+            return static_cast<T>(field->default_value_bool());
+        default:
+            return T{};
+    }
+}
+
+// Decodes the elements of a packed repeated field, continuing the element count of earlier occurrences
+template <typename T>
+auto ExtractPacked(const std::string_view payload, const Component& component, int& element, std::vector<T>& values) -> bool {
+    const auto wire_type = GetScalarWireType(component.field);
+    size_t position = 0;
+    while (position < payload.size()) {
+        uint64_t raw = 0;
+        if (wire_type == WireType::kVarint) {
+            unsigned shift = 0;
+            bool complete = false;
+            while (!complete && shift < 64 && position < payload.size()) {
+                const auto byte = static_cast<uint8_t>(payload[position++]);
+                raw |= static_cast<uint64_t>(byte & 0x7FU) << shift;
+                complete = (byte & 0x80U) == 0;
+                shift += 7;
+            }
+            if (!complete) {
+                return false;
+            }
+        } else {
+            const size_t size = wire_type == WireType::kFixed64 ? sizeof(uint64_t) : sizeof(uint32_t);
+            if (payload.size() - position < size) {
+                return false;
+            }
+            for (size_t i = 0; i < size; ++i) {
+                raw |= static_cast<uint64_t>(static_cast<uint8_t>(payload[position + i])) << (8 * i);
+            }
+            position += size;
+        }
+        if (component.index == CompiledFieldPath::kAllElements || component.index == element) {
+            values.push_back(DecodeValue<T>(component.field, raw));
+        }
+        ++element;
+    }
+    return true;
+}
+
+template <typename T>
+auto ExtractFromWire(const std::string_view message, const Component* component, const Component* end, std::vector<T>& values) -> bool {
+    const auto* field = component->field;
+    const auto number = static_cast<uint32_t>(field->number());
+    const bool is_value = component + 1 == end;
+    const auto wire_type = is_value ? GetScalarWireType(field) : WireType::kLengthDelimited;
+    WireFieldReader reader(message);
+    WireField wire_field;
+
+    if (component->index == CompiledFieldPath::kSingular) {
+        // as when parsing, the last occurrence of a scalar wins and the occurrences of a message merge
+        std::optional<WireField> last;
+        std::string merged;  // concatenated occurrences of a message, which protobuf parses as their merge
+        size_t occurrences = 0;
+        while (reader.Next(wire_field)) {
+            if (wire_field.number == number && wire_field.type == wire_type) {
+                if (!is_value && occurrences > 0) {
+                    if (occurrences == 1) {
+                        merged.assign(last->payload);
+                    }
+                    merged.append(wire_field.payload);
+                }
+                last = wire_field;
+                ++occurrences;
+            }
+        }
+        if (reader.HasError()) {
+            return false;
+        }
+        if (is_value) {
+            values.push_back(last ? DecodeValue<T>(field, last->value) : GetDefaultValue<T>(field));
+            return true;
+        }
+        const std::string_view payload = occurrences > 1 ? std::string_view(merged) : last ? last->payload : std::string_view{};
+        return ExtractFromWire(payload, component + 1, end, values);
+    }
+
+    int element = 0;
+    while (reader.Next(wire_field)) {
+        if (wire_field.number != number) {
+            continue;
+        }
+        if (is_value && wire_field.type == WireType::kLengthDelimited) {
+            if (!ExtractPacked(wire_field.payload, *component, element, values)) {
+                return false;
+            }
+        } else if (wire_field.type == wire_type) {
+            if (component->index == CompiledFieldPath::kAllElements || component->index == element) {
+                if (is_value) {
+                    values.push_back(DecodeValue<T>(field, wire_field.value));
+                } else if (!ExtractFromWire(wire_field.payload, component + 1, end, values)) {
+                    return false;
+                }
+            }
+            ++element;
+        }
+        if (component->index >= 0 && element > component->index) {
+            break;
+        }
+    }
+    return !reader.HasError();
+}
+
+}  // namespace
+
+CompiledFieldPath::CompiledFieldPath(const google::protobuf::Descriptor* descriptor, const std::string_view expression) : descriptor_(descriptor), expression_(expression) {
+    if (descriptor == nullptr) {
+        ThrowInvalidPath(expression_, "message type is unknown");
+    }
+    const auto* message_type = descriptor;
+    size_t begin = 0;
+    while (begin <= expression.size()) {
+        const auto end = std::min(expression.find('.', begin), expression.size());
+        auto name = expression.substr(begin, end - begin);
+        begin = end + 1;
+        if (message_type == nullptr) {
+            ThrowInvalidPath(expression_, "'" + std::string(components_.back().field->name()) + "' is not a message field");
+        }
+
+        int index = kSingular;
+        if (const auto bracket = name.find('['); bracket != std::string_view::npos) {
+            const auto selector = name.substr(bracket + 1);
+            name = name.substr(0, bracket);
+            if (selector.empty() || selector.back() != ']') {
+                ThrowInvalidPath(expression_, "unterminated element selector of '" + std::string(name) + "'");
+            }
+            const auto digits = selector.substr(0, selector.size() - 1);
+            if (digits == "*") {
+                index = kAllElements;
+            } else if (digits.empty() || std::from_chars(digits.data(), digits.data() + digits.size(), index).ptr != digits.data() + digits.size() || index < 0) {
+                ThrowInvalidPath(expression_, "invalid element selector '[" + std::string(digits) + "]'");
+            }
+        }
+
+        const auto* field = message_type->FindFieldByName(std::string(name));
+        if (field == nullptr) {
+            ThrowInvalidPath(expression_, "message type '" + std::string(message_type->full_name()) + "' has no field '" + std::string(name) + "'");
+        }
+        if (field->is_repeated() && index == kSingular) {
+            ThrowInvalidPath(expression_, "repeated field '" + std::string(name) + "' needs an element selector such as [*]");
+        }
+        if (!field->is_repeated() && index != kSingular) {
+            ThrowInvalidPath(expression_, "singular field '" + std::string(name) + "' cannot have an element selector");
+        }
+        components_.push_back({field, index});
+        message_type = field->message_type();
+    }
+
+    const auto value_type = GetFieldValueType(components_.back().field);
+    if (!value_type) {
+        ThrowInvalidPath(expression_, "the path must end in a numeric, enum or bool field");
+    }
+    value_type_ = *value_type;
+}
+
+template <typename T>
+auto CompiledFieldPath::Extract(const google::protobuf::Message& message, std::vector<T>& values) const -> size_t {
+    if (message.GetDescriptor() != descriptor_) {
+        throw std::runtime_error("Cannot extract field path '" + expression_ + "' from a message of type '" + std::string(message.GetDescriptor()->full_name()) + "'");
+    }
+    const auto size = values.size();
+    ExtractFromMessage(message, components_.data(), components_.data() + components_.size(), values);
+    return values.size() - size;
+}
+
+template <typename T>
+auto CompiledFieldPath::ExtractSerialized(const std::string_view serialized, std::vector<T>& values) const -> bool {
+    return ExtractFromWire(serialized, components_.data(), components_.data() + components_.size(), values);
+}
+
+template size_t CompiledFieldPath::Extract<double>(const google::protobuf::Message&, std::vector<double>&) const;
+template size_t CompiledFieldPath::Extract<float>(const google::protobuf::Message&, std::vector<float>&) const;
+template size_t CompiledFieldPath::Extract<int64_t>(const google::protobuf::Message&, std::vector<int64_t>&) const;
+template size_t CompiledFieldPath::Extract<uint64_t>(const google::protobuf::Message&, std::vector<uint64_t>&) const;
+template size_t CompiledFieldPath::Extract<int32_t>(const google::protobuf::Message&, std::vector<int32_t>&) const;
+template size_t CompiledFieldPath::Extract<uint32_t>(const google::protobuf::Message&, std::vector<uint32_t>&) const;
+template size_t CompiledFieldPath::Extract<bool>(const google::protobuf::Message&, std::vector<bool>&) const;
+
+template bool CompiledFieldPath::ExtractSerialized<double>(std::string_view, std::vector<double>&) const;
+template bool CompiledFieldPath::ExtractSerialized<float>(std::string_view, std::vector<float>&) const;
+template bool CompiledFieldPath::ExtractSerialized<int64_t>(std::string_view, std::vector<int64_t>&) const;
+template bool CompiledFieldPath::ExtractSerialized<uint64_t>(std::string_view, std::vector<uint64_t>&) const;
+template bool CompiledFieldPath::ExtractSerialized<int32_t>(std::string_view, std::vector<int32_t>&) const;
+template bool CompiledFieldPath::ExtractSerialized<uint32_t>(std::string_view, std::vector<uint32_t>&) const;
+template bool CompiledFieldPath::ExtractSerialized<bool>(std::string_view, std::vector<bool>&) const;
+
+}  // namespace osi3::tracefile
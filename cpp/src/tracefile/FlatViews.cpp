@@ -0,0 +1,190 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/FlatViews.h"
+
+#include <cstring>
+
+namespace osi3::tracefile {
+
+namespace {
+
+auto AsDouble(const WireField& field) -> double {
+    double value = 0.0;
+    if (field.type == WireType::kFixed64) {
+        std::memcpy(&value, &field.value, sizeof(value));
+    }
+    return value;
+}
+
+auto IsMessage(const WireField& field, const uint32_t field_number) -> bool { return field.number == field_number && field.type == WireType::kLengthDelimited; }
+
+auto IsVarint(const WireField& field, const uint32_t field_number) -> bool { return field.number == field_number && field.type == WireType::kVarint; }
+
+// Vector3d, Dimension3d and Orientation3d all consist of three doubles with field numbers 1 to 3
+auto MergeDoubleTriple(const std::string_view serialized, double& first, double& second, double& third) -> bool {
+    static_assert(Vector3d::kXFieldNumber == 1 && Vector3d::kYFieldNumber == 2 && Vector3d::kZFieldNumber == 3);
+    static_assert(Dimension3d::kLengthFieldNumber == 1 && Dimension3d::kWidthFieldNumber == 2 && Dimension3d::kHeightFieldNumber == 3);
+    static_assert(Orientation3d::kRollFieldNumber == 1 && Orientation3d::kPitchFieldNumber == 2 && Orientation3d::kYawFieldNumber == 3);
+    WireFieldReader reader(serialized);
+    WireField field;
+    while (reader.Next(field)) {
+        switch (field.number) {
+            case 1:
+                first = AsDouble(field);
+                break;
+            case 2:
+                second = AsDouble(field);
+                break;
+            case 3:
+                third = AsDouble(field);
+                break;
+            default:
+                break;
+        }
+    }
+    return !reader.HasError();
+}
+
+auto MergeVector3d(const std::string_view serialized, Vector3dView& view) -> bool { return MergeDoubleTriple(serialized, view.x, view.y, view.z); }
+
+auto MergeDimension3d(const std::string_view serialized, Dimension3dView& view) -> bool { return MergeDoubleTriple(serialized, view.length, view.width, view.height); }
+
+auto MergeOrientation3d(const std::string_view serialized, Orientation3dView& view) -> bool { return MergeDoubleTriple(serialized, view.roll, view.pitch, view.yaw); }
+
+auto MergeIdentifier(const std::string_view serialized, uint64_t& value) -> bool {
+    WireFieldReader reader(serialized);
+    WireField field;
+    while (reader.Next(field)) {
+        if (IsVarint(field, Identifier::kValueFieldNumber)) {
+            value = field.value;
+        }
+    }
+    return !reader.HasError();
+}
+
+auto MergeVehicleClassificationType(const std::string_view serialized, int32_t& type) -> bool {
+    WireFieldReader reader(serialized);
+    WireField field;
+    while (reader.Next(field)) {
+        if (IsVarint(field, MovingObject::VehicleClassification::kTypeFieldNumber)) {
+            type = static_cast<int32_t>(field.value);
+        }
+    }
+    return !reader.HasError();
+}
+
+// has_ground_truth_id is kept across occurrences of the header, whose repeated ground_truth_id fields are concatenated
+auto MergeDetectedItemHeader(const std::string_view serialized, DetectedMovingObjectView& view, bool& has_ground_truth_id) -> bool {
+    WireFieldReader reader(serialized);
+    WireField field;
+    bool ok = true;
+    while (ok && reader.Next(field)) {
+        if (IsMessage(field, DetectedItemHeader::kTrackingIdFieldNumber)) {
+            ok = MergeIdentifier(field.payload, view.tracking_id);
+        } else if (IsMessage(field, DetectedItemHeader::kGroundTruthIdFieldNumber) && !has_ground_truth_id) {
+            view.ground_truth_id = 0;
+            ok = MergeIdentifier(field.payload, view.ground_truth_id);
+            has_ground_truth_id = true;
+        } else if (field.number == DetectedItemHeader::kExistenceProbabilityFieldNumber) {
+            view.existence_probability = AsDouble(field);
+        } else if (field.number == DetectedItemHeader::kAgeFieldNumber) {
+            view.age = AsDouble(field);
+        } else if (IsVarint(field, DetectedItemHeader::kMeasurementStateFieldNumber)) {
+            view.measurement_state = static_cast<int32_t>(field.value);
+        }
+    }
+    return ok && !reader.HasError();
+}
+
+auto MergeBaseMoving(const std::string_view serialized, BaseMovingView& view) -> bool {
+    WireFieldReader reader(serialized);
+    WireField field;
+    bool ok = true;
+    while (ok && reader.Next(field)) {
+        if (field.type != WireType::kLengthDelimited) {
+            continue;
+        }
+        switch (field.number) {
+            case BaseMoving::kDimensionFieldNumber:
+                ok = MergeDimension3d(field.payload, view.dimension);
+                break;
+            case BaseMoving::kPositionFieldNumber:
+                ok = MergeVector3d(field.payload, view.position);
+                break;
+            case BaseMoving::kOrientationFieldNumber:
+                ok = MergeOrientation3d(field.payload, view.orientation);
+                break;
+            case BaseMoving::kVelocityFieldNumber:
+                ok = MergeVector3d(field.payload, view.velocity);
+                break;
+            case BaseMoving::kAccelerationFieldNumber:
+                ok = MergeVector3d(field.payload, view.acceleration);
+                break;
+            case BaseMoving::kOrientationRateFieldNumber:
+                ok = MergeOrientation3d(field.payload, view.orientation_rate);
+                break;
+            case BaseMoving::kOrientationAccelerationFieldNumber:
+                ok = MergeOrientation3d(field.payload, view.orientation_acceleration);
+                break;
+            default:
+                break;
+        }
+    }
+    return ok && !reader.HasError();
+}
+
+}  // namespace
+
+// The views are reset once and then merged into, so a sub-message occurring several times
+// on the wire merges like protobuf does: set scalars overwrite, absent ones are kept.
+
+auto DecodeBaseMoving(const std::string_view serialized, BaseMovingView& view) -> bool {
+    view = BaseMovingView{};
+    return MergeBaseMoving(serialized, view);
+}
+
+auto DecodeMovingObject(const std::string_view serialized, MovingObjectView& view) -> bool {
+    view = MovingObjectView{};
+    view.serialized = serialized;
+    WireFieldReader reader(serialized);
+    WireField field;
+    bool ok = true;
+    while (ok && reader.Next(field)) {
+        if (IsMessage(field, MovingObject::kIdFieldNumber)) {
+            ok = MergeIdentifier(field.payload, view.id);
+        } else if (IsMessage(field, MovingObject::kBaseFieldNumber)) {
+            ok = MergeBaseMoving(field.payload, view.base);
+            view.has_base = true;
+        } else if (IsVarint(field, MovingObject::kTypeFieldNumber)) {
+            view.type = static_cast<int32_t>(field.value);
+        } else if (IsMessage(field, MovingObject::kVehicleClassificationFieldNumber)) {
+            ok = MergeVehicleClassificationType(field.payload, view.vehicle_type);
+        }
+    }
+    return ok && !reader.HasError();
+}
+
+auto DecodeDetectedMovingObject(const std::string_view serialized, DetectedMovingObjectView& view) -> bool {
+    view = DetectedMovingObjectView{};
+    view.serialized = serialized;
+    WireFieldReader reader(serialized);
+    WireField field;
+    bool has_ground_truth_id = false;
+    bool ok = true;
+    while (ok && reader.Next(field)) {
+        if (IsMessage(field, DetectedMovingObject::kHeaderFieldNumber)) {
+            ok = MergeDetectedItemHeader(field.payload, view, has_ground_truth_id);
+        } else if (IsMessage(field, DetectedMovingObject::kBaseFieldNumber)) {
+            ok = MergeBaseMoving(field.payload, view.base);
+            view.has_base = true;
+        } else if (IsMessage(field, DetectedMovingObject::kBaseRmseFieldNumber)) {
+            ok = MergeBaseMoving(field.payload, view.base_rmse);
+        }
+    }
+    return ok && !reader.HasError();
+}
+
+}  // namespace osi3::tracefile
@@ -0,0 +1,450 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/FrameCache.h"
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include "osi-utilities/tracefile/BlockFileIo.h"
+#include "osi-utilities/tracefile/FilenameUtils.h"
+#include "osi-utilities/tracefile/MessageTypeUtils.h"
+#include "osi-utilities/tracefile/WireFormatUtils.h"
+#include "osi-utilities/tracefile/reader/MCAPTraceFileReader.h"
+
+namespace osi3::tracefile {
+
+namespace {
+
+auto DecodeFrame(const char* data, const size_t size, const ReaderTopLevelMessage message_type, const uint64_t log_time, const size_t index)
+    -> std::shared_ptr<const CachedFrame> {
+    auto message = CreateMessage(message_type);
+    if (message == nullptr || !message->ParseFromArray(data, static_cast<int>(size))) {
+        throw std::runtime_error("Failed to parse frame " + std::to_string(index));
+    }
+    auto frame = std::make_shared<CachedFrame>();
+    frame->memory_size = message->SpaceUsedLong();
+    frame->message = std::move(message);
+    frame->message_type = message_type;
+    frame->log_time = log_time;
+    frame->index = index;
+    return frame;
+}
+
+}  // namespace
+
+/** @brief Frame index of a trace file and random access to its frames */
+class FrameCache::FileSource {
+   public:
+    using FrameCallback = std::function<void(std::shared_ptr<const CachedFrame>)>;
+
+    FileSource(const std::filesystem::path& path, std::string key, const IoOptions& io_options) : path_(path), key_(std::move(key)), io_options_(io_options) {
+        if (path.extension().string() == ".mcap") {
+            mcap_ = true;
+            IndexMcapFile();
+        } else {
+            IndexBinaryFile();
+        }
+    }
+
+    auto GetKey() const -> const std::string& { return key_; }
+
+    // Log times by frame index, nullptr for unknown topics
+    auto GetTimes(const std::string& topic) const -> const std::vector<uint64_t>* {
+        const auto channel = channels_.find(topic);
+        return channel != channels_.end() ? &channel->second.times : nullptr;
+    }
+
+    // Decodes the frames [first, end) of a channel, in order
+    void Load(const std::string& topic, const size_t first, const size_t end, const FrameCallback& on_frame) {
+        const auto& channel = channels_.at(topic);
+        if (mcap_) {
+            LoadMcapFrames(topic, channel, first, end, on_frame);
+        } else {
+            LoadBinaryFrames(channel, first, end, on_frame);
+        }
+    }
+
+   private:
+    struct Channel {
+        std::vector<uint64_t> times;                                          /**< Log time by frame index */
+        std::vector<uint64_t> offsets;                                        /**< .osi files: offset of the length prefix by frame index */
+        std::vector<uint32_t> sizes;                                          /**< .osi files: frame size by frame index */
+        ReaderTopLevelMessage message_type = ReaderTopLevelMessage::kUnknown; /**< Type of the messages */
+    };
+
+    std::filesystem::path path_;
+    std::string key_;
+    IoOptions io_options_;
+    bool mcap_ = false;
+    std::unordered_map<std::string, Channel> channels_;
+    std::mutex file_mutex_;           /**< Guards file_ and mcap_reader_ */
+    BlockFileReader file_;            /**< .osi files: reader seeking to the requested frames */
+    MCAPTraceFileReader mcap_reader_; /**< .mcap files: reader jumping to the chunks of the requested frames */
+
+    void IndexBinaryFile() {
+        auto& channel = channels_[""];
+        channel.message_type = InferMessageTypeFromFilename(path_);
+        const auto* descriptor = GetMessageDescriptor(channel.message_type);
+        if (descriptor == nullptr) {
+            throw std::runtime_error("Cannot infer the message type of " + path_.string() + " from its name");
+        }
+        const auto* timestamp_field = descriptor->FindFieldByName("timestamp");
+        const auto timestamp_field_number = timestamp_field != nullptr ? static_cast<uint32_t>(timestamp_field->number()) : 0U;
+
+        BlockFileReader index_file;
+        if (!index_file.Open(path_, io_options_)) {
+            throw std::runtime_error("Failed to open trace file " + path_.string());
+        }
+        std::vector<char> buffer;
+        while (!index_file.AtEnd()) {
+            const auto offset = index_file.Tell();
+            uint32_t message_size = 0;
+            if (index_file.Read(reinterpret_cast<char*>(&message_size), sizeof(message_size)) != sizeof(message_size) || message_size > config::kMaxExpectedMessageSize) {
+                throw std::runtime_error("Invalid frame at offset " + std::to_string(offset) + " of " + path_.string());
+            }
+            buffer.resize(message_size);
+            if (index_file.Read(buffer.data(), buffer.size()) != buffer.size()) {
+                throw std::runtime_error("Truncated frame at offset " + std::to_string(offset) + " of " + path_.string());
+            }
+            channel.offsets.push_back(offset);
+            channel.sizes.push_back(message_size);
+            channel.times.push_back(PeekTimestampNanoseconds({buffer.data(), buffer.size()}, timestamp_field_number).value_or(0));
+        }
+
+        // small blocks, so that seeking to a frame does not read its neighbours
+        IoOptions seek_options = io_options_;
+        seek_options.block_size = config::kIoBufferAlignment;
+        seek_options.queue_depth = 1;
+        if (!file_.Open(path_, seek_options)) {
+            throw std::runtime_error("Failed to open trace file " + path_.string());
+        }
+    }
+
+    void IndexMcapFile() {
+        mcap::ReadMessageOptions options;
+        options.readOrder = mcap::ReadMessageOptions::ReadOrder::LogTimeOrder;
+        // the reader stays open, so loading frames later reuses its summary instead of reopening the file
+        mcap_reader_.SetIoOptions(io_options_);
+        mcap_reader_.SetSkipIncompatibleMessages(true);
+        if (!mcap_reader_.Open(path_, options)) {
+            throw std::runtime_error("Failed to open trace file " + path_.string());
+        }
+        while (mcap_reader_.HasNext()) {
+            const auto raw = mcap_reader_.ReadRawMessage();
+            if (!raw) {
+                break;
+            }
+            if (raw->status != ReadStatus::kOk) {
+                continue;
+            }
+            auto& channel = channels_[raw->channel_name];
+            channel.message_type = raw->message_type;
+            channel.times.push_back(raw->log_time);
+        }
+    }
+
+    void LoadBinaryFrames(const Channel& channel, const size_t first, const size_t end, const FrameCallback& on_frame) {
+        std::vector<char> buffer;
+        for (size_t index = first; index < end; ++index) {
+            buffer.resize(channel.sizes[index]);
+            {
+                const std::lock_guard<std::mutex> lock(file_mutex_);
+                file_.Seek(channel.offsets[index] + config::kBinaryOsiMessageLengthPrefixSize);
+                if (file_.Read(buffer.data(), buffer.size()) != buffer.size()) {
+                    throw std::runtime_error("Failed to read frame " + std::to_string(index) + " of " + path_.string());
+                }
+            }
+            // parsing does not need the file, other frames can be read meanwhile
+            on_frame(DecodeFrame(buffer.data(), buffer.size(), channel.message_type, channel.times[index], index));
+        }
+    }
+
+    // Reads the time window of the frames in one pass; frames with equal log times are told apart by their order
+    void LoadMcapFrames(const std::string& topic, const Channel& channel, const size_t first, const size_t end, const FrameCallback& on_frame) {
+        mcap::ReadMessageOptions options;
+        options.readOrder = mcap::ReadMessageOptions::ReadOrder::LogTimeOrder;
+        options.startTime = channel.times[first];
+        options.endTime = channel.times[end - 1] + 1;
+        options.topicFilter = [topic](const std::string_view message_topic) noexcept { return message_topic == topic; };
+
+        struct RawFrame {
+            size_t index;
+            uint64_t log_time;
+            ReaderTopLevelMessage message_type;
+            std::string data;
+        };
+        std::vector<RawFrame> frames;
+        {
+            const std::lock_guard<std::mutex> lock(file_mutex_);
+            mcap_reader_.SetReadOptions(options);
+            uint64_t current_time = 0;
+            size_t index = 0;
+            bool started = false;
+            while (mcap_reader_.HasNext()) {
+                const auto raw = mcap_reader_.ReadRawMessage();
+                if (!raw) {
+                    break;
+                }
+                if (raw->status != ReadStatus::kOk) {
+                    continue;
+                }
+                if (!started || raw->log_time != current_time) {
+                    current_time = raw->log_time;
+                    index = static_cast<size_t>(std::lower_bound(channel.times.begin(), channel.times.end(), current_time) - channel.times.begin());
+                    started = true;
+                } else {
+                    ++index;
+                }
+                if (index >= end) {
+                    break;
+                }
+                if (index >= first) {
+                    frames.push_back({index, raw->log_time, raw->message_type, std::string(raw->data, raw->size)});
+                }
+            }
+        }
+        // parsing does not need the file, other frames can be read meanwhile
+        for (const auto& frame : frames) {
+            on_frame(DecodeFrame(frame.data.data(), frame.data.size(), frame.message_type, frame.log_time, frame.index));
+        }
+    }
+};
+
+FrameCache::FrameCache(const FrameCacheOptions& options) : options_(options) {
+    if (options_.prefetch_count > 0) {
+        for (size_t worker = 0; worker < options_.worker_count; ++worker) {
+            workers_.emplace_back([this] { RunWorker(); });
+        }
+    }
+}
+
+FrameCache::~FrameCache() {
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    work_available_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+auto FrameCache::GetSource(const std::filesystem::path& file_path) -> std::shared_ptr<FileSource> {
+    const auto extension = file_path.extension().string();
+    if (extension != ".osi" && extension != ".mcap") {
+        throw std::invalid_argument("Frame caches support .osi and .mcap files, not " + file_path.string());
+    }
+    auto key = std::filesystem::absolute(file_path).lexically_normal().string();
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        if (const auto source = sources_.find(key); source != sources_.end()) {
+            return source->second;
+        }
+    }
+    // indexing reads the whole file, other files stay accessible meanwhile
+    auto source = std::make_shared<FileSource>(file_path, key, options_.io);
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return sources_.emplace(std::move(key), std::move(source)).first->second;
+}
+
+auto FrameCache::GetFrame(const std::filesystem::path& file_path, const std::string& topic, const size_t index) -> std::shared_ptr<const CachedFrame> {
+    return GetFrame(GetSource(file_path), topic, index);
+}
+
+auto FrameCache::GetFrameAt(const std::filesystem::path& file_path, const std::string& topic, const uint64_t log_time) -> std::shared_ptr<const CachedFrame> {
+    const auto source = GetSource(file_path);
+    const auto* times = source->GetTimes(topic);
+    if (times == nullptr) {
+        return nullptr;
+    }
+    const auto next = std::upper_bound(times->begin(), times->end(), log_time);
+    if (next == times->begin()) {
+        return nullptr;
+    }
+    return GetFrame(source, topic, static_cast<size_t>(next - times->begin()) - 1);
+}
+
+auto FrameCache::GetFrameTimes(const std::filesystem::path& file_path, const std::string& topic) -> std::vector<uint64_t> {
+    const auto* times = GetSource(file_path)->GetTimes(topic);
+    return times != nullptr ? *times : std::vector<uint64_t>{};
+}
+
+auto FrameCache::GetFrame(const std::shared_ptr<FileSource>& source, const std::string& topic, const size_t index) -> std::shared_ptr<const CachedFrame> {
+    const auto* times = source->GetTimes(topic);
+    if (times == nullptr || index >= times->size()) {
+        return nullptr;
+    }
+    const FrameKey key{source->GetKey(), topic, index};
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        frame_loaded_.wait(lock, [&] { return loading_.count(key) == 0; });
+        SchedulePrefetch(source, topic, index);
+        if (const auto entry = entries_.find(key); entry != entries_.end()) {
+            ++statistics_.hits;
+            lru_.splice(lru_.begin(), lru_, entry->second.lru);
+            return entry->second.frame;
+        }
+        ++statistics_.misses;
+        // concurrent requests of the frame wait for this load instead of repeating it
+        loading_.insert(key);
+    }
+
+    std::shared_ptr<const CachedFrame> frame;
+    try {
+        source->Load(topic, index, index + 1, [&frame](std::shared_ptr<const CachedFrame> loaded) { frame = std::move(loaded); });
+    } catch (...) {
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            loading_.erase(key);
+        }
+        frame_loaded_.notify_all();
+        throw;
+    }
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        loading_.erase(key);
+        if (frame) {
+            Insert(key, frame);
+        }
+    }
+    frame_loaded_.notify_all();
+    if (!frame) {
+        throw std::runtime_error("Failed to read frame " + std::to_string(index) + " of " + source->GetKey());
+    }
+    return frame;
+}
+
+void FrameCache::Insert(const FrameKey& key, std::shared_ptr<const CachedFrame> frame) {
+    if (const auto entry = entries_.find(key); entry != entries_.end()) {
+        lru_.splice(lru_.begin(), lru_, entry->second.lru);
+        return;
+    }
+    statistics_.memory_usage += frame->memory_size;
+    ++statistics_.cached_frames;
+    lru_.push_front(key);
+    entries_.emplace(key, Entry{std::move(frame), lru_.begin()});
+
+    // the most recent frame stays even if it alone exceeds the budget
+    while (statistics_.memory_usage > options_.memory_budget && lru_.size() > 1) {
+        const auto entry = entries_.find(lru_.back());
+        statistics_.memory_usage -= entry->second.frame->memory_size;
+        --statistics_.cached_frames;
+        ++statistics_.evictions;
+        entries_.erase(entry);
+        lru_.pop_back();
+    }
+}
+
+void FrameCache::SchedulePrefetch(const std::shared_ptr<FileSource>& source, const std::string& topic, const size_t index) {
+    if (workers_.empty()) {
+        return;
+    }
+    auto& [last_index, backwards] = scrub_state_[{source->GetKey(), topic}];
+    if (index != last_index) {
+        backwards = index < last_index;
+    }
+    last_index = index;
+
+    // a pending prefetch of the channel is outdated by the new request
+    tasks_.erase(std::remove_if(tasks_.begin(), tasks_.end(), [&](const PrefetchTask& task) { return task.source == source && task.topic == topic; }), tasks_.end());
+    const size_t frame_count = source->GetTimes(topic)->size();
+    PrefetchTask task{source, topic, 0, 0};
+    if (backwards) {
+        task.first = index - std::min(index, options_.prefetch_count);
+        task.end = index;
+    } else {
+        task.first = index + 1;
+        task.end = std::min(frame_count, index + 1 + options_.prefetch_count);
+    }
+    if (task.first < task.end) {
+        tasks_.push_back(std::move(task));
+        work_available_.notify_one();
+    }
+}
+
+void FrameCache::RunWorker() {
+    while (true) {
+        PrefetchTask task;
+        std::set<FrameKey> claimed;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            work_available_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+            if (stopping_) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+
+            // only frames that are neither cached nor being loaded are read
+            const auto is_cached_or_loading = [&](const size_t index) {
+                const FrameKey key{task.source->GetKey(), task.topic, index};
+                return entries_.count(key) > 0 || loading_.count(key) > 0;
+            };
+            while (task.first < task.end && is_cached_or_loading(task.first)) {
+                ++task.first;
+            }
+            while (task.end > task.first && is_cached_or_loading(task.end - 1)) {
+                --task.end;
+            }
+            for (size_t index = task.first; index < task.end; ++index) {
+                FrameKey key{task.source->GetKey(), task.topic, index};
+                if (entries_.count(key) == 0 && loading_.insert(key).second) {
+                    claimed.insert(std::move(key));
+                }
+            }
+        }
+        if (task.first == task.end) {
+            continue;
+        }
+
+        try {
+            task.source->Load(task.topic, task.first, task.end, [&](std::shared_ptr<const CachedFrame> frame) {
+                const FrameKey key{task.source->GetKey(), task.topic, frame->index};
+                {
+                    const std::lock_guard<std::mutex> lock(mutex_);
+                    // frames claimed by another thread are left to it
+                    if (claimed.erase(key) == 0) {
+                        return;
+                    }
+                    loading_.erase(key);
+                    ++statistics_.prefetched;
+                    Insert(key, std::move(frame));
+                }
+                frame_loaded_.notify_all();
+            });
+        } catch (const std::exception& e) {
+            std::cerr << "ERROR: Failed to prefetch frames of " << task.source->GetKey() << ": " << e.what() << "\n";
+        }
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            for (const auto& key : claimed) {
+                loading_.erase(key);
+            }
+        }
+        frame_loaded_.notify_all();
+    }
+}
+
+auto FrameCache::GetStatistics() const -> FrameCacheStatistics {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return statistics_;
+}
+
+void FrameCache::Clear() {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+    tasks_.clear();
+    scrub_state_.clear();
+    statistics_.memory_usage = 0;
+    statistics_.cached_frames = 0;
+}
+
+}  // namespace osi3::tracefile
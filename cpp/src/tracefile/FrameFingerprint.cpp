@@ -0,0 +1,169 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/FrameFingerprint.h"
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+
+#include <stdexcept>
+
+#include "osi-utilities/tracefile/MessageTypeUtils.h"
+
+namespace osi3::tracefile {
+
+namespace {
+
+// XXH64 constants, see https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t kPrime5 = 0x27D4EB2F165667C5ULL;
+
+constexpr auto RotateLeft(const uint64_t value, const unsigned bits) -> uint64_t { return (value << bits) | (value >> (64U - bits)); }
+
+// Little-endian loads independent of the host byte order
+auto Load64(const unsigned char* ptr) -> uint64_t {
+    uint64_t value = 0;
+    for (unsigned i = 0; i < 8; ++i) {
+        value |= static_cast<uint64_t>(ptr[i]) << (8U * i);
+    }
+    return value;
+}
+
+auto Load32(const unsigned char* ptr) -> uint64_t {
+    uint64_t value = 0;
+    for (unsigned i = 0; i < 4; ++i) {
+        value |= static_cast<uint64_t>(ptr[i]) << (8U * i);
+    }
+    return value;
+}
+
+constexpr auto Round(uint64_t accumulator, const uint64_t input) -> uint64_t {
+    accumulator += input * kPrime2;
+    accumulator = RotateLeft(accumulator, 31);
+    return accumulator * kPrime1;
+}
+
+constexpr auto MergeRound(uint64_t accumulator, const uint64_t value) -> uint64_t {
+    accumulator ^= Round(0, value);
+    return accumulator * kPrime1 + kPrime4;
+}
+
+// Deterministic serialization orders map entries, so equal messages yield equal bytes
+void SerializeDeterministic(const google::protobuf::Message& message, std::string& buffer) {
+    buffer.clear();
+    message.ByteSizeLong();  // populates the cached sizes used below
+    google::protobuf::io::StringOutputStream string_stream(&buffer);
+    google::protobuf::io::CodedOutputStream coded_stream(&string_stream);
+    coded_stream.SetSerializationDeterministic(true);
+    message.SerializeWithCachedSizes(&coded_stream);
+}
+
+}  // namespace
+
+auto HashBytes(const void* data, const size_t size, const uint64_t seed) -> uint64_t {
+    const auto* ptr = static_cast<const unsigned char*>(data);
+    const auto* const end = ptr + size;
+    uint64_t hash = 0;
+
+    if (size >= 32) {
+        uint64_t v1 = seed + kPrime1 + kPrime2;
+        uint64_t v2 = seed + kPrime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - kPrime1;
+        const auto* const limit = end - 32;
+        do {
+            v1 = Round(v1, Load64(ptr));
+            v2 = Round(v2, Load64(ptr + 8));
+            v3 = Round(v3, Load64(ptr + 16));
+            v4 = Round(v4, Load64(ptr + 24));
+            ptr += 32;
+        } while (ptr <= limit);
+        hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+        hash = MergeRound(hash, v1);
+        hash = MergeRound(hash, v2);
+        hash = MergeRound(hash, v3);
+        hash = MergeRound(hash, v4);
+    } else {
+        hash = seed + kPrime5;
+    }
+
+    hash += static_cast<uint64_t>(size);
+
+    while (end - ptr >= 8) {
+        hash ^= Round(0, Load64(ptr));
+        hash = RotateLeft(hash, 27) * kPrime1 + kPrime4;
+        ptr += 8;
+    }
+    if (end - ptr >= 4) {
+        hash ^= Load32(ptr) * kPrime1;
+        hash = RotateLeft(hash, 23) * kPrime2 + kPrime3;
+        ptr += 4;
+    }
+    while (ptr < end) {
+        hash ^= static_cast<uint64_t>(*ptr) * kPrime5;
+        hash = RotateLeft(hash, 11) * kPrime1;
+        ++ptr;
+    }
+
+    hash ^= hash >> 33;
+    hash *= kPrime2;
+    hash ^= hash >> 29;
+    hash *= kPrime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+auto HashMessageCanonical(const google::protobuf::Message& message) -> uint64_t {
+    std::string buffer;
+    SerializeDeterministic(message, buffer);
+    return HashBytes(buffer.data(), buffer.size());
+}
+
+auto ComputeTraceFingerprints(TraceFileReader& reader, const FingerprintMode mode) -> std::vector<FrameFingerprint> {
+    std::vector<FrameFingerprint> fingerprints;
+    std::unique_ptr<google::protobuf::Message> canonical_message;
+    std::string canonical_buffer;
+
+    while (reader.HasNext()) {
+        const auto raw = reader.ReadRawMessage();
+        if (!raw) {
+            break;
+        }
+        if (raw->status == ReadStatus::kIncompatible) {
+            continue;
+        }
+        if (raw->status == ReadStatus::kError) {
+            throw std::runtime_error("Failed to read frame " + std::to_string(fingerprints.size()) + ": " + raw->error_message);
+        }
+
+        FrameFingerprint fingerprint;
+        fingerprint.channel_name = raw->channel_name;
+        fingerprint.log_time = raw->log_time;
+        fingerprint.index = fingerprints.size();
+        fingerprint.message_type = raw->message_type;
+
+        if (mode == FingerprintMode::kRawBytes) {
+            fingerprint.hash = HashBytes(raw->data, raw->size);
+            fingerprint.size = raw->size;
+        } else {
+            if (!canonical_message || canonical_message->GetDescriptor() != GetMessageDescriptor(raw->message_type)) {
+                canonical_message = CreateMessage(raw->message_type);
+            }
+            if (!canonical_message || !canonical_message->ParseFromArray(raw->data, static_cast<int>(raw->size))) {
+                throw std::runtime_error("Failed to parse frame " + std::to_string(fingerprint.index) + " for canonical hashing");
+            }
+            SerializeDeterministic(*canonical_message, canonical_buffer);
+            fingerprint.hash = HashBytes(canonical_buffer.data(), canonical_buffer.size());
+            fingerprint.size = canonical_buffer.size();
+        }
+        fingerprints.push_back(std::move(fingerprint));
+    }
+    return fingerprints;
+}
+
+}  // namespace osi3::tracefile
@@ -0,0 +1,110 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/MessageTypeUtils.h"
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <utility>
+
+#include "osi-utilities/tracefile/WireFormatUtils.h"
+#include "osi_groundtruth.pb.h"
+#include "osi_hostvehicledata.pb.h"
+#include "osi_motionrequest.pb.h"
+#include "osi_sensordata.pb.h"
+#include "osi_sensorview.pb.h"
+#include "osi_sensorviewconfiguration.pb.h"
+#include "osi_streamingupdate.pb.h"
+#include "osi_trafficcommand.pb.h"
+#include "osi_trafficcommandupdate.pb.h"
+#include "osi_trafficupdate.pb.h"
+
+namespace osi3::tracefile {
+
+namespace {
+
+auto GetDescriptorTable() -> const std::array<std::pair<ReaderTopLevelMessage, const google::protobuf::Descriptor*>, 10>& {
+    static const std::array<std::pair<ReaderTopLevelMessage, const google::protobuf::Descriptor*>, 10> kDescriptorTable = {{
+        {ReaderTopLevelMessage::kGroundTruth, GroundTruth::descriptor()},
+        {ReaderTopLevelMessage::kSensorData, SensorData::descriptor()},
+        {ReaderTopLevelMessage::kSensorView, SensorView::descriptor()},
+        {ReaderTopLevelMessage::kSensorViewConfiguration, SensorViewConfiguration::descriptor()},
+        {ReaderTopLevelMessage::kHostVehicleData, HostVehicleData::descriptor()},
+        {ReaderTopLevelMessage::kTrafficCommand, TrafficCommand::descriptor()},
+        {ReaderTopLevelMessage::kTrafficCommandUpdate, TrafficCommandUpdate::descriptor()},
+        {ReaderTopLevelMessage::kTrafficUpdate, TrafficUpdate::descriptor()},
+        {ReaderTopLevelMessage::kMotionRequest, MotionRequest::descriptor()},
+        {ReaderTopLevelMessage::kStreamingUpdate, StreamingUpdate::descriptor()},
+    }};
+    return kDescriptorTable;
+}
+
+}  // namespace
+
+auto GetMessageDescriptor(const ReaderTopLevelMessage message_type) -> const google::protobuf::Descriptor* {
+    for (const auto& [type, descriptor] : GetDescriptorTable()) {
+        if (type == message_type) {
+            return descriptor;
+        }
+    }
+    return nullptr;
+}
+
+auto GetMessageTypeFromFullName(const std::string_view full_name) -> ReaderTopLevelMessage {
+    for (const auto& [type, descriptor] : GetDescriptorTable()) {
+        if (descriptor->full_name() == full_name) {
+            return type;
+        }
+    }
+    return ReaderTopLevelMessage::kUnknown;
+}
+
+auto CreateMessage(const ReaderTopLevelMessage message_type) -> std::unique_ptr<google::protobuf::Message> {
+    const auto* descriptor = GetMessageDescriptor(message_type);
+    if (descriptor == nullptr) {
+        return nullptr;
+    }
+    const auto* prototype = google::protobuf::MessageFactory::generated_factory()->GetPrototype(descriptor);
+    return std::unique_ptr<google::protobuf::Message>(prototype->New());
+}
+
+auto WrapGroundTruthInSensorView(const std::string_view ground_truth, std::string& sensor_view) -> bool {
+    std::optional<std::string_view> timestamp;
+    std::optional<std::string_view> host_vehicle_id;
+    WireFieldReader reader(ground_truth);
+    WireField field;
+    while (reader.Next(field)) {
+        if (field.type != WireType::kLengthDelimited) {
+            continue;
+        }
+        if (field.number == GroundTruth::kTimestampFieldNumber) {
+            timestamp = field.payload;
+        } else if (field.number == GroundTruth::kHostVehicleIdFieldNumber) {
+            host_vehicle_id = field.payload;
+        }
+    }
+    if (reader.HasError()) {
+        return false;
+    }
+
+    // fields in ascending field number order, as written by the protobuf serializer
+    std::array<std::pair<uint32_t, std::optional<std::string_view>>, 3> fields = {{
+        {SensorView::kTimestampFieldNumber, timestamp},
+        {SensorView::kGlobalGroundTruthFieldNumber, ground_truth},
+        {SensorView::kHostVehicleIdFieldNumber, host_vehicle_id},
+    }};
+    std::sort(fields.begin(), fields.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    sensor_view.clear();
+    sensor_view.reserve(ground_truth.size() + 64);
+    for (const auto& [number, payload] : fields) {
+        if (payload) {
+            AppendLengthDelimitedField(sensor_view, number, *payload);
+        }
+    }
+    return true;
+}
+
+}  // namespace osi3::tracefile
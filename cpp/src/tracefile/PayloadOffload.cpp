@@ -0,0 +1,202 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/PayloadOffload.h"
+
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/io/coded_stream.h>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <limits>
+#include <memory>
+#include <optional>
+
+#include "osi-utilities/tracefile/TraceFileConfig.h"
+
+namespace osi3::tracefile {
+
+namespace {
+
+auto SplitPath(const std::string_view path) -> std::vector<std::string_view> {
+    std::vector<std::string_view> components;
+    size_t begin = 0;
+    while (begin <= path.size()) {
+        const auto end = std::min(path.find('.', begin), path.size());
+        components.push_back(path.substr(begin, end - begin));
+        begin = end + 1;
+    }
+    return components;
+}
+
+// Moves a set field into an otherwise empty message of the same type and serializes it
+auto ExtractField(google::protobuf::Message& message, const google::protobuf::FieldDescriptor* field, const size_t min_size, std::string& data) -> bool {
+    const auto* reflection = message.GetReflection();
+    if (field->is_repeated() ? reflection->FieldSize(message, field) == 0 : !reflection->HasField(message, field)) {
+        return false;
+    }
+    const std::unique_ptr<google::protobuf::Message> fragment(message.New());
+    reflection->SwapFields(&message, fragment.get(), {field});
+    if (fragment->ByteSizeLong() < min_size || !fragment->SerializeToString(&data)) {
+        reflection->SwapFields(&message, fragment.get(), {field});
+        return false;
+    }
+    return true;
+}
+
+void OffloadField(google::protobuf::Message& message, const std::vector<std::string_view>& components, const size_t index, const std::string& prefix, const size_t min_size,
+                  std::vector<OffloadedPayload>& payloads) {
+    const auto* field = message.GetDescriptor()->FindFieldByName(std::string(components[index]));
+    if (field == nullptr) {
+        return;
+    }
+    const std::string name(field->name());
+    const auto path = prefix.empty() ? name : prefix + "." + name;
+    if (index + 1 == components.size()) {
+        OffloadedPayload payload{path, {}};
+        if (ExtractField(message, field, min_size, payload.data)) {
+            payloads.push_back(std::move(payload));
+        }
+        return;
+    }
+    if (field->cpp_type() != google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE) {
+        return;
+    }
+    const auto* reflection = message.GetReflection();
+    if (field->is_repeated()) {
+        const auto size = reflection->FieldSize(message, field);
+        for (int i = 0; i < size; ++i) {
+            OffloadField(*reflection->MutableRepeatedMessage(&message, field, i), components, index + 1, path + "[" + std::to_string(i) + "]", min_size, payloads);
+        }
+    } else if (reflection->HasField(message, field)) {
+        OffloadField(*reflection->MutableMessage(&message, field), components, index + 1, path, min_size, payloads);
+    }
+}
+
+// Resolves "name" or "name[index]" to the sub-message, nullptr if it does not exist
+auto ResolveComponent(google::protobuf::Message& message, const std::string_view component) -> google::protobuf::Message* {
+    auto name = component;
+    std::optional<int> element;
+    if (const auto bracket = component.find('['); bracket != std::string_view::npos) {
+        if (component.back() != ']') {
+            return nullptr;
+        }
+        name = component.substr(0, bracket);
+        int value = 0;
+        const auto digits = component.substr(bracket + 1, component.size() - bracket - 2);
+        if (std::from_chars(digits.data(), digits.data() + digits.size(), value).ptr != digits.data() + digits.size() || digits.empty()) {
+            return nullptr;
+        }
+        element = value;
+    }
+    const auto* field = message.GetDescriptor()->FindFieldByName(std::string(name));
+    if (field == nullptr || field->cpp_type() != google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE || field->is_repeated() != element.has_value()) {
+        return nullptr;
+    }
+    const auto* reflection = message.GetReflection();
+    if (!element) {
+        return reflection->MutableMessage(&message, field);
+    }
+    if (*element >= reflection->FieldSize(message, field)) {
+        return nullptr;
+    }
+    return reflection->MutableRepeatedMessage(&message, field, *element);
+}
+
+}  // namespace
+
+auto OffloadPayloads(google::protobuf::Message& message, const PayloadOffloadOptions& options) -> std::vector<OffloadedPayload> {
+    std::vector<OffloadedPayload> payloads;
+    for (const auto& field_path : options.field_paths) {
+        OffloadField(message, SplitPath(field_path), 0, {}, options.min_size, payloads);
+    }
+    return payloads;
+}
+
+auto AttachPayload(google::protobuf::Message& message, const std::string_view path, const std::string_view data) -> bool {
+    const auto components = SplitPath(path);
+    auto* parent = &message;
+    for (size_t i = 0; i + 1 < components.size() && parent != nullptr; ++i) {
+        parent = ResolveComponent(*parent, components[i]);
+    }
+    if (parent == nullptr || parent->GetDescriptor()->FindFieldByName(std::string(components.back())) == nullptr) {
+        return false;
+    }
+    google::protobuf::io::CodedInputStream input(reinterpret_cast<const uint8_t*>(data.data()), static_cast<int>(data.size()));
+    return parent->MergeFromCodedStream(&input) && input.ConsumedEntireMessage();
+}
+
+void AppendPayloadRecord(std::string& batch, const uint64_t log_time, const OffloadedPayload& payload) {
+    std::array<uint8_t, sizeof(uint64_t) + 2 * sizeof(uint32_t)> header{};
+    auto* end = google::protobuf::io::CodedOutputStream::WriteLittleEndian64ToArray(log_time, header.data());
+    end = google::protobuf::io::CodedOutputStream::WriteLittleEndian32ToArray(static_cast<uint32_t>(payload.path.size()), end);
+    google::protobuf::io::CodedOutputStream::WriteLittleEndian32ToArray(static_cast<uint32_t>(payload.data.size()), end);
+    batch.append(reinterpret_cast<const char*>(header.data()), header.size());
+    batch += payload.path;
+    batch += payload.data;
+}
+
+auto AttachPayloads(google::protobuf::Message& message, const std::string_view batch, const uint64_t log_time) -> bool {
+    if (batch.size() > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        return false;
+    }
+    google::protobuf::io::CodedInputStream input(reinterpret_cast<const uint8_t*>(batch.data()), static_cast<int>(batch.size()));
+    std::string path;
+    std::string data;
+    while (!input.ExpectAtEnd()) {
+        uint64_t record_log_time = 0;
+        uint32_t path_size = 0;
+        uint32_t data_size = 0;
+        if (!input.ReadLittleEndian64(&record_log_time) || !input.ReadLittleEndian32(&path_size) || !input.ReadLittleEndian32(&data_size) ||
+            !input.ReadString(&path, static_cast<int>(path_size))) {
+            return false;
+        }
+        if (record_log_time != log_time) {
+            if (!input.Skip(static_cast<int>(data_size))) {
+                return false;
+            }
+            continue;
+        }
+        if (!input.ReadString(&data, static_cast<int>(data_size)) || !AttachPayload(message, path, data)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+auto GetPayloadAttachmentName(const std::string& topic, const uint64_t first_log_time, const uint64_t last_log_time) -> std::string {
+    return config::kPayloadAttachmentNamePrefix + topic + "@" + std::to_string(first_log_time) + "-" + std::to_string(last_log_time);
+}
+
+auto ParsePayloadAttachmentName(const std::string_view name, const std::string& topic) -> std::optional<std::pair<uint64_t, uint64_t>> {
+    const auto prefix = config::kPayloadAttachmentNamePrefix + topic + "@";
+    if (name.size() <= prefix.size() || name.compare(0, prefix.size(), prefix) != 0) {
+        return std::nullopt;
+    }
+    const auto* const end = name.data() + name.size();
+    std::pair<uint64_t, uint64_t> range;
+    const auto first = std::from_chars(name.data() + prefix.size(), end, range.first);
+    if (first.ec != std::errc() || first.ptr == end || *first.ptr != '-') {
+        return std::nullopt;
+    }
+    const auto last = std::from_chars(first.ptr + 1, end, range.second);
+    if (last.ec != std::errc() || last.ptr != end || range.second < range.first) {
+        return std::nullopt;
+    }
+    return range;
+}
+
+void AddPayloadOffloadMetadata(const PayloadOffloadOptions& options, std::unordered_map<std::string, std::string>& channel_metadata) {
+    std::string field_paths;
+    for (const auto& field_path : options.field_paths) {
+        field_paths += (field_paths.empty() ? "" : ",") + field_path;
+    }
+    if (!field_paths.empty()) {
+        channel_metadata[config::kOsiChannelOffloadedFieldsKey] = field_paths;
+    }
+}
+
+}  // namespace osi3::tracefile
@@ -0,0 +1,147 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/Quantization.h"
+
+#include <google/protobuf/descriptor.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+#include "osi-utilities/tracefile/TraceFileConfig.h"
+
+namespace osi3::tracefile {
+
+namespace {
+
+struct QuantizationSteps {
+    double linear = 0.0;
+    double angular = 0.0;
+};
+
+auto Quantize(const double value, const double step) -> double { return std::nearbyint(value / step) * step; }
+
+auto FormatStep(const double step) -> std::string {
+    std::ostringstream stream;
+    stream.imbue(std::locale::classic());
+    stream.precision(std::numeric_limits<double>::max_digits10);
+    stream << step;
+    return stream.str();
+}
+
+// Step of the OSI types holding positional data, 0 for all other types
+auto GetStepForType(const google::protobuf::Descriptor& descriptor, const QuantizationSteps& steps) -> double {
+    const auto& name = descriptor.full_name();
+    if (name == "osi3.Vector3d" || name == "osi3.Vector2d" || name == "osi3.Dimension3d") {
+        return steps.linear;
+    }
+    if (name == "osi3.Orientation3d") {
+        return steps.angular;
+    }
+    return 0.0;
+}
+
+void QuantizeFields(google::protobuf::Message& message, const double step) {
+    const auto* descriptor = message.GetDescriptor();
+    const auto* reflection = message.GetReflection();
+    for (int i = 0; i < descriptor->field_count(); ++i) {
+        const auto* field = descriptor->field(i);
+        if (field->is_repeated() || !reflection->HasField(message, field)) {
+            continue;
+        }
+        if (field->cpp_type() == google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE) {
+            reflection->SetDouble(&message, field, Quantize(reflection->GetDouble(message, field), step));
+        } else if (field->cpp_type() == google::protobuf::FieldDescriptor::CPPTYPE_FLOAT) {
+            reflection->SetFloat(&message, field, static_cast<float>(Quantize(reflection->GetFloat(message, field), step)));
+        }
+    }
+}
+
+void QuantizeRecursive(google::protobuf::Message& message, const QuantizationSteps& steps, const std::vector<const google::protobuf::FieldDescriptor*>& pose_fields) {
+    const auto* descriptor = message.GetDescriptor();
+    const auto* reflection = message.GetReflection();
+    for (int i = 0; i < descriptor->field_count(); ++i) {
+        const auto* field = descriptor->field(i);
+        if (field->cpp_type() != google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE) {
+            continue;
+        }
+        const bool is_pose_field = std::find(pose_fields.begin(), pose_fields.end(), field) != pose_fields.end();
+        const auto step = is_pose_field ? GetStepForType(*field->message_type(), steps) : 0.0;
+        const auto process = [&](google::protobuf::Message& child) {
+            if (step > 0.0) {
+                QuantizeFields(child, step);
+            } else if (!is_pose_field) {
+                QuantizeRecursive(child, steps, pose_fields);
+            }
+        };
+        if (field->is_repeated()) {
+            const int size = reflection->FieldSize(message, field);
+            for (int j = 0; j < size; ++j) {
+                process(*reflection->MutableRepeatedMessage(&message, field, j));
+            }
+        } else if (reflection->HasField(message, field)) {
+            process(*reflection->MutableMessage(&message, field));
+        }
+    }
+}
+
+}  // namespace
+
+auto GetQuantizationStep(const double precision) -> double {
+    if (!(precision > 0.0) || !std::isfinite(precision)) {
+        return 0.0;
+    }
+    // ilogb is floor(log2) for normal numbers
+    return std::ldexp(1.0, std::ilogb(precision));
+}
+
+auto GetDefaultPoseFields() -> std::vector<std::string> {
+    return {
+        "osi3.BaseMoving.position",
+        "osi3.BaseMoving.orientation",
+        "osi3.BaseMoving.velocity",
+        "osi3.BaseMoving.acceleration",
+        "osi3.BaseMoving.orientation_rate",
+        "osi3.BaseMoving.orientation_acceleration",
+        "osi3.BaseMoving.dimension",
+        "osi3.BaseStationary.position",
+        "osi3.BaseStationary.orientation",
+        "osi3.BaseStationary.dimension",
+        "osi3.MountingPosition.position",
+        "osi3.MountingPosition.orientation",
+    };
+}
+
+void QuantizeMessage(google::protobuf::Message& message, const QuantizationOptions& options) {
+    if (!options.Enabled()) {
+        return;
+    }
+    // resolved in the pool of the message, so that dynamic messages are quantized as well
+    const auto* pool = message.GetDescriptor()->file()->pool();
+    std::vector<const google::protobuf::FieldDescriptor*> pose_fields;
+    pose_fields.reserve(options.pose_fields.size());
+    for (const auto& name : options.pose_fields) {
+        if (const auto* field = pool->FindFieldByName(name); field != nullptr) {
+            pose_fields.push_back(field);
+        }
+    }
+    if (pose_fields.empty()) {
+        return;
+    }
+    QuantizeRecursive(message, {GetQuantizationStep(options.linear_precision), GetQuantizationStep(options.angular_precision)}, pose_fields);
+}
+
+void AddQuantizationMetadata(const QuantizationOptions& options, std::unordered_map<std::string, std::string>& channel_metadata) {
+    if (const auto step = GetQuantizationStep(options.linear_precision); step > 0.0) {
+        channel_metadata[config::kOsiChannelQuantizationLinearStepKey] = FormatStep(step);
+    }
+    if (const auto step = GetQuantizationStep(options.angular_precision); step > 0.0) {
+        channel_metadata[config::kOsiChannelQuantizationAngularStepKey] = FormatStep(step);
+    }
+}
+
+}  // namespace osi3::tracefile
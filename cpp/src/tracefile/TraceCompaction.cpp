@@ -0,0 +1,248 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/TraceCompaction.h"
+
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "osi-utilities/tracefile/MessageTypeUtils.h"
+#include "osi-utilities/tracefile/TraceFileConfig.h"
+#include "osi-utilities/tracefile/Writer.h"
+#include "osi-utilities/tracefile/reader/MCAPTraceFileReader.h"
+#include "osi-utilities/tracefile/writer/MCAPTraceFileWriter.h"
+#include "osi_groundtruth.pb.h"
+
+namespace osi3::tracefile {
+
+namespace {
+
+auto HasDefaultValue(const google::protobuf::Message& message, const google::protobuf::FieldDescriptor& field) -> bool {
+    const auto* reflection = message.GetReflection();
+    switch (field.cpp_type()) {
+        case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
+            return reflection->GetInt32(message, &field) == field.default_value_int32();
+        case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+            return reflection->GetInt64(message, &field) == field.default_value_int64();
+        case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+            return reflection->GetUInt32(message, &field) == field.default_value_uint32();
+        case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+            return reflection->GetUInt64(message, &field) == field.default_value_uint64();
+        case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE:
+            return reflection->GetDouble(message, &field) == field.default_value_double();
+        case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT:
+            return reflection->GetFloat(message, &field) == field.default_value_float();
+        case google::protobuf::FieldDescriptor::CPPTYPE_BOOL:
+            return reflection->GetBool(message, &field) == field.default_value_bool();
+        case google::protobuf::FieldDescriptor::CPPTYPE_ENUM:
+            return reflection->GetEnumValue(message, &field) == field.default_value_enum()->number();
+        case google::protobuf::FieldDescriptor::CPPTYPE_STRING:
+            return reflection->GetString(message, &field) == field.default_value_string();
+        default:
+            return false;
+    }
+}
+
+void TrimLaneBoundaries(osi3::GroundTruth& ground_truth, const double range) {
+    if (!ground_truth.has_host_vehicle_id()) {
+        return;
+    }
+    const osi3::Vector3d* host_position = nullptr;
+    for (const auto& moving_object : ground_truth.moving_object()) {
+        if (moving_object.id().value() == ground_truth.host_vehicle_id().value()) {
+            host_position = &moving_object.base().position();
+            break;
+        }
+    }
+    if (host_position == nullptr) {
+        return;
+    }
+    const double max_squared_distance = range * range;
+    for (auto& lane_boundary : *ground_truth.mutable_lane_boundary()) {
+        auto* points = lane_boundary.mutable_boundary_line();
+        // stable in-place filter, points without position are kept
+        int kept = 0;
+        for (int i = 0; i < points->size(); ++i) {
+            const auto& point = points->Get(i);
+            const double dx = point.position().x() - host_position->x();
+            const double dy = point.position().y() - host_position->y();
+            if (!point.has_position() || dx * dx + dy * dy <= max_squared_distance) {
+                points->SwapElements(kept++, i);
+            }
+        }
+        points->DeleteSubrange(kept, points->size() - kept);
+    }
+}
+
+// Topic of the output frame: the MCAP channel, or the message type for single-channel input
+auto GetOutputTopic(const RawReadResult& result, const google::protobuf::Message& message) -> std::string {
+    return result.channel_name.empty() ? message.GetDescriptor()->name() : result.channel_name;
+}
+
+}  // namespace
+
+MessageCompactor::MessageCompactor(CompactionOptions options)
+    : options_(std::move(options)), removed_fields_(options_.removed_fields.begin(), options_.removed_fields.end()) {}
+
+void MessageCompactor::Compact(google::protobuf::Message& message) const {
+    if (options_.remove_unknown_fields) {
+        message.DiscardUnknownFields();
+    }
+    CompactFields(message);
+}
+
+void MessageCompactor::CompactFields(google::protobuf::Message& message) const {
+    if (options_.lane_boundary_range > 0.0) {
+        if (auto* ground_truth = dynamic_cast<osi3::GroundTruth*>(&message)) {
+            TrimLaneBoundaries(*ground_truth, options_.lane_boundary_range);
+        }
+    }
+    const auto* descriptor = message.GetDescriptor();
+    const auto* reflection = message.GetReflection();
+    for (int i = 0; i < descriptor->field_count(); ++i) {
+        const auto* field = descriptor->field(i);
+        if (IsRemoved(*field)) {
+            reflection->ClearField(&message, field);
+        } else if (field->cpp_type() == google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE) {
+            if (field->is_repeated()) {
+                const int size = reflection->FieldSize(message, field);
+                for (int j = 0; j < size; ++j) {
+                    CompactFields(*reflection->MutableRepeatedMessage(&message, field, j));
+                }
+            } else if (reflection->HasField(message, field)) {
+                CompactFields(*reflection->MutableMessage(&message, field));
+            }
+        } else if (options_.remove_default_values && !field->is_repeated() && reflection->HasField(message, field) && HasDefaultValue(message, *field)) {
+            reflection->ClearField(&message, field);
+        }
+    }
+}
+
+auto MessageCompactor::IsRemoved(const google::protobuf::FieldDescriptor& field) const -> bool {
+    return !removed_fields_.empty() && (removed_fields_.count(field.name()) != 0 || removed_fields_.count(field.full_name()) != 0);
+}
+
+void CompactMessage(google::protobuf::Message& message, const CompactionOptions& options) { MessageCompactor(options).Compact(message); }
+
+auto SerializeCanonical(const google::protobuf::Message& message, std::string& buffer) -> bool {
+    buffer.clear();
+    buffer.reserve(message.ByteSizeLong());
+    google::protobuf::io::StringOutputStream string_stream(&buffer);
+    google::protobuf::io::CodedOutputStream coded_stream(&string_stream);
+    coded_stream.SetSerializationDeterministic(true);
+    if (!message.SerializeToCodedStream(&coded_stream)) {
+        return false;
+    }
+    coded_stream.Trim();
+    return !coded_stream.HadError();
+}
+
+namespace {
+
+// Temporary output next to the final one, keeping the extension that selects the writer
+auto GetPartialPath(const std::filesystem::path& output_path) -> std::filesystem::path {
+    return output_path.parent_path() / (output_path.stem().string() + ".partial" + output_path.extension().string());
+}
+
+auto CompactToPath(const std::filesystem::path& input_path, const std::filesystem::path& output_path, const std::filesystem::path& writer_path,
+                   const CompactionOptions& options) -> CompactionReport {
+    const auto reader = TraceFileReaderFactory::openReader(input_path, options.message_type);
+    const auto writer = TraceFileWriterFactory::createWriter(writer_path);
+
+    // keep file and channel metadata between MCAP files; statistics describe the input and are collected anew instead
+    auto* mcap_reader = dynamic_cast<MCAPTraceFileReader*>(reader.get());
+    auto* mcap_writer = dynamic_cast<MCAPTraceFileWriter*>(writer.get());
+    decltype(mcap_reader->GetFileMetadata()) file_metadata;
+    if (mcap_reader != nullptr && mcap_writer != nullptr) {
+        file_metadata = mcap_reader->GetFileMetadata();
+    }
+    const auto is_statistics = [](const auto& record) { return record.first == config::kOsiTraceStatisticsMetadataName; };
+    if (std::any_of(file_metadata.begin(), file_metadata.end(), is_statistics)) {
+        mcap_writer->SetStatisticsEnabled(true);
+    }
+    if (!writer->Open(output_path)) {
+        throw std::runtime_error("Failed to open output trace file " + output_path.string());
+    }
+    for (const auto& record : file_metadata) {
+        if (!is_statistics(record)) {
+            mcap_writer->AddFileMetadata(record.first, record.second);
+        }
+    }
+
+    const MessageCompactor compactor(options);
+    std::unordered_set<std::string> topics;
+    // reusable messages to parse the raw frames into, by message type
+    std::unordered_map<ReaderTopLevelMessage, std::unique_ptr<google::protobuf::Message>> messages;
+    std::string buffer;
+    CompactionReport report;
+    while (reader->HasNext()) {
+        // frames are read raw to account for their size as stored
+        const auto result = reader->ReadRawMessage();
+        if (!result) {
+            break;
+        }
+        if (result->status == ReadStatus::kIncompatible) {
+            continue;
+        }
+        if (result->status != ReadStatus::kOk) {
+            throw std::runtime_error("Failed to read frame " + std::to_string(report.frame_count) + ": " + result->error_message);
+        }
+        auto& parsed = messages[result->message_type];
+        if (!parsed) {
+            parsed = CreateMessage(result->message_type);
+        }
+        if (!parsed || !parsed->ParseFromArray(result->data, static_cast<int>(result->size))) {
+            throw std::runtime_error("Failed to parse frame " + std::to_string(report.frame_count));
+        }
+        auto& message = *parsed;
+        report.input_bytes += result->size;
+        compactor.Compact(message);
+        if (!SerializeCanonical(message, buffer)) {
+            throw std::runtime_error("Failed to serialize frame " + std::to_string(report.frame_count));
+        }
+
+        const auto topic = GetOutputTopic(*result, message);
+        if (mcap_writer != nullptr && topics.insert(topic).second) {
+            auto channel_metadata = mcap_reader != nullptr ? mcap_reader->GetChannelMetadata(topic) : std::nullopt;
+            mcap_writer->AddChannel(topic, message.GetDescriptor(), channel_metadata.value_or(std::unordered_map<std::string, std::string>{}));
+        }
+        if (!writer->WriteRawMessage(buffer.data(), buffer.size(), message.GetDescriptor(), topic)) {
+            throw std::runtime_error("Failed to write frame " + std::to_string(report.frame_count));
+        }
+        report.output_bytes += buffer.size();
+        ++report.frame_count;
+    }
+    reader->Close();
+    writer->Close();
+    if (writer->CloseFailed()) {
+        throw std::runtime_error("Failed to finish output trace file " + output_path.string());
+    }
+    return report;
+}
+
+}  // namespace
+
+auto CompactTraceFile(const std::filesystem::path& input_path, const std::filesystem::path& output_path, const CompactionOptions& options) -> CompactionReport {
+    const auto partial_path = GetPartialPath(output_path);
+    try {
+        const auto report = CompactToPath(input_path, partial_path, output_path, options);
+        std::filesystem::rename(partial_path, output_path);
+        return report;
+    } catch (...) {
+        std::error_code error;
+        std::filesystem::remove(partial_path, error);
+        throw;
+    }
+}
+
+}  // namespace osi3::tracefile
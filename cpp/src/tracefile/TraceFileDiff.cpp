@@ -0,0 +1,167 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/TraceFileDiff.h"
+
+#include <google/protobuf/util/message_differencer.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+
+#include "osi-utilities/tracefile/MessageTypeUtils.h"
+
+namespace osi3::tracefile {
+
+namespace {
+
+// Alignment key: channel, log time and the occurrence of that (channel, log time) pair
+using FrameKey = std::tuple<std::string, uint64_t, size_t>;
+
+auto BuildKeys(const std::vector<FrameFingerprint>& fingerprints) -> std::vector<FrameKey> {
+    std::map<std::pair<std::string, uint64_t>, size_t> occurrences;
+    std::vector<FrameKey> keys;
+    keys.reserve(fingerprints.size());
+    for (const auto& fingerprint : fingerprints) {
+        const auto occurrence = occurrences[{fingerprint.channel_name, fingerprint.log_time}]++;
+        keys.emplace_back(fingerprint.channel_name, fingerprint.log_time, occurrence);
+    }
+    return keys;
+}
+
+// Parse the frames with the given indices (file order, OSI frames only) from a trace
+auto LoadFrames(const std::filesystem::path& path, const ReaderTopLevelMessage message_type, const std::set<size_t>& indices)
+    -> std::unordered_map<size_t, std::unique_ptr<google::protobuf::Message>> {
+    std::unordered_map<size_t, std::unique_ptr<google::protobuf::Message>> frames;
+    if (indices.empty()) {
+        return frames;
+    }
+    const auto last_index = *indices.rbegin();
+    const auto reader = TraceFileReaderFactory::openReader(path, message_type);
+
+    size_t index = 0;
+    while (index <= last_index && reader->HasNext()) {
+        const auto raw = reader->ReadRawMessage();
+        if (!raw) {
+            break;
+        }
+        if (raw->status != ReadStatus::kOk) {
+            continue;
+        }
+        if (indices.count(index) != 0) {
+            auto message = CreateMessage(raw->message_type);
+            if (message && message->ParseFromArray(raw->data, static_cast<int>(raw->size))) {
+                frames.emplace(index, std::move(message));
+            }
+        }
+        ++index;
+    }
+    reader->Close();
+    return frames;
+}
+
+auto ComputeFieldDiff(const google::protobuf::Message& reference, const google::protobuf::Message& candidate) -> std::string {
+    if (reference.GetDescriptor() != candidate.GetDescriptor()) {
+        return "message type differs: " + reference.GetDescriptor()->full_name() + " vs. " + candidate.GetDescriptor()->full_name() + "\n";
+    }
+    std::string differences;
+    google::protobuf::util::MessageDifferencer differencer;
+    differencer.ReportDifferencesToString(&differences);
+    differencer.Compare(reference, candidate);
+    return differences;
+}
+
+auto FingerprintTrace(const std::filesystem::path& path, const TraceDiffOptions& options) -> std::vector<FrameFingerprint> {
+    const auto reader = TraceFileReaderFactory::openReader(path, options.message_type);
+    auto fingerprints = ComputeTraceFingerprints(*reader, options.mode);
+    reader->Close();
+    return fingerprints;
+}
+
+}  // namespace
+
+auto DiffFingerprints(const std::vector<FrameFingerprint>& reference, const std::vector<FrameFingerprint>& candidate) -> TraceDiffReport {
+    const auto reference_keys = BuildKeys(reference);
+    const auto candidate_keys = BuildKeys(candidate);
+
+    std::map<FrameKey, size_t> candidate_lookup;
+    for (size_t i = 0; i < candidate_keys.size(); ++i) {
+        candidate_lookup.emplace(candidate_keys[i], i);
+    }
+
+    TraceDiffReport report;
+    std::vector<bool> candidate_matched(candidate.size(), false);
+    for (size_t i = 0; i < reference.size(); ++i) {
+        const auto match = candidate_lookup.find(reference_keys[i]);
+        if (match == candidate_lookup.end()) {
+            ++report.missing_count;
+            report.entries.push_back({FrameDiffStatus::kMissing, reference[i].channel_name, reference[i].log_time, reference[i].index, 0, {}});
+            continue;
+        }
+        const auto& other = candidate[match->second];
+        candidate_matched[match->second] = true;
+        if (reference[i].hash == other.hash && reference[i].size == other.size && reference[i].message_type == other.message_type) {
+            ++report.identical_count;
+        } else {
+            ++report.differing_count;
+            report.entries.push_back({FrameDiffStatus::kDiffering, reference[i].channel_name, reference[i].log_time, reference[i].index, other.index, {}});
+        }
+    }
+    for (size_t i = 0; i < candidate.size(); ++i) {
+        if (!candidate_matched[i]) {
+            ++report.extra_count;
+            report.entries.push_back({FrameDiffStatus::kExtra, candidate[i].channel_name, candidate[i].log_time, 0, candidate[i].index, {}});
+        }
+    }
+
+    std::stable_sort(report.entries.begin(), report.entries.end(), [](const FrameDiffEntry& lhs, const FrameDiffEntry& rhs) { return lhs.log_time < rhs.log_time; });
+    return report;
+}
+
+auto DiffTraces(const std::filesystem::path& reference_path, const std::filesystem::path& candidate_path, const TraceDiffOptions& options) -> TraceDiffReport {
+    auto report = DiffFingerprints(FingerprintTrace(reference_path, options), FingerprintTrace(candidate_path, options));
+    if (!options.field_diff || report.differing_count == 0 || options.max_field_diffs == 0) {
+        return report;
+    }
+
+    // Second pass: parse only the differing frames, up to the configured limit
+    std::vector<FrameDiffEntry*> selected;
+    std::set<size_t> reference_indices;
+    std::set<size_t> candidate_indices;
+    for (auto& entry : report.entries) {
+        if (entry.status != FrameDiffStatus::kDiffering) {
+            continue;
+        }
+        if (selected.size() == options.max_field_diffs) {
+            break;
+        }
+        selected.push_back(&entry);
+        reference_indices.insert(entry.reference_index);
+        candidate_indices.insert(entry.candidate_index);
+    }
+
+    const auto reference_frames = LoadFrames(reference_path, options.message_type, reference_indices);
+    const auto candidate_frames = LoadFrames(candidate_path, options.message_type, candidate_indices);
+    for (auto* entry : selected) {
+        const auto reference_frame = reference_frames.find(entry->reference_index);
+        const auto candidate_frame = candidate_frames.find(entry->candidate_index);
+        if (reference_frame == reference_frames.end() || candidate_frame == candidate_frames.end()) {
+            entry->field_diff = "frame could not be parsed\n";
+            continue;
+        }
+        entry->field_diff = ComputeFieldDiff(*reference_frame->second, *candidate_frame->second);
+        if (entry->field_diff.empty()) {
+            // Equal content, different encoding (e.g. field order or default values written explicitly)
+            entry->field_diff = "serialized bytes differ, fields are equal\n";
+        }
+    }
+    return report;
+}
+
+}  // namespace osi3::tracefile
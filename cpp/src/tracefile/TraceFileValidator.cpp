@@ -0,0 +1,374 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/TraceFileValidator.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include "osi-utilities/tracefile/FilenameUtils.h"
+#include "osi-utilities/tracefile/MessageTypeUtils.h"
+#include "osi-utilities/tracefile/TimestampUtils.h"
+#include "osi-utilities/tracefile/TraceFileConfig.h"
+#include "osi-utilities/tracefile/reader/MCAPTraceFileReader.h"
+
+namespace osi3::tracefile {
+
+namespace {
+
+/** Number of batches that may wait for a worker, per worker. Bounds the memory in flight. */
+constexpr size_t kQueuedBatchesPerWorker = 2;
+
+// A frame copied out of the reader, so that it outlives the next read call
+struct FrameTask {
+    size_t index = 0;
+    ReaderTopLevelMessage message_type = ReaderTopLevelMessage::kUnknown;
+    std::string channel_name;
+    uint64_t log_time = 0;
+    bool compare_log_time = false;
+    std::string data;
+};
+
+using FrameBatch = std::vector<FrameTask>;
+
+// Blocking single-producer/multi-consumer queue with a fixed capacity
+class BatchQueue {
+   public:
+    explicit BatchQueue(const size_t capacity) : capacity_(capacity) {}
+
+    void Push(FrameBatch batch) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock, [this] { return queue_.size() < capacity_; });
+        queue_.push_back(std::move(batch));
+        not_empty_.notify_one();
+    }
+
+    auto Pop(FrameBatch& batch) -> bool {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_empty_.wait(lock, [this] { return !queue_.empty() || closed_; });
+        if (queue_.empty()) {
+            return false;
+        }
+        batch = std::move(queue_.front());
+        queue_.pop_front();
+        not_full_.notify_one();
+        return true;
+    }
+
+    void Close() {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        not_empty_.notify_all();
+    }
+
+   private:
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    std::deque<FrameBatch> queue_;
+    size_t capacity_;
+    bool closed_ = false;
+};
+
+auto MakeIssue(const ValidationSeverity severity, const char* check, std::string message, std::string channel_name = {}, std::optional<size_t> frame_index = std::nullopt)
+    -> ValidationIssue {
+    return {severity, check, std::move(message), std::move(channel_name), frame_index};
+}
+
+// Per-frame checks, executed on a worker thread
+class FrameChecker {
+   public:
+    void Check(const FrameTask& frame, std::vector<ValidationIssue>& issues) {
+        auto& message = messages_[frame.message_type];
+        if (!message) {
+            message = CreateMessage(frame.message_type);
+        }
+        if (!message) {
+            issues.push_back(MakeIssue(ValidationSeverity::kError, validation_check::kMessageParse, "Unknown message type", frame.channel_name, frame.index));
+            return;
+        }
+        if (!message->ParseFromArray(frame.data.data(), static_cast<int>(frame.data.size()))) {
+            issues.push_back(MakeIssue(ValidationSeverity::kError, validation_check::kMessageParse, "Failed to deserialize " + message->GetDescriptor()->full_name(),
+                                       frame.channel_name, frame.index));
+            return;
+        }
+
+        const auto* timestamp_field = message->GetDescriptor()->FindFieldByName("timestamp");
+        if (timestamp_field == nullptr || !message->GetReflection()->HasField(*message, timestamp_field)) {
+            issues.push_back(MakeIssue(ValidationSeverity::kWarning, validation_check::kMessageTimestamp, "Message has no timestamp", frame.channel_name, frame.index));
+            return;
+        }
+        try {
+            const auto timestamp = TimestampToNanoseconds(*message);
+            if (frame.compare_log_time && timestamp != frame.log_time) {
+                issues.push_back(MakeIssue(ValidationSeverity::kWarning, validation_check::kMessageTimestamp,
+                                           "Message timestamp " + std::to_string(timestamp) + " ns differs from log time " + std::to_string(frame.log_time) + " ns",
+                                           frame.channel_name, frame.index));
+            }
+        } catch (const std::out_of_range& error) {
+            issues.push_back(MakeIssue(ValidationSeverity::kError, validation_check::kMessageTimestamp, std::string("Invalid timestamp: ") + error.what(), frame.channel_name, frame.index));
+        }
+    }
+
+   private:
+    std::unordered_map<ReaderTopLevelMessage, std::unique_ptr<google::protobuf::Message>> messages_; /**< Reused message instance per type */
+};
+
+void CheckMetadataKeys(const std::unordered_map<std::string, std::string>& metadata, const char* const* required_begin, const char* const* required_end,
+                       const char* const* recommended_begin, const char* const* recommended_end, const bool check_recommended, const char* check, const std::string& context,
+                       const std::string& channel_name, std::vector<ValidationIssue>& issues) {
+    for (const auto* key = required_begin; key != required_end; ++key) {
+        if (metadata.find(*key) == metadata.end()) {
+            issues.push_back(MakeIssue(ValidationSeverity::kError, check, context + " is missing required key '" + *key + "'", channel_name));
+        }
+    }
+    if (!check_recommended) {
+        return;
+    }
+    for (const auto* key = recommended_begin; key != recommended_end; ++key) {
+        if (metadata.find(*key) == metadata.end()) {
+            issues.push_back(MakeIssue(ValidationSeverity::kWarning, check, context + " is missing recommended key '" + *key + "'", channel_name));
+        }
+    }
+}
+
+void CheckMcapMetadata(const MCAPTraceFileReader& reader, const bool check_recommended, std::vector<ValidationIssue>& issues) {
+    const auto file_metadata = reader.GetFileMetadata();
+    const auto trace_metadata =
+        std::find_if(file_metadata.begin(), file_metadata.end(), [](const auto& record) { return record.first == config::kOsiTraceMetadataName; });
+    if (trace_metadata == file_metadata.end()) {
+        issues.push_back(MakeIssue(ValidationSeverity::kError, validation_check::kFileMetadata, std::string("Missing metadata record '") + config::kOsiTraceMetadataName + "'"));
+    } else {
+        CheckMetadataKeys(trace_metadata->second, config::kOsiTraceRequiredMetadataKeys.begin(), config::kOsiTraceRequiredMetadataKeys.end(),
+                          config::kOsiTraceRecommendedMetadataKeys.begin(), config::kOsiTraceRecommendedMetadataKeys.end(), check_recommended, validation_check::kFileMetadata,
+                          std::string("Metadata record '") + config::kOsiTraceMetadataName + "'", {}, issues);
+    }
+
+    auto topics = reader.GetAvailableTopics();
+    std::sort(topics.begin(), topics.end());
+    for (const auto& topic : topics) {
+        if (!reader.GetMessageTypeForTopic(topic).has_value()) {
+            continue;  // non-OSI channels carry no OSI channel metadata
+        }
+        const auto channel_metadata = reader.GetChannelMetadata(topic).value_or(std::unordered_map<std::string, std::string>{});
+        CheckMetadataKeys(channel_metadata, config::kOsiChannelRequiredMetadataKeys.begin(), config::kOsiChannelRequiredMetadataKeys.end(),
+                          config::kOsiChannelRecommendedMetadataKeys.begin(), config::kOsiChannelRecommendedMetadataKeys.end(), check_recommended, validation_check::kChannelMetadata,
+                          "Channel '" + topic + "'", topic, issues);
+    }
+}
+
+void CheckFilename(const std::filesystem::path& file_path, const bool multi_channel, const size_t frame_count, const std::set<ReaderTopLevelMessage>& observed_types,
+                   std::vector<ValidationIssue>& issues) {
+    const auto components = ParseOsiTraceFilename(file_path);
+    if (!components) {
+        if (!multi_channel) {
+            issues.push_back(MakeIssue(ValidationSeverity::kWarning, validation_check::kFilenameConvention, "Filename does not follow the OSI trace file naming convention"));
+        }
+        return;
+    }
+
+    const auto filename_type = InferMessageTypeFromFilename(file_path);
+    if (filename_type != ReaderTopLevelMessage::kUnknown && !observed_types.empty() && observed_types.count(filename_type) == 0) {
+        issues.push_back(MakeIssue(multi_channel ? ValidationSeverity::kWarning : ValidationSeverity::kError, validation_check::kFilenameConvention,
+                                   "Filename message type '" + components->message_type + "' does not match the message type of the frames"));
+    }
+    if (components->frame_count != std::to_string(frame_count)) {
+        issues.push_back(MakeIssue(ValidationSeverity::kWarning, validation_check::kFilenameConvention,
+                                   "Filename frame count " + components->frame_count + " does not match the actual frame count " + std::to_string(frame_count)));
+    }
+}
+
+auto SeverityToString(const ValidationSeverity severity) -> const char* { return severity == ValidationSeverity::kError ? "error" : "warning"; }
+
+void AppendJsonString(std::ostringstream& out, const std::string& value) {
+    out << '"';
+    for (const char character : value) {
+        switch (character) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            case '\r':
+                out << "\\r";
+                break;
+            case '\t':
+                out << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(character) < 0x20) {
+                    char escaped[7];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(character));
+                    out << escaped;
+                } else {
+                    out << character;
+                }
+        }
+    }
+    out << '"';
+}
+
+// Orders issues (file-level first, then by frame), counts them and applies the per-check limit
+void FinalizeReport(ValidationReport& report, std::vector<ValidationIssue> issues, const size_t max_issues_per_check) {
+    const auto sort_key = [](const ValidationIssue& issue) { return issue.frame_index ? *issue.frame_index + 1 : 0; };
+    std::stable_sort(issues.begin(), issues.end(), [&sort_key](const ValidationIssue& lhs, const ValidationIssue& rhs) { return sort_key(lhs) < sort_key(rhs); });
+
+    std::map<std::string, size_t> per_check_count;
+    for (auto& issue : issues) {
+        if (issue.severity == ValidationSeverity::kError) {
+            ++report.error_count;
+        } else {
+            ++report.warning_count;
+        }
+        if (per_check_count[issue.check]++ < max_issues_per_check) {
+            report.issues.push_back(std::move(issue));
+        } else {
+            ++report.suppressed_issue_count;
+        }
+    }
+}
+
+}  // namespace
+
+auto ValidationReport::ToJson() const -> std::string {
+    std::ostringstream out;
+    out << "{\"file\":";
+    AppendJsonString(out, file_path);
+    out << ",\"valid\":" << (IsValid() ? "true" : "false") << ",\"frame_count\":" << frame_count << ",\"error_count\":" << error_count << ",\"warning_count\":" << warning_count
+        << ",\"suppressed_issue_count\":" << suppressed_issue_count << ",\"issues\":[";
+    for (size_t i = 0; i < issues.size(); ++i) {
+        const auto& issue = issues[i];
+        out << (i == 0 ? "" : ",") << "{\"severity\":\"" << SeverityToString(issue.severity) << "\",\"check\":";
+        AppendJsonString(out, issue.check);
+        out << ",\"message\":";
+        AppendJsonString(out, issue.message);
+        if (!issue.channel_name.empty()) {
+            out << ",\"channel\":";
+            AppendJsonString(out, issue.channel_name);
+        }
+        if (issue.frame_index) {
+            out << ",\"frame\":" << *issue.frame_index;
+        }
+        out << "}";
+    }
+    out << "]}";
+    return out.str();
+}
+
+auto ValidateTraceFile(const std::filesystem::path& file_path, const ValidationOptions& options) -> ValidationReport {
+    ValidationReport report;
+    report.file_path = file_path.string();
+    std::vector<ValidationIssue> issues;
+
+    std::unique_ptr<TraceFileReader> reader;
+    try {
+        reader = TraceFileReaderFactory::openReader(file_path, options.message_type, options.io);
+    } catch (const std::exception& error) {
+        issues.push_back(MakeIssue(ValidationSeverity::kError, validation_check::kRead, error.what()));
+        FinalizeReport(report, std::move(issues), options.max_issues_per_check);
+        return report;
+    }
+
+    auto* mcap_reader = dynamic_cast<MCAPTraceFileReader*>(reader.get());
+    if (mcap_reader != nullptr) {
+        mcap_reader->SetSkipIncompatibleMessages(true);
+        mcap_reader->SetLogIncompatibleMessages(false);
+        CheckMcapMetadata(*mcap_reader, options.check_recommended, issues);
+    }
+
+    // Per-frame checks run on the worker pool
+    const auto worker_count = std::max<size_t>(1, options.worker_count != 0 ? options.worker_count : std::thread::hardware_concurrency());
+    const auto batch_size = std::max<size_t>(1, options.batch_size);
+    BatchQueue queue(worker_count * kQueuedBatchesPerWorker);
+    std::vector<std::vector<ValidationIssue>> worker_issues(worker_count);
+    std::vector<std::thread> workers;
+    workers.reserve(worker_count);
+    for (size_t i = 0; i < worker_count; ++i) {
+        workers.emplace_back([&queue, &issues = worker_issues[i]] {
+            FrameChecker checker;
+            FrameBatch batch;
+            while (queue.Pop(batch)) {
+                for (const auto& frame : batch) {
+                    checker.Check(frame, issues);
+                }
+            }
+        });
+    }
+
+    // Sequential checks run on the reading thread while the workers parse
+    std::unordered_map<std::string, uint64_t> last_log_time;
+    std::set<ReaderTopLevelMessage> observed_types;
+    FrameBatch batch;
+    batch.reserve(batch_size);
+    try {
+        while (reader->HasNext()) {
+            const auto raw = reader->ReadRawMessage();
+            if (!raw) {
+                break;
+            }
+            if (raw->status == ReadStatus::kIncompatible) {
+                continue;
+            }
+            if (raw->status == ReadStatus::kError) {
+                issues.push_back(MakeIssue(ValidationSeverity::kError, validation_check::kMessageParse, raw->error_message, raw->channel_name, report.frame_count));
+                ++report.frame_count;
+                continue;
+            }
+
+            const auto index = report.frame_count++;
+            observed_types.insert(raw->message_type);
+            const auto [last, inserted] = last_log_time.try_emplace(raw->channel_name, raw->log_time);
+            if (!inserted) {
+                if (raw->log_time < last->second) {
+                    issues.push_back(MakeIssue(ValidationSeverity::kError, validation_check::kTimestampMonotonic,
+                                               "Log time " + std::to_string(raw->log_time) + " ns is before the previous frame at " + std::to_string(last->second) + " ns",
+                                               raw->channel_name, index));
+                }
+                last->second = raw->log_time;
+            }
+
+            batch.push_back({index, raw->message_type, raw->channel_name, raw->log_time, mcap_reader != nullptr, std::string(raw->data, raw->size)});
+            if (batch.size() == batch_size) {
+                queue.Push(std::move(batch));
+                batch = FrameBatch();
+                batch.reserve(batch_size);
+            }
+        }
+    } catch (const std::exception& error) {
+        issues.push_back(MakeIssue(ValidationSeverity::kError, validation_check::kRead, std::string("Reading stopped after frame ") + std::to_string(report.frame_count) + ": " + error.what()));
+    }
+    if (!batch.empty()) {
+        queue.Push(std::move(batch));
+    }
+    queue.Close();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    reader->Close();
+
+    CheckFilename(file_path, mcap_reader != nullptr, report.frame_count, observed_types, issues);
+    for (auto& per_worker : worker_issues) {
+        issues.insert(issues.end(), std::make_move_iterator(per_worker.begin()), std::make_move_iterator(per_worker.end()));
+    }
+    FinalizeReport(report, std::move(issues), options.max_issues_per_check);
+    return report;
+}
+
+}  // namespace osi3::tracefile
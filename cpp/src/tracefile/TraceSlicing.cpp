@@ -0,0 +1,431 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/TraceSlicing.h"
+
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mcap/reader.hpp>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+
+#include "osi-utilities/tracefile/BlockFileIo.h"
+#include "osi-utilities/tracefile/FilenameUtils.h"
+#include "osi-utilities/tracefile/MessageTypeUtils.h"
+#include "osi-utilities/tracefile/TraceFileConfig.h"
+#include "osi-utilities/tracefile/TraceStatistics.h"
+#include "osi-utilities/tracefile/WireFormatUtils.h"
+#include "osi-utilities/tracefile/writer/MCAPTraceFileWriter.h"
+
+namespace osi3::tracefile {
+
+namespace {
+
+// Size of a MessageIndex record without its entries: opcode, record length, channel ID, entries length
+constexpr uint64_t kMessageIndexHeaderSize = 1 + 8 + 2 + 4;
+// Size of a MessageIndex entry: log time and message offset
+constexpr uint64_t kMessageIndexEntrySize = 8 + 8;
+
+enum class SliceFormat { kBinary, kMcap };
+
+auto GetSliceFormat(const std::filesystem::path& path) -> SliceFormat {
+    const auto extension = path.extension().string();
+    if (extension == ".osi") {
+        return SliceFormat::kBinary;
+    }
+    if (extension == ".mcap") {
+        return SliceFormat::kMcap;
+    }
+    throw std::invalid_argument("Slicing supports .osi and .mcap files, not " + path.string());
+}
+
+auto MakePartPath(const std::filesystem::path& input_path, const std::filesystem::path& output_directory, const std::string& suffix) -> std::filesystem::path {
+    return output_directory / (input_path.stem().string() + "_" + suffix + input_path.extension().string());
+}
+
+// ---------------------------------------------------------------------------
+// Single-channel binary (.osi) files
+// ---------------------------------------------------------------------------
+
+/** @brief Frame offsets of a .osi file, collected from the length prefixes only */
+class BinaryFrameIndex {
+   public:
+    BinaryFrameIndex(const std::filesystem::path& path, const ReaderTopLevelMessage message_type) {
+        // small blocks, so that seeking over the frames does not read them
+        IoOptions index_options;
+        index_options.block_size = config::kIoBufferAlignment;
+        index_options.queue_depth = 1;
+        if (!file_.Open(path, index_options)) {
+            throw std::runtime_error("Failed to open trace file " + path.string());
+        }
+        const auto type = message_type != ReaderTopLevelMessage::kUnknown ? message_type : InferMessageTypeFromFilename(path);
+        if (const auto* descriptor = GetMessageDescriptor(type)) {
+            if (const auto* timestamp_field = descriptor->FindFieldByName("timestamp")) {
+                timestamp_field_number_ = static_cast<uint32_t>(timestamp_field->number());
+            }
+        }
+
+        uint64_t offset = 0;
+        while (offset < file_.Size()) {
+            uint32_t message_size = 0;
+            file_.Seek(offset);
+            if (file_.Read(reinterpret_cast<char*>(&message_size), sizeof(message_size)) != sizeof(message_size) || message_size == 0 ||
+                message_size > config::kMaxExpectedMessageSize || offset + sizeof(message_size) + message_size > file_.Size()) {
+                throw std::runtime_error("Invalid frame at offset " + std::to_string(offset) + " of " + path.string());
+            }
+            offsets_.push_back(offset);
+            offset += sizeof(message_size) + message_size;
+        }
+        offsets_.push_back(offset);
+    }
+
+    auto FrameCount() const -> size_t { return offsets_.size() - 1; }
+
+    auto Offset(const size_t frame) const -> uint64_t { return offsets_[frame]; }
+
+    // First frame with a timestamp not before the given time, assuming non-decreasing timestamps
+    auto LowerBound(const uint64_t time) -> size_t {
+        if (timestamp_field_number_ == 0) {
+            throw std::runtime_error("Time windows of .osi files require a known message type");
+        }
+        size_t low = 0;
+        size_t high = FrameCount();
+        while (low < high) {
+            const size_t middle = low + (high - low) / 2;
+            if (ReadTimestamp(middle) < time) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        return low;
+    }
+
+   private:
+    BlockFileReader file_;
+    std::vector<uint64_t> offsets_; /**< Offset of every frame, followed by the file size */
+    uint32_t timestamp_field_number_ = 0;
+    std::vector<char> buffer_;
+
+    auto ReadTimestamp(const size_t frame) -> uint64_t {
+        buffer_.resize(static_cast<size_t>(offsets_[frame + 1] - offsets_[frame] - sizeof(uint32_t)));
+        file_.Seek(offsets_[frame] + sizeof(uint32_t));
+        if (file_.Read(buffer_.data(), buffer_.size()) != buffer_.size()) {
+            throw std::runtime_error("Failed to read frame " + std::to_string(frame));
+        }
+        const auto timestamp = PeekTimestampNanoseconds({buffer_.data(), buffer_.size()}, timestamp_field_number_);
+        if (!timestamp) {
+            throw std::runtime_error("Frame " + std::to_string(frame) + " has no valid timestamp");
+        }
+        return *timestamp;
+    }
+};
+
+// Selected frames [first, end) of a .osi file
+auto SelectBinaryFrames(BinaryFrameIndex& index, const SliceRange& range) -> std::pair<size_t, size_t> {
+    size_t first = std::min(range.first_frame, index.FrameCount());
+    size_t end = std::min(range.end_frame, index.FrameCount());
+    if (range.start_time > 0) {
+        first = std::max(first, index.LowerBound(range.start_time));
+    }
+    if (range.end_time != std::numeric_limits<uint64_t>::max()) {
+        end = std::min(end, index.LowerBound(range.end_time));
+    }
+    return {first, std::max(first, end)};
+}
+
+void CopyByteRange(const std::filesystem::path& input_path, const uint64_t begin, const uint64_t end, const std::filesystem::path& output_path) {
+    BlockFileReader input;
+    BlockFileWriter output;
+    if (!input.Open(input_path)) {
+        throw std::runtime_error("Failed to open trace file " + input_path.string());
+    }
+    if (!output.Open(output_path)) {
+        throw std::runtime_error("Failed to create trace file " + output_path.string());
+    }
+    std::vector<char> buffer(config::kDefaultIoBlockSize);
+    input.Seek(begin);
+    for (uint64_t remaining = end - begin; remaining > 0;) {
+        const auto size = static_cast<size_t>(std::min<uint64_t>(remaining, buffer.size()));
+        if (input.Read(buffer.data(), size) != size || !output.Write(buffer.data(), size)) {
+            throw std::runtime_error("Failed to copy frames to " + output_path.string());
+        }
+        remaining -= size;
+    }
+    if (!output.Close()) {
+        throw std::runtime_error("Failed to write trace file " + output_path.string());
+    }
+}
+
+auto SliceBinaryFile(BinaryFrameIndex& index, const std::filesystem::path& input_path, const std::filesystem::path& output_path, const SliceRange& range) -> size_t {
+    const auto [first, end] = SelectBinaryFrames(index, range);
+    CopyByteRange(input_path, index.Offset(first), index.Offset(end), output_path);
+    return end - first;
+}
+
+// ---------------------------------------------------------------------------
+// MCAP files
+// ---------------------------------------------------------------------------
+
+void OnMcapProblem(const mcap::Status& status) { std::cerr << "ERROR: The following MCAP problem occurred: " << status.message << std::endl; }
+
+void OpenMcapInput(mcap::McapReader& reader, const std::filesystem::path& path) {
+    if (const auto status = reader.open(path.string()); !status.ok()) {
+        throw std::runtime_error("Failed to open trace file " + path.string() + ": " + status.message);
+    }
+    (void)reader.readSummary(mcap::ReadSummaryMethod::AllowFallbackScan, OnMcapProblem);
+}
+
+// Number of messages of a chunk, derived from the length of its message index records
+auto GetChunkMessageCount(const mcap::ChunkIndex& chunk_index) -> uint64_t {
+    const uint64_t headers = kMessageIndexHeaderSize * chunk_index.messageIndexOffsets.size();
+    return chunk_index.messageIndexLength > headers ? (chunk_index.messageIndexLength - headers) / kMessageIndexEntrySize : 0;
+}
+
+auto GetMcapMessageCount(const mcap::McapReader& reader) -> uint64_t {
+    if (reader.statistics()) {
+        return reader.statistics()->messageCount;
+    }
+    uint64_t count = 0;
+    for (const auto& chunk_index : reader.chunkIndexes()) {
+        count += GetChunkMessageCount(chunk_index);
+    }
+    return count;
+}
+
+/**
+ * @brief Converts the start of a frame range into a start time and the frames to skip from there
+ *
+ * Whole chunks before the first frame are skipped using their message counts, as long as the
+ * chunks do not overlap in time. Otherwise, counting starts at the beginning of the file.
+ */
+auto LocateFirstFrame(const mcap::McapReader& reader, const size_t first_frame) -> std::pair<mcap::Timestamp, uint64_t> {
+    auto chunk_indexes = reader.chunkIndexes();
+    std::sort(chunk_indexes.begin(), chunk_indexes.end(), [](const auto& lhs, const auto& rhs) { return lhs.messageStartTime < rhs.messageStartTime; });
+    uint64_t skipped = 0;
+    for (size_t i = 0; i < chunk_indexes.size(); ++i) {
+        const auto count = GetChunkMessageCount(chunk_indexes[i]);
+        const bool overlaps_next = i + 1 < chunk_indexes.size() && chunk_indexes[i + 1].messageStartTime <= chunk_indexes[i].messageEndTime;
+        if (skipped + count > first_frame || overlaps_next) {
+            return {chunk_indexes[i].messageStartTime, first_frame - skipped};
+        }
+        skipped += count;
+    }
+    return {0, first_frame};
+}
+
+/**
+ * @brief MCAP output file that receives schemas and channels of the input on first use
+ *
+ * Statistics of the input are not copied; if the input has them, they are collected for the
+ * written messages instead.
+ */
+class McapSliceWriter {
+   public:
+    McapSliceWriter(mcap::McapReader& input, const std::filesystem::path& output_path, const bool copy_attachments) {
+        writer_.SetStatisticsEnabled(input.metadataIndexes().count(config::kOsiTraceStatisticsMetadataName) > 0);
+        if (!writer_.Open(output_path)) {
+            throw std::runtime_error("Failed to create trace file " + output_path.string());
+        }
+        auto* data_source = input.dataSource();
+        if (data_source == nullptr) {
+            return;
+        }
+        for (const auto& [name, index] : input.metadataIndexes()) {
+            if (name == config::kOsiTraceStatisticsMetadataName) {
+                continue;
+            }
+            mcap::Record record{};
+            mcap::Metadata metadata;
+            if (mcap::McapReader::ReadRecord(*data_source, index.offset, &record).ok() && mcap::McapReader::ParseMetadata(record, &metadata).ok()) {
+                writer_.AddFileMetadata(metadata);
+            }
+        }
+        if (copy_attachments) {
+            for (const auto& [name, index] : input.attachmentIndexes()) {
+                mcap::Record record{};
+                mcap::Attachment attachment;
+                if (!mcap::McapReader::ReadRecord(*data_source, index.offset, &record).ok() || !mcap::McapReader::ParseAttachment(record, &attachment).ok() ||
+                    !writer_.GetMcapWriter()->write(attachment).ok()) {
+                    throw std::runtime_error("Failed to copy attachment " + name + " to " + output_path.string());
+                }
+            }
+        }
+    }
+
+    void Write(const mcap::MessageView& view) {
+        mcap::Message message = view.message;
+        message.channelId = GetChannelId(view);
+        if (const auto status = writer_.GetMcapWriter()->write(message); !status.ok()) {
+            throw std::runtime_error("Failed to write message: " + status.message);
+        }
+        if (auto* statistics = writer_.GetStatistics()) {
+            statistics->Observe(view.channel->topic, message.logTime, std::string_view(reinterpret_cast<const char*>(message.data), message.dataSize));
+        }
+    }
+
+    void Close() { writer_.Close(); }
+
+   private:
+    MCAPTraceFileWriter writer_;
+    std::unordered_map<mcap::SchemaId, mcap::SchemaId> schema_ids_;
+    std::unordered_map<mcap::ChannelId, mcap::ChannelId> channel_ids_;
+
+    auto GetChannelId(const mcap::MessageView& view) -> mcap::ChannelId {
+        if (const auto channel_id = channel_ids_.find(view.channel->id); channel_id != channel_ids_.end()) {
+            return channel_id->second;
+        }
+        mcap::SchemaId schema_id = 0;
+        if (view.schema) {
+            const auto known_schema = schema_ids_.find(view.schema->id);
+            if (known_schema == schema_ids_.end()) {
+                mcap::Schema schema = *view.schema;
+                writer_.GetMcapWriter()->addSchema(schema);
+                schema_ids_.emplace(view.schema->id, schema.id);
+                schema_id = schema.id;
+            } else {
+                schema_id = known_schema->second;
+            }
+        }
+        mcap::Channel channel(view.channel->topic, view.channel->messageEncoding, schema_id, view.channel->metadata);
+        writer_.GetMcapWriter()->addChannel(channel);
+        channel_ids_.emplace(view.channel->id, channel.id);
+        if (auto* statistics = writer_.GetStatistics(); statistics != nullptr && view.schema) {
+            // channels of message types unknown to this build are left out, as when writing them
+            statistics->AddChannel(view.channel->topic, google::protobuf::DescriptorPool::generated_pool()->FindMessageTypeByName(view.schema->name));
+        }
+        return channel.id;
+    }
+};
+
+auto SliceMcapFile(mcap::McapReader& reader, const std::filesystem::path& output_path, const SliceRange& range, const SliceOptions& options) -> size_t {
+    mcap::ReadMessageOptions read_options;
+    read_options.readOrder = mcap::ReadMessageOptions::ReadOrder::LogTimeOrder;
+    read_options.endTime = std::min<uint64_t>(range.end_time, mcap::MaxTime);
+    uint64_t frame = 0;
+    if (range.first_frame > 0) {
+        uint64_t skip = 0;
+        std::tie(read_options.startTime, skip) = LocateFirstFrame(reader, range.first_frame);
+        frame = range.first_frame - skip;
+    } else if (range.end_frame == std::numeric_limits<size_t>::max()) {
+        // without frame range, the chunk index lets the reader start right at the time window
+        read_options.startTime = range.start_time;
+    }
+
+    McapSliceWriter writer(reader, output_path, options.copy_attachments);
+    size_t copied = 0;
+    for (const auto& view : reader.readMessages(OnMcapProblem, read_options)) {
+        if (frame >= range.end_frame) {
+            break;
+        }
+        if (frame++ >= range.first_frame && view.message.logTime >= range.start_time) {
+            writer.Write(view);
+            ++copied;
+        }
+    }
+    writer.Close();
+    return copied;
+}
+
+}  // namespace
+
+auto SliceTraceFile(const std::filesystem::path& input_path, const std::filesystem::path& output_path, const SliceRange& range, const SliceOptions& options) -> size_t {
+    const auto format = GetSliceFormat(input_path);
+    if (GetSliceFormat(output_path) != format) {
+        throw std::invalid_argument("Slices are written in the format of the input file");
+    }
+    if (format == SliceFormat::kBinary) {
+        BinaryFrameIndex index(input_path, options.message_type);
+        return SliceBinaryFile(index, input_path, output_path, range);
+    }
+
+    mcap::McapReader reader;
+    OpenMcapInput(reader, input_path);
+    const auto copied = SliceMcapFile(reader, output_path, range, options);
+    reader.close();
+    return copied;
+}
+
+auto SplitTraceFile(const std::filesystem::path& input_path, const std::filesystem::path& output_directory, const size_t part_count, const SliceOptions& options)
+    -> std::vector<std::filesystem::path> {
+    if (part_count == 0) {
+        throw std::invalid_argument("A trace file cannot be split into 0 parts");
+    }
+    const auto format = GetSliceFormat(input_path);
+    std::vector<std::filesystem::path> parts;
+
+    std::unique_ptr<BinaryFrameIndex> binary_index;
+    mcap::McapReader mcap_reader;
+    uint64_t frame_count = 0;
+    if (format == SliceFormat::kBinary) {
+        binary_index = std::make_unique<BinaryFrameIndex>(input_path, options.message_type);
+        frame_count = binary_index->FrameCount();
+    } else {
+        OpenMcapInput(mcap_reader, input_path);
+        frame_count = GetMcapMessageCount(mcap_reader);
+    }
+
+    for (size_t part = 0; part < part_count; ++part) {
+        SliceRange range;
+        range.first_frame = static_cast<size_t>(frame_count * part / part_count);
+        range.end_frame = static_cast<size_t>(frame_count * (part + 1) / part_count);
+        parts.push_back(MakePartPath(input_path, output_directory, "part" + std::to_string(part + 1)));
+        if (binary_index) {
+            SliceBinaryFile(*binary_index, input_path, parts.back(), range);
+        } else {
+            SliceMcapFile(mcap_reader, parts.back(), range, options);
+        }
+    }
+    mcap_reader.close();
+    return parts;
+}
+
+auto SplitTraceFileByTopic(const std::filesystem::path& input_path, const std::filesystem::path& output_directory, const SliceOptions& options)
+    -> std::vector<std::filesystem::path> {
+    if (GetSliceFormat(input_path) != SliceFormat::kMcap) {
+        throw std::invalid_argument("Only MCAP files can be split by topic");
+    }
+    mcap::McapReader reader;
+    OpenMcapInput(reader, input_path);
+
+    std::map<std::string, std::unique_ptr<McapSliceWriter>> writers;
+    std::map<std::string, std::filesystem::path> paths;
+    std::set<std::string> used_suffixes;
+    for (const auto& view : reader.readMessages(OnMcapProblem, mcap::ReadMessageOptions{})) {
+        auto& writer = writers[view.channel->topic];
+        if (!writer) {
+            auto suffix = view.channel->topic;
+            std::replace_if(suffix.begin(), suffix.end(), [](const unsigned char character) { return std::isalnum(character) == 0; }, '_');
+            // distinct topics like "a/b" and "a.b" sanitize to the same name and must not overwrite each other's file
+            const auto base_suffix = suffix;
+            for (size_t index = 2; !used_suffixes.insert(suffix).second; ++index) {
+                suffix = base_suffix + "_" + std::to_string(index);
+            }
+            const auto& path = paths[view.channel->topic] = MakePartPath(input_path, output_directory, suffix);
+            writer = std::make_unique<McapSliceWriter>(reader, path, options.copy_attachments);
+        }
+        writer->Write(view);
+    }
+    for (auto& [topic, writer] : writers) {
+        writer->Close();
+    }
+    reader.close();
+
+    std::vector<std::filesystem::path> result;
+    for (const auto& [topic, path] : paths) {
+        result.push_back(path);
+    }
+    return result;
+}
+
+}  // namespace osi3::tracefile
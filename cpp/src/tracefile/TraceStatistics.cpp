@@ -0,0 +1,223 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/TraceStatistics.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <locale>
+#include <sstream>
+
+#include "osi-utilities/tracefile/FlatViews.h"
+#include "osi-utilities/tracefile/WireFormatUtils.h"
+#include "osi_groundtruth.pb.h"
+
+namespace osi3::tracefile {
+
+namespace {
+
+auto GetSizeBucket(const uint64_t size) -> size_t {
+    size_t bucket = 0;
+    while (bucket + 1 < 64 && (size >> (bucket + 1)) != 0) {
+        ++bucket;
+    }
+    return bucket;
+}
+
+auto FormatDouble(const double value) -> std::string {
+    std::ostringstream stream;
+    stream.imbue(std::locale::classic());
+    stream.precision(std::numeric_limits<double>::max_digits10);
+    stream << value;
+    return stream.str();
+}
+
+auto ParseUnsigned(const std::string_view text, uint64_t& value) -> bool {
+    return !text.empty() && std::from_chars(text.data(), text.data() + text.size(), value).ptr == text.data() + text.size();
+}
+
+auto ParseDouble(const std::string& text, double& value) -> bool {
+    std::istringstream stream(text);
+    stream.imbue(std::locale::classic());
+    stream >> value;
+    return !stream.fail() && stream.eof();
+}
+
+// Looks up an unsigned entry, the entry is optional if value is left unchanged on absence
+auto ReadUnsigned(const std::unordered_map<std::string, std::string>& metadata, const std::string& key, uint64_t& value, const bool required) -> bool {
+    const auto entry = metadata.find(key);
+    if (entry == metadata.end()) {
+        return !required;
+    }
+    return ParseUnsigned(entry->second, value);
+}
+
+auto ReadDouble(const std::unordered_map<std::string, std::string>& metadata, const std::string& key, double& value) -> bool {
+    const auto entry = metadata.find(key);
+    return entry != metadata.end() && ParseDouble(entry->second, value);
+}
+
+auto DecodeHostVehicleId(const std::string_view ground_truth) -> std::optional<uint64_t> {
+    std::string merge_buffer;
+    const auto identifier = FindMergedMessageField(ground_truth, GroundTruth::kHostVehicleIdFieldNumber, merge_buffer);
+    if (!identifier) {
+        return std::nullopt;
+    }
+    WireFieldReader reader(*identifier);
+    WireField field;
+    uint64_t value = 0;
+    while (reader.Next(field)) {
+        if (field.number == Identifier::kValueFieldNumber && field.type == WireType::kVarint) {
+            value = field.value;
+        }
+    }
+    if (reader.HasError()) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+void ObserveGroundTruth(const std::string_view serialized, ChannelStatistics& statistics) {
+    const auto host_vehicle_id = DecodeHostVehicleId(serialized);
+    MovingObjectScanner scanner(serialized);
+    MovingObjectView object;
+    uint64_t object_count = 0;
+    std::optional<double> host_speed;
+    while (scanner.Next(object)) {
+        ++object_count;
+        if (host_vehicle_id && object.id == *host_vehicle_id && object.has_base) {
+            const auto& velocity = object.base.velocity;
+            host_speed = std::sqrt(velocity.x * velocity.x + velocity.y * velocity.y + velocity.z * velocity.z);
+        }
+    }
+    if (scanner.HasError()) {
+        return;
+    }
+    ++statistics.object_count_frames;
+    statistics.min_object_count = std::min(statistics.min_object_count, object_count);
+    statistics.max_object_count = std::max(statistics.max_object_count, object_count);
+    if (host_speed) {
+        ++statistics.host_speed_count;
+        statistics.min_host_speed = std::min(statistics.min_host_speed, *host_speed);
+        statistics.max_host_speed = std::max(statistics.max_host_speed, *host_speed);
+        statistics.host_speed_sum += *host_speed;
+    }
+}
+
+}  // namespace
+
+void TraceStatistics::AddChannel(const std::string& topic, const google::protobuf::Descriptor* descriptor) {
+    if (descriptor == nullptr || channel_index_.count(topic) > 0) {
+        return;
+    }
+    ChannelStatistics statistics;
+    statistics.topic = topic;
+    statistics.message_type = std::string(descriptor->full_name());
+    channel_index_[topic] = {channels_.size(), descriptor == GroundTruth::descriptor()};
+    channels_.push_back(std::move(statistics));
+}
+
+void TraceStatistics::Observe(const std::string& topic, const uint64_t log_time, const std::string_view serialized) {
+    const auto channel = channel_index_.find(topic);
+    if (channel == channel_index_.end()) {
+        return;
+    }
+    auto& statistics = channels_[channel->second.index];
+    ++statistics.message_count;
+    statistics.min_log_time = std::min(statistics.min_log_time, log_time);
+    statistics.max_log_time = std::max(statistics.max_log_time, log_time);
+    statistics.total_size += serialized.size();
+    statistics.min_size = std::min<uint64_t>(statistics.min_size, serialized.size());
+    statistics.max_size = std::max<uint64_t>(statistics.max_size, serialized.size());
+    ++statistics.size_histogram[GetSizeBucket(serialized.size())];
+    if (channel->second.ground_truth) {
+        ObserveGroundTruth(serialized, statistics);
+    }
+}
+
+auto ToMetadata(const ChannelStatistics& statistics) -> std::unordered_map<std::string, std::string> {
+    std::unordered_map<std::string, std::string> metadata;
+    metadata["topic"] = statistics.topic;
+    metadata["message_type"] = statistics.message_type;
+    metadata["message_count"] = std::to_string(statistics.message_count);
+    if (statistics.message_count > 0) {
+        metadata["min_log_time"] = std::to_string(statistics.min_log_time);
+        metadata["max_log_time"] = std::to_string(statistics.max_log_time);
+        metadata["total_size"] = std::to_string(statistics.total_size);
+        metadata["min_size"] = std::to_string(statistics.min_size);
+        metadata["max_size"] = std::to_string(statistics.max_size);
+    }
+    std::string histogram;
+    for (size_t bucket = 0; bucket < statistics.size_histogram.size(); ++bucket) {
+        if (statistics.size_histogram[bucket] > 0) {
+            histogram += (histogram.empty() ? "" : ",") + std::to_string(bucket == 0 ? 0 : uint64_t{1} << bucket) + ":" + std::to_string(statistics.size_histogram[bucket]);
+        }
+    }
+    metadata["size_histogram"] = histogram;
+    if (statistics.object_count_frames > 0) {
+        metadata["min_object_count"] = std::to_string(statistics.min_object_count);
+        metadata["max_object_count"] = std::to_string(statistics.max_object_count);
+    }
+    if (statistics.host_speed_count > 0) {
+        metadata["host_speed_frames"] = std::to_string(statistics.host_speed_count);
+        metadata["min_host_speed"] = FormatDouble(statistics.min_host_speed);
+        metadata["max_host_speed"] = FormatDouble(statistics.max_host_speed);
+        metadata["mean_host_speed"] = FormatDouble(statistics.MeanHostSpeed());
+    }
+    return metadata;
+}
+
+auto ParseStatisticsMetadata(const std::unordered_map<std::string, std::string>& metadata) -> std::optional<ChannelStatistics> {
+    ChannelStatistics statistics;
+    const auto topic = metadata.find("topic");
+    const auto message_type = metadata.find("message_type");
+    if (topic == metadata.end() || message_type == metadata.end() || !ReadUnsigned(metadata, "message_count", statistics.message_count, true)) {
+        return std::nullopt;
+    }
+    statistics.topic = topic->second;
+    statistics.message_type = message_type->second;
+    const bool has_messages = statistics.message_count > 0;
+    if (!ReadUnsigned(metadata, "min_log_time", statistics.min_log_time, has_messages) || !ReadUnsigned(metadata, "max_log_time", statistics.max_log_time, has_messages) ||
+        !ReadUnsigned(metadata, "total_size", statistics.total_size, has_messages) || !ReadUnsigned(metadata, "min_size", statistics.min_size, has_messages) ||
+        !ReadUnsigned(metadata, "max_size", statistics.max_size, has_messages)) {
+        return std::nullopt;
+    }
+
+    if (const auto histogram = metadata.find("size_histogram"); histogram != metadata.end()) {
+        const std::string_view text = histogram->second;
+        size_t begin = 0;
+        while (begin < text.size()) {
+            const auto end = std::min(text.find(',', begin), text.size());
+            const auto entry = text.substr(begin, end - begin);
+            const auto colon = entry.find(':');
+            uint64_t lower_bound = 0;
+            uint64_t count = 0;
+            if (colon == std::string_view::npos || !ParseUnsigned(entry.substr(0, colon), lower_bound) || !ParseUnsigned(entry.substr(colon + 1), count)) {
+                return std::nullopt;
+            }
+            statistics.size_histogram[GetSizeBucket(lower_bound)] += count;
+            begin = end + 1;
+        }
+    }
+
+    if (metadata.count("min_object_count") > 0) {
+        if (!ReadUnsigned(metadata, "min_object_count", statistics.min_object_count, true) || !ReadUnsigned(metadata, "max_object_count", statistics.max_object_count, true)) {
+            return std::nullopt;
+        }
+        statistics.object_count_frames = statistics.message_count;
+    }
+    if (metadata.count("host_speed_frames") > 0) {
+        double mean = 0.0;
+        if (!ReadUnsigned(metadata, "host_speed_frames", statistics.host_speed_count, true) || !ReadDouble(metadata, "min_host_speed", statistics.min_host_speed) ||
+            !ReadDouble(metadata, "max_host_speed", statistics.max_host_speed) || !ReadDouble(metadata, "mean_host_speed", mean)) {
+            return std::nullopt;
+        }
+        statistics.host_speed_sum = mean * static_cast<double>(statistics.host_speed_count);
+    }
+    return statistics;
+}
+
+}  // namespace osi3::tracefile
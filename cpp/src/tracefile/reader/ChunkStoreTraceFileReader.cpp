@@ -0,0 +1,79 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/reader/ChunkStoreTraceFileReader.h"
+
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+#include "osi-utilities/tracefile/ChunkStore.h"
+#include "osi-utilities/tracefile/TraceFileConfig.h"
+#include "osi-utilities/tracefile/reader/MCAPTraceFileReader.h"
+#include "osi-utilities/tracefile/reader/SingleChannelBinaryTraceFileReader.h"
+
+namespace osi3 {
+
+ChunkStoreTraceFileReader::~ChunkStoreTraceFileReader() { ChunkStoreTraceFileReader::Close(); }
+
+auto ChunkStoreTraceFileReader::Open(const std::filesystem::path& file_path) -> bool { return Open(file_path, ReaderTopLevelMessage::kUnknown); }
+
+auto ChunkStoreTraceFileReader::Open(const std::filesystem::path& file_path, const ReaderTopLevelMessage message_type) -> bool {
+    Close();
+    if (file_path.extension().string() != tracefile::config::kChunkManifestExtension) {
+        std::cerr << "ERROR: The file " << file_path << " is not a chunk store manifest\n";
+        return false;
+    }
+    // the manifest is named after the stored file, which keeps the format and message type inferable
+    const auto stored_path = file_path.parent_path() / file_path.stem();
+    bool opened = false;
+    try {
+        auto source = std::make_unique<tracefile::ChunkStoreFileSource>(file_path);
+        reader_ = TraceFileReaderFactory::createReader(stored_path);
+        reader_->SetLazyDecoding(lazy_decoding_);
+        if (auto* binary_reader = dynamic_cast<SingleChannelBinaryTraceFileReader*>(reader_.get())) {
+            binary_reader->SetFileSource(std::move(source));
+            opened = message_type == ReaderTopLevelMessage::kUnknown ? binary_reader->Open(stored_path) : binary_reader->Open(stored_path, message_type);
+        } else if (auto* mcap_reader = dynamic_cast<MCAPTraceFileReader*>(reader_.get())) {
+            mcap_reader->SetFileSource(std::move(source));
+            opened = mcap_reader->Open(stored_path);
+        } else {
+            throw std::invalid_argument("Chunk stores support .osi and .mcap files, not " + stored_path.string());
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "ERROR: Failed to open " << file_path << ": " << e.what() << "\n";
+    }
+    if (!opened) {
+        Close();
+    }
+    return opened;
+}
+
+auto ChunkStoreTraceFileReader::ReadMessage() -> std::optional<ReadResult> {
+    if (!reader_) {
+        std::cerr << "ERROR: Cannot read message, file is not open\n";
+        return std::nullopt;
+    }
+    return reader_->ReadMessage();
+}
+
+auto ChunkStoreTraceFileReader::ReadRawMessage() -> std::optional<RawReadResult> {
+    if (!reader_) {
+        std::cerr << "ERROR: Cannot read message, file is not open\n";
+        return std::nullopt;
+    }
+    return reader_->ReadRawMessage();
+}
+
+auto ChunkStoreTraceFileReader::HasNext() -> bool { return reader_ && reader_->HasNext(); }
+
+void ChunkStoreTraceFileReader::Close() {
+    if (reader_) {
+        reader_->Close();
+        reader_.reset();
+    }
+}
+
+}  // namespace osi3
@@ -5,15 +5,19 @@
 
 #include "osi-utilities/tracefile/reader/MCAPTraceFileReader.h"
 
+#include <algorithm>
+#include <array>
 #include <cstdio>
 #include <cstring>
 #include <exception>
 #include <filesystem>
 
+#include "osi-utilities/tracefile/PayloadOffload.h"
+
 namespace osi3 {
 
 MCAPTraceFileReader::~MCAPTraceFileReader() noexcept {
-    if (trace_file_.is_open()) {
+    if (trace_file_.IsOpen()) {
         try {
             Close();
         } catch (const std::exception& error) {
@@ -34,21 +38,20 @@ auto MCAPTraceFileReader::Open(const std::filesystem::path& file_path) -> bool {
     }
 
     // check if file exists
-    if (!exists(file_path)) {
+    if (!file_source_ && !exists(file_path)) {
         std::cerr << "ERROR: The trace file '" << file_path << "' does not exist." << std::endl;
         return false;
     }
 
-    // open but instead of mcap::McapReader::open(std::string_view filename) use internal ifstream to support
+    // open but instead of mcap::McapReader::open(std::string_view filename) use an internal file reader to support
     // even the strangest paths with std::filesystem::path
-    trace_file_ = std::ifstream(file_path, std::ios::binary);
-    if (!trace_file_) {
+    if (!(file_source_ ? trace_file_.Open(std::move(file_source_)) : trace_file_.Open(file_path, io_options_))) {
         std::cerr << "ERROR: Failed to open file stream: " << file_path << std::endl;
         return false;
     }
-    if (const auto status = mcap_reader_.open(trace_file_); !status.ok()) {
+    if (const auto status = mcap_reader_.open(readable_); !status.ok()) {
         std::cerr << "ERROR: Failed to open MCAP file: " << status.message << std::endl;
-        trace_file_.close();
+        trace_file_.Close();
         return false;
     }
 
@@ -79,33 +82,46 @@ auto MCAPTraceFileReader::Open(const std::filesystem::path& file_path, const mca
     return this->Open(file_path);
 }
 
-auto MCAPTraceFileReader::ProcessMessageView(const mcap::MessageView& msg_view) -> std::optional<ReadResult> {
-    const auto& channel = msg_view.channel;
+auto MCAPTraceFileReader::FindDeserializer(const mcap::MessageView& msg_view, std::string& reason) const -> const std::pair<DeserializeFunction, ReaderTopLevelMessage>* {
     const auto& schema = msg_view.schema;
 
-    if (!channel || !schema) {
-        throw std::runtime_error("ERROR: MCAP message has null channel or schema pointer.");
-    }
-
     // Check for incompatible messages (non-OSI protobuf encoding/schema)
     if (schema->encoding != "protobuf" || schema->name.size() < 5 || schema->name.substr(0, 5) != "osi3.") {
-        return HandleIncompatibleMessage(
-            channel->topic, schema->encoding != "protobuf" ? "Incompatible message encoding: " + schema->encoding : "Incompatible schema: " + schema->name + " (expected osi3.*)");
+        reason = schema->encoding != "protobuf" ? "Incompatible message encoding: " + schema->encoding : "Incompatible schema: " + schema->name + " (expected osi3.*)";
+        return nullptr;
     }
 
     // Look up the deserializer for this OSI schema
     auto deserializer_it = deserializer_map_.find(schema->name);
     if (deserializer_it == deserializer_map_.end()) {
-        return HandleIncompatibleMessage(channel->topic, "Unsupported OSI message type: " + schema->name);
+        reason = "Unsupported OSI message type: " + schema->name;
+        return nullptr;
+    }
+    return &deserializer_it->second;
+}
+
+auto MCAPTraceFileReader::ProcessMessageView(const mcap::MessageView& msg_view) -> std::optional<ReadResult> {
+    const auto& channel = msg_view.channel;
+    const auto& schema = msg_view.schema;
+
+    if (!channel || !schema) {
+        throw std::runtime_error("ERROR: MCAP message has null channel or schema pointer.");
+    }
+
+    std::string incompatibility_reason;
+    const auto* deserializer = FindDeserializer(msg_view, incompatibility_reason);
+    if (deserializer == nullptr) {
+        return HandleIncompatibleMessage(channel->topic, incompatibility_reason);
     }
 
     // Deserialize the message
-    const auto& [deserialize_fn, message_type] = deserializer_it->second;
+    const auto& [deserialize_fn, message_type] = *deserializer;
     try {
         ReadResult result;
         result.message = deserialize_fn(msg_view.message);
         result.message_type = message_type;
         result.channel_name = channel->topic;
+        result.log_time = msg_view.message.logTime;
         result.status = ReadStatus::kOk;
         return result;
     } catch (const std::exception& e) {
@@ -120,6 +136,39 @@ auto MCAPTraceFileReader::ProcessMessageView(const mcap::MessageView& msg_view)
     }
 }
 
+auto MCAPTraceFileReader::ProcessRawMessageView(const mcap::MessageView& msg_view) -> std::optional<RawReadResult> {
+    const auto& channel = msg_view.channel;
+    const auto& schema = msg_view.schema;
+
+    if (!channel || !schema) {
+        throw std::runtime_error("ERROR: MCAP message has null channel or schema pointer.");
+    }
+
+    std::string incompatibility_reason;
+    const auto* deserializer = FindDeserializer(msg_view, incompatibility_reason);
+    if (deserializer == nullptr) {
+        const auto incompatible = HandleIncompatibleMessage(channel->topic, incompatibility_reason);
+        if (!incompatible.has_value()) {
+            return std::nullopt;
+        }
+        RawReadResult result;
+        result.status = ReadStatus::kIncompatible;
+        result.error_message = incompatible->error_message;
+        result.channel_name = channel->topic;
+        result.log_time = msg_view.message.logTime;
+        return result;
+    }
+
+    RawReadResult result;
+    result.data = reinterpret_cast<const char*>(msg_view.message.data);
+    result.size = static_cast<size_t>(msg_view.message.dataSize);
+    result.message_type = deserializer->second;
+    result.channel_name = channel->topic;
+    result.log_time = msg_view.message.logTime;
+    result.status = ReadStatus::kOk;
+    return result;
+}
+
 auto MCAPTraceFileReader::HandleIncompatibleMessage(const std::string& topic, const std::string& reason) const -> std::optional<ReadResult> {
     if (log_incompatible_msgs_) {
         std::cerr << "WARNING: " << reason << " on topic '" << topic << "'" << std::endl;
@@ -135,6 +184,11 @@ auto MCAPTraceFileReader::HandleIncompatibleMessage(const std::string& topic, co
 }
 
 auto MCAPTraceFileReader::ReadMessage() -> std::optional<ReadResult> {
+    if (lazy_decoding_) {
+        const auto raw_result = ReadRawMessage();
+        return raw_result ? std::optional<ReadResult>(MakeLazyResult(*raw_result)) : std::nullopt;
+    }
+
     while (this->HasNext()) {
         auto result = ProcessMessageView(**message_iterator_);
         ++*message_iterator_;
@@ -148,22 +202,49 @@ auto MCAPTraceFileReader::ReadMessage() -> std::optional<ReadResult> {
     return std::nullopt;
 }
 
+auto MCAPTraceFileReader::ReadRawMessage() -> std::optional<RawReadResult> {
+    while (this->HasNext()) {
+        auto result = ProcessRawMessageView(**message_iterator_);
+
+        if (!result.has_value()) {
+            ++*message_iterator_;
+            continue;  // message was skipped (incompatible + skip enabled)
+        }
+        if (result->status == ReadStatus::kOk) {
+            advance_pending_ = true;  // keep the chunk holding result->data alive until the next call
+        } else {
+            ++*message_iterator_;
+        }
+        return result;
+    }
+
+    return std::nullopt;
+}
+
 void MCAPTraceFileReader::Close() {
+    advance_pending_ = false;
     message_iterator_.reset();
     message_view_.reset();
     mcap_reader_.close();
-    trace_file_.close();
+    trace_file_.Close();
     file_metadata_.clear();
+    payload_batch_offset_ = std::numeric_limits<uint64_t>::max();
+    payload_batch_.clear();
 }
 
 auto MCAPTraceFileReader::HasNext() -> bool {
     // not opened yet
-    if (!(trace_file_ && trace_file_.is_open())) {
+    if (!trace_file_.IsOpen()) {
         return false;
     }
     if (!message_iterator_) {
         return false;
     }
+    // move past a message handed out by ReadRawMessage()
+    if (advance_pending_) {
+        advance_pending_ = false;
+        ++*message_iterator_;
+    }
     // no more messages
     if (*message_iterator_ == message_view_->end()) {
         return false;
@@ -180,14 +261,23 @@ void MCAPTraceFileReader::SetTopics(const std::unordered_set<std::string>& topic
         mcap_options_.topicFilter = [this](const std::string_view topic) noexcept { return TopicMatches(topic); };
     }
 
-    if (trace_file_.is_open()) {
+    if (trace_file_.IsOpen()) {
+        ResetMessageIteration();
+    }
+}
+
+void MCAPTraceFileReader::SetReadOptions(const mcap::ReadMessageOptions& options) {
+    filtered_topics_.clear();
+    mcap_options_ = options;
+
+    if (trace_file_.IsOpen()) {
         ResetMessageIteration();
     }
 }
 
 auto MCAPTraceFileReader::GetAvailableTopics() const -> std::vector<std::string> {
     std::vector<std::string> topics;
-    if (!trace_file_.is_open()) {
+    if (!trace_file_.IsOpen()) {
         return topics;
     }
 
@@ -203,7 +293,7 @@ auto MCAPTraceFileReader::GetAvailableTopics() const -> std::vector<std::string>
 auto MCAPTraceFileReader::GetFileMetadata() const -> std::vector<std::pair<std::string, std::unordered_map<std::string, std::string>>> { return file_metadata_; }
 
 auto MCAPTraceFileReader::GetChannelMetadata(const std::string& topic) const -> std::optional<std::unordered_map<std::string, std::string>> {
-    if (!trace_file_.is_open()) {
+    if (!trace_file_.IsOpen()) {
         return std::nullopt;
     }
 
@@ -217,7 +307,7 @@ auto MCAPTraceFileReader::GetChannelMetadata(const std::string& topic) const ->
 }
 
 auto MCAPTraceFileReader::GetMessageTypeForTopic(const std::string& topic) const -> std::optional<ReaderTopLevelMessage> {
-    if (!trace_file_.is_open()) {
+    if (!trace_file_.IsOpen()) {
         return std::nullopt;
     }
 
@@ -239,6 +329,102 @@ auto MCAPTraceFileReader::GetMessageTypeForTopic(const std::string& topic) const
     return std::nullopt;
 }
 
+auto MCAPTraceFileReader::GetAttachments() const -> std::vector<McapAttachmentInfo> {
+    std::vector<McapAttachmentInfo> attachments;
+    if (!trace_file_.IsOpen()) {
+        return attachments;
+    }
+    for (const auto& [name, index] : mcap_reader_.attachmentIndexes()) {
+        attachments.push_back({index.name, index.mediaType, index.logTime, index.createTime, index.dataSize, index.offset});
+    }
+    return attachments;
+}
+
+auto MCAPTraceFileReader::ReadAttachment(const McapAttachmentInfo& attachment) -> std::optional<std::string> {
+    if (!trace_file_.IsOpen()) {
+        std::cerr << "ERROR: cannot read attachment, file is not open" << std::endl;
+        return std::nullopt;
+    }
+    // Skip the record header (opcode, record length, log time, create time, name, media type)
+    // to read the data directly, instead of loading the whole record via the MCAP reader
+    constexpr uint64_t kFixedHeaderSize = 1 + 8 + 8 + 8 + 4 + 4;
+    const uint64_t data_offset = attachment.offset + kFixedHeaderSize + attachment.name.size() + attachment.media_type.size() + sizeof(uint64_t);
+    if (data_offset > trace_file_.Size() || attachment.data_size > trace_file_.Size() - data_offset) {
+        std::cerr << "ERROR: cannot read attachment " << attachment.name << ", it exceeds the file" << std::endl;
+        return std::nullopt;
+    }
+
+    std::array<unsigned char, sizeof(uint64_t)> data_size_field{};
+    trace_file_.Seek(data_offset - sizeof(uint64_t));
+    trace_file_.Read(reinterpret_cast<char*>(data_size_field.data()), data_size_field.size());
+    uint64_t data_size = 0;
+    for (size_t i = 0; i < data_size_field.size(); ++i) {
+        data_size |= static_cast<uint64_t>(data_size_field[i]) << (8 * i);
+    }
+    if (data_size != attachment.data_size) {
+        std::cerr << "ERROR: cannot read attachment " << attachment.name << ", its record does not match the summary" << std::endl;
+        return std::nullopt;
+    }
+
+    std::string data(static_cast<size_t>(data_size), '\0');
+    if (trace_file_.Read(data.data(), data.size()) != data.size()) {
+        std::cerr << "ERROR: Failed to read attachment " << attachment.name << std::endl;
+        return std::nullopt;
+    }
+    return data;
+}
+
+auto MCAPTraceFileReader::ReadAttachment(const std::string& name) -> std::optional<std::string> {
+    for (const auto& attachment : GetAttachments()) {
+        if (attachment.name == name) {
+            return ReadAttachment(attachment);
+        }
+    }
+    std::cerr << "ERROR: The trace file has no attachment " << name << std::endl;
+    return std::nullopt;
+}
+
+auto MCAPTraceFileReader::AttachOffloadedPayloads(ReadResult& result) -> bool {
+    if (!trace_file_.IsOpen() || result.status != ReadStatus::kOk || result.Decode() == nullptr) {
+        return false;
+    }
+    // the batches of a channel share the name prefix and are therefore adjacent in the name-ordered index
+    const auto prefix = tracefile::config::kPayloadAttachmentNamePrefix + result.channel_name + "@";
+    const auto& indexes = mcap_reader_.attachmentIndexes();
+    for (auto it = indexes.lower_bound(prefix); it != indexes.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it) {
+        const auto range = tracefile::ParsePayloadAttachmentName(it->first, result.channel_name);
+        if (!range || result.log_time < range->first || result.log_time > range->second) {
+            continue;
+        }
+        const auto& index = it->second;
+        if (index.offset != payload_batch_offset_) {
+            auto data = ReadAttachment(McapAttachmentInfo{index.name, index.mediaType, index.logTime, index.createTime, index.dataSize, index.offset});
+            if (!data) {
+                return false;
+            }
+            payload_batch_ = std::move(*data);
+            payload_batch_offset_ = index.offset;
+        }
+        if (!tracefile::AttachPayloads(*result.message, payload_batch_, result.log_time)) {
+            std::cerr << "ERROR: Failed to attach payloads of " << index.name << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+auto MCAPTraceFileReader::BlockReadable::read(std::byte** output, const uint64_t offset, const uint64_t size) -> uint64_t {
+    if (offset >= file_.Size()) {
+        return 0;
+    }
+    // the MCAP reader mostly reads consecutive ranges, which keeps the read-ahead of the file reader effective
+    file_.Seek(offset);
+    buffer_.resize(static_cast<size_t>(std::min(size, file_.Size() - offset)));
+    const auto read = file_.Read(reinterpret_cast<char*>(buffer_.data()), buffer_.size());
+    *output = buffer_.data();
+    return read;
+}
+
 void MCAPTraceFileReader::OnProblem(const mcap::Status& status) { std::cerr << "ERROR: The following MCAP problem occurred: " << status.message; }
 
 auto MCAPTraceFileReader::TopicMatches(const std::string_view topic) const noexcept -> bool {
@@ -252,10 +438,11 @@ auto MCAPTraceFileReader::TopicMatches(const std::string_view topic) const noexc
 }
 
 void MCAPTraceFileReader::ResetMessageIteration() {
+    advance_pending_ = false;
     message_iterator_.reset();
     message_view_.reset();
 
-    if (!trace_file_.is_open()) {
+    if (!trace_file_.IsOpen()) {
         return;
     }
 
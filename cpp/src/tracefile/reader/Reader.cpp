@@ -7,6 +7,10 @@
 
 #include <iostream>
 
+#include "osi-utilities/tracefile/MessageTypeUtils.h"
+#include "osi-utilities/tracefile/TimestampUtils.h"
+#include "osi-utilities/tracefile/TraceFileConfig.h"
+#include "osi-utilities/tracefile/reader/ChunkStoreTraceFileReader.h"
 #include "osi-utilities/tracefile/reader/MCAPTraceFileReader.h"
 #include "osi-utilities/tracefile/reader/SingleChannelBinaryTraceFileReader.h"
 
@@ -22,6 +26,63 @@
 
 namespace osi3 {
 
+auto ReadResult::Decode() -> const google::protobuf::Message* {
+    if (message != nullptr || status != ReadStatus::kOk) {
+        return message.get();
+    }
+    auto decoded = tracefile::CreateMessage(message_type);
+    if (decoded == nullptr || !decoded->ParseFromString(serialized_message)) {
+        status = ReadStatus::kError;
+        error_message = "Deserialization failed: invalid serialized message";
+        return nullptr;
+    }
+    message = std::move(decoded);
+    return message.get();
+}
+
+auto TraceFileReader::MakeLazyResult(const RawReadResult& raw_result) -> ReadResult {
+    ReadResult result;
+    result.message_type = raw_result.message_type;
+    result.channel_name = raw_result.channel_name;
+    result.log_time = raw_result.log_time;
+    result.status = raw_result.status;
+    result.error_message = raw_result.error_message;
+    if (raw_result.status == ReadStatus::kOk) {
+        result.serialized_message.assign(raw_result.data, raw_result.size);
+    }
+    return result;
+}
+
+auto TraceFileReader::ReadRawMessage() -> std::optional<RawReadResult> {
+    auto read_result = ReadMessage();
+    if (!read_result) {
+        return std::nullopt;
+    }
+
+    RawReadResult result;
+    result.message_type = read_result->message_type;
+    result.channel_name = std::move(read_result->channel_name);
+    result.status = read_result->status;
+    result.error_message = std::move(read_result->error_message);
+    if (result.status != ReadStatus::kOk || !read_result->message) {
+        return result;
+    }
+
+    if (!read_result->message->SerializeToString(&raw_message_buffer_)) {
+        result.status = ReadStatus::kError;
+        result.error_message = "Failed to serialize message";
+        return result;
+    }
+    try {
+        result.log_time = tracefile::TimestampToNanoseconds(*read_result->message);
+    } catch (const std::out_of_range&) {
+        // messages without a valid timestamp keep log_time == 0
+    }
+    result.data = raw_message_buffer_.data();
+    result.size = raw_message_buffer_.size();
+    return result;
+}
+
 auto TraceFileReaderFactory::createReader(const std::filesystem::path& path) -> std::unique_ptr<osi3::TraceFileReader> {
     if (path.extension().string() == ".osi") {
         return std::make_unique<osi3::SingleChannelBinaryTraceFileReader>();
@@ -34,9 +95,34 @@ auto TraceFileReaderFactory::createReader(const std::filesystem::path& path) ->
                      "(protobuf text format is not stable across versions). Use .osi or .mcap instead.\n";
         return std::make_unique<osi3::TXTHTraceFileReader>();
     }
+    if (path.extension().string() == tracefile::config::kChunkManifestExtension) {
+        return std::make_unique<osi3::ChunkStoreTraceFileReader>();
+    }
     throw std::invalid_argument("Unsupported format: " + path.extension().string());
 }
 
+auto TraceFileReaderFactory::openReader(const std::filesystem::path& path, const ReaderTopLevelMessage message_type, const tracefile::IoOptions& io_options)
+    -> std::unique_ptr<osi3::TraceFileReader> {
+    auto reader = createReader(path);
+    reader->SetIoOptions(io_options);
+    bool opened = false;
+    if (message_type == ReaderTopLevelMessage::kUnknown) {
+        opened = reader->Open(path);
+    } else if (auto* binary_reader = dynamic_cast<SingleChannelBinaryTraceFileReader*>(reader.get())) {
+        opened = binary_reader->Open(path, message_type);
+    } else if (auto* txth_reader = dynamic_cast<TXTHTraceFileReader*>(reader.get())) {
+        opened = txth_reader->Open(path, message_type);
+    } else if (auto* chunk_store_reader = dynamic_cast<ChunkStoreTraceFileReader*>(reader.get())) {
+        opened = chunk_store_reader->Open(path, message_type);
+    } else {
+        opened = reader->Open(path);
+    }
+    if (!opened) {
+        throw std::runtime_error("Failed to open trace file: " + path.string());
+    }
+    return reader;
+}
+
 }  // namespace osi3
 
 #if defined(__GNUC__) || defined(__clang__)
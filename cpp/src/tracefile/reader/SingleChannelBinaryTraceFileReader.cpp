@@ -5,14 +5,218 @@
 
 #include "osi-utilities/tracefile/reader/SingleChannelBinaryTraceFileReader.h"
 
+#include <google/protobuf/io/zero_copy_stream.h>
+
+#include <algorithm>
 #include <filesystem>
+#include <iostream>
+#include <optional>
+#include <string>
 
+#include "osi-utilities/tracefile/MessageTypeUtils.h"
 #include "osi-utilities/tracefile/TraceFileConfig.h"
+#include "osi-utilities/tracefile/WireFormatUtils.h"
 
 namespace osi3 {
 
+namespace {
+
+// Scans the top-level fields of a message fed in consecutive pieces and merges the occurrences of its 'timestamp'
+// field, the incremental counterpart of tracefile::PeekTimestampNanoseconds()
+class TimestampPeeker {
+   public:
+    explicit TimestampPeeker(const uint32_t timestamp_field_number) : timestamp_field_number_(timestamp_field_number) {}
+
+    void Feed(const char* data, const size_t size) {
+        size_t position = 0;
+        while (position < size && !failed_) {
+            if (state_ == State::kPayload) {
+                const auto count = static_cast<size_t>(std::min<uint64_t>(remaining_, size - position));
+                if (capturing_) {
+                    timestamp_.append(data + position, count);
+                }
+                position += count;
+                remaining_ -= count;
+                FinishPayloadIfComplete();
+                continue;
+            }
+            const auto byte = static_cast<uint8_t>(data[position++]);
+            if (shift_ > 63) {
+                failed_ = true;
+                break;
+            }
+            varint_ |= static_cast<uint64_t>(byte & 0x7FU) << shift_;
+            shift_ += 7;
+            if ((byte & 0x80U) == 0) {
+                FinishVarint();
+            }
+        }
+    }
+
+    // Timestamp in nanoseconds, or std::nullopt if absent, malformed or the message is incomplete
+    std::optional<uint64_t> Result() const {
+        if (failed_ || state_ != State::kTag || !has_timestamp_ || timestamp_too_large_) {
+            return std::nullopt;
+        }
+        // the concatenated occurrences decode to their merge
+        return tracefile::DecodeTimestampNanoseconds(timestamp_);
+    }
+
+   private:
+    enum class State { kTag, kVarint, kLength, kPayload };
+
+    // An osi3::Timestamp holds two varints; more occurrences than fit are not buffered to keep the peek bounded
+    static constexpr uint64_t kMaxTimestampSize = 64;
+
+    void FinishVarint() {
+        const uint64_t value = varint_;
+        varint_ = 0;
+        shift_ = 0;
+        switch (state_) {
+            case State::kTag:
+                field_number_ = static_cast<uint32_t>(value >> 3);
+                switch (static_cast<tracefile::WireType>(value & 0x7U)) {
+                    case tracefile::WireType::kVarint:
+                        state_ = State::kVarint;
+                        break;
+                    case tracefile::WireType::kFixed64:
+                        StartPayload(8, false);
+                        break;
+                    case tracefile::WireType::kLengthDelimited:
+                        state_ = State::kLength;
+                        break;
+                    case tracefile::WireType::kFixed32:
+                        StartPayload(4, false);
+                        break;
+                    default:
+                        failed_ = true;
+                        break;
+                }
+                failed_ = failed_ || field_number_ == 0;
+                break;
+            case State::kVarint:
+                state_ = State::kTag;
+                break;
+            case State::kLength:
+                if (field_number_ != timestamp_field_number_) {
+                    StartPayload(value, false);
+                } else if (value > kMaxTimestampSize - timestamp_.size()) {
+                    timestamp_too_large_ = true;
+                    StartPayload(value, false);
+                } else {
+                    has_timestamp_ = true;
+                    StartPayload(value, true);
+                }
+                break;
+            case State::kPayload:
+                break;
+        }
+    }
+
+    void StartPayload(const uint64_t size, const bool capture) {
+        state_ = State::kPayload;
+        remaining_ = size;
+        capturing_ = capture;
+        FinishPayloadIfComplete();
+    }
+
+    void FinishPayloadIfComplete() {
+        if (remaining_ != 0) {
+            return;
+        }
+        capturing_ = false;
+        state_ = State::kTag;
+    }
+
+    uint32_t timestamp_field_number_;
+    State state_ = State::kTag;
+    uint64_t varint_ = 0;
+    uint32_t shift_ = 0;
+    uint32_t field_number_ = 0;
+    uint64_t remaining_ = 0;
+    bool capturing_ = false;
+    std::string timestamp_;  // concatenated payloads of the 'timestamp' occurrences
+    bool has_timestamp_ = false;
+    bool timestamp_too_large_ = false;
+    bool failed_ = false;
+};
+
+// Presents the next 'size' bytes of the file as a stream, read in chunks into a caller-owned buffer.
+// Every chunk is also fed to the peeker, so the log time is known without a second pass over the file.
+class BoundedFileInputStream final : public google::protobuf::io::ZeroCopyInputStream {
+   public:
+    BoundedFileInputStream(tracefile::BlockFileReader& file, const uint64_t size, std::vector<char>& buffer, TimestampPeeker& peeker)
+        : file_(file), remaining_(size), buffer_(buffer), peeker_(peeker) {}
+
+    bool Next(const void** data, int* size) override {
+        if (backed_up_ == 0) {
+            if (remaining_ == 0) {
+                return false;
+            }
+            const auto requested = static_cast<size_t>(std::min<uint64_t>(buffer_.size(), remaining_));
+            chunk_size_ = file_.Read(buffer_.data(), requested);
+            if (chunk_size_ != requested) {
+                truncated_ = true;
+            }
+            if (chunk_size_ == 0) {
+                remaining_ = 0;
+                return false;
+            }
+            remaining_ -= chunk_size_;
+            backed_up_ = chunk_size_;
+            peeker_.Feed(buffer_.data(), chunk_size_);
+        }
+        *data = buffer_.data() + (chunk_size_ - backed_up_);
+        *size = static_cast<int>(backed_up_);
+        position_ += backed_up_;
+        backed_up_ = 0;
+        return true;
+    }
+
+    void BackUp(const int count) override {
+        backed_up_ = static_cast<size_t>(count);
+        position_ -= static_cast<size_t>(count);
+    }
+
+    bool Skip(int count) override {
+        const void* data = nullptr;
+        int size = 0;
+        while (count > 0 && Next(&data, &size)) {
+            if (size > count) {
+                BackUp(size - count);
+                return true;
+            }
+            count -= size;
+        }
+        return count == 0;
+    }
+
+    int64_t ByteCount() const override { return static_cast<int64_t>(position_); }
+
+    // Whether the file ended before the message
+    bool IsTruncated() const { return truncated_; }
+
+    // Moves the file to the end of the message, e.g. after a parse error
+    void SkipToEnd() {
+        file_.Seek(file_.Tell() + remaining_);
+        remaining_ = 0;
+    }
+
+   private:
+    tracefile::BlockFileReader& file_;
+    uint64_t remaining_;
+    std::vector<char>& buffer_;
+    TimestampPeeker& peeker_;
+    size_t chunk_size_ = 0;
+    size_t backed_up_ = 0;
+    uint64_t position_ = 0;
+    bool truncated_ = false;
+};
+
+}  // namespace
+
 SingleChannelBinaryTraceFileReader::~SingleChannelBinaryTraceFileReader() {
-    if (trace_file_.is_open()) {
+    if (trace_file_.IsOpen()) {
         Close();
     }
 }
@@ -24,7 +228,7 @@ auto SingleChannelBinaryTraceFileReader::Open(const std::filesystem::path& file_
 
 auto SingleChannelBinaryTraceFileReader::Open(const std::filesystem::path& file_path) -> bool {
     // prevent opening again if already opened
-    if (trace_file_.is_open()) {
+    if (trace_file_.IsOpen()) {
         std::cerr << "ERROR: Opening file " << file_path << ", reader has already a file opened" << std::endl;
         return false;
     }
@@ -36,7 +240,7 @@ auto SingleChannelBinaryTraceFileReader::Open(const std::filesystem::path& file_
     }
 
     // check if file exists
-    if (!exists(file_path)) {
+    if (!file_source_ && !exists(file_path)) {
         std::cerr << "ERROR: The trace file '" << file_path << "' does not exist." << std::endl;
         return false;
     }
@@ -69,9 +273,10 @@ auto SingleChannelBinaryTraceFileReader::Open(const std::filesystem::path& file_
     }
 
     parser_ = kParserMap_.at(message_type_);
+    const auto* timestamp_field = tracefile::GetMessageDescriptor(message_type_)->FindFieldByName("timestamp");
+    timestamp_field_number_ = timestamp_field != nullptr ? static_cast<uint32_t>(timestamp_field->number()) : 0;
 
-    trace_file_ = std::ifstream(file_path, std::ios::binary);
-    if (!trace_file_) {
+    if (!(file_source_ ? trace_file_.Open(std::move(file_source_)) : trace_file_.Open(file_path, io_options_))) {
         std::cerr << "ERROR: Failed to open trace file: " << file_path << std::endl;
         return false;
     }
@@ -79,20 +284,33 @@ auto SingleChannelBinaryTraceFileReader::Open(const std::filesystem::path& file_
 }
 
 void SingleChannelBinaryTraceFileReader::Close() {
-    trace_file_.close();
+    trace_file_.Close();
     read_buffer_.clear();
     read_buffer_.shrink_to_fit();
+    stream_buffer_.clear();
+    stream_buffer_.shrink_to_fit();
 }
 
-auto SingleChannelBinaryTraceFileReader::HasNext() -> bool { return (trace_file_ && trace_file_.is_open() && trace_file_.peek() != EOF); }
+auto SingleChannelBinaryTraceFileReader::HasNext() -> bool { return trace_file_.IsOpen() && !trace_file_.HasError() && !trace_file_.AtEnd(); }
+
+void SingleChannelBinaryTraceFileReader::SetIoOptions(const tracefile::IoOptions& options) { io_options_ = options; }
 
 auto SingleChannelBinaryTraceFileReader::ReadMessage() -> std::optional<ReadResult> {
+    if (lazy_decoding_) {
+        const auto raw_result = ReadRawMessage();
+        return raw_result ? std::optional<ReadResult>(MakeLazyResult(*raw_result)) : std::nullopt;
+    }
+
     // check if ready and if there are messages left
     if (!this->HasNext()) {
         std::cerr << "Unable to read message: No more messages available in trace file or file not opened." << std::endl;
         return std::nullopt;
     }
 
+    if (streaming_parse_) {
+        return StreamNextMessageFromFile();
+    }
+
     const auto& serialized_msg = ReadNextMessageFromFile();
 
     if (serialized_msg.empty()) {
@@ -102,6 +320,26 @@ auto SingleChannelBinaryTraceFileReader::ReadMessage() -> std::optional<ReadResu
     ReadResult result;
     result.message = parser_(serialized_msg);
     result.message_type = message_type_;
+    result.log_time = tracefile::PeekTimestampNanoseconds({serialized_msg.data(), serialized_msg.size()}, timestamp_field_number_).value_or(0);
+    result.status = ReadStatus::kOk;
+
+    return result;
+}
+
+auto SingleChannelBinaryTraceFileReader::ReadRawMessage() -> std::optional<RawReadResult> {
+    // check if ready and if there are messages left
+    if (!this->HasNext()) {
+        std::cerr << "Unable to read message: No more messages available in trace file or file not opened." << std::endl;
+        return std::nullopt;
+    }
+
+    const auto& serialized_msg = ReadNextMessageFromFile();
+
+    RawReadResult result;
+    result.data = serialized_msg.data();
+    result.size = serialized_msg.size();
+    result.message_type = message_type_;
+    result.log_time = tracefile::PeekTimestampNanoseconds({serialized_msg.data(), serialized_msg.size()}, timestamp_field_number_).value_or(0);
     result.status = ReadStatus::kOk;
 
     return result;
@@ -110,17 +348,46 @@ auto SingleChannelBinaryTraceFileReader::ReadMessage() -> std::optional<ReadResu
 auto SingleChannelBinaryTraceFileReader::ReadNextMessageFromFile() -> const std::vector<char>& {
     uint32_t message_size = 0;
 
-    if (!trace_file_.read(reinterpret_cast<char*>(&message_size), sizeof(message_size))) {
+    if (trace_file_.Read(reinterpret_cast<char*>(&message_size), sizeof(message_size)) != sizeof(message_size)) {
         throw std::runtime_error("ERROR: Failed to read message size from file.");
     }
     if (message_size == 0 || message_size > tracefile::config::kMaxExpectedMessageSize) {
         throw std::runtime_error("ERROR: Invalid message size: " + std::to_string(message_size));
     }
     read_buffer_.resize(message_size);
-    if (!trace_file_.read(read_buffer_.data(), message_size)) {
+    if (trace_file_.Read(read_buffer_.data(), message_size) != message_size) {
         throw std::runtime_error("ERROR: Failed to read message from file");
     }
     return read_buffer_;
 }
 
+auto SingleChannelBinaryTraceFileReader::StreamNextMessageFromFile() -> ReadResult {
+    uint32_t message_size = 0;
+
+    if (trace_file_.Read(reinterpret_cast<char*>(&message_size), sizeof(message_size)) != sizeof(message_size)) {
+        throw std::runtime_error("ERROR: Failed to read message size from file.");
+    }
+    if (message_size == 0 || message_size > tracefile::config::kMaxExpectedMessageSize) {
+        throw std::runtime_error("ERROR: Invalid message size: " + std::to_string(message_size));
+    }
+    stream_buffer_.resize(tracefile::config::kStreamingParseChunkSize);
+
+    ReadResult result;
+    result.message = tracefile::CreateMessage(message_type_);
+    TimestampPeeker peeker(timestamp_field_number_);
+    BoundedFileInputStream stream(trace_file_, message_size, stream_buffer_, peeker);
+    const bool parsed = result.message->ParseFromZeroCopyStream(&stream);
+    if (stream.IsTruncated()) {
+        throw std::runtime_error("ERROR: Failed to read message from file");
+    }
+    if (!parsed) {
+        stream.SkipToEnd();
+        throw std::runtime_error("Failed to parse message");
+    }
+    result.message_type = message_type_;
+    result.log_time = peeker.Result().value_or(0);
+    result.status = ReadStatus::kOk;
+    return result;
+}
+
 }  // namespace osi3
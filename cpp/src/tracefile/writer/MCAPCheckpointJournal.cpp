@@ -0,0 +1,500 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "MCAPCheckpointJournal.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <system_error>
+
+#include "osi-utilities/tracefile/TraceFileConfig.h"
+#include "osi-utilities/tracefile/writer/MCAPCheckpoint.h"
+
+namespace osi3::mcap_utils {
+
+namespace {
+
+constexpr std::array<char, 8> kMcapMagic = {'\x89', 'M', 'C', 'A', 'P', '0', '\r', '\n'};
+constexpr std::array<char, 8> kJournalMagic = {'\x89', 'O', 'S', 'I', 'J', '0', '\r', '\n'};
+
+// Opcode and length prefix of every MCAP record
+constexpr uint64_t kRecordPrefixSize = 9;
+
+// MCAP reserves the opcodes from 0x80 for private records
+constexpr auto kCheckpointOpCode = static_cast<mcap::OpCode>(0x80);
+
+// Body bytes kept per record: enough for the fixed fields and names of index entries
+auto CaptureSize(const mcap::OpCode opcode, const uint64_t length) -> size_t {
+    switch (opcode) {
+        case mcap::OpCode::Chunk:
+        case mcap::OpCode::MessageIndex:
+        case mcap::OpCode::Message:
+        case mcap::OpCode::DataEnd:
+            return static_cast<size_t>(std::min<uint64_t>(length, 256));
+        case mcap::OpCode::Metadata:
+        case mcap::OpCode::Attachment:
+            return static_cast<size_t>(std::min<uint64_t>(length, 4096));
+        default:
+            return 0;
+    }
+}
+
+/** @brief Reads little-endian MCAP fields from a record body */
+class FieldReader {
+   public:
+    FieldReader(const std::byte* data, const size_t size) : data_(data), size_(size) {}
+
+    template <typename T>
+    auto Read(T& value) -> bool {
+        if (size_ - position_ < sizeof(T)) {
+            return false;
+        }
+        value = 0;
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            value |= static_cast<T>(static_cast<uint64_t>(data_[position_ + i]) << (8 * i));
+        }
+        position_ += sizeof(T);
+        return true;
+    }
+
+    auto ReadString(std::string& value) -> bool {
+        uint32_t length = 0;
+        if (!Read(length) || size_ - position_ < length) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char*>(data_ + position_), length);
+        position_ += length;
+        return true;
+    }
+
+   private:
+    const std::byte* data_;
+    size_t size_;
+    size_t position_ = 0;
+};
+
+/** @brief Builds MCAP records with little-endian fields */
+class RecordBuilder {
+   public:
+    template <typename T>
+    void Write(const T value) {
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            body_.push_back(static_cast<char>((static_cast<uint64_t>(value) >> (8 * i)) & 0xFFU));
+        }
+    }
+
+    void WriteString(const std::string& value) {
+        Write(static_cast<uint32_t>(value.size()));
+        body_ += value;
+    }
+
+    void WriteBytes(const mcap::ByteArray& value) {
+        Write(static_cast<uint32_t>(value.size()));
+        body_.append(reinterpret_cast<const char*>(value.data()), value.size());
+    }
+
+    template <typename Map, typename WriteEntry>
+    void WriteMap(const Map& map, WriteEntry write_entry) {
+        RecordBuilder entries;
+        for (const auto& [key, value] : map) {
+            write_entry(entries, key, value);
+        }
+        WriteString(entries.body_);
+    }
+
+    auto Finish(const mcap::OpCode opcode) const -> std::string {
+        RecordBuilder record;
+        record.Write(static_cast<uint8_t>(opcode));
+        record.Write(static_cast<uint64_t>(body_.size()));
+        return record.body_ + body_;
+    }
+
+   private:
+    std::string body_;
+};
+
+auto SchemaRecord(const mcap::Schema& schema) -> std::string {
+    RecordBuilder record;
+    record.Write(schema.id);
+    record.WriteString(schema.name);
+    record.WriteString(schema.encoding);
+    record.WriteBytes(schema.data);
+    return record.Finish(mcap::OpCode::Schema);
+}
+
+auto ChannelRecord(const mcap::Channel& channel) -> std::string {
+    RecordBuilder record;
+    record.Write(channel.id);
+    record.Write(channel.schemaId);
+    record.WriteString(channel.topic);
+    record.WriteString(channel.messageEncoding);
+    // sorted keys make the record reproducible
+    const std::map<std::string, std::string> metadata(channel.metadata.begin(), channel.metadata.end());
+    record.WriteMap(metadata, [](RecordBuilder& entries, const std::string& key, const std::string& value) {
+        entries.WriteString(key);
+        entries.WriteString(value);
+    });
+    return record.Finish(mcap::OpCode::Channel);
+}
+
+auto ChunkIndexRecord(const mcap::ChunkIndex& index) -> std::string {
+    RecordBuilder record;
+    record.Write(index.messageStartTime);
+    record.Write(index.messageEndTime);
+    record.Write(index.chunkStartOffset);
+    record.Write(index.chunkLength);
+    const std::map<mcap::ChannelId, mcap::ByteOffset> offsets(index.messageIndexOffsets.begin(), index.messageIndexOffsets.end());
+    record.WriteMap(offsets, [](RecordBuilder& entries, const mcap::ChannelId channel, const mcap::ByteOffset offset) {
+        entries.Write(channel);
+        entries.Write(offset);
+    });
+    record.Write(index.messageIndexLength);
+    record.WriteString(index.compression);
+    record.Write(index.compressedSize);
+    record.Write(index.uncompressedSize);
+    return record.Finish(mcap::OpCode::ChunkIndex);
+}
+
+auto MetadataIndexRecord(const mcap::MetadataIndex& index) -> std::string {
+    RecordBuilder record;
+    record.Write(index.offset);
+    record.Write(index.length);
+    record.WriteString(index.name);
+    return record.Finish(mcap::OpCode::MetadataIndex);
+}
+
+auto AttachmentIndexRecord(const mcap::AttachmentIndex& index) -> std::string {
+    RecordBuilder record;
+    record.Write(index.offset);
+    record.Write(index.length);
+    record.Write(index.logTime);
+    record.Write(index.createTime);
+    record.Write(index.dataSize);
+    record.WriteString(index.name);
+    record.WriteString(index.mediaType);
+    return record.Finish(mcap::OpCode::AttachmentIndex);
+}
+
+auto StatisticsRecord(const mcap::Statistics& statistics) -> std::string {
+    RecordBuilder record;
+    record.Write(statistics.messageCount);
+    record.Write(statistics.schemaCount);
+    record.Write(statistics.channelCount);
+    record.Write(statistics.attachmentCount);
+    record.Write(statistics.metadataCount);
+    record.Write(statistics.chunkCount);
+    record.Write(statistics.messageCount > 0 ? statistics.messageStartTime : mcap::Timestamp{0});
+    record.Write(statistics.messageEndTime);
+    const std::map<mcap::ChannelId, uint64_t> counts(statistics.channelMessageCounts.begin(), statistics.channelMessageCounts.end());
+    record.WriteMap(counts, [](RecordBuilder& entries, const mcap::ChannelId channel, const uint64_t count) {
+        entries.Write(channel);
+        entries.Write(count);
+    });
+    return record.Finish(mcap::OpCode::Statistics);
+}
+
+void UpdateMessageTimes(mcap::Statistics& statistics, const mcap::Timestamp start, const mcap::Timestamp end) {
+    statistics.messageStartTime = std::min(statistics.messageStartTime, start);
+    statistics.messageEndTime = std::max(statistics.messageEndTime, end);
+}
+
+}  // namespace
+
+auto CheckpointJournal::Open(const std::filesystem::path& journal_path) -> bool {
+    journal_.open(journal_path, std::ios::binary | std::ios::trunc);
+    if (!journal_) {
+        std::cerr << "ERROR: Opening checkpoint journal " << journal_path << std::endl;
+        return false;
+    }
+    journal_.write(kJournalMagic.data(), kJournalMagic.size());
+    statistics_ = {};
+    statistics_.messageStartTime = mcap::MaxTime;
+    return journal_.good();
+}
+
+void CheckpointJournal::Close() { journal_.close(); }
+
+void CheckpointJournal::Observe(const std::byte* data, uint64_t size) {
+    while (size > 0 && !finished_) {
+        uint64_t consumed = 0;
+        if (offset_ < kMcapMagic.size()) {
+            consumed = std::min<uint64_t>(kMcapMagic.size() - offset_, size);
+        } else if (header_.size() < kRecordPrefixSize) {
+            if (header_.empty()) {
+                record_offset_ = offset_;
+            }
+            consumed = std::min<uint64_t>(kRecordPrefixSize - header_.size(), size);
+            header_.insert(header_.end(), data, data + consumed);
+            if (header_.size() == kRecordPrefixSize) {
+                FieldReader prefix(header_.data() + 1, sizeof(uint64_t));
+                prefix.Read(record_length_);
+                record_remaining_ = record_length_;
+                capture_size_ = kRecordPrefixSize + CaptureSize(static_cast<mcap::OpCode>(header_[0]), record_length_);
+            }
+        } else {
+            consumed = std::min(record_remaining_, size);
+            if (header_.size() < capture_size_) {
+                const auto captured = std::min<uint64_t>(capture_size_ - header_.size(), consumed);
+                header_.insert(header_.end(), data, data + captured);
+            }
+            record_remaining_ -= consumed;
+        }
+        data += consumed;
+        size -= consumed;
+        offset_ += consumed;
+        if (header_.size() >= kRecordPrefixSize && record_remaining_ == 0) {
+            HandleRecord();
+            header_.clear();
+        }
+    }
+    offset_ += size;
+}
+
+void CheckpointJournal::HandleRecord() {
+    const auto opcode = static_cast<mcap::OpCode>(header_[0]);
+    const auto record_size = kRecordPrefixSize + record_length_;
+    FieldReader body(header_.data() + kRecordPrefixSize, header_.size() - kRecordPrefixSize);
+
+    if (opcode == mcap::OpCode::MessageIndex) {
+        mcap::ChannelId channel = 0;
+        uint32_t entries_size = 0;
+        if (chunk_ && body.Read(channel) && body.Read(entries_size)) {
+            // one entry of log time and offset per message
+            const uint64_t count = entries_size / (2 * sizeof(uint64_t));
+            chunk_->messageIndexOffsets[channel] = record_offset_;
+            chunk_->messageIndexLength += record_size;
+            statistics_.messageCount += count;
+            statistics_.channelMessageCounts[channel] += count;
+        }
+        return;
+    }
+    FinishChunk();
+
+    switch (opcode) {
+        case mcap::OpCode::Chunk: {
+            mcap::ChunkIndex index;
+            uint32_t crc = 0;
+            if (body.Read(index.messageStartTime) && body.Read(index.messageEndTime) && body.Read(index.uncompressedSize) && body.Read(crc) &&
+                body.ReadString(index.compression) && body.Read(index.compressedSize)) {
+                index.chunkStartOffset = record_offset_;
+                index.chunkLength = record_size;
+                chunk_ = index;
+                ++statistics_.chunkCount;
+                UpdateMessageTimes(statistics_, index.messageStartTime, index.messageEndTime);
+            }
+            break;
+        }
+        case mcap::OpCode::Message: {
+            mcap::ChannelId channel = 0;
+            uint32_t sequence = 0;
+            mcap::Timestamp log_time = 0;
+            if (body.Read(channel) && body.Read(sequence) && body.Read(log_time)) {
+                ++statistics_.messageCount;
+                ++statistics_.channelMessageCounts[channel];
+                UpdateMessageTimes(statistics_, log_time, log_time);
+            }
+            break;
+        }
+        case mcap::OpCode::Metadata: {
+            mcap::MetadataIndex index;
+            if (body.ReadString(index.name)) {
+                index.offset = record_offset_;
+                index.length = record_size;
+                metadata_indexes_.push_back(index);
+                ++statistics_.metadataCount;
+            }
+            break;
+        }
+        case mcap::OpCode::Attachment: {
+            mcap::AttachmentIndex index;
+            if (body.Read(index.logTime) && body.Read(index.createTime) && body.ReadString(index.name) && body.ReadString(index.mediaType) && body.Read(index.dataSize)) {
+                index.offset = record_offset_;
+                index.length = record_size;
+                attachment_indexes_.push_back(index);
+                ++statistics_.attachmentCount;
+            }
+            break;
+        }
+        case mcap::OpCode::DataEnd:
+            // the summary section follows, nothing left to index
+            finished_ = true;
+            break;
+        default:
+            break;
+    }
+}
+
+void CheckpointJournal::FinishChunk() {
+    if (chunk_) {
+        chunk_indexes_.push_back(*chunk_);
+        chunk_.reset();
+    }
+}
+
+auto CheckpointJournal::Checkpoint(const std::vector<mcap::Schema>& schemas, const std::vector<mcap::Channel>& channels) -> bool {
+    FinishChunk();
+    std::string records;
+    for (const auto& schema : schemas) {
+        if (journaled_schemas_.insert(schema.id).second) {
+            records += SchemaRecord(schema);
+        }
+    }
+    for (const auto& channel : channels) {
+        if (journaled_channels_.insert(channel.id).second) {
+            records += ChannelRecord(channel);
+        }
+    }
+    for (const auto& index : metadata_indexes_) {
+        records += MetadataIndexRecord(index);
+    }
+    for (const auto& index : attachment_indexes_) {
+        records += AttachmentIndexRecord(index);
+    }
+    for (const auto& index : chunk_indexes_) {
+        records += ChunkIndexRecord(index);
+    }
+    metadata_indexes_.clear();
+    attachment_indexes_.clear();
+    chunk_indexes_.clear();
+
+    statistics_.schemaCount = static_cast<uint16_t>(journaled_schemas_.size());
+    statistics_.channelCount = static_cast<uint32_t>(journaled_channels_.size());
+    records += StatisticsRecord(statistics_);
+    RecordBuilder checkpoint;
+    checkpoint.Write(offset_);
+    records += checkpoint.Finish(kCheckpointOpCode);
+
+    journal_.write(records.data(), static_cast<std::streamsize>(records.size()));
+    journal_.flush();
+    return journal_.good();
+}
+
+}  // namespace osi3::mcap_utils
+
+namespace osi3::tracefile {
+
+auto GetCheckpointJournalPath(const std::filesystem::path& trace_file_path) -> std::filesystem::path {
+    auto journal_path = trace_file_path;
+    journal_path += config::kCheckpointJournalSuffix;
+    return journal_path;
+}
+
+auto RecoverMcapTraceFile(const std::filesystem::path& trace_file_path) -> bool {
+    using mcap_utils::kCheckpointOpCode;
+    using mcap_utils::kJournalMagic;
+    using mcap_utils::kMcapMagic;
+    using mcap_utils::kRecordPrefixSize;
+
+    const auto journal_path = GetCheckpointJournalPath(trace_file_path);
+    std::ifstream journal_file(journal_path, std::ios::binary);
+    if (!journal_file) {
+        std::cerr << "ERROR: Opening checkpoint journal " << journal_path << std::endl;
+        return false;
+    }
+    const std::string journal{std::istreambuf_iterator<char>(journal_file), std::istreambuf_iterator<char>()};
+    journal_file.close();
+    if (journal.size() < kJournalMagic.size() || !std::equal(kJournalMagic.begin(), kJournalMagic.end(), journal.begin())) {
+        std::cerr << "ERROR: " << journal_path << " is not a checkpoint journal" << std::endl;
+        return false;
+    }
+
+    std::error_code error;
+    const auto file_size = std::filesystem::file_size(trace_file_path, error);
+    if (error) {
+        std::cerr << "ERROR: Opening file " << trace_file_path << ": " << error.message() << std::endl;
+        return false;
+    }
+
+    // Summary records up to the last checkpoint that lies within the file; an incomplete journal tail is ignored
+    std::vector<std::string> records;
+    std::string statistics;
+    size_t committed_records = 0;
+    std::string committed_statistics;
+    std::optional<uint64_t> committed_offset;
+    size_t position = kJournalMagic.size();
+    while (journal.size() - position >= kRecordPrefixSize) {
+        const auto opcode = static_cast<mcap::OpCode>(journal[position]);
+        uint64_t length = 0;
+        mcap_utils::FieldReader(reinterpret_cast<const std::byte*>(journal.data() + position + 1), sizeof(uint64_t)).Read(length);
+        if (journal.size() - position - kRecordPrefixSize < length) {
+            break;
+        }
+        auto record = journal.substr(position, kRecordPrefixSize + length);
+        position += record.size();
+        if (opcode == kCheckpointOpCode) {
+            uint64_t offset = 0;
+            mcap_utils::FieldReader(reinterpret_cast<const std::byte*>(record.data() + kRecordPrefixSize), length).Read(offset);
+            if (offset > file_size) {
+                break;
+            }
+            committed_records = records.size();
+            committed_statistics = statistics;
+            committed_offset = offset;
+        } else if (opcode == mcap::OpCode::Statistics) {
+            statistics = std::move(record);
+        } else {
+            records.push_back(std::move(record));
+        }
+    }
+    if (!committed_offset) {
+        std::cerr << "ERROR: The checkpoint journal " << journal_path << " has no checkpoint within " << trace_file_path << std::endl;
+        return false;
+    }
+
+    // A file that was closed properly ends with the magic after its footer
+    if (file_size > *committed_offset + kMcapMagic.size()) {
+        std::ifstream trace_file(trace_file_path, std::ios::binary);
+        std::array<char, kMcapMagic.size()> tail{};
+        trace_file.seekg(static_cast<std::streamoff>(file_size - tail.size()));
+        if (trace_file.read(tail.data(), tail.size()) && tail == kMcapMagic) {
+            std::filesystem::remove(journal_path, error);
+            return true;
+        }
+    }
+
+    records.resize(committed_records);
+    // group the summary records by type, as the MCAP writer does
+    std::stable_sort(records.begin(), records.end(), [](const std::string& lhs, const std::string& rhs) { return lhs[0] < rhs[0]; });
+
+    std::filesystem::resize_file(trace_file_path, *committed_offset, error);
+    if (error) {
+        std::cerr << "ERROR: Truncating " << trace_file_path << ": " << error.message() << std::endl;
+        return false;
+    }
+    std::ofstream trace_file(trace_file_path, std::ios::binary | std::ios::app);
+    mcap_utils::RecordBuilder data_end;
+    data_end.Write(uint32_t{0});
+    const auto data_end_record = data_end.Finish(mcap::OpCode::DataEnd);
+    trace_file.write(data_end_record.data(), static_cast<std::streamsize>(data_end_record.size()));
+
+    const uint64_t summary_start = *committed_offset + data_end_record.size();
+    for (const auto& record : records) {
+        trace_file.write(record.data(), static_cast<std::streamsize>(record.size()));
+    }
+    trace_file.write(committed_statistics.data(), static_cast<std::streamsize>(committed_statistics.size()));
+
+    // no summary offsets and no summary CRC (0: not computed)
+    mcap_utils::RecordBuilder footer;
+    footer.Write(summary_start);
+    footer.Write(uint64_t{0});
+    footer.Write(uint32_t{0});
+    const auto footer_record = footer.Finish(mcap::OpCode::Footer);
+    trace_file.write(footer_record.data(), static_cast<std::streamsize>(footer_record.size()));
+    trace_file.write(kMcapMagic.data(), kMcapMagic.size());
+    trace_file.close();
+    if (!trace_file) {
+        std::cerr << "ERROR: Writing the summary of " << trace_file_path << std::endl;
+        return false;
+    }
+    std::filesystem::remove(journal_path, error);
+    return true;
+}
+
+}  // namespace osi3::tracefile
@@ -0,0 +1,88 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#ifndef OSIUTILITIES_TRACEFILE_WRITER_MCAPCHECKPOINTJOURNAL_H_
+#define OSIUTILITIES_TRACEFILE_WRITER_MCAPCHECKPOINTJOURNAL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mcap/mcap.hpp>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace osi3::mcap_utils {
+
+/**
+ * @brief Index journal of an MCAP file that is being written
+ *
+ * Observe() follows the records the MCAP writer emits at the top level of the file
+ * and builds the chunk, metadata and attachment indexes and the statistics from their
+ * headers. Checkpoint() appends the index entries since the previous checkpoint to the
+ * journal as MCAP summary records, followed by the statistics and a checkpoint record
+ * holding the file size. RecoverMcapTraceFile() turns them into the summary section.
+ *
+ * Schemas and channels are written inside chunks, so they are passed to Checkpoint().
+ */
+class CheckpointJournal {
+   public:
+    /**
+     * @brief Creates (or truncates) the journal file
+     * @param journal_path Path to the journal
+     * @return true if successful, false otherwise
+     */
+    bool Open(const std::filesystem::path& journal_path);
+
+    /** @brief Closes the journal file */
+    void Close();
+
+    /**
+     * @brief Follows bytes written to the MCAP file
+     * @param data Written bytes
+     * @param size Number of written bytes
+     */
+    void Observe(const std::byte* data, uint64_t size);
+
+    /**
+     * @brief Appends the index since the previous checkpoint to the journal
+     *
+     * All observed bytes must be flushed to the MCAP file before.
+     *
+     * @param schemas Schemas registered so far
+     * @param channels Channels registered so far
+     * @return true if the journal was written, false otherwise
+     */
+    bool Checkpoint(const std::vector<mcap::Schema>& schemas, const std::vector<mcap::Channel>& channels);
+
+    /** @brief Number of bytes observed, i.e. the size of the MCAP file */
+    uint64_t Offset() const { return offset_; }
+
+   private:
+    void HandleRecord();
+    void FinishChunk();
+
+    std::ofstream journal_;                                 /**< Journal file */
+    uint64_t offset_ = 0;                                   /**< File offset of the next observed byte */
+    bool finished_ = false;                                 /**< The data end record was observed */
+    std::vector<std::byte> header_;                         /**< Opcode, length and body prefix of the current record */
+    size_t capture_size_ = 0;                               /**< Number of bytes of the current record to keep in header_ */
+    uint64_t record_offset_ = 0;                            /**< File offset of the current record */
+    uint64_t record_length_ = 0;                            /**< Body length of the current record */
+    uint64_t record_remaining_ = 0;                         /**< Body bytes of the current record not yet observed */
+    std::optional<mcap::ChunkIndex> chunk_;                 /**< Index of the last chunk, completed by its message indexes */
+    std::vector<mcap::ChunkIndex> chunk_indexes_;           /**< Chunk indexes since the last checkpoint */
+    std::vector<mcap::MetadataIndex> metadata_indexes_;     /**< Metadata indexes since the last checkpoint */
+    std::vector<mcap::AttachmentIndex> attachment_indexes_; /**< Attachment indexes since the last checkpoint */
+    mcap::Statistics statistics_;                           /**< Statistics of the observed records */
+    std::set<mcap::SchemaId> journaled_schemas_;            /**< Schemas already in the journal */
+    std::set<mcap::ChannelId> journaled_channels_;          /**< Channels already in the journal */
+};
+
+}  // namespace osi3::mcap_utils
+
+#endif  // OSIUTILITIES_TRACEFILE_WRITER_MCAPCHECKPOINTJOURNAL_H_
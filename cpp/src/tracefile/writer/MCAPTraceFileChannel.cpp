@@ -5,10 +5,12 @@
 
 #include "osi-utilities/tracefile/writer/MCAPTraceFileChannel.h"
 
+#include <algorithm>
 #include <stdexcept>
 
 #include "MCAPWriterUtils.h"
 #include "osi-utilities/tracefile/TimestampUtils.h"
+#include "osi-utilities/tracefile/WireFormatUtils.h"
 #include "osi_groundtruth.pb.h"
 #include "osi_hostvehicledata.pb.h"
 #include "osi_motionrequest.pb.h"
@@ -36,7 +38,7 @@ auto MCAPTraceFileChannel::WriteMessage(const google::protobuf::Message& message
 
     const auto topic_channel_id = topic_to_channel_id_.find(topic);
 
-    if (!message.SerializeToString(&serialize_buffer_)) {
+    if (!SerializeMessage(message, topic_channel_id->second)) {
         std::cerr << "ERROR: Failed to serialize protobuf message\n";
         return false;
     }
@@ -52,11 +54,58 @@ auto MCAPTraceFileChannel::WriteMessage(const google::protobuf::Message& message
     msg.publishTime = msg.logTime;
     msg.data = reinterpret_cast<const std::byte*>(serialize_buffer_.data());
     msg.dataSize = serialize_buffer_.size();
-    if (const auto status = mcap_writer_.write(msg); status.code != mcap::StatusCode::Success) {
-        std::cerr << "ERROR: Failed to write message " << status.message;
+    return WriteSerialized(msg, topic);
+}
+
+auto MCAPTraceFileChannel::WriteRawMessage(const char* data, const size_t size, const google::protobuf::Descriptor* descriptor, const std::string& topic) -> bool {
+    if (topic.empty()) {
+        std::cerr << "ERROR: cannot write message, topic is empty\n";
+        return false;
+    }
+    if (descriptor == nullptr) {
+        std::cerr << "ERROR: cannot write message, message type is unknown\n";
+        return false;
+    }
+
+    // Auto-register channel if topic is not yet known
+    if (topic_to_channel_id_.find(topic) == topic_to_channel_id_.end()) {
+        AddChannel(topic, descriptor);
+    }
+
+    const auto topic_channel_id = topic_to_channel_id_.find(topic);
+
+    const auto* timestamp_field = descriptor->FindFieldByName("timestamp");
+    if (timestamp_field == nullptr) {
+        std::cerr << "ERROR: invalid message timestamp: message type '" << descriptor->full_name() << "' does not have a 'timestamp' field\n";
+        return false;
+    }
+    const auto log_time = tracefile::PeekTimestampNanoseconds(std::string_view(data, size), static_cast<uint32_t>(timestamp_field->number()));
+    if (!log_time) {
+        std::cerr << "ERROR: invalid message timestamp: missing, negative or malformed\n";
         return false;
     }
-    return true;
+
+    mcap::Message msg;
+    msg.channelId = topic_channel_id->second;
+    msg.logTime = *log_time;
+    msg.publishTime = msg.logTime;
+    msg.data = reinterpret_cast<const std::byte*>(data);
+    msg.dataSize = size;
+    if (channel_transforms_.count(msg.channelId) > 0) {
+        // transformations need the field values, so this path parses the message after all
+        auto* parsed = GetTransformBuffer(descriptor);
+        if (parsed == nullptr || !parsed->ParseFromArray(data, static_cast<int>(size))) {
+            std::cerr << "ERROR: Failed to parse message of type " << descriptor->full_name() << " for transformation\n";
+            return false;
+        }
+        if (!SerializeMessage(*parsed, msg.channelId)) {
+            std::cerr << "ERROR: Failed to serialize protobuf message\n";
+            return false;
+        }
+        msg.data = reinterpret_cast<const std::byte*>(serialize_buffer_.data());
+        msg.dataSize = serialize_buffer_.size();
+    }
+    return WriteSerialized(msg, topic);
 }
 
 template <typename T>
@@ -73,7 +122,7 @@ auto MCAPTraceFileChannel::WriteMessage(const T& top_level_message, const std::s
         return false;
     }
 
-    if (!top_level_message.SerializeToString(&serialize_buffer_)) {
+    if (!SerializeMessage(top_level_message, topic_channel_id->second)) {
         std::cerr << "ERROR: Failed to serialize protobuf message\n";
         return false;
     }
@@ -89,11 +138,67 @@ auto MCAPTraceFileChannel::WriteMessage(const T& top_level_message, const std::s
     msg.publishTime = msg.logTime;
     msg.data = reinterpret_cast<const std::byte*>(serialize_buffer_.data());
     msg.dataSize = serialize_buffer_.size();
-    if (const auto status = mcap_writer_.write(msg); status.code != mcap::StatusCode::Success) {
+    return WriteSerialized(msg, topic);
+}
+
+auto MCAPTraceFileChannel::WriteSerialized(const mcap::Message& msg, const std::string& topic) -> bool {
+    const auto status = mcap_writer_.write(msg);
+    if (status.code == mcap::StatusCode::Success) {
+        last_message_size_ = msg.dataSize;
+        if (statistics_ != nullptr) {
+            statistics_->Observe(topic, msg.logTime, std::string_view(reinterpret_cast<const char*>(msg.data), msg.dataSize));
+        }
+    }
+    ReleaseOversizedBuffers();
+    if (status.code != mcap::StatusCode::Success) {
         std::cerr << "ERROR: Failed to write message " << status.message;
+        offloaded_payloads_.clear();
         return false;
     }
-    return true;
+    if (offloaded_payloads_.empty()) {
+        return true;
+    }
+    // payloads are written as attachments outside of the chunks, so readers of the messages skip them
+    auto& batch = payload_batches_[msg.channelId];
+    batch.topic = topic;
+    batch.first_log_time = std::min(batch.first_log_time, msg.logTime);
+    batch.last_log_time = std::max(batch.last_log_time, msg.logTime);
+    for (const auto& payload : offloaded_payloads_) {
+        tracefile::AppendPayloadRecord(batch.records, msg.logTime, payload);
+    }
+    offloaded_payloads_.clear();
+    // every attachment closes the current chunk, so payloads are only written in batches
+    const auto& offload = channel_transforms_.at(msg.channelId).offload;
+    return batch.records.size() < offload->batch_size || WritePayloadBatch(batch);
+}
+
+auto MCAPTraceFileChannel::FlushPayloads() -> bool {
+    bool success = true;
+    for (auto& [channel_id, batch] : payload_batches_) {
+        success = WritePayloadBatch(batch) && success;
+    }
+    return success;
+}
+
+auto MCAPTraceFileChannel::WritePayloadBatch(PayloadBatch& batch) -> bool {
+    if (batch.records.empty()) {
+        return true;
+    }
+    mcap::Attachment attachment;
+    attachment.name = tracefile::GetPayloadAttachmentName(batch.topic, batch.first_log_time, batch.last_log_time);
+    attachment.mediaType = tracefile::config::kPayloadAttachmentMediaType;
+    attachment.logTime = batch.first_log_time;
+    attachment.createTime = batch.first_log_time;
+    attachment.data = reinterpret_cast<const std::byte*>(batch.records.data());
+    attachment.dataSize = batch.records.size();
+    const auto status = mcap_writer_.write(attachment);
+    if (status.code != mcap::StatusCode::Success) {
+        std::cerr << "ERROR: Failed to write payloads " << attachment.name << "\n" << status.message;
+    }
+    batch.first_log_time = std::numeric_limits<uint64_t>::max();
+    batch.last_log_time = 0;
+    batch.records.clear();
+    return status.code == mcap::StatusCode::Success;
 }
 
 auto MCAPTraceFileChannel::AddChannel(const std::string& topic, const google::protobuf::Descriptor* descriptor,
@@ -126,6 +231,10 @@ auto MCAPTraceFileChannel::AddChannel(const std::string& topic, const google::pr
 
     // add OSI-required channel metadata
     mcap_utils::AddOsiChannelMetadata(channel_metadata);
+    tracefile::AddQuantizationMetadata(transform_.quantization, channel_metadata);
+    if (transform_.offload) {
+        tracefile::AddPayloadOffloadMetadata(*transform_.offload, channel_metadata);
+    }
 
     // add the channel to the writer/mcap file
     mcap::Channel channel(topic, "protobuf", path_schema.id, channel_metadata);
@@ -134,10 +243,71 @@ auto MCAPTraceFileChannel::AddChannel(const std::string& topic, const google::pr
     // store channel id and schema name for writing use and duplicate detection
     topic_to_channel_id_[topic] = channel.id;
     topic_to_schema_name_[topic] = schema_name;
+    channels_.push_back(channel);
+    if (transform_.Enabled()) {
+        channel_transforms_[channel.id] = transform_;
+    }
+    if (statistics_ != nullptr) {
+        statistics_->AddChannel(topic, descriptor);
+    }
 
     return channel.id;
 }
 
+auto MCAPTraceFileChannel::SerializeMessage(const google::protobuf::Message& message, const uint16_t channel_id) -> bool {
+    const auto transform = channel_transforms_.find(channel_id);
+    if (transform == channel_transforms_.end()) {
+        return message.SerializeToString(&serialize_buffer_);
+    }
+    // transform a copy, the caller's message stays unchanged
+    auto* transformed = GetTransformBuffer(message.GetDescriptor());
+    if (transformed == nullptr) {
+        return false;
+    }
+    if (transformed != &message) {
+        transformed->CopyFrom(message);
+    }
+    if (transform->second.offload) {
+        offloaded_payloads_ = tracefile::OffloadPayloads(*transformed, *transform->second.offload);
+    }
+    tracefile::QuantizeMessage(*transformed, transform->second.quantization);
+    if (transform->second.compaction) {
+        transform->second.compaction->Compact(*transformed);
+        return tracefile::SerializeCanonical(*transformed, serialize_buffer_);
+    }
+    return transformed->SerializeToString(&serialize_buffer_);
+}
+
+void MCAPTraceFileChannel::ReleaseOversizedBuffers() {
+    if (serialize_buffer_.capacity() <= retained_buffer_limit_) {
+        return;
+    }
+    std::string().swap(serialize_buffer_);
+    // the transform buffers hold the parsed copy of the large message
+    transform_buffers_.clear();
+}
+
+auto MCAPTraceFileChannel::GetTransformBuffer(const google::protobuf::Descriptor* descriptor) -> google::protobuf::Message* {
+    auto& buffer = transform_buffers_[descriptor];
+    if (!buffer) {
+        const auto* prototype = google::protobuf::MessageFactory::generated_factory()->GetPrototype(descriptor);
+        if (prototype == nullptr) {
+            return nullptr;
+        }
+        buffer.reset(prototype->New());
+    }
+    return buffer.get();
+}
+
+auto MCAPTraceFileChannel::GetSchemas() const -> std::vector<mcap::Schema> {
+    std::vector<mcap::Schema> schemas;
+    schemas.reserve(schemas_.size());
+    for (const auto& [name, schema] : schemas_) {
+        schemas.push_back(schema);
+    }
+    return schemas;
+}
+
 auto MCAPTraceFileChannel::PrepareRequiredFileMetadata() -> mcap::Metadata { return mcap_utils::PrepareRequiredFileMetadata(OSI_TRACE_FILE_SPEC_VERSION); }
 
 auto MCAPTraceFileChannel::GetCurrentTimeAsString() -> std::string { return mcap_utils::GetCurrentTimeAsString(); }
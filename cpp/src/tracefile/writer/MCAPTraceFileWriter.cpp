@@ -5,6 +5,13 @@
 
 #include "osi-utilities/tracefile/writer/MCAPTraceFileWriter.h"
 
+#include <fstream>
+#include <system_error>
+
+#include "MCAPCheckpointJournal.h"
+#include "osi-utilities/tracefile/TimestampUtils.h"
+#include "osi-utilities/tracefile/TraceFileConfig.h"
+#include "osi-utilities/tracefile/WireFormatUtils.h"
 #include "osi_groundtruth.pb.h"
 #include "osi_hostvehicledata.pb.h"
 #include "osi_motionrequest.pb.h"
@@ -17,25 +24,58 @@
 
 namespace osi3 {
 
+MCAPTraceFileWriter::MCAPTraceFileWriter() = default;
+
 MCAPTraceFileWriter::~MCAPTraceFileWriter() {
-    if (trace_file_.is_open()) {
+    if (trace_file_.IsOpen()) {
         Close();
     }
 }
 
 auto MCAPTraceFileWriter::Open(const std::filesystem::path& file_path) -> bool {
     // prevent opening again if already opened
-    if (trace_file_.is_open()) {
+    if (trace_file_.IsOpen()) {
         std::cerr << "ERROR: Opening file " << file_path << ", writer has already a file opened" << std::endl;
         return false;
     }
 
-    trace_file_.open(file_path, std::ios::binary);
-    if (!trace_file_) {
+    if (preview_options_ && preview_options_->source_topic.empty()) {
+        std::cerr << "ERROR: Opening file " << file_path << ", the preview channel has no source topic" << std::endl;
+        return false;
+    }
+
+    if (!trace_file_.Open(file_path, io_options_)) {
         std::cerr << "ERROR: Opening file " << file_path << std::endl;
         return false;
     }
-    mcap_writer_.open(trace_file_, mcap_options_);
+    if (checkpoint_options_.Enabled()) {
+        journal_path_ = tracefile::GetCheckpointJournalPath(file_path);
+        journal_ = std::make_unique<mcap_utils::CheckpointJournal>();
+        if (!journal_->Open(journal_path_)) {
+            journal_.reset();
+            trace_file_.Close();
+            return false;
+        }
+        writable_.SetJournal(journal_.get());
+        checkpoint_bytes_ = 0;
+        last_checkpoint_ = std::chrono::steady_clock::now();
+    }
+    statistics_.reset();
+    if (statistics_enabled_) {
+        statistics_ = std::make_unique<tracefile::TraceStatistics>();
+    }
+    channel_.SetStatistics(statistics_.get());
+    preview_.reset();
+    if (preview_options_) {
+        preview_ = std::make_unique<PreviewState>();
+        preview_->options = *preview_options_;
+        if (preview_->options.topic.empty()) {
+            preview_->options.topic = preview_->options.source_topic + tracefile::config::kPreviewTopicSuffix;
+        }
+        preview_->compactor.emplace(preview_->options.compaction);
+    }
+    close_failed_ = false;
+    mcap_writer_.open(writable_, mcap_options_);
     return true;
 }
 
@@ -45,7 +85,7 @@ auto MCAPTraceFileWriter::Open(const std::filesystem::path& file_path, const mca
 }
 
 auto MCAPTraceFileWriter::WriteMessage(const google::protobuf::Message& message, const std::string& topic) -> bool {
-    if (!(trace_file_ && trace_file_.is_open())) {
+    if (!trace_file_.IsOpen()) {
         std::cerr << "ERROR: cannot write message, file is not open\n";
         return false;
     }
@@ -56,12 +96,34 @@ auto MCAPTraceFileWriter::WriteMessage(const google::protobuf::Message& message,
             return false;
         }
     }
-    return channel_.WriteMessage(message, topic);
+    if (!channel_.WriteMessage(message, topic)) {
+        return false;
+    }
+    PreviewIfDue(message, topic);
+    return CheckpointIfDue();
+}
+
+auto MCAPTraceFileWriter::WriteRawMessage(const char* data, const size_t size, const google::protobuf::Descriptor* descriptor, const std::string& topic) -> bool {
+    if (!trace_file_.IsOpen()) {
+        std::cerr << "ERROR: cannot write message, file is not open\n";
+        return false;
+    }
+    if (!required_metadata_added_) {
+        if (!AddFileMetadata(PrepareRequiredFileMetadata())) {
+            std::cerr << "ERROR: failed to auto-add required metadata\n";
+            return false;
+        }
+    }
+    if (!channel_.WriteRawMessage(data, size, descriptor, topic)) {
+        return false;
+    }
+    PreviewIfDue(data, size, descriptor, topic);
+    return CheckpointIfDue();
 }
 
 template <typename T>
 auto MCAPTraceFileWriter::WriteMessage(const T& top_level_message, const std::string& topic) -> bool {
-    if (!(trace_file_ && trace_file_.is_open())) {
+    if (!trace_file_.IsOpen()) {
         std::cerr << "ERROR: cannot write message, file is not open\n";
         return false;
     }
@@ -69,7 +131,11 @@ auto MCAPTraceFileWriter::WriteMessage(const T& top_level_message, const std::st
         std::cerr << "ERROR: cannot write message, required metadata (according to the OSI specification) was not set in advance\n";
         return false;
     }
-    return channel_.WriteMessage(top_level_message, topic);
+    if (!channel_.WriteMessage(top_level_message, topic)) {
+        return false;
+    }
+    PreviewIfDue(top_level_message, topic);
+    return CheckpointIfDue();
 }
 
 auto MCAPTraceFileWriter::AddFileMetadata(const mcap::Metadata& metadata) -> bool {
@@ -106,9 +172,203 @@ auto MCAPTraceFileWriter::AddFileMetadata(const std::string& name, const std::un
     return this->AddFileMetadata(metadata);
 }
 
+auto MCAPTraceFileWriter::AddAttachment(const std::string& name, const std::string& media_type, const char* data, const size_t size, const uint64_t log_time) -> bool {
+    if (!trace_file_.IsOpen()) {
+        std::cerr << "ERROR: cannot add attachment, file is not open\n";
+        return false;
+    }
+    mcap::Attachment attachment;
+    attachment.name = name;
+    attachment.mediaType = media_type;
+    attachment.logTime = log_time;
+    attachment.createTime = static_cast<mcap::Timestamp>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+    attachment.data = reinterpret_cast<const std::byte*>(data);
+    attachment.dataSize = size;
+    // attachments are written outside of the chunks, so readers can skip them without decompressing anything
+    if (const auto status = mcap_writer_.write(attachment); status.code != mcap::StatusCode::Success) {
+        std::cerr << "ERROR: Failed to write attachment with name " << name << "\n" << status.message;
+        return false;
+    }
+    return true;
+}
+
+auto MCAPTraceFileWriter::AddAttachment(const std::string& name, const google::protobuf::Message& message, const uint64_t log_time) -> bool {
+    std::string data;
+    if (!message.SerializeToString(&data)) {
+        std::cerr << "ERROR: Failed to serialize attachment with name " << name << "\n";
+        return false;
+    }
+    return AddAttachment(name, tracefile::config::kProtobufAttachmentMediaTypePrefix + message.GetDescriptor()->full_name(), data.data(), data.size(), log_time);
+}
+
+auto MCAPTraceFileWriter::AddAttachmentFromFile(const std::filesystem::path& file_path, const std::string& media_type) -> bool {
+    std::ifstream file(file_path, std::ios::binary);
+    if (!file) {
+        std::cerr << "ERROR: cannot add attachment, failed to open " << file_path << "\n";
+        return false;
+    }
+    std::error_code error;
+    std::string data(static_cast<size_t>(std::filesystem::file_size(file_path, error)), '\0');
+    if (error || !file.read(data.data(), static_cast<std::streamsize>(data.size()))) {
+        std::cerr << "ERROR: cannot add attachment, failed to read " << file_path << "\n";
+        return false;
+    }
+    return AddAttachment(file_path.filename().string(), media_type, data.data(), data.size());
+}
+
+auto MCAPTraceFileWriter::Checkpoint() -> bool {
+    if (!journal_) {
+        std::cerr << "ERROR: cannot write checkpoint, checkpoints are not enabled or the file is not open\n";
+        return false;
+    }
+    checkpoint_bytes_ = 0;
+    last_checkpoint_ = std::chrono::steady_clock::now();
+    // the journal must never point beyond data that could be lost, so it is only advanced
+    // once the pending preview and payload records are written and the file is flushed
+    if (!FlushPreview() || !channel_.FlushPayloads()) {
+        close_failed_ = true;
+        std::cerr << "ERROR: Failed to write pending records for the checkpoint of the trace file\n";
+        return false;
+    }
+    mcap_writer_.closeLastChunk();
+    const bool flushed = io_options_.HasDurabilityOptions() ? trace_file_.Sync() : trace_file_.Flush();
+    if (!flushed) {
+        close_failed_ = true;
+    }
+    if (!flushed || !journal_->Checkpoint(channel_.GetSchemas(), channel_.GetChannels())) {
+        std::cerr << "ERROR: Failed to write checkpoint of the trace file\n";
+        return false;
+    }
+    return true;
+}
+
+auto MCAPTraceFileWriter::CheckpointIfDue() -> bool {
+    if (!journal_) {
+        return true;
+    }
+    // the channel knows the serialized size, so the message is not traversed again
+    checkpoint_bytes_ += channel_.GetLastMessageSize();
+    const bool bytes_due = checkpoint_options_.interval_bytes > 0 && checkpoint_bytes_ >= checkpoint_options_.interval_bytes;
+    const bool time_due = checkpoint_options_.interval.count() > 0 && std::chrono::steady_clock::now() - last_checkpoint_ >= checkpoint_options_.interval;
+    return !(bytes_due || time_due) || Checkpoint();
+}
+
+void MCAPTraceFileWriter::PreviewIfDue(const google::protobuf::Message& message, const std::string& topic) {
+    if (!preview_ || topic != preview_->options.source_topic) {
+        return;
+    }
+    // the channel accepted the message, so its timestamp is valid
+    const auto log_time = tracefile::TimestampToNanoseconds(message);
+    if (preview_->descriptor != nullptr && log_time < preview_->next_log_time) {
+        return;
+    }
+    if (!preview_->message || preview_->message->GetDescriptor() != message.GetDescriptor()) {
+        preview_->message.reset(message.New());
+    }
+    preview_->message->CopyFrom(message);
+    AddPreview(log_time);
+}
+
+void MCAPTraceFileWriter::PreviewIfDue(const char* data, const size_t size, const google::protobuf::Descriptor* descriptor, const std::string& topic) {
+    if (!preview_ || topic != preview_->options.source_topic) {
+        return;
+    }
+    // the channel accepted the message, so the type has a timestamp field
+    const auto log_time = tracefile::PeekTimestampNanoseconds(std::string_view(data, size), static_cast<uint32_t>(descriptor->FindFieldByName("timestamp")->number()));
+    if (!log_time || (preview_->descriptor != nullptr && *log_time < preview_->next_log_time)) {
+        return;
+    }
+    if (!preview_->message || preview_->message->GetDescriptor() != descriptor) {
+        preview_->message.reset(google::protobuf::MessageFactory::generated_factory()->GetPrototype(descriptor)->New());
+    }
+    if (!preview_->message->ParseFromArray(data, static_cast<int>(size))) {
+        std::cerr << "ERROR: Failed to parse message of topic " << topic << " for the preview channel\n";
+        return;
+    }
+    AddPreview(*log_time);
+}
+
+void MCAPTraceFileWriter::AddPreview(const uint64_t log_time) {
+    auto& preview = *preview_;
+    if (preview.descriptor == nullptr) {
+        preview.descriptor = preview.message->GetDescriptor();
+        channel_.AddChannel(preview.options.topic, preview.descriptor,
+                            {{tracefile::config::kOsiChannelPreviewSourceKey, preview.options.source_topic},
+                             {tracefile::config::kOsiChannelPreviewIntervalKey, std::to_string(std::chrono::nanoseconds(preview.options.interval).count())}});
+    }
+    preview.next_log_time = log_time + static_cast<uint64_t>(std::chrono::nanoseconds(preview.options.interval).count());
+    preview.compactor->Compact(*preview.message);
+    std::string serialized;
+    if (!tracefile::SerializeCanonical(*preview.message, serialized)) {
+        std::cerr << "ERROR: Failed to serialize preview message of topic " << preview.options.source_topic << "\n";
+        return;
+    }
+    preview.pending.push_back(std::move(serialized));
+    if (preview.pending.size() >= preview.options.batch_size) {
+        FlushPreview();
+    }
+}
+
+auto MCAPTraceFileWriter::FlushPreview() -> bool {
+    if (!preview_ || preview_->pending.empty()) {
+        return true;
+    }
+    // closing the chunks around the batch keeps full-rate messages out of the preview chunks,
+    // so readers of the preview channel skip the full-rate chunks
+    mcap_writer_.closeLastChunk();
+    bool success = true;
+    for (const auto& serialized : preview_->pending) {
+        success = channel_.WriteRawMessage(serialized.data(), serialized.size(), preview_->descriptor, preview_->options.topic) && success;
+    }
+    mcap_writer_.closeLastChunk();
+    preview_->pending.clear();
+    return success;
+}
+
+void MCAPTraceFileWriter::BlockWritable::handleWrite(const std::byte* data, const uint64_t size) {
+    file_.Write(reinterpret_cast<const char*>(data), static_cast<size_t>(size));
+    if (journal_ != nullptr) {
+        journal_->Observe(data, size);
+    }
+}
+
 void MCAPTraceFileWriter::Close() {
+    if (trace_file_.IsOpen() && !FlushPreview()) {
+        close_failed_ = true;
+        std::cerr << "ERROR: Failed to write the preview channel\n";
+    }
+    if (trace_file_.IsOpen() && !channel_.FlushPayloads()) {
+        close_failed_ = true;
+    }
+    preview_.reset();
+    if (statistics_ && trace_file_.IsOpen()) {
+        for (const auto& channel_statistics : statistics_->GetChannels()) {
+            mcap::Metadata metadata;
+            metadata.name = tracefile::config::kOsiTraceStatisticsMetadataName;
+            metadata.metadata = tracefile::ToMetadata(channel_statistics);
+            if (const auto status = mcap_writer_.write(metadata); status.code != mcap::StatusCode::Success) {
+                close_failed_ = true;
+                std::cerr << "ERROR: Failed to write statistics of channel " << channel_statistics.topic << "\n" << status.message;
+            }
+        }
+    }
+    channel_.SetStatistics(nullptr);
     mcap_writer_.close();
-    trace_file_.close();
+    const bool closed = trace_file_.Close();
+    if (!closed) {
+        close_failed_ = true;
+        std::cerr << "ERROR: Failed to write buffered records to the trace file\n";
+    }
+    if (journal_) {
+        writable_.SetJournal(nullptr);
+        journal_->Close();
+        journal_.reset();
+        // the file is complete, the journal is only kept if it may be needed for recovery
+        if (closed && !close_failed_) {
+            std::error_code error;
+            std::filesystem::remove(journal_path_, error);
+        }
+    }
 }
 
 auto MCAPTraceFileWriter::PrepareRequiredFileMetadata() -> mcap::Metadata { return MCAPTraceFileChannel::PrepareRequiredFileMetadata(); }
@@ -0,0 +1,318 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/writer/RealtimeTraceFileWriter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace osi3 {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint64_t kFrameAlignment = 8;
+
+// Frames start at multiples of 8 bytes, so a frame header always fits before the end of the buffer
+auto AlignFrame(const uint64_t size) -> uint64_t { return (size + kFrameAlignment - 1) & ~(kFrameAlignment - 1); }
+
+// Idle wait of the background thread in case a wake-up is missed
+constexpr std::chrono::milliseconds kIdleWait{1};
+
+}  // namespace
+
+RealtimeTraceFileWriter::RealtimeTraceFileWriter(std::unique_ptr<TraceFileWriter> writer, const RealtimeWriterOptions& options)
+    : writer_(std::move(writer)), options_(options) {
+    if (!writer_) {
+        throw std::invalid_argument("RealtimeTraceFileWriter requires a writer");
+    }
+    // frame and padding sizes are stored in the 32-bit FrameHeader::size
+    if (options_.buffer_size < 2 * kFrameAlignment || options_.buffer_size > UINT32_MAX || options_.max_topics == 0 || options_.max_topics >= kPadding || options_.max_wait.count() < 0 ||
+        options_.degrade_threshold < 0.0 || options_.degrade_threshold > 1.0) {
+        throw std::invalid_argument("Invalid RealtimeWriterOptions");
+    }
+    topics_ = std::make_unique<Topic[]>(options_.max_topics);
+}
+
+RealtimeTraceFileWriter::~RealtimeTraceFileWriter() {
+    if (thread_.joinable()) {
+        Close();
+    }
+}
+
+auto RealtimeTraceFileWriter::Open(const std::filesystem::path& file_path) -> bool {
+    if (thread_.joinable()) {
+        std::cerr << "ERROR: Opening file " << file_path << ", writer has already a file opened" << std::endl;
+        return false;
+    }
+
+    // Value-initialization zeroes the buffer, which also maps all of its pages before recording starts
+    capacity_ = options_.buffer_size & ~(kFrameAlignment - 1);
+    buffer_ = std::make_unique<char[]>(capacity_);
+    if (!writer_->Open(file_path)) {
+        buffer_.reset();
+        return false;
+    }
+
+    head_ = 0;
+    tail_ = 0;
+    stop_ = false;
+    frames_written_ = 0;
+    bytes_written_ = 0;
+    frames_dropped_full_ = 0;
+    frames_dropped_degraded_ = 0;
+    frames_dropped_oversize_ = 0;
+    write_errors_ = 0;
+    max_buffer_usage_ = 0;
+    max_write_time_ns_ = 0;
+    for (uint32_t i = 0; i < topic_count_.load(); ++i) {
+        topics_[i].dropped = 0;
+    }
+    thread_ = std::thread(&RealtimeTraceFileWriter::Run, this);
+    return true;
+}
+
+void RealtimeTraceFileWriter::Close() {
+    if (!thread_.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_one();
+    thread_.join();
+    writer_->Close();
+    buffer_.reset();
+}
+
+auto RealtimeTraceFileWriter::AddTopic(const std::string& topic, const google::protobuf::Descriptor* descriptor, const bool droppable) -> bool {
+    const auto count = topic_count_.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < count; ++i) {
+        if (topics_[i].name == topic) {
+            if (topics_[i].descriptor != descriptor) {
+                std::cerr << "ERROR: Topic '" << topic << "' is already registered with another message type\n";
+                return false;
+            }
+            topics_[i].droppable = droppable;
+            return true;
+        }
+    }
+    if (count == options_.max_topics) {
+        std::cerr << "ERROR: Cannot register topic '" << topic << "', the maximum of " << options_.max_topics << " topics is reached\n";
+        return false;
+    }
+    topics_[count].name = topic;
+    topics_[count].descriptor = descriptor;
+    topics_[count].droppable = droppable;
+    topic_count_.store(count + 1, std::memory_order_release);
+    return true;
+}
+
+auto RealtimeTraceFileWriter::FindTopic(const std::string& topic, const google::protobuf::Descriptor* descriptor) -> Topic* {
+    const auto count = topic_count_.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < count; ++i) {
+        if (topics_[i].name == topic) {
+            if (topics_[i].descriptor != descriptor) {
+                std::cerr << "ERROR: Topic '" << topic << "' is registered with another message type\n";
+                return nullptr;
+            }
+            return &topics_[i];
+        }
+    }
+    if (!AddTopic(topic, descriptor)) {
+        return nullptr;
+    }
+    return &topics_[count];
+}
+
+auto RealtimeTraceFileWriter::WriteMessage(const google::protobuf::Message& message, const std::string& topic) -> bool {
+    const auto start = Clock::now();
+    if (!thread_.joinable()) {
+        std::cerr << "ERROR: cannot write message, file is not open\n";
+        return false;
+    }
+    auto* registered = FindTopic(topic, message.GetDescriptor());
+    if (registered == nullptr) {
+        return false;
+    }
+    // ByteSizeLong() caches the sizes of all submessages for SerializeWithCachedSizesToArray()
+    char* destination = Reserve(message.ByteSizeLong(), *registered, start);
+    if (destination == nullptr) {
+        RecordWriteTime(start);
+        return false;
+    }
+    message.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(destination));
+    Commit();
+    RecordWriteTime(start);
+    return true;
+}
+
+auto RealtimeTraceFileWriter::WriteRawMessage(const char* data, const size_t size, const google::protobuf::Descriptor* descriptor, const std::string& topic) -> bool {
+    const auto start = Clock::now();
+    if (!thread_.joinable()) {
+        std::cerr << "ERROR: cannot write message, file is not open\n";
+        return false;
+    }
+    auto* registered = FindTopic(topic, descriptor);
+    if (registered == nullptr) {
+        return false;
+    }
+    char* destination = Reserve(size, *registered, start);
+    if (destination == nullptr) {
+        RecordWriteTime(start);
+        return false;
+    }
+    std::memcpy(destination, data, size);
+    Commit();
+    RecordWriteTime(start);
+    return true;
+}
+
+auto RealtimeTraceFileWriter::Reserve(const size_t size, Topic& topic, const Clock::time_point start) -> char* {
+    const uint64_t frame_size = AlignFrame(sizeof(FrameHeader) + static_cast<uint64_t>(size));
+    if (size > std::numeric_limits<uint32_t>::max() || frame_size > capacity_) {
+        Drop(topic, frames_dropped_oversize_);
+        return nullptr;
+    }
+
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    const auto used = head - tail_.load(std::memory_order_acquire);
+    if (topic.droppable && static_cast<double>(used + frame_size) > options_.degrade_threshold * static_cast<double>(capacity_)) {
+        Drop(topic, frames_dropped_degraded_);
+        return nullptr;
+    }
+
+    // A frame does not wrap around; the rest of the buffer is skipped with a padding header
+    const auto offset = head % capacity_;
+    const auto contiguous = capacity_ - offset;
+    const auto needed = frame_size > contiguous ? contiguous + frame_size : frame_size;
+    const auto deadline = start + options_.max_wait;
+    while (capacity_ - (head - tail_.load(std::memory_order_acquire)) < std::min<uint64_t>(needed, capacity_)) {
+        if (Clock::now() >= deadline) {
+            Drop(topic, frames_dropped_full_);
+            return nullptr;
+        }
+        wake_.notify_one();
+        std::this_thread::yield();
+    }
+    if (frame_size > contiguous) {
+        // Publish the padding separately: padding plus frame may exceed the capacity
+        auto* padding = reinterpret_cast<FrameHeader*>(buffer_.get() + offset);
+        padding->size = static_cast<uint32_t>(contiguous);
+        padding->topic = kPadding;
+        head += contiguous;
+        head_.store(head, std::memory_order_release);
+        while (capacity_ - (head - tail_.load(std::memory_order_acquire)) < frame_size) {
+            if (Clock::now() >= deadline) {
+                Drop(topic, frames_dropped_full_);
+                return nullptr;
+            }
+            wake_.notify_one();
+            std::this_thread::yield();
+        }
+    }
+
+    auto* header = reinterpret_cast<FrameHeader*>(buffer_.get() + head % capacity_);
+    header->size = static_cast<uint32_t>(size);
+    header->topic = static_cast<uint32_t>(&topic - topics_.get());
+    reserved_ = frame_size;
+    return reinterpret_cast<char*>(header + 1);
+}
+
+void RealtimeTraceFileWriter::Commit() {
+    const auto head = head_.load(std::memory_order_relaxed) + reserved_;
+    head_.store(head, std::memory_order_release);
+    const auto used = static_cast<size_t>(head - tail_.load(std::memory_order_relaxed));
+    if (used > max_buffer_usage_.load(std::memory_order_relaxed)) {
+        max_buffer_usage_.store(used, std::memory_order_relaxed);
+    }
+    if (consumer_waiting_.load()) {
+        wake_.notify_one();
+    }
+}
+
+void RealtimeTraceFileWriter::Drop(Topic& topic, std::atomic<uint64_t>& counter) {
+    counter.fetch_add(1, std::memory_order_relaxed);
+    topic.dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RealtimeTraceFileWriter::RecordWriteTime(const Clock::time_point start) {
+    const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+    if (duration > max_write_time_ns_.load(std::memory_order_relaxed)) {
+        max_write_time_ns_.store(duration, std::memory_order_relaxed);
+    }
+}
+
+void RealtimeTraceFileWriter::Run() {
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+    while (true) {
+        const auto head = head_.load(std::memory_order_acquire);
+        if (tail == head) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            drained_.notify_all();
+            if (stop_) {
+                break;
+            }
+            consumer_waiting_ = true;
+            if (head_.load(std::memory_order_acquire) == tail) {
+                wake_.wait_for(lock, kIdleWait);
+            }
+            consumer_waiting_ = false;
+            continue;
+        }
+
+        const auto* header = reinterpret_cast<const FrameHeader*>(buffer_.get() + tail % capacity_);
+        if (header->topic == kPadding) {
+            tail += header->size;
+        } else {
+            const auto& topic = topics_[header->topic];
+            if (writer_->WriteRawMessage(reinterpret_cast<const char*>(header + 1), header->size, topic.descriptor, topic.name)) {
+                frames_written_.fetch_add(1, std::memory_order_relaxed);
+                bytes_written_.fetch_add(header->size, std::memory_order_relaxed);
+            } else {
+                write_errors_.fetch_add(1, std::memory_order_relaxed);
+            }
+            tail += AlignFrame(sizeof(FrameHeader) + header->size);
+        }
+        tail_.store(tail, std::memory_order_release);
+    }
+}
+
+void RealtimeTraceFileWriter::Flush() {
+    if (!thread_.joinable()) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    wake_.notify_one();
+    drained_.wait(lock, [this] { return tail_.load() == head_.load(); });
+}
+
+auto RealtimeTraceFileWriter::GetStatistics() const -> RealtimeWriterStatistics {
+    RealtimeWriterStatistics statistics;
+    statistics.frames_written = frames_written_.load();
+    statistics.bytes_written = bytes_written_.load();
+    statistics.frames_dropped_full = frames_dropped_full_.load();
+    statistics.frames_dropped_degraded = frames_dropped_degraded_.load();
+    statistics.frames_dropped_oversize = frames_dropped_oversize_.load();
+    statistics.write_errors = write_errors_.load();
+    statistics.max_buffer_usage = max_buffer_usage_.load();
+    statistics.max_write_time = std::chrono::nanoseconds(max_write_time_ns_.load());
+    const auto count = topic_count_.load(std::memory_order_acquire);
+    for (uint32_t i = 0; i < count; ++i) {
+        const auto dropped = topics_[i].dropped.load();
+        if (dropped > 0) {
+            statistics.dropped_per_topic[topics_[i].name] += dropped;
+        }
+    }
+    return statistics;
+}
+
+}  // namespace osi3
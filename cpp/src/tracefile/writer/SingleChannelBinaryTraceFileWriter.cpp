@@ -5,6 +5,10 @@
 
 #include "osi-utilities/tracefile/writer/SingleChannelBinaryTraceFileWriter.h"
 
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream.h>
+
+#include <iostream>
 #include <limits>
 
 #include "osi_groundtruth.pb.h"
@@ -19,8 +23,52 @@
 
 namespace osi3 {
 
+namespace {
+
+// Hands out a caller-owned chunk buffer to the serializer and appends each filled chunk to the file
+class ChunkedFileOutputStream final : public google::protobuf::io::ZeroCopyOutputStream {
+   public:
+    ChunkedFileOutputStream(tracefile::BlockFileWriter& file, std::vector<char>& buffer) : file_(file), buffer_(buffer) {}
+
+    bool Next(void** data, int* size) override {
+        if (!Flush()) {
+            return false;
+        }
+        pending_ = buffer_.size();
+        byte_count_ += pending_;
+        *data = buffer_.data();
+        *size = static_cast<int>(pending_);
+        return true;
+    }
+
+    void BackUp(const int count) override {
+        pending_ -= static_cast<size_t>(count);
+        byte_count_ -= static_cast<size_t>(count);
+    }
+
+    int64_t ByteCount() const override { return static_cast<int64_t>(byte_count_); }
+
+    // Appends the filled part of the current chunk to the file
+    bool Flush() {
+        if (pending_ > 0 && !file_.Write(buffer_.data(), pending_)) {
+            failed_ = true;
+        }
+        pending_ = 0;
+        return !failed_;
+    }
+
+   private:
+    tracefile::BlockFileWriter& file_;
+    std::vector<char>& buffer_;
+    size_t pending_ = 0;
+    uint64_t byte_count_ = 0;
+    bool failed_ = false;
+};
+
+}  // namespace
+
 SingleChannelBinaryTraceFileWriter::~SingleChannelBinaryTraceFileWriter() {
-    if (trace_file_.is_open()) {
+    if (trace_file_.IsOpen()) {
         Close();
     }
 }
@@ -33,66 +81,86 @@ auto SingleChannelBinaryTraceFileWriter::Open(const std::filesystem::path& file_
     }
 
     // prevent opening again if already opened
-    if (trace_file_.is_open()) {
+    if (trace_file_.IsOpen()) {
         std::cerr << "ERROR: Opening file " << file_path << ", writer has already a file opened" << std::endl;
         return false;
     }
 
-    trace_file_.open(file_path, std::ios::binary);
-    if (!trace_file_) {
+    if (!trace_file_.Open(file_path, io_options_)) {
         std::cerr << "ERROR: Opening file " << file_path << std::endl;
         return false;
     }
+    close_failed_ = false;
     return true;
 }
 
-void SingleChannelBinaryTraceFileWriter::Close() { trace_file_.close(); }
+void SingleChannelBinaryTraceFileWriter::Close() {
+    if (!trace_file_.Close()) {
+        close_failed_ = true;
+        std::cerr << "ERROR: Failed to write buffered messages to the trace file\n";
+    }
+}
+
+void SingleChannelBinaryTraceFileWriter::SetIoOptions(const tracefile::IoOptions& options) { io_options_ = options; }
 
 template <typename T>
 auto SingleChannelBinaryTraceFileWriter::WriteMessage(const T& top_level_message) -> bool {
-    if (!(trace_file_ && trace_file_.is_open())) {
+    if (!trace_file_.IsOpen()) {
+        std::cerr << "ERROR: cannot write message, file is not open\n";
+        return false;
+    }
+    return WriteSerialized(top_level_message);
+}
+
+auto SingleChannelBinaryTraceFileWriter::WriteMessage(const google::protobuf::Message& message, const std::string& /*topic*/) -> bool {
+    if (!trace_file_.IsOpen()) {
         std::cerr << "ERROR: cannot write message, file is not open\n";
         return false;
     }
+    return WriteSerialized(message);
+}
 
-    std::string serialized_message;
-    if (!top_level_message.SerializeToString(&serialized_message)) {
+auto SingleChannelBinaryTraceFileWriter::WriteSerialized(const google::protobuf::Message& message) -> bool {
+    if (!message.IsInitialized()) {
         std::cerr << "ERROR: Failed to serialize protobuf message\n";
         return false;
     }
-    if (serialized_message.size() > std::numeric_limits<uint32_t>::max()) {
+    // ByteSizeLong() caches the sizes of all submessages for SerializeWithCachedSizes()
+    const auto serialized_size = message.ByteSizeLong();
+    if (serialized_size > std::numeric_limits<uint32_t>::max()) {
         std::cerr << "ERROR: Serialized message size exceeds uint32_t maximum\n";
         return false;
     }
-    const auto message_size = static_cast<uint32_t>(serialized_message.size());
-
-    trace_file_.write(reinterpret_cast<const char*>(&message_size), sizeof(message_size));
-    trace_file_.write(serialized_message.data(), message_size);
+    const auto message_size = static_cast<uint32_t>(serialized_size);
+    if (!trace_file_.Write(reinterpret_cast<const char*>(&message_size), sizeof(message_size))) {
+        return false;
+    }
 
-    return trace_file_.good();
+    stream_buffer_.resize(tracefile::config::kStreamingSerializeChunkSize);
+    ChunkedFileOutputStream file_stream(trace_file_, stream_buffer_);
+    {
+        google::protobuf::io::CodedOutputStream coded_stream(&file_stream);
+        message.SerializeWithCachedSizes(&coded_stream);
+        if (coded_stream.HadError()) {
+            return false;
+        }
+    }
+    return file_stream.Flush() && file_stream.ByteCount() == static_cast<int64_t>(message_size);
 }
 
-auto SingleChannelBinaryTraceFileWriter::WriteMessage(const google::protobuf::Message& message, const std::string& /*topic*/) -> bool {
-    if (!(trace_file_ && trace_file_.is_open())) {
+auto SingleChannelBinaryTraceFileWriter::WriteRawMessage(const char* data, const size_t size, const google::protobuf::Descriptor* /*descriptor*/, const std::string& /*topic*/)
+    -> bool {
+    if (!trace_file_.IsOpen()) {
         std::cerr << "ERROR: cannot write message, file is not open\n";
         return false;
     }
-
-    std::string serialized_message;
-    if (!message.SerializeToString(&serialized_message)) {
-        std::cerr << "ERROR: Failed to serialize protobuf message\n";
-        return false;
-    }
-    if (serialized_message.size() > std::numeric_limits<uint32_t>::max()) {
+    if (size > std::numeric_limits<uint32_t>::max()) {
         std::cerr << "ERROR: Serialized message size exceeds uint32_t maximum\n";
         return false;
     }
-    const auto message_size = static_cast<uint32_t>(serialized_message.size());
-
-    trace_file_.write(reinterpret_cast<const char*>(&message_size), sizeof(message_size));
-    trace_file_.write(serialized_message.data(), message_size);
+    const auto message_size = static_cast<uint32_t>(size);
 
-    return trace_file_.good();
+    return trace_file_.Write(reinterpret_cast<const char*>(&message_size), sizeof(message_size)) && trace_file_.Write(data, message_size);
 }
 
 // Template instantiations for allowed OSI top-level messages
@@ -53,10 +53,20 @@ auto TXTHTraceFileWriter::Open(const std::filesystem::path& file_path) -> bool {
         std::cerr << "ERROR: Opening file " << file_path << std::endl;
         return false;
     }
+    close_failed_ = false;
     return true;
 }
 
-void TXTHTraceFileWriter::Close() { trace_file_.close(); }
+void TXTHTraceFileWriter::Close() {
+    if (!trace_file_.is_open()) {
+        return;
+    }
+    trace_file_.close();
+    if (trace_file_.fail()) {
+        close_failed_ = true;
+        std::cerr << "ERROR: Failed to write buffered messages to the trace file\n";
+    }
+}
 
 template <typename T>
 auto TXTHTraceFileWriter::WriteMessage(const T& top_level_message) -> bool {
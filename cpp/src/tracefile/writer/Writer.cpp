@@ -6,6 +6,7 @@
 #include "osi-utilities/tracefile/Writer.h"
 
 #include <iostream>
+#include <limits>
 
 #include "osi-utilities/tracefile/writer/MCAPTraceFileWriter.h"
 #include "osi-utilities/tracefile/writer/SingleChannelBinaryTraceFileWriter.h"
@@ -22,6 +23,26 @@
 
 namespace osi3 {
 
+auto TraceFileWriter::WriteRawMessage(const char* data, const size_t size, const google::protobuf::Descriptor* descriptor, const std::string& topic) -> bool {
+    if (descriptor == nullptr) {
+        std::cerr << "ERROR: cannot write message, message type is unknown\n";
+        return false;
+    }
+    if (!raw_message_ || raw_message_->GetDescriptor() != descriptor) {
+        const auto* prototype = google::protobuf::MessageFactory::generated_factory()->GetPrototype(descriptor);
+        if (prototype == nullptr) {
+            std::cerr << "ERROR: cannot write message, no generated message type " << descriptor->full_name() << "\n";
+            return false;
+        }
+        raw_message_.reset(prototype->New());
+    }
+    if (size > static_cast<size_t>(std::numeric_limits<int>::max()) || !raw_message_->ParseFromArray(data, static_cast<int>(size))) {
+        std::cerr << "ERROR: Failed to parse serialized " << descriptor->full_name() << "\n";
+        return false;
+    }
+    return WriteMessage(*raw_message_, topic);
+}
+
 auto TraceFileWriterFactory::createWriter(const std::filesystem::path& path) -> std::unique_ptr<osi3::TraceFileWriter> {
     if (path.extension().string() == ".osi") {
         return std::make_unique<osi3::SingleChannelBinaryTraceFileWriter>();
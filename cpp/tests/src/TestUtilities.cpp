@@ -30,4 +30,11 @@ void SafeRemoveTestFile(const std::filesystem::path& path) {
     // Intentionally ignore errors - file may not exist
 }
 
+auto MakeGroundTruth(const int64_t second) -> osi3::GroundTruth {
+    osi3::GroundTruth ground_truth;
+    ground_truth.mutable_timestamp()->set_seconds(second);
+    ground_truth.add_moving_object()->mutable_id()->set_value(static_cast<uint64_t>(second));
+    return ground_truth;
+}
+
 }  // namespace osi3::testing
@@ -6,9 +6,12 @@
 #ifndef OSI_UTILITIES_TEST_UTILITIES_H_
 #define OSI_UTILITIES_TEST_UTILITIES_H_
 
+#include <cstdint>
 #include <filesystem>
 #include <string>
 
+#include "osi_groundtruth.pb.h"
+
 namespace osi3::testing {
 
 /**
@@ -49,6 +52,17 @@ std::filesystem::path MakeTempPath(const std::string& prefix, const std::string&
  */
 void SafeRemoveTestFile(const std::filesystem::path& path);
 
+/**
+ * @brief Creates a minimal GroundTruth frame for trace file tests.
+ *
+ * The frame has the given timestamp and one moving object whose id equals the second,
+ * so frames can be told apart after writing and reading.
+ *
+ * @param second Timestamp of the frame in seconds
+ * @return osi3::GroundTruth The frame
+ */
+osi3::GroundTruth MakeGroundTruth(int64_t second);
+
 }  // namespace osi3::testing
 
 #endif  // OSI_UTILITIES_TEST_UTILITIES_H_
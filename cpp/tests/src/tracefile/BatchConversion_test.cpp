@@ -0,0 +1,160 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/BatchConversion.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../TestUtilities.h"
+#include "osi-utilities/tracefile/reader/SingleChannelBinaryTraceFileReader.h"
+#include "osi-utilities/tracefile/writer/SingleChannelBinaryTraceFileWriter.h"
+#include "osi_groundtruth.pb.h"
+#include "osi_sensorview.pb.h"
+
+namespace {
+
+class BatchConversionTest : public ::testing::Test {
+   protected:
+    std::filesystem::path input_directory_ = osi3::testing::MakeTempPath("batch_in", "dir");
+    std::filesystem::path output_directory_ = osi3::testing::MakeTempPath("batch_out", "dir");
+
+    void SetUp() override { std::filesystem::create_directories(input_directory_ / "nested"); }
+
+    void TearDown() override {
+        std::filesystem::remove_all(input_directory_);
+        std::filesystem::remove_all(output_directory_);
+    }
+
+    auto WriteGroundTruthTrace(const std::filesystem::path& path, const int64_t frame_count) const -> std::filesystem::path {
+        osi3::SingleChannelBinaryTraceFileWriter writer;
+        EXPECT_TRUE(writer.Open(path));
+        for (int64_t second = 0; second < frame_count; ++second) {
+            osi3::GroundTruth ground_truth;
+            ground_truth.mutable_timestamp()->set_seconds(second);
+            ground_truth.mutable_host_vehicle_id()->set_value(1);
+            EXPECT_TRUE(writer.WriteMessage(ground_truth));
+        }
+        writer.Close();
+        return path;
+    }
+};
+
+TEST_F(BatchConversionTest, CollectsTraceFilesRecursively) {
+    const auto first = WriteGroundTruthTrace(input_directory_ / "a_gt_.osi", 1);
+    const auto second = WriteGroundTruthTrace(input_directory_ / "nested" / "b_gt_.osi", 1);
+    { std::ofstream(input_directory_ / "notes.txt") << "not a trace"; }
+    EXPECT_EQ(osi3::tracefile::CollectTraceFiles({input_directory_}), (std::vector<std::filesystem::path>{first, second}));
+    EXPECT_THROW(osi3::tracefile::CollectTraceFiles({input_directory_ / "missing.osi"}), std::runtime_error);
+}
+
+TEST_F(BatchConversionTest, NamesOutputsAfterInputs) {
+    osi3::tracefile::BatchConversionOptions options;
+    EXPECT_EQ(osi3::tracefile::GetConversionOutputPath("in/trace_gt_3.8.0.osi", "out", options), std::filesystem::path("out/trace_gt_3.8.0.mcap"));
+    options.conversion = osi3::tracefile::TraceConversion::kGroundTruthToSensorView;
+    options.output_extension = ".osi";
+    EXPECT_EQ(osi3::tracefile::GetConversionOutputPath("in/trace_gt_3.8.0.osi", "out", options), std::filesystem::path("out/trace_sv_3.8.0.osi"));
+}
+
+TEST_F(BatchConversionTest, LimitsThreadsByMemoryBudget) {
+    osi3::tracefile::BatchConversionOptions options;
+    options.thread_count = 8;
+    EXPECT_EQ(osi3::tracefile::GetBatchThreadCount(options, 100), 8U);
+    EXPECT_EQ(osi3::tracefile::GetBatchThreadCount(options, 3), 3U);
+    options.memory_budget = 1;
+    EXPECT_EQ(osi3::tracefile::GetBatchThreadCount(options, 100), 1U);
+    options.memory_budget = 256ULL * 1024 * 1024;
+    EXPECT_GT(osi3::tracefile::GetBatchThreadCount(options, 100), 1U);
+    EXPECT_LT(osi3::tracefile::GetBatchThreadCount(options, 100), 8U);
+}
+
+TEST_F(BatchConversionTest, ConvertsGroundTruthToSensorView) {
+    std::vector<std::filesystem::path> inputs;
+    for (int i = 0; i < 4; ++i) {
+        inputs.push_back(WriteGroundTruthTrace(input_directory_ / ("trace" + std::to_string(i) + "_gt_.osi"), 2 + i));
+    }
+    osi3::tracefile::BatchConversionOptions options;
+    options.conversion = osi3::tracefile::TraceConversion::kGroundTruthToSensorView;
+    options.output_extension = ".osi";
+    options.thread_count = 2;
+    std::mutex mutex;
+    std::vector<std::filesystem::path> done;
+    options.on_file_done = [&](const osi3::tracefile::BatchConversionResult& result) {
+        const std::lock_guard<std::mutex> lock(mutex);
+        done.push_back(result.input_path);
+    };
+
+    const auto report = osi3::tracefile::ConvertTraceFiles(inputs, output_directory_, options);
+    EXPECT_EQ(report.thread_count, 2U);
+    EXPECT_EQ(report.converted_count, 4U);
+    EXPECT_EQ(report.frame_count, 2U + 3U + 4U + 5U);
+    EXPECT_GT(report.output_bytes, report.input_bytes);
+    EXPECT_EQ(done.size(), 4U);
+    ASSERT_EQ(report.results.size(), 4U);
+    EXPECT_EQ(report.results[3].output_path, output_directory_ / "trace3_sv_.osi");
+
+    osi3::SingleChannelBinaryTraceFileReader reader;
+    ASSERT_TRUE(reader.Open(report.results[3].output_path, osi3::ReaderTopLevelMessage::kSensorView));
+    int64_t second = 0;
+    while (reader.HasNext()) {
+        const auto result = reader.ReadMessage();
+        ASSERT_TRUE(result.has_value());
+        const auto& sensor_view = static_cast<const osi3::SensorView&>(*result->message);
+        EXPECT_EQ(sensor_view.timestamp().seconds(), second++);
+        EXPECT_EQ(sensor_view.host_vehicle_id().value(), 1U);
+        EXPECT_TRUE(sensor_view.has_global_ground_truth());
+    }
+    EXPECT_EQ(second, 5);
+    reader.Close();
+}
+
+TEST_F(BatchConversionTest, SkipsUpToDateOutputsAndReportsFailures) {
+    const auto valid = WriteGroundTruthTrace(input_directory_ / "valid_gt_.osi", 3);
+    const auto corrupt = input_directory_ / "corrupt_gt_.osi";
+    { std::ofstream(corrupt, std::ios::binary) << std::string("\xFF\xFF\xFF\x00garbage", 11); }
+    osi3::tracefile::BatchConversionOptions options;
+    options.output_extension = ".osi";
+
+    auto report = osi3::tracefile::ConvertTraceFiles({valid, corrupt}, output_directory_, options);
+    EXPECT_EQ(report.converted_count, 1U);
+    EXPECT_EQ(report.failed_count, 1U);
+    EXPECT_EQ(report.results[0].frame_count, 3U);
+    EXPECT_EQ(report.results[1].status, osi3::tracefile::BatchConversionStatus::kFailed);
+    EXPECT_FALSE(report.results[1].error_message.empty());
+    // failed conversions leave neither a partial nor a final output behind
+    EXPECT_FALSE(std::filesystem::exists(report.results[1].output_path));
+    EXPECT_FALSE(std::filesystem::exists(output_directory_ / "corrupt_gt_.partial.osi"));
+
+    report = osi3::tracefile::ConvertTraceFiles({valid}, output_directory_, options);
+    EXPECT_EQ(report.skipped_count, 1U);
+    EXPECT_EQ(report.converted_count, 0U);
+
+    options.force = true;
+    report = osi3::tracefile::ConvertTraceFiles({valid}, output_directory_, options);
+    EXPECT_EQ(report.converted_count, 1U);
+    EXPECT_EQ(report.frame_count, 3U);
+}
+
+TEST_F(BatchConversionTest, RejectsInputsWithTheSameOutput) {
+    WriteGroundTruthTrace(input_directory_ / "trace_gt_.osi", 1);
+    WriteGroundTruthTrace(input_directory_ / "nested" / "trace_gt_.osi", 2);
+    osi3::tracefile::BatchConversionOptions options;
+    options.output_extension = ".osi";
+    EXPECT_THROW(osi3::tracefile::ConvertTraceFiles(osi3::tracefile::CollectTraceFiles({input_directory_}), output_directory_, options), std::invalid_argument);
+    EXPECT_FALSE(std::filesystem::exists(output_directory_));
+}
+
+TEST_F(BatchConversionTest, RejectsUnsupportedOutputFormat) {
+    osi3::tracefile::BatchConversionOptions options;
+    options.output_extension = ".json";
+    EXPECT_THROW(osi3::tracefile::ConvertTraceFiles({}, output_directory_, options), std::invalid_argument);
+}
+
+}  // namespace
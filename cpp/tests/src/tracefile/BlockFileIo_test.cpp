@@ -0,0 +1,297 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/BlockFileIo.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+#include "../TestUtilities.h"
+#include "osi-utilities/tracefile/reader/SingleChannelBinaryTraceFileReader.h"
+#include "osi-utilities/tracefile/writer/SingleChannelBinaryTraceFileWriter.h"
+#include "osi_groundtruth.pb.h"
+
+namespace {
+
+using osi3::tracefile::BlockFileReader;
+using osi3::tracefile::BlockFileWriter;
+using osi3::tracefile::IoBackend;
+using osi3::tracefile::IoOptions;
+
+auto MakePattern(const size_t size) -> std::string {
+    std::string pattern(size, '\0');
+    for (size_t i = 0; i < size; ++i) {
+        pattern[i] = static_cast<char>((i * 31U + i / 251U) & 0xFFU);
+    }
+    return pattern;
+}
+
+auto ReadFile(const std::filesystem::path& path) -> std::string {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+class BlockFileIoTest : public ::testing::TestWithParam<IoBackend> {
+   protected:
+    std::filesystem::path test_file_ = osi3::testing::MakeTempPath("block_io_gt", osi3::testing::FileExtensions::kOsi);
+
+    void TearDown() override { osi3::testing::SafeRemoveTestFile(test_file_); }
+
+    // Small blocks so that the tests cross many block boundaries
+    auto Options() const -> IoOptions {
+        IoOptions options;
+        options.backend = GetParam();
+        options.block_size = 1000;
+        options.queue_depth = 3;
+        return options;
+    }
+
+    void WriteFile(const std::string& content) const {
+        std::ofstream file(test_file_, std::ios::binary);
+        file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+};
+
+TEST_P(BlockFileIoTest, WriteAcrossBlocks) {
+    const auto content = MakePattern(10'500);
+    BlockFileWriter writer;
+    ASSERT_TRUE(writer.Open(test_file_, Options()));
+    size_t offset = 0;
+    for (const size_t piece : {1U, 999U, 1U, 2500U, 7U, 6992U}) {
+        ASSERT_TRUE(writer.Write(content.data() + offset, piece));
+        offset += piece;
+    }
+    ASSERT_EQ(offset, content.size());
+    EXPECT_EQ(writer.Size(), content.size());
+    EXPECT_TRUE(writer.Close());
+    EXPECT_FALSE(writer.IsOpen());
+
+    EXPECT_EQ(ReadFile(test_file_), content);
+}
+
+TEST_P(BlockFileIoTest, ReadAcrossBlocks) {
+    const auto content = MakePattern(10'500);
+    WriteFile(content);
+
+    BlockFileReader reader;
+    ASSERT_TRUE(reader.Open(test_file_, Options()));
+    EXPECT_EQ(reader.Size(), content.size());
+    std::string result(content.size(), '\0');
+    size_t offset = 0;
+    for (const size_t piece : {4U, 996U, 3001U, 1U, 6498U}) {
+        ASSERT_EQ(reader.Read(result.data() + offset, piece), piece);
+        offset += piece;
+    }
+    EXPECT_TRUE(reader.AtEnd());
+    EXPECT_EQ(result, content);
+
+    char byte = 0;
+    EXPECT_EQ(reader.Read(&byte, 1), 0U);
+    EXPECT_FALSE(reader.HasError());
+}
+
+TEST_P(BlockFileIoTest, ReadPastEndReturnsRemainder) {
+    const auto content = MakePattern(1500);
+    WriteFile(content);
+
+    BlockFileReader reader;
+    ASSERT_TRUE(reader.Open(test_file_, Options()));
+    std::string result(2000, '\0');
+    EXPECT_EQ(reader.Read(result.data(), result.size()), content.size());
+    EXPECT_EQ(result.substr(0, content.size()), content);
+    EXPECT_TRUE(reader.AtEnd());
+}
+
+TEST_P(BlockFileIoTest, Seek) {
+    const auto content = MakePattern(10'000);
+    WriteFile(content);
+
+    BlockFileReader reader;
+    ASSERT_TRUE(reader.Open(test_file_, Options()));
+    std::string result(100, '\0');
+    // forward within the read-ahead, backward, then far forward and to the end
+    for (const uint64_t offset : {1500U, 200U, 8950U, 9950U, 0U}) {
+        reader.Seek(offset);
+        EXPECT_EQ(reader.Tell(), offset);
+        const auto expected = content.substr(offset, result.size());
+        ASSERT_EQ(reader.Read(result.data(), result.size()), expected.size()) << offset;
+        EXPECT_EQ(result.substr(0, expected.size()), expected) << offset;
+    }
+}
+
+TEST_P(BlockFileIoTest, EmptyFile) {
+    WriteFile("");
+
+    BlockFileReader reader;
+    ASSERT_TRUE(reader.Open(test_file_, Options()));
+    EXPECT_TRUE(reader.AtEnd());
+    char byte = 0;
+    EXPECT_EQ(reader.Read(&byte, 1), 0U);
+}
+
+TEST_P(BlockFileIoTest, OpenErrors) {
+    BlockFileReader reader;
+    EXPECT_FALSE(reader.Open("missing_block_io_gt_.osi", Options()));
+    EXPECT_FALSE(reader.IsOpen());
+
+    IoOptions invalid = Options();
+    invalid.block_size = 0;
+    BlockFileWriter writer;
+    EXPECT_FALSE(writer.Open(test_file_, invalid));
+    ASSERT_TRUE(writer.Open(test_file_, Options()));
+    EXPECT_FALSE(writer.Open(test_file_, Options()));
+}
+
+TEST_P(BlockFileIoTest, BinaryTraceRoundTrip) {
+    osi3::SingleChannelBinaryTraceFileWriter writer;
+    writer.SetIoOptions(Options());
+    ASSERT_TRUE(writer.Open(test_file_));
+    for (int64_t second = 0; second < 50; ++second) {
+        osi3::GroundTruth ground_truth;
+        ground_truth.mutable_timestamp()->set_seconds(second);
+        ground_truth.add_moving_object()->mutable_id()->set_value(static_cast<uint64_t>(second));
+        ASSERT_TRUE(writer.WriteMessage(ground_truth));
+    }
+    writer.Close();
+
+    osi3::SingleChannelBinaryTraceFileReader reader;
+    reader.SetIoOptions(Options());
+    ASSERT_TRUE(reader.Open(test_file_));
+    int64_t second = 0;
+    while (reader.HasNext()) {
+        const auto result = reader.ReadMessage();
+        ASSERT_TRUE(result.has_value());
+        const auto* ground_truth = dynamic_cast<const osi3::GroundTruth*>(result->message.get());
+        ASSERT_NE(ground_truth, nullptr);
+        EXPECT_EQ(ground_truth->timestamp().seconds(), second);
+        ++second;
+    }
+    EXPECT_EQ(second, 50);
+}
+
+INSTANTIATE_TEST_SUITE_P(Backends, BlockFileIoTest, ::testing::Values(IoBackend::kStream, IoBackend::kPread, IoBackend::kIoUring), [](const auto& info) {
+    switch (info.param) {
+        case IoBackend::kPread:
+            return std::string("Pread");
+        case IoBackend::kIoUring:
+            return std::string("IoUring");
+        default:
+            return std::string("Stream");
+    }
+});
+
+TEST_P(BlockFileIoTest, PeriodicSyncAdvancesDurableSize) {
+    auto options = Options();
+    options.sync_interval_bytes = 2500;
+    const auto content = MakePattern(10'000);
+
+    BlockFileWriter writer;
+    ASSERT_TRUE(writer.Open(test_file_, options));
+    uint64_t durable_size = 0;
+    for (size_t offset = 0; offset < content.size(); offset += 500) {
+        ASSERT_TRUE(writer.Write(content.data() + offset, 500));
+        // synchronizations complete in the background, the durable size only grows up to the written size
+        EXPECT_GE(writer.DurableSize(), durable_size);
+        EXPECT_LE(writer.DurableSize(), offset + 500);
+        durable_size = writer.DurableSize();
+    }
+    ASSERT_TRUE(writer.Sync());
+    EXPECT_EQ(writer.DurableSize(), content.size());
+    EXPECT_TRUE(writer.Close());
+
+    EXPECT_EQ(ReadFile(test_file_), content);
+}
+
+TEST_P(BlockFileIoTest, TimedSyncKeepsPartialBlockBuffered) {
+    auto options = Options();
+    options.sync_interval = std::chrono::milliseconds(1);
+    const auto content = MakePattern(1600);
+
+    BlockFileWriter writer;
+    ASSERT_TRUE(writer.Open(test_file_, options));
+    if (writer.Backend() == IoBackend::kStream) {
+        GTEST_SKIP() << "file streams buffer independently of the blocks";
+    }
+    ASSERT_TRUE(writer.Write(content.data(), 100));
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    ASSERT_TRUE(writer.Write(content.data() + 100, 200));
+    // no whole block yet, the timed synchronization must not write the partially filled block
+    EXPECT_EQ(std::filesystem::file_size(test_file_), 0U);
+    ASSERT_TRUE(writer.Write(content.data() + 300, 1200));
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    ASSERT_TRUE(writer.Write(content.data() + 1500, 100));
+    EXPECT_TRUE(writer.Close());
+    EXPECT_EQ(writer.DurableSize(), content.size());
+
+    EXPECT_EQ(ReadFile(test_file_), content);
+}
+
+TEST_P(BlockFileIoTest, FlushRewritesPartialBlockInPlace) {
+    auto options = Options();
+    options.sync_interval_bytes = 1U << 20U;
+    const auto content = MakePattern(2500);
+
+    BlockFileWriter writer;
+    ASSERT_TRUE(writer.Open(test_file_, options));
+    ASSERT_TRUE(writer.Write(content.data(), 300));
+    ASSERT_TRUE(writer.Flush());
+    EXPECT_EQ(std::filesystem::file_size(test_file_), 300U);
+    ASSERT_TRUE(writer.Write(content.data() + 300, 900));
+    ASSERT_TRUE(writer.Sync());
+    EXPECT_EQ(writer.DurableSize(), 1200U);
+    EXPECT_EQ(std::filesystem::file_size(test_file_), 1200U);
+    ASSERT_TRUE(writer.Write(content.data() + 1200, 1300));
+    EXPECT_TRUE(writer.Close());
+
+    EXPECT_EQ(ReadFile(test_file_), content);
+}
+
+TEST_P(BlockFileIoTest, PreallocationKeepsFileSize) {
+    auto options = Options();
+    options.preallocate_size = 1U << 20U;
+    const auto content = MakePattern(1500);
+
+    BlockFileWriter writer;
+    ASSERT_TRUE(writer.Open(test_file_, options));
+    ASSERT_TRUE(writer.Write(content.data(), content.size()));
+    EXPECT_TRUE(writer.Close());
+
+    EXPECT_EQ(std::filesystem::file_size(test_file_), content.size());
+    EXPECT_EQ(ReadFile(test_file_), content);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST(BlockFileIoBackendTest, DurabilityOptionsReplaceStreams) {
+    const auto path = osi3::testing::MakeTempPath("block_io_gt", osi3::testing::FileExtensions::kOsi);
+    IoOptions options;
+    options.sync_interval_bytes = 1U << 20U;
+    BlockFileWriter writer;
+    ASSERT_TRUE(writer.Open(path, options));
+    EXPECT_EQ(writer.Backend(), IoBackend::kPread);
+    ASSERT_TRUE(writer.Write("osi", 3));
+    EXPECT_TRUE(writer.Close());
+    EXPECT_EQ(writer.DurableSize(), 3U);
+    osi3::testing::SafeRemoveTestFile(path);
+}
+#endif
+
+TEST(BlockFileIoBackendTest, FallsBackWhenIoUringIsUnavailable) {
+    const auto path = osi3::testing::MakeTempPath("block_io_gt", osi3::testing::FileExtensions::kOsi);
+    IoOptions options;
+    options.backend = IoBackend::kIoUring;
+    BlockFileWriter writer;
+    ASSERT_TRUE(writer.Open(path, options));
+    EXPECT_EQ(writer.Backend() == IoBackend::kIoUring, osi3::tracefile::IsIoUringAvailable());
+    EXPECT_TRUE(writer.Close());
+    osi3::testing::SafeRemoveTestFile(path);
+}
+
+}  // namespace
@@ -0,0 +1,163 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/CApi.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "../TestUtilities.h"
+#include "osi_groundtruth.pb.h"
+
+namespace {
+
+auto SerializeGroundTruth(const int64_t seconds) -> std::string {
+    osi3::GroundTruth ground_truth;
+    ground_truth.mutable_timestamp()->set_seconds(seconds);
+    ground_truth.add_moving_object()->mutable_id()->set_value(static_cast<uint64_t>(seconds));
+    return ground_truth.SerializeAsString();
+}
+
+auto AsBytes(const std::string& data) -> const uint8_t* { return reinterpret_cast<const uint8_t*>(data.data()); }
+
+class CApiTest : public ::testing::Test {
+   protected:
+    std::filesystem::path test_file_;
+
+    void TearDown() override { osi3::testing::SafeRemoveTestFile(test_file_); }
+
+    void WriteFrames(const char* topic, const int64_t count) {
+        osiu_writer* writer = nullptr;
+        ASSERT_EQ(osiu_writer_open(test_file_.string().c_str(), &writer), OSIU_OK) << osiu_last_error();
+        for (int64_t second = 1; second <= count; ++second) {
+            const auto frame = SerializeGroundTruth(second);
+            ASSERT_EQ(osiu_writer_write(writer, AsBytes(frame), frame.size(), OSIU_MESSAGE_TYPE_GROUND_TRUTH, topic), OSIU_OK) << osiu_last_error();
+        }
+        ASSERT_EQ(osiu_writer_close(writer), OSIU_OK) << osiu_last_error();
+    }
+};
+
+TEST(CApiVersionTest, MatchesHeader) { EXPECT_EQ(osiu_api_version(), static_cast<uint32_t>(OSIU_C_API_VERSION)); }
+
+TEST_F(CApiTest, BinaryRoundTripWithoutCopies) {
+    test_file_ = osi3::testing::MakeTempPath("capi_gt", osi3::testing::FileExtensions::kOsi);
+    WriteFrames(nullptr, 3);
+
+    osiu_reader* reader = nullptr;
+    ASSERT_EQ(osiu_reader_open(test_file_.string().c_str(), OSIU_MESSAGE_TYPE_UNKNOWN, &reader), OSIU_OK) << osiu_last_error();
+    osiu_frame frame{};
+    int64_t second = 0;
+    while (osiu_reader_next(reader, &frame) == OSIU_OK) {
+        ++second;
+        EXPECT_EQ(frame.status, OSIU_FRAME_OK);
+        EXPECT_EQ(frame.message_type, OSIU_MESSAGE_TYPE_GROUND_TRUTH);
+        EXPECT_EQ(frame.log_time, static_cast<uint64_t>(second) * 1000000000U);
+        EXPECT_STREQ(frame.topic, "");
+        EXPECT_EQ(std::string(reinterpret_cast<const char*>(frame.data), frame.size), SerializeGroundTruth(second));
+    }
+    EXPECT_EQ(second, 3);
+    EXPECT_EQ(osiu_reader_next(reader, &frame), OSIU_END_OF_TRACE);
+    osiu_reader_close(reader);
+}
+
+TEST_F(CApiTest, McapRoundTripWithTopics) {
+    test_file_ = osi3::testing::MakeTempPath("capi", osi3::testing::FileExtensions::kMcap);
+    {
+        osiu_writer* writer = nullptr;
+        ASSERT_EQ(osiu_writer_open(test_file_.string().c_str(), &writer), OSIU_OK) << osiu_last_error();
+        const char* keys[] = {"description"};
+        const char* values[] = {"C API test"};
+        EXPECT_EQ(osiu_writer_add_file_metadata(writer, "test", keys, values, 1), OSIU_OK);
+        EXPECT_EQ(osiu_writer_add_channel(writer, "gt_a", OSIU_MESSAGE_TYPE_GROUND_TRUTH), OSIU_OK);
+        EXPECT_EQ(osiu_writer_add_channel(writer, "gt_a", OSIU_MESSAGE_TYPE_SENSOR_DATA), OSIU_ERROR_INVALID_ARGUMENT);
+        const auto frame_a = SerializeGroundTruth(1);
+        const auto frame_b = SerializeGroundTruth(2);
+        EXPECT_EQ(osiu_writer_write(writer, AsBytes(frame_a), frame_a.size(), OSIU_MESSAGE_TYPE_GROUND_TRUTH, "gt_a"), OSIU_OK) << osiu_last_error();
+        EXPECT_EQ(osiu_writer_write(writer, AsBytes(frame_b), frame_b.size(), OSIU_MESSAGE_TYPE_GROUND_TRUTH, "gt_b"), OSIU_OK) << osiu_last_error();
+        EXPECT_EQ(osiu_writer_write(writer, AsBytes(frame_b), frame_b.size(), OSIU_MESSAGE_TYPE_GROUND_TRUTH, nullptr), OSIU_ERROR_WRITE);
+        EXPECT_EQ(osiu_writer_close(writer), OSIU_OK);
+    }
+
+    osiu_reader* reader = nullptr;
+    ASSERT_EQ(osiu_reader_open(test_file_.string().c_str(), OSIU_MESSAGE_TYPE_UNKNOWN, &reader), OSIU_OK) << osiu_last_error();
+    const char* topics[] = {"gt_b"};
+    ASSERT_EQ(osiu_reader_set_topics(reader, topics, 1), OSIU_OK);
+    osiu_frame frame{};
+    ASSERT_EQ(osiu_reader_next(reader, &frame), OSIU_OK) << osiu_last_error();
+    EXPECT_STREQ(frame.topic, "gt_b");
+    EXPECT_EQ(frame.log_time, 2000000000U);
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(frame.data), frame.size), SerializeGroundTruth(2));
+    EXPECT_EQ(osiu_reader_next(reader, &frame), OSIU_END_OF_TRACE);
+    osiu_reader_close(reader);
+}
+
+TEST_F(CApiTest, CloseReportsFailedFlush) {
+    if (!std::filesystem::exists("/dev/full")) {
+        GTEST_SKIP() << "/dev/full is not available";
+    }
+    test_file_ = osi3::testing::MakeTempPath("capi_full", osi3::testing::FileExtensions::kOsi);
+    std::filesystem::create_symlink("/dev/full", test_file_);
+    osiu_writer* writer = nullptr;
+    ASSERT_EQ(osiu_writer_open(test_file_.string().c_str(), &writer), OSIU_OK) << osiu_last_error();
+    const auto frame = SerializeGroundTruth(1);
+    ASSERT_EQ(osiu_writer_write(writer, AsBytes(frame), frame.size(), OSIU_MESSAGE_TYPE_GROUND_TRUTH, nullptr), OSIU_OK);
+    EXPECT_EQ(osiu_writer_close(writer), OSIU_ERROR_WRITE);
+    EXPECT_NE(std::string(osiu_last_error()).find("incomplete"), std::string::npos);
+    EXPECT_EQ(osiu_writer_close(nullptr), OSIU_OK);
+}
+
+TEST_F(CApiTest, InvalidArguments) {
+    test_file_ = osi3::testing::MakeTempPath("capi_gt", osi3::testing::FileExtensions::kOsi);
+    osiu_reader* reader = nullptr;
+    EXPECT_EQ(osiu_reader_open(nullptr, OSIU_MESSAGE_TYPE_UNKNOWN, &reader), OSIU_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(osiu_reader_open(test_file_.string().c_str(), 99, &reader), OSIU_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(osiu_reader_next(nullptr, nullptr), OSIU_ERROR_INVALID_ARGUMENT);
+    osiu_reader_close(nullptr);
+
+    osiu_writer* writer = nullptr;
+    ASSERT_EQ(osiu_writer_open(test_file_.string().c_str(), &writer), OSIU_OK);
+    const auto frame = SerializeGroundTruth(1);
+    EXPECT_EQ(osiu_writer_write(writer, AsBytes(frame), frame.size(), OSIU_MESSAGE_TYPE_UNKNOWN, nullptr), OSIU_ERROR_INVALID_ARGUMENT);
+    EXPECT_NE(std::string(osiu_last_error()).find("Unknown message type"), std::string::npos);
+    EXPECT_EQ(osiu_writer_add_channel(writer, "gt", OSIU_MESSAGE_TYPE_GROUND_TRUTH), OSIU_ERROR_INVALID_ARGUMENT);
+    osiu_writer_close(writer);
+
+    ASSERT_EQ(osiu_reader_open(test_file_.string().c_str(), OSIU_MESSAGE_TYPE_GROUND_TRUTH, &reader), OSIU_OK);
+    const char* topics[] = {"gt"};
+    EXPECT_EQ(osiu_reader_set_topics(reader, topics, 1), OSIU_ERROR_INVALID_ARGUMENT);
+    osiu_reader_close(reader);
+}
+
+TEST_F(CApiTest, OpenErrors) {
+    osiu_reader* reader = nullptr;
+    EXPECT_EQ(osiu_reader_open("missing_gt_.osi", OSIU_MESSAGE_TYPE_UNKNOWN, &reader), OSIU_ERROR_OPEN);
+    EXPECT_EQ(reader, nullptr);
+    EXPECT_NE(std::string(osiu_last_error()), "");
+
+    osiu_writer* writer = nullptr;
+    EXPECT_EQ(osiu_writer_open("trace.unsupported", &writer), OSIU_ERROR_OPEN);
+    EXPECT_EQ(writer, nullptr);
+}
+
+TEST_F(CApiTest, CorruptFrameIsReadError) {
+    test_file_ = osi3::testing::MakeTempPath("capi_gt", osi3::testing::FileExtensions::kOsi);
+    {
+        std::ofstream file(test_file_, std::ios::binary);
+        const uint32_t size = 100;
+        file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        file.write("abc", 3);
+    }
+
+    osiu_reader* reader = nullptr;
+    ASSERT_EQ(osiu_reader_open(test_file_.string().c_str(), OSIU_MESSAGE_TYPE_GROUND_TRUTH, &reader), OSIU_OK);
+    osiu_frame frame{};
+    EXPECT_EQ(osiu_reader_next(reader, &frame), OSIU_ERROR_READ);
+    osiu_reader_close(reader);
+}
+
+}  // namespace
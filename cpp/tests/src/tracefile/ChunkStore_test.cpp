@@ -0,0 +1,243 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/ChunkStore.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../TestUtilities.h"
+#include "osi-utilities/tracefile/Reader.h"
+#include "osi-utilities/tracefile/writer/MCAPTraceFileWriter.h"
+#include "osi-utilities/tracefile/writer/SingleChannelBinaryTraceFileWriter.h"
+#include "osi_groundtruth.pb.h"
+
+namespace {
+
+constexpr int64_t kFrameCount = 200;
+
+auto ReadFile(const std::filesystem::path& path) -> std::string {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+// Writes ground truth frames, the frames from 'divergence' on differ between variants
+void WriteTrace(const std::filesystem::path& path, const int64_t divergence, const double variant) {
+    osi3::SingleChannelBinaryTraceFileWriter writer;
+    ASSERT_TRUE(writer.Open(path));
+    for (int64_t frame = 0; frame < kFrameCount; ++frame) {
+        osi3::GroundTruth ground_truth;
+        ground_truth.mutable_timestamp()->set_seconds(frame);
+        auto* object = ground_truth.add_moving_object();
+        object->mutable_id()->set_value(1);
+        object->mutable_base()->mutable_position()->set_x(static_cast<double>(frame) + (frame >= divergence ? variant : 0.0));
+        ASSERT_TRUE(writer.WriteMessage(ground_truth));
+    }
+    writer.Close();
+}
+
+class ChunkStoreTest : public ::testing::Test {
+   protected:
+    std::filesystem::path store_root_ = osi3::testing::MakeTempPath("cas_store", "dir");
+    std::filesystem::path trace_ = osi3::testing::MakeTempPath("cas_gt", osi3::testing::FileExtensions::kOsi);
+    std::filesystem::path variant_ = osi3::testing::MakeTempPath("cas_variant_gt", osi3::testing::FileExtensions::kOsi);
+    std::filesystem::path restored_ = osi3::testing::MakeTempPath("cas_restored_gt", osi3::testing::FileExtensions::kOsi);
+    std::vector<std::filesystem::path> manifests_;
+
+    void TearDown() override {
+        for (const auto& path : manifests_) {
+            osi3::testing::SafeRemoveTestFile(path);
+        }
+        osi3::testing::SafeRemoveTestFile(trace_);
+        osi3::testing::SafeRemoveTestFile(variant_);
+        osi3::testing::SafeRemoveTestFile(restored_);
+        std::filesystem::remove_all(store_root_);
+    }
+
+    auto Store(const std::filesystem::path& trace, osi3::tracefile::ChunkStore& store, const osi3::tracefile::ChunkStoreOptions& options = {})
+        -> osi3::tracefile::ChunkStoreResult {
+        auto result = osi3::tracefile::StoreTraceFile(trace, store, {}, options);
+        manifests_.push_back(result.manifest_path);
+        return result;
+    }
+};
+
+}  // namespace
+
+TEST_F(ChunkStoreTest, PutStoresIdenticalBlocksOnce) {
+    osi3::tracefile::ChunkStore store(store_root_);
+    std::string key;
+    EXPECT_TRUE(store.Put("static content", key));
+    std::string second_key;
+    EXPECT_FALSE(store.Put("static content", second_key));
+    EXPECT_EQ(key, second_key);
+    EXPECT_EQ(key.size(), 32U);
+    EXPECT_TRUE(store.Contains(key));
+    EXPECT_FALSE(store.Contains(osi3::tracefile::ChunkStore::ComputeKey("other content")));
+
+    std::string block;
+    store.Get(key, block);
+    EXPECT_EQ(block, "static content");
+
+    std::ofstream(store.GetBlockPath(key), std::ios::binary | std::ios::trunc) << "tampered";
+    EXPECT_THROW(store.Get(key, block), std::runtime_error);
+    EXPECT_THROW(store.GetBlockPath("../escape"), std::runtime_error);
+}
+
+TEST_F(ChunkStoreTest, RestoreIsByteIdentical) {
+    WriteTrace(trace_, kFrameCount, 0.0);
+    osi3::tracefile::ChunkStore store(store_root_);
+    const auto result = Store(trace_, store);
+    EXPECT_EQ(result.manifest_path, std::filesystem::path(trace_.string() + ".manifest"));
+    EXPECT_EQ(result.total_size, std::filesystem::file_size(trace_));
+    EXPECT_EQ(result.added_size, result.total_size);
+    EXPECT_GT(result.block_count, 0U);
+
+    const auto manifest = osi3::tracefile::ReadChunkManifest(result.manifest_path);
+    EXPECT_EQ(manifest.entries.size(), result.block_count);
+    EXPECT_TRUE(std::filesystem::equivalent(manifest.store_root, store_root_));
+
+    osi3::tracefile::RestoreTraceFile(result.manifest_path, restored_);
+    EXPECT_EQ(ReadFile(restored_), ReadFile(trace_));
+}
+
+TEST_F(ChunkStoreTest, SharedPrefixIsStoredOnce) {
+    WriteTrace(trace_, 150, 0.5);
+    WriteTrace(variant_, 150, 0.25);
+    osi3::tracefile::ChunkStoreOptions options;
+    options.average_block_frames = 8;
+    osi3::tracefile::ChunkStore store(store_root_);
+
+    const auto first = Store(trace_, store, options);
+    const auto second = Store(variant_, store, options);
+    EXPECT_EQ(first.added_size, first.total_size);
+    EXPECT_LT(second.added_size, second.total_size / 2);
+    EXPECT_GT(second.added_block_count, 0U);
+    EXPECT_LT(second.added_block_count, second.block_count);
+}
+
+TEST_F(ChunkStoreTest, ReadManifestThroughFactory) {
+    WriteTrace(trace_, kFrameCount, 0.0);
+    osi3::tracefile::ChunkStore store(store_root_);
+    const auto result = Store(trace_, store);
+
+    // the message type is inferred from the name of the stored file
+    auto reader = osi3::TraceFileReaderFactory::openReader(result.manifest_path);
+    int64_t frames = 0;
+    while (reader->HasNext()) {
+        const auto message = reader->ReadMessage();
+        ASSERT_TRUE(message.has_value());
+        ASSERT_EQ(message->message_type, osi3::ReaderTopLevelMessage::kGroundTruth);
+        EXPECT_EQ(static_cast<const osi3::GroundTruth&>(*message->message).timestamp().seconds(), frames);
+        ++frames;
+    }
+    EXPECT_EQ(frames, kFrameCount);
+    reader->Close();
+}
+
+TEST_F(ChunkStoreTest, FileSourceReadsAcrossBlocks) {
+    WriteTrace(trace_, kFrameCount, 0.0);
+    osi3::tracefile::ChunkStoreOptions options;
+    options.average_block_frames = 4;
+    osi3::tracefile::ChunkStore store(store_root_);
+    const auto result = Store(trace_, store, options);
+    ASSERT_GT(result.block_count, 2U);
+
+    const auto content = ReadFile(trace_);
+    osi3::tracefile::ChunkStoreFileSource source(result.manifest_path);
+    ASSERT_EQ(source.Size(), content.size());
+    std::string read(content.size(), '\0');
+    size_t offset = 0;
+    for (const size_t piece : {size_t{1}, size_t{4095}, size_t{3}, content.size() - 4099}) {
+        source.ReadAt(read.data() + offset, offset, piece);
+        offset += piece;
+    }
+    EXPECT_EQ(read, content);
+
+    // backwards reads load earlier blocks again
+    std::string tail(100, '\0');
+    source.ReadAt(tail.data(), content.size() - tail.size(), tail.size());
+    EXPECT_EQ(tail, content.substr(content.size() - tail.size()));
+    source.ReadAt(tail.data(), 0, tail.size());
+    EXPECT_EQ(tail, content.substr(0, tail.size()));
+    EXPECT_THROW(source.ReadAt(tail.data(), content.size() - 1, 2), std::runtime_error);
+}
+
+TEST_F(ChunkStoreTest, CorruptBlockFailsWhenRead) {
+    WriteTrace(trace_, kFrameCount, 0.0);
+    osi3::tracefile::ChunkStoreOptions options;
+    options.average_block_frames = 4;
+    osi3::tracefile::ChunkStore store(store_root_);
+    const auto result = Store(trace_, store, options);
+    const auto manifest = osi3::tracefile::ReadChunkManifest(result.manifest_path);
+    ASSERT_GT(manifest.entries.size(), 2U);
+    const auto& last = manifest.entries.back();
+    std::ofstream(store.GetBlockPath(last.key), std::ios::binary | std::ios::trunc) << std::string(last.size, 'x');
+
+    // blocks are only loaded when reached, so the frames before the corrupt block are read
+    auto reader = osi3::TraceFileReaderFactory::openReader(result.manifest_path);
+    int64_t frames = 0;
+    EXPECT_THROW(
+        {
+            while (reader->HasNext() && reader->ReadMessage().has_value()) {
+                ++frames;
+            }
+        },
+        std::runtime_error);
+    EXPECT_GT(frames, 0);
+    EXPECT_LT(frames, kFrameCount);
+    reader->Close();
+}
+
+TEST_F(ChunkStoreTest, MissingBlockFailsToOpen) {
+    WriteTrace(trace_, kFrameCount, 0.0);
+    osi3::tracefile::ChunkStore store(store_root_);
+    const auto result = Store(trace_, store);
+    const auto manifest = osi3::tracefile::ReadChunkManifest(result.manifest_path);
+    std::filesystem::remove(store.GetBlockPath(manifest.entries.front().key));
+
+    EXPECT_THROW(osi3::tracefile::RestoreTraceFile(result.manifest_path, restored_), std::runtime_error);
+    EXPECT_THROW(osi3::TraceFileReaderFactory::openReader(result.manifest_path), std::runtime_error);
+}
+
+TEST_F(ChunkStoreTest, StoreMcapTrace) {
+    const auto mcap_trace = osi3::testing::MakeTempPath("cas", osi3::testing::FileExtensions::kMcap);
+    {
+        osi3::MCAPTraceFileWriter writer;
+        ASSERT_TRUE(writer.Open(mcap_trace));
+        writer.AddFileMetadata(osi3::MCAPTraceFileWriter::PrepareRequiredFileMetadata());
+        writer.AddChannel("gt", osi3::GroundTruth::descriptor());
+        osi3::GroundTruth ground_truth;
+        for (int64_t second = 0; second < 10; ++second) {
+            ground_truth.mutable_timestamp()->set_seconds(second);
+            ASSERT_TRUE(writer.WriteMessage(ground_truth, "gt"));
+        }
+        writer.Close();
+    }
+    osi3::tracefile::ChunkStore store(store_root_);
+    const auto result = Store(mcap_trace, store);
+    EXPECT_EQ(result.total_size, std::filesystem::file_size(mcap_trace));
+
+    const auto restored_mcap = osi3::testing::MakeTempPath("cas_restored", osi3::testing::FileExtensions::kMcap);
+    osi3::tracefile::RestoreTraceFile(result.manifest_path, restored_mcap);
+    EXPECT_EQ(ReadFile(restored_mcap), ReadFile(mcap_trace));
+    osi3::testing::SafeRemoveTestFile(mcap_trace);
+    osi3::testing::SafeRemoveTestFile(restored_mcap);
+}
+
+TEST_F(ChunkStoreTest, RejectsUnsupportedInput) {
+    osi3::tracefile::ChunkStore store(store_root_);
+    EXPECT_THROW(osi3::tracefile::StoreTraceFile("trace.txth", store), std::invalid_argument);
+    WriteTrace(trace_, kFrameCount, 0.0);
+    osi3::tracefile::ChunkStoreOptions options;
+    options.average_block_frames = 3;
+    EXPECT_THROW(osi3::tracefile::StoreTraceFile(trace_, store, {}, options), std::invalid_argument);
+}
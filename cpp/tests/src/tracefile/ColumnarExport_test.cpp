@@ -0,0 +1,155 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/ColumnarExport.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "../TestUtilities.h"
+#include "osi-utilities/tracefile/reader/MCAPTraceFileReader.h"
+#include "osi-utilities/tracefile/reader/SingleChannelBinaryTraceFileReader.h"
+#include "osi-utilities/tracefile/writer/MCAPTraceFileWriter.h"
+#include "osi-utilities/tracefile/writer/SingleChannelBinaryTraceFileWriter.h"
+#include "osi_groundtruth.pb.h"
+#include "osi_sensordata.pb.h"
+
+namespace {
+
+auto MakeGroundTruth(const int64_t seconds, const size_t object_count) -> osi3::GroundTruth {
+    osi3::GroundTruth gt;
+    gt.mutable_timestamp()->set_seconds(seconds);
+    for (size_t i = 0; i < object_count; ++i) {
+        auto* moving_object = gt.add_moving_object();
+        moving_object->mutable_id()->set_value(i + 1);
+        auto* base = moving_object->mutable_base();
+        base->mutable_position()->set_x(static_cast<double>(seconds));
+        base->mutable_position()->set_y(static_cast<double>(i));
+        base->mutable_position()->set_z(0.5);
+        base->mutable_orientation()->set_yaw(0.1);
+        base->mutable_dimension()->set_length(4.5);
+    }
+    return gt;
+}
+
+TEST(ColumnarExportTest, AppendMovingObjects) {
+    osi3::tracefile::MovingObjectColumns columns;
+    osi3::tracefile::AppendMovingObjects(MakeGroundTruth(3, 2), 7, 3000000000, columns);
+
+    ASSERT_EQ(columns.Size(), 2U);
+    EXPECT_EQ(columns.frame_index[1], 7U);
+    EXPECT_EQ(columns.timestamp[1], 3000000000U);
+    EXPECT_EQ(columns.id[0], 1U);
+    EXPECT_EQ(columns.id[1], 2U);
+    EXPECT_DOUBLE_EQ(columns.position_x[1], 3.0);
+    EXPECT_DOUBLE_EQ(columns.position_y[1], 1.0);
+    EXPECT_DOUBLE_EQ(columns.orientation_yaw[0], 0.1);
+    EXPECT_DOUBLE_EQ(columns.dimension_length[0], 4.5);
+    // Unset sub-messages are NaN
+    EXPECT_TRUE(std::isnan(columns.velocity_x[0]));
+    EXPECT_EQ(columns.velocity_x.size(), columns.Size());
+    EXPECT_EQ(columns.dimension_height.size(), columns.Size());
+}
+
+TEST(ColumnarExportTest, AppendDetectedObjects) {
+    osi3::SensorData sensor_data;
+    auto* tracked = sensor_data.add_moving_object();
+    tracked->mutable_header()->add_tracking_id()->set_value(42);
+    tracked->mutable_header()->set_existence_probability(0.9);
+    tracked->mutable_base()->mutable_position()->set_x(10.0);
+    tracked->mutable_base()->mutable_velocity()->set_x(2.0);
+    sensor_data.add_moving_object();
+
+    osi3::tracefile::DetectedObjectColumns columns;
+    osi3::tracefile::AppendDetectedObjects(sensor_data, 0, 0, columns);
+
+    ASSERT_EQ(columns.Size(), 2U);
+    EXPECT_EQ(columns.id[0], 42U);
+    EXPECT_DOUBLE_EQ(columns.existence_probability[0], 0.9);
+    EXPECT_DOUBLE_EQ(columns.position_x[0], 10.0);
+    EXPECT_DOUBLE_EQ(columns.velocity_x[0], 2.0);
+    EXPECT_EQ(columns.id[1], 0U);
+    EXPECT_TRUE(std::isnan(columns.existence_probability[1]));
+    EXPECT_TRUE(std::isnan(columns.position_x[1]));
+}
+
+class ColumnarExportTraceTest : public ::testing::Test {
+   protected:
+    std::filesystem::path test_file_;
+
+    void TearDown() override { osi3::testing::SafeRemoveTestFile(test_file_); }
+};
+
+TEST_F(ColumnarExportTraceTest, ExtractMovingObjectsFromBinaryTrace) {
+    test_file_ = osi3::testing::MakeTempPath("gt", osi3::testing::FileExtensions::kOsi);
+    osi3::SingleChannelBinaryTraceFileWriter writer;
+    ASSERT_TRUE(writer.Open(test_file_));
+    for (int64_t second = 0; second < 4; ++second) {
+        ASSERT_TRUE(writer.WriteMessage(MakeGroundTruth(second, static_cast<size_t>(second))));
+    }
+    writer.Close();
+
+    osi3::SingleChannelBinaryTraceFileReader reader;
+    ASSERT_TRUE(reader.Open(test_file_));
+    const auto columns = osi3::tracefile::ExtractMovingObjects(reader);
+
+    // 0 + 1 + 2 + 3 objects
+    ASSERT_EQ(columns.Size(), 6U);
+    EXPECT_EQ(columns.frame_index.front(), 1U);
+    EXPECT_EQ(columns.frame_index.back(), 3U);
+    EXPECT_EQ(columns.timestamp.back(), 3000000000U);
+    EXPECT_DOUBLE_EQ(columns.position_x.back(), 3.0);
+}
+
+TEST_F(ColumnarExportTraceTest, ExtractSkipsOtherMessageTypes) {
+    test_file_ = osi3::testing::MakeTempPath("gt", osi3::testing::FileExtensions::kOsi);
+    osi3::SingleChannelBinaryTraceFileWriter writer;
+    ASSERT_TRUE(writer.Open(test_file_));
+    ASSERT_TRUE(writer.WriteMessage(MakeGroundTruth(0, 2)));
+    writer.Close();
+
+    osi3::SingleChannelBinaryTraceFileReader reader;
+    ASSERT_TRUE(reader.Open(test_file_));
+    EXPECT_EQ(osi3::tracefile::ExtractDetectedObjects(reader).Size(), 0U);
+}
+
+TEST_F(ColumnarExportTraceTest, ExtractFromMcapRespectsTopicFilter) {
+    test_file_ = osi3::testing::MakeTempPath("columnar", osi3::testing::FileExtensions::kMcap);
+    osi3::MCAPTraceFileWriter writer;
+    ASSERT_TRUE(writer.Open(test_file_));
+    ASSERT_TRUE(writer.AddFileMetadata(osi3::MCAPTraceFileWriter::PrepareRequiredFileMetadata()));
+    writer.AddChannel("gt_a", osi3::GroundTruth::descriptor());
+    writer.AddChannel("gt_b", osi3::GroundTruth::descriptor());
+    ASSERT_TRUE(writer.WriteMessage(MakeGroundTruth(1, 1), "gt_a"));
+    ASSERT_TRUE(writer.WriteMessage(MakeGroundTruth(1, 3), "gt_b"));
+    writer.Close();
+
+    osi3::MCAPTraceFileReader reader;
+    ASSERT_TRUE(reader.Open(test_file_));
+    reader.SetTopics({"gt_b"});
+    EXPECT_EQ(osi3::tracefile::ExtractMovingObjects(reader).Size(), 3U);
+}
+
+TEST_F(ColumnarExportTraceTest, UnparseableFrameThrows) {
+    test_file_ = osi3::testing::MakeTempPath("gt", osi3::testing::FileExtensions::kOsi);
+    {
+        std::ofstream file(test_file_, std::ios::binary);
+        const std::string invalid = "\xFF\xFF\xFF";
+        const auto size = static_cast<uint32_t>(invalid.size());
+        file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        file.write(invalid.data(), size);
+    }
+
+    osi3::SingleChannelBinaryTraceFileReader reader;
+    ASSERT_TRUE(reader.Open(test_file_));
+    EXPECT_THROW(osi3::tracefile::ExtractMovingObjects(reader), std::runtime_error);
+}
+
+}  // namespace
@@ -0,0 +1,160 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/FieldPath.h"
+
+#include <google/protobuf/descriptor.pb.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "osi_groundtruth.pb.h"
+#include "osi_sensordata.pb.h"
+
+namespace {
+
+using osi3::tracefile::CompiledFieldPath;
+using osi3::tracefile::FieldValueType;
+
+auto MakeGroundTruth() -> osi3::GroundTruth {
+    osi3::GroundTruth ground_truth;
+    ground_truth.mutable_timestamp()->set_seconds(4);
+    ground_truth.mutable_timestamp()->set_nanos(500);
+    ground_truth.mutable_host_vehicle_id()->set_value(100);
+    for (int i = 0; i < 3; ++i) {
+        auto* moving_object = ground_truth.add_moving_object();
+        moving_object->mutable_id()->set_value(100 + i);
+        moving_object->set_type(osi3::MovingObject::TYPE_VEHICLE);
+        moving_object->mutable_base()->mutable_position()->set_x(10.5 * i);
+    }
+    // the position of the last object is not set
+    ground_truth.mutable_moving_object(2)->mutable_base()->clear_position();
+    return ground_truth;
+}
+
+TEST(FieldPathTest, ExtractsSingularAndRepeatedFields) {
+    const auto ground_truth = MakeGroundTruth();
+
+    const CompiledFieldPath host_id(osi3::GroundTruth::descriptor(), "host_vehicle_id.value");
+    EXPECT_EQ(host_id.GetValueType(), FieldValueType::kUInt64);
+    std::vector<uint64_t> ids;
+    EXPECT_EQ(host_id.Extract(ground_truth, ids), 1U);
+    EXPECT_EQ(ids, std::vector<uint64_t>({100}));
+
+    const CompiledFieldPath position_x(osi3::GroundTruth::descriptor(), "moving_object[*].base.position.x");
+    EXPECT_EQ(position_x.GetValueType(), FieldValueType::kDouble);
+    std::vector<double> positions;
+    EXPECT_EQ(position_x.Extract(ground_truth, positions), 3U);
+    EXPECT_EQ(positions, std::vector<double>({0.0, 10.5, 0.0}));
+
+    const CompiledFieldPath second_type(osi3::GroundTruth::descriptor(), "moving_object[1].type");
+    EXPECT_EQ(second_type.GetValueType(), FieldValueType::kInt64);
+    std::vector<int32_t> types;
+    EXPECT_EQ(second_type.Extract(ground_truth, types), 1U);
+    EXPECT_EQ(types, std::vector<int32_t>({osi3::MovingObject::TYPE_VEHICLE}));
+
+    // buffers are appended to, missing elements yield no value
+    const CompiledFieldPath missing_element(osi3::GroundTruth::descriptor(), "moving_object[7].id.value");
+    EXPECT_EQ(missing_element.Extract(ground_truth, ids), 0U);
+    EXPECT_EQ(ids.size(), 1U);
+}
+
+TEST(FieldPathTest, SerializedExtractionMatchesReflection) {
+    const auto ground_truth = MakeGroundTruth();
+    const auto serialized = ground_truth.SerializeAsString();
+    for (const auto* expression : {"timestamp.seconds", "timestamp.nanos", "host_vehicle_id.value", "moving_object[*].id.value", "moving_object[*].base.position.x",
+                                   "moving_object[2].type", "moving_object[5].type", "stationary_object[*].id.value", "country_code"}) {
+        SCOPED_TRACE(expression);
+        const CompiledFieldPath path(osi3::GroundTruth::descriptor(), expression);
+        std::vector<double> from_message;
+        std::vector<double> from_bytes;
+        path.Extract(ground_truth, from_message);
+        EXPECT_TRUE(path.ExtractSerialized(serialized, from_bytes));
+        EXPECT_EQ(from_bytes, from_message);
+    }
+}
+
+TEST(FieldPathTest, SerializedExtractionMergesRepeatedOccurrences) {
+    // concatenated messages parse as their merge: the second timestamp only sets nanos, the host vehicle id is replaced
+    osi3::GroundTruth first;
+    first.mutable_timestamp()->set_seconds(4);
+    first.mutable_timestamp()->set_nanos(500);
+    first.mutable_host_vehicle_id()->set_value(100);
+    first.add_moving_object()->mutable_id()->set_value(1);
+    osi3::GroundTruth second;
+    second.mutable_timestamp()->set_nanos(7);
+    second.mutable_host_vehicle_id()->set_value(200);
+    second.add_moving_object()->mutable_id()->set_value(2);
+    const auto serialized = first.SerializeAsString() + second.SerializeAsString();
+    osi3::GroundTruth merged;
+    ASSERT_TRUE(merged.ParseFromString(serialized));
+
+    for (const auto* expression : {"timestamp.seconds", "timestamp.nanos", "host_vehicle_id.value", "moving_object[*].id.value"}) {
+        SCOPED_TRACE(expression);
+        const CompiledFieldPath path(osi3::GroundTruth::descriptor(), expression);
+        std::vector<double> from_message;
+        std::vector<double> from_bytes;
+        path.Extract(merged, from_message);
+        EXPECT_TRUE(path.ExtractSerialized(serialized, from_bytes));
+        EXPECT_EQ(from_bytes, from_message);
+    }
+    const CompiledFieldPath seconds(osi3::GroundTruth::descriptor(), "timestamp.seconds");
+    std::vector<int64_t> values;
+    EXPECT_TRUE(seconds.ExtractSerialized(serialized, values));
+    EXPECT_EQ(values, std::vector<int64_t>({4}));
+}
+
+TEST(FieldPathTest, ExtractsPackedAndUnpackedRepeatedScalars) {
+    google::protobuf::SourceCodeInfo source_code_info;
+    auto* location = source_code_info.add_location();
+    location->add_path(4);
+    location->add_path(-3);
+    location->add_path(7);
+    source_code_info.add_location()->add_path(9);
+    const CompiledFieldPath packed(google::protobuf::SourceCodeInfo::descriptor(), "location[*].path[*]");
+    std::vector<int64_t> from_message;
+    std::vector<int64_t> from_bytes;
+    packed.Extract(source_code_info, from_message);
+    EXPECT_TRUE(packed.ExtractSerialized(source_code_info.SerializeAsString(), from_bytes));
+    EXPECT_EQ(from_message, std::vector<int64_t>({4, -3, 7, 9}));
+    EXPECT_EQ(from_bytes, from_message);
+
+    google::protobuf::FileDescriptorProto file;
+    file.add_public_dependency(2);
+    file.add_public_dependency(5);
+    const CompiledFieldPath unpacked(google::protobuf::FileDescriptorProto::descriptor(), "public_dependency[1]");
+    std::vector<uint32_t> dependencies;
+    EXPECT_TRUE(unpacked.ExtractSerialized(file.SerializeAsString(), dependencies));
+    EXPECT_EQ(dependencies, std::vector<uint32_t>({5}));
+}
+
+TEST(FieldPathTest, RejectsInvalidExpressions) {
+    const auto* descriptor = osi3::GroundTruth::descriptor();
+    for (const auto* expression : {"", "moving_object.id.value", "host_vehicle_id[0].value", "moving_object[*].unknown", "moving_object[*].base", "moving_object[-1].id.value",
+                                   "moving_object[x].id.value", "moving_object[*.id.value", "host_vehicle_id.value.x", "model_reference"}) {
+        SCOPED_TRACE(expression);
+        EXPECT_THROW(CompiledFieldPath(descriptor, expression), std::runtime_error);
+    }
+    EXPECT_THROW(CompiledFieldPath(nullptr, "timestamp.seconds"), std::runtime_error);
+}
+
+TEST(FieldPathTest, RejectsOtherMessageTypes) {
+    const CompiledFieldPath path(osi3::GroundTruth::descriptor(), "timestamp.seconds");
+    std::vector<double> values;
+    EXPECT_THROW(path.Extract(osi3::SensorData(), values), std::runtime_error);
+}
+
+TEST(FieldPathTest, ReportsMalformedBytes) {
+    auto serialized = MakeGroundTruth().SerializeAsString();
+    serialized.resize(serialized.size() - 3);
+    const CompiledFieldPath path(osi3::GroundTruth::descriptor(), "moving_object[*].id.value");
+    std::vector<uint64_t> values;
+    EXPECT_FALSE(path.ExtractSerialized(serialized, values));
+}
+
+}  // namespace
@@ -0,0 +1,173 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/FlatViews.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <type_traits>
+
+#include "osi_groundtruth.pb.h"
+#include "osi_sensordata.pb.h"
+
+namespace {
+
+void SetBaseMoving(osi3::BaseMoving& base, const double offset) {
+    base.mutable_dimension()->set_length(4.5 + offset);
+    base.mutable_dimension()->set_width(1.8);
+    base.mutable_position()->set_x(10.0 + offset);
+    base.mutable_position()->set_y(-2.0);
+    base.mutable_orientation()->set_yaw(0.25);
+    base.mutable_velocity()->set_x(13.5 + offset);
+    base.mutable_acceleration()->set_z(-0.5);
+    base.mutable_orientation_rate()->set_yaw(0.1);
+    base.add_base_polygon()->set_x(1.0);
+}
+
+auto MakeGroundTruth() -> osi3::GroundTruth {
+    osi3::GroundTruth ground_truth;
+    ground_truth.mutable_timestamp()->set_seconds(3);
+    ground_truth.add_stationary_object()->mutable_id()->set_value(99);
+    for (int i = 0; i < 3; ++i) {
+        auto* moving_object = ground_truth.add_moving_object();
+        moving_object->mutable_id()->set_value(100 + i);
+        moving_object->set_type(osi3::MovingObject::TYPE_VEHICLE);
+        moving_object->mutable_vehicle_classification()->set_type(osi3::MovingObject::VehicleClassification::TYPE_MEDIUM_CAR);
+        moving_object->set_model_reference("car.fbx");
+        SetBaseMoving(*moving_object->mutable_base(), i);
+    }
+    ground_truth.mutable_host_vehicle_id()->set_value(100);
+    return ground_truth;
+}
+
+TEST(FlatViewsTest, ViewsArePlainData) {
+    EXPECT_TRUE(std::is_trivially_copyable_v<osi3::tracefile::MovingObjectView>);
+    EXPECT_TRUE(std::is_trivially_copyable_v<osi3::tracefile::DetectedMovingObjectView>);
+    EXPECT_TRUE(std::is_trivially_destructible_v<osi3::tracefile::BaseMovingView>);
+}
+
+TEST(FlatViewsTest, ScansMovingObjectsOfGroundTruth) {
+    const auto ground_truth = MakeGroundTruth();
+    const auto serialized = ground_truth.SerializeAsString();
+
+    osi3::tracefile::MovingObjectScanner scanner(serialized);
+    osi3::tracefile::MovingObjectView view;
+    int index = 0;
+    while (scanner.Next(view)) {
+        ASSERT_LT(index, ground_truth.moving_object_size());
+        const auto& expected = ground_truth.moving_object(index);
+        EXPECT_EQ(view.id, expected.id().value());
+        EXPECT_EQ(view.type, osi3::MovingObject::TYPE_VEHICLE);
+        EXPECT_EQ(view.vehicle_type, osi3::MovingObject::VehicleClassification::TYPE_MEDIUM_CAR);
+        EXPECT_TRUE(view.has_base);
+        EXPECT_DOUBLE_EQ(view.base.dimension.length, expected.base().dimension().length());
+        EXPECT_DOUBLE_EQ(view.base.dimension.width, 1.8);
+        EXPECT_DOUBLE_EQ(view.base.position.x, expected.base().position().x());
+        EXPECT_DOUBLE_EQ(view.base.position.y, -2.0);
+        EXPECT_DOUBLE_EQ(view.base.position.z, 0.0);
+        EXPECT_DOUBLE_EQ(view.base.orientation.yaw, 0.25);
+        EXPECT_DOUBLE_EQ(view.base.velocity.x, expected.base().velocity().x());
+        EXPECT_DOUBLE_EQ(view.base.acceleration.z, -0.5);
+        EXPECT_DOUBLE_EQ(view.base.orientation_rate.yaw, 0.1);
+
+        osi3::MovingObject reparsed;
+        ASSERT_TRUE(reparsed.ParseFromArray(view.serialized.data(), static_cast<int>(view.serialized.size())));
+        EXPECT_EQ(reparsed.model_reference(), "car.fbx");
+        ++index;
+    }
+    EXPECT_FALSE(scanner.HasError());
+    EXPECT_EQ(index, 3);
+}
+
+TEST(FlatViewsTest, MissingFieldsDecodeToDefaults) {
+    osi3::GroundTruth ground_truth;
+    ground_truth.add_moving_object()->mutable_id()->set_value(7);
+    const auto serialized = ground_truth.SerializeAsString();
+
+    osi3::tracefile::MovingObjectScanner scanner(serialized);
+    osi3::tracefile::MovingObjectView view;
+    ASSERT_TRUE(scanner.Next(view));
+    EXPECT_EQ(view.id, 7U);
+    EXPECT_EQ(view.type, 0);
+    EXPECT_FALSE(view.has_base);
+    EXPECT_DOUBLE_EQ(view.base.velocity.x, 0.0);
+    EXPECT_FALSE(scanner.Next(view));
+    EXPECT_FALSE(scanner.HasError());
+}
+
+TEST(FlatViewsTest, MergesRepeatedEmbeddedMessages) {
+    // Concatenated messages parse as a merge, so base and base.position occur twice on the wire
+    osi3::MovingObject first;
+    first.mutable_id()->set_value(1);
+    first.mutable_base()->mutable_position()->set_x(10.0);
+    first.mutable_base()->mutable_position()->set_y(20.0);
+    first.mutable_base()->mutable_dimension()->set_length(4.5);
+    osi3::MovingObject second;
+    second.mutable_base()->mutable_position()->set_y(-5.0);
+    second.mutable_base()->mutable_velocity()->set_x(3.0);
+    const auto serialized = first.SerializeAsString() + second.SerializeAsString();
+
+    osi3::MovingObject expected;
+    ASSERT_TRUE(expected.ParseFromString(serialized));
+    osi3::tracefile::MovingObjectView view;
+    ASSERT_TRUE(osi3::tracefile::DecodeMovingObject(serialized, view));
+    EXPECT_EQ(view.id, expected.id().value());
+    EXPECT_DOUBLE_EQ(view.base.position.x, expected.base().position().x());
+    EXPECT_DOUBLE_EQ(view.base.position.y, expected.base().position().y());
+    EXPECT_DOUBLE_EQ(view.base.dimension.length, expected.base().dimension().length());
+    EXPECT_DOUBLE_EQ(view.base.velocity.x, expected.base().velocity().x());
+    EXPECT_DOUBLE_EQ(view.base.position.x, 10.0);
+    EXPECT_DOUBLE_EQ(view.base.position.y, -5.0);
+}
+
+TEST(FlatViewsTest, ScansDetectedMovingObjectsOfSensorData) {
+    osi3::SensorData sensor_data;
+    sensor_data.mutable_timestamp()->set_seconds(1);
+    for (int i = 0; i < 2; ++i) {
+        auto* detected = sensor_data.add_moving_object();
+        detected->mutable_header()->add_ground_truth_id()->set_value(200 + i);
+        detected->mutable_header()->add_ground_truth_id()->set_value(300 + i);
+        detected->mutable_header()->set_existence_probability(0.75);
+        detected->mutable_header()->set_age(2.5);
+        SetBaseMoving(*detected->mutable_base(), i);
+        detected->mutable_base_rmse()->mutable_position()->set_x(0.2);
+    }
+    const auto serialized = sensor_data.SerializeAsString();
+
+    osi3::tracefile::DetectedMovingObjectScanner scanner(serialized);
+    osi3::tracefile::DetectedMovingObjectView view;
+    int index = 0;
+    while (scanner.Next(view)) {
+        EXPECT_EQ(view.ground_truth_id, 200U + index);
+        EXPECT_DOUBLE_EQ(view.existence_probability, 0.75);
+        EXPECT_DOUBLE_EQ(view.age, 2.5);
+        EXPECT_TRUE(view.has_base);
+        EXPECT_DOUBLE_EQ(view.base.velocity.x, 13.5 + index);
+        EXPECT_DOUBLE_EQ(view.base_rmse.position.x, 0.2);
+        ++index;
+    }
+    EXPECT_FALSE(scanner.HasError());
+    EXPECT_EQ(index, 2);
+}
+
+TEST(FlatViewsTest, ReportsMalformedInput) {
+    auto serialized = MakeGroundTruth().SerializeAsString();
+    serialized.resize(serialized.size() - 5);
+
+    osi3::tracefile::MovingObjectScanner scanner(serialized);
+    osi3::tracefile::MovingObjectView view;
+    int count = 0;
+    while (scanner.Next(view)) {
+        ++count;
+    }
+    EXPECT_LT(count, 3);
+    EXPECT_TRUE(scanner.HasError());
+
+    osi3::tracefile::BaseMovingView base;
+    EXPECT_FALSE(osi3::tracefile::DecodeBaseMoving(std::string("\x12\x05\x09", 3), base));
+}
+
+}  // namespace
@@ -0,0 +1,222 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/FrameCache.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../TestUtilities.h"
+#include "osi-utilities/tracefile/writer/MCAPTraceFileWriter.h"
+#include "osi-utilities/tracefile/writer/SingleChannelBinaryTraceFileWriter.h"
+#include "osi_groundtruth.pb.h"
+#include "osi_sensorview.pb.h"
+
+namespace {
+
+constexpr int kFrameCount = 50;
+constexpr uint64_t kFrameStep = 100'000'000;  // 0.1 s
+constexpr uint64_t kFirstTime = 1'000'000'000;
+
+auto GetSeconds(const osi3::tracefile::CachedFrame& frame) -> int64_t { return static_cast<const osi3::GroundTruth&>(*frame.message).timestamp().seconds(); }
+
+auto GetNanos(const osi3::tracefile::CachedFrame& frame) -> uint32_t { return static_cast<const osi3::GroundTruth&>(*frame.message).timestamp().nanos(); }
+
+// Waits for the background threads to prefetch the given number of frames
+auto WaitForPrefetched(const osi3::tracefile::FrameCache& cache, const size_t count) -> bool {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (cache.GetStatistics().prefetched < count) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+class FrameCacheTest : public ::testing::Test {
+   protected:
+    std::filesystem::path trace_ = osi3::testing::MakeTempPath("cache_gt", osi3::testing::FileExtensions::kOsi);
+
+    void SetUp() override {
+        osi3::SingleChannelBinaryTraceFileWriter writer;
+        ASSERT_TRUE(writer.Open(trace_));
+        for (int frame = 0; frame < kFrameCount; ++frame) {
+            osi3::GroundTruth ground_truth;
+            const uint64_t time = kFirstTime + static_cast<uint64_t>(frame) * kFrameStep;
+            ground_truth.mutable_timestamp()->set_seconds(static_cast<int64_t>(time / 1'000'000'000));
+            ground_truth.mutable_timestamp()->set_nanos(static_cast<uint32_t>(time % 1'000'000'000));
+            auto* object = ground_truth.add_moving_object();
+            object->mutable_id()->set_value(1);
+            object->mutable_base()->mutable_position()->set_x(frame);
+            ASSERT_TRUE(writer.WriteMessage(ground_truth));
+        }
+        writer.Close();
+    }
+
+    void TearDown() override { osi3::testing::SafeRemoveTestFile(trace_); }
+
+    static auto WithoutPrefetch() -> osi3::tracefile::FrameCacheOptions {
+        osi3::tracefile::FrameCacheOptions options;
+        options.prefetch_count = 0;
+        return options;
+    }
+};
+
+}  // namespace
+
+TEST_F(FrameCacheTest, GetFrameByIndexAndTime) {
+    osi3::tracefile::FrameCache cache(WithoutPrefetch());
+    EXPECT_EQ(cache.GetFrameTimes(trace_, "").size(), static_cast<size_t>(kFrameCount));
+    EXPECT_TRUE(cache.GetFrameTimes(trace_, "unknown").empty());
+
+    const auto frame = cache.GetFrame(trace_, "", 12);
+    ASSERT_NE(frame, nullptr);
+    EXPECT_EQ(frame->index, 12U);
+    EXPECT_EQ(frame->log_time, kFirstTime + 12 * kFrameStep);
+    EXPECT_EQ(frame->message_type, osi3::ReaderTopLevelMessage::kGroundTruth);
+    EXPECT_EQ(GetSeconds(*frame), 2);
+    EXPECT_EQ(GetNanos(*frame), 200'000'000U);
+
+    const auto at = cache.GetFrameAt(trace_, "", kFirstTime + 12 * kFrameStep + kFrameStep / 2);
+    ASSERT_NE(at, nullptr);
+    EXPECT_EQ(at->index, 12U);
+    EXPECT_EQ(cache.GetFrameAt(trace_, "", kFirstTime - 1), nullptr);
+    EXPECT_EQ(cache.GetFrame(trace_, "", kFrameCount), nullptr);
+    EXPECT_EQ(cache.GetFrame(trace_, "unknown", 0), nullptr);
+}
+
+TEST_F(FrameCacheTest, RepeatedRequestsHit) {
+    osi3::tracefile::FrameCache cache(WithoutPrefetch());
+    const auto first = cache.GetFrame(trace_, "", 3);
+    // another view opening the file through a different path shares the frame
+    const auto second = cache.GetFrame(trace_.parent_path() / "." / trace_.filename(), "", 3);
+    EXPECT_EQ(first, second);
+
+    const auto statistics = cache.GetStatistics();
+    EXPECT_EQ(statistics.misses, 1U);
+    EXPECT_EQ(statistics.hits, 1U);
+    EXPECT_EQ(statistics.cached_frames, 1U);
+    EXPECT_EQ(statistics.memory_usage, first->memory_size);
+
+    cache.Clear();
+    EXPECT_EQ(cache.GetStatistics().cached_frames, 0U);
+    EXPECT_NE(cache.GetFrame(trace_, "", 3), first);
+}
+
+TEST_F(FrameCacheTest, MemoryBudgetEvictsLeastRecentlyUsed) {
+    size_t frame_size = 0;
+    {
+        osi3::tracefile::FrameCache probe(WithoutPrefetch());
+        frame_size = probe.GetFrame(trace_, "", 0)->memory_size;
+    }
+    auto options = WithoutPrefetch();
+    options.memory_budget = 2 * frame_size + frame_size / 2;
+    osi3::tracefile::FrameCache cache(options);
+
+    const auto frame = cache.GetFrame(trace_, "", 0);
+    cache.GetFrame(trace_, "", 1);
+    cache.GetFrame(trace_, "", 0);
+    cache.GetFrame(trace_, "", 2);  // evicts frame 1, frame 0 was used more recently
+    auto statistics = cache.GetStatistics();
+    EXPECT_EQ(statistics.evictions, 1U);
+    EXPECT_EQ(statistics.cached_frames, 2U);
+    EXPECT_LE(statistics.memory_usage, options.memory_budget);
+
+    cache.GetFrame(trace_, "", 0);
+    EXPECT_EQ(cache.GetStatistics().hits, statistics.hits + 1);
+    cache.GetFrame(trace_, "", 1);
+    EXPECT_EQ(cache.GetStatistics().misses, statistics.misses + 1);
+    // evicted frames stay valid for their users
+    EXPECT_EQ(frame->index, 0U);
+}
+
+TEST_F(FrameCacheTest, PrefetchesInScrubDirection) {
+    osi3::tracefile::FrameCacheOptions options;
+    options.prefetch_count = 4;
+    options.worker_count = 1;
+    osi3::tracefile::FrameCache cache(options);
+
+    ASSERT_NE(cache.GetFrame(trace_, "", 10), nullptr);
+    // scrubbing forwards prefetches frames 11 to 14
+    ASSERT_TRUE(WaitForPrefetched(cache, 4));
+    // scrubbing backwards prefetches frames 5 to 8
+    ASSERT_NE(cache.GetFrame(trace_, "", 9), nullptr);
+    ASSERT_TRUE(WaitForPrefetched(cache, 8));
+
+    for (size_t index = 5; index <= 14; ++index) {
+        const auto frame = cache.GetFrame(trace_, "", index);
+        ASSERT_NE(frame, nullptr);
+        EXPECT_EQ(frame->log_time, kFirstTime + index * kFrameStep);
+    }
+    EXPECT_EQ(cache.GetStatistics().misses, 2U);
+}
+
+TEST_F(FrameCacheTest, ConcurrentViewsShareFrames) {
+    osi3::tracefile::FrameCache cache;
+    std::vector<std::thread> views;
+    std::vector<std::vector<std::shared_ptr<const osi3::tracefile::CachedFrame>>> frames(4);
+    for (size_t view = 0; view < frames.size(); ++view) {
+        views.emplace_back([&, view] {
+            for (size_t index = 0; index < static_cast<size_t>(kFrameCount); ++index) {
+                frames[view].push_back(cache.GetFrame(trace_, "", index));
+            }
+        });
+    }
+    for (auto& view : views) {
+        view.join();
+    }
+    for (size_t index = 0; index < static_cast<size_t>(kFrameCount); ++index) {
+        ASSERT_NE(frames[0][index], nullptr);
+        EXPECT_EQ(frames[0][index]->index, index);
+        for (size_t view = 1; view < frames.size(); ++view) {
+            EXPECT_EQ(frames[view][index], frames[0][index]);
+        }
+    }
+    EXPECT_EQ(cache.GetStatistics().cached_frames, static_cast<size_t>(kFrameCount));
+}
+
+TEST_F(FrameCacheTest, McapChannelsByTopic) {
+    const auto mcap_trace = osi3::testing::MakeTempPath("cache", osi3::testing::FileExtensions::kMcap);
+    {
+        osi3::MCAPTraceFileWriter writer;
+        ASSERT_TRUE(writer.Open(mcap_trace));
+        writer.AddFileMetadata(osi3::MCAPTraceFileWriter::PrepareRequiredFileMetadata());
+        writer.AddChannel("gt", osi3::GroundTruth::descriptor());
+        writer.AddChannel("sv", osi3::SensorView::descriptor());
+        for (int64_t second = 1; second <= 5; ++second) {
+            osi3::GroundTruth ground_truth;
+            ground_truth.mutable_timestamp()->set_seconds(second);
+            ASSERT_TRUE(writer.WriteMessage(ground_truth, "gt"));
+            osi3::SensorView sensor_view;
+            sensor_view.mutable_timestamp()->set_seconds(second);
+            sensor_view.mutable_timestamp()->set_nanos(500'000'000);
+            ASSERT_TRUE(writer.WriteMessage(sensor_view, "sv"));
+        }
+        writer.Close();
+    }
+
+    osi3::tracefile::FrameCache cache(WithoutPrefetch());
+    EXPECT_EQ(cache.GetFrameTimes(mcap_trace, "gt").size(), 5U);
+    const auto ground_truth = cache.GetFrameAt(mcap_trace, "gt", 3'700'000'000);
+    ASSERT_NE(ground_truth, nullptr);
+    EXPECT_EQ(ground_truth->index, 2U);
+    EXPECT_EQ(GetSeconds(*ground_truth), 3);
+    const auto sensor_view = cache.GetFrame(mcap_trace, "sv", 4);
+    ASSERT_NE(sensor_view, nullptr);
+    EXPECT_EQ(sensor_view->message_type, osi3::ReaderTopLevelMessage::kSensorView);
+    EXPECT_EQ(sensor_view->log_time, 5'500'000'000U);
+    osi3::testing::SafeRemoveTestFile(mcap_trace);
+}
+
+TEST_F(FrameCacheTest, RejectsUnsupportedFormat) {
+    osi3::tracefile::FrameCache cache(WithoutPrefetch());
+    EXPECT_THROW(cache.GetFrame("trace_gt_.txth", "", 0), std::invalid_argument);
+}
@@ -0,0 +1,106 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/FrameFingerprint.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../TestUtilities.h"
+#include "osi-utilities/tracefile/reader/SingleChannelBinaryTraceFileReader.h"
+#include "osi-utilities/tracefile/writer/SingleChannelBinaryTraceFileWriter.h"
+#include "osi_groundtruth.pb.h"
+
+namespace {
+
+auto MakeGroundTruth(const int64_t seconds, const uint64_t host_vehicle_id) -> osi3::GroundTruth {
+    osi3::GroundTruth gt;
+    gt.mutable_timestamp()->set_seconds(seconds);
+    gt.mutable_host_vehicle_id()->set_value(host_vehicle_id);
+    return gt;
+}
+
+TEST(FrameFingerprintTest, HashBytesMatchesReferenceVectors) {
+    EXPECT_EQ(osi3::tracefile::HashBytes("", 0), 0xEF46DB3751D8E999ULL);
+    EXPECT_EQ(osi3::tracefile::HashBytes("a", 1), 0xD24EC4F1A98C6E5BULL);
+    EXPECT_EQ(osi3::tracefile::HashBytes("abc", 3), 0x44BC2CF5AD770999ULL);
+    const std::string long_input = "Nobody inspects the spammish repetition";
+    EXPECT_EQ(osi3::tracefile::HashBytes(long_input.data(), long_input.size()), 0xFBCEA83C8A378BF1ULL);
+}
+
+TEST(FrameFingerprintTest, HashBytesDependsOnSeed) {
+    const std::string input = "osi";
+    EXPECT_NE(osi3::tracefile::HashBytes(input.data(), input.size(), 0), osi3::tracefile::HashBytes(input.data(), input.size(), 1));
+}
+
+TEST(FrameFingerprintTest, CanonicalHashIgnoresFieldOrder) {
+    const auto gt = MakeGroundTruth(1, 2);
+    const auto timestamp = gt.timestamp().SerializeAsString();
+    const auto host_vehicle_id = gt.host_vehicle_id().SerializeAsString();
+
+    // Same fields, serialized in reverse field order
+    std::string reordered;
+    reordered.push_back(static_cast<char>((osi3::GroundTruth::kHostVehicleIdFieldNumber << 3) | 2));
+    reordered.push_back(static_cast<char>(host_vehicle_id.size()));
+    reordered += host_vehicle_id;
+    reordered.push_back(static_cast<char>((osi3::GroundTruth::kTimestampFieldNumber << 3) | 2));
+    reordered.push_back(static_cast<char>(timestamp.size()));
+    reordered += timestamp;
+
+    osi3::GroundTruth parsed;
+    ASSERT_TRUE(parsed.ParseFromString(reordered));
+    const auto original = gt.SerializeAsString();
+    EXPECT_NE(osi3::tracefile::HashBytes(original.data(), original.size()), osi3::tracefile::HashBytes(reordered.data(), reordered.size()));
+    EXPECT_EQ(osi3::tracefile::HashMessageCanonical(gt), osi3::tracefile::HashMessageCanonical(parsed));
+}
+
+class FrameFingerprintTraceTest : public ::testing::Test {
+   protected:
+    std::filesystem::path test_file_;
+
+    void SetUp() override {
+        test_file_ = osi3::testing::MakeTempPath("gt", osi3::testing::FileExtensions::kOsi);
+        osi3::SingleChannelBinaryTraceFileWriter writer;
+        ASSERT_TRUE(writer.Open(test_file_));
+        for (int i = 0; i < 3; ++i) {
+            ASSERT_TRUE(writer.WriteMessage(MakeGroundTruth(i, 10)));
+        }
+        writer.Close();
+    }
+
+    void TearDown() override { osi3::testing::SafeRemoveTestFile(test_file_); }
+};
+
+TEST_F(FrameFingerprintTraceTest, ComputeRawFingerprints) {
+    osi3::SingleChannelBinaryTraceFileReader reader;
+    ASSERT_TRUE(reader.Open(test_file_));
+    const auto fingerprints = osi3::tracefile::ComputeTraceFingerprints(reader);
+    reader.Close();
+
+    ASSERT_EQ(fingerprints.size(), 3U);
+    for (size_t i = 0; i < fingerprints.size(); ++i) {
+        const auto serialized = MakeGroundTruth(static_cast<int64_t>(i), 10).SerializeAsString();
+        EXPECT_EQ(fingerprints[i].index, i);
+        EXPECT_EQ(fingerprints[i].log_time, i * 1'000'000'000ULL);
+        EXPECT_EQ(fingerprints[i].size, serialized.size());
+        EXPECT_EQ(fingerprints[i].hash, osi3::tracefile::HashBytes(serialized.data(), serialized.size()));
+        EXPECT_EQ(fingerprints[i].message_type, osi3::ReaderTopLevelMessage::kGroundTruth);
+        EXPECT_TRUE(fingerprints[i].channel_name.empty());
+    }
+    EXPECT_NE(fingerprints[0].hash, fingerprints[1].hash);
+}
+
+TEST_F(FrameFingerprintTraceTest, ComputeCanonicalFingerprints) {
+    osi3::SingleChannelBinaryTraceFileReader reader;
+    ASSERT_TRUE(reader.Open(test_file_));
+    const auto fingerprints = osi3::tracefile::ComputeTraceFingerprints(reader, osi3::tracefile::FingerprintMode::kCanonical);
+    reader.Close();
+
+    ASSERT_EQ(fingerprints.size(), 3U);
+    EXPECT_EQ(fingerprints[1].hash, osi3::tracefile::HashMessageCanonical(MakeGroundTruth(1, 10)));
+}
+
+}  // namespace
@@ -0,0 +1,67 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/MessageTypeUtils.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "osi_groundtruth.pb.h"
+#include "osi_sensorview.pb.h"
+
+namespace {
+
+TEST(MessageTypeUtilsTest, GetMessageDescriptor) {
+    EXPECT_EQ(osi3::tracefile::GetMessageDescriptor(osi3::ReaderTopLevelMessage::kGroundTruth), osi3::GroundTruth::descriptor());
+    EXPECT_EQ(osi3::tracefile::GetMessageDescriptor(osi3::ReaderTopLevelMessage::kSensorView), osi3::SensorView::descriptor());
+    EXPECT_EQ(osi3::tracefile::GetMessageDescriptor(osi3::ReaderTopLevelMessage::kUnknown), nullptr);
+}
+
+TEST(MessageTypeUtilsTest, GetMessageTypeFromFullName) {
+    EXPECT_EQ(osi3::tracefile::GetMessageTypeFromFullName("osi3.GroundTruth"), osi3::ReaderTopLevelMessage::kGroundTruth);
+    EXPECT_EQ(osi3::tracefile::GetMessageTypeFromFullName("osi3.StreamingUpdate"), osi3::ReaderTopLevelMessage::kStreamingUpdate);
+    EXPECT_EQ(osi3::tracefile::GetMessageTypeFromFullName("osi3.MovingObject"), osi3::ReaderTopLevelMessage::kUnknown);
+    EXPECT_EQ(osi3::tracefile::GetMessageTypeFromFullName(""), osi3::ReaderTopLevelMessage::kUnknown);
+}
+
+TEST(MessageTypeUtilsTest, CreateMessage) {
+    const auto message = osi3::tracefile::CreateMessage(osi3::ReaderTopLevelMessage::kSensorView);
+    ASSERT_NE(message, nullptr);
+    EXPECT_NE(dynamic_cast<osi3::SensorView*>(message.get()), nullptr);
+    EXPECT_EQ(osi3::tracefile::CreateMessage(osi3::ReaderTopLevelMessage::kUnknown), nullptr);
+}
+
+TEST(MessageTypeUtilsTest, WrapGroundTruthInSensorView) {
+    osi3::GroundTruth ground_truth;
+    ground_truth.mutable_timestamp()->set_seconds(12);
+    ground_truth.mutable_timestamp()->set_nanos(345);
+    ground_truth.mutable_host_vehicle_id()->set_value(7);
+    ground_truth.add_moving_object()->mutable_id()->set_value(7);
+    const auto serialized = ground_truth.SerializeAsString();
+
+    // same bytes as wrapping the parsed message
+    osi3::SensorView expected;
+    *expected.mutable_timestamp() = ground_truth.timestamp();
+    *expected.mutable_host_vehicle_id() = ground_truth.host_vehicle_id();
+    *expected.mutable_global_ground_truth() = ground_truth;
+    std::string sensor_view;
+    ASSERT_TRUE(osi3::tracefile::WrapGroundTruthInSensorView(serialized, sensor_view));
+    EXPECT_EQ(sensor_view, expected.SerializeAsString());
+
+    osi3::SensorView parsed;
+    ASSERT_TRUE(parsed.ParseFromString(sensor_view));
+    EXPECT_EQ(parsed.timestamp().nanos(), 345U);
+    EXPECT_EQ(parsed.global_ground_truth().moving_object(0).id().value(), 7U);
+
+    ASSERT_TRUE(osi3::tracefile::WrapGroundTruthInSensorView("", sensor_view));
+    ASSERT_TRUE(parsed.ParseFromString(sensor_view));
+    EXPECT_TRUE(parsed.has_global_ground_truth());
+    EXPECT_FALSE(parsed.has_timestamp());
+
+    EXPECT_FALSE(osi3::tracefile::WrapGroundTruthInSensorView(std::string("\x12\x05\x08", 3), sensor_view));
+}
+
+}  // namespace
@@ -0,0 +1,142 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/PayloadOffload.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "osi_groundtruth.pb.h"
+#include "osi_sensorview.pb.h"
+
+namespace {
+
+auto MakeSensorView() -> osi3::SensorView {
+    osi3::SensorView sensor_view;
+    sensor_view.mutable_timestamp()->set_seconds(2);
+    sensor_view.mutable_sensor_id()->set_value(7);
+    for (int i = 0; i < 2; ++i) {
+        auto* camera = sensor_view.add_camera_sensor_view();
+        camera->mutable_view_configuration()->set_number_of_pixels_horizontal(640);
+        camera->set_image_data(std::string(4096, static_cast<char>('a' + i)));
+    }
+    auto* lidar = sensor_view.add_lidar_sensor_view();
+    lidar->mutable_view_configuration()->set_max_number_of_interactions(3);
+    for (int i = 0; i < 200; ++i) {
+        auto* reflection = lidar->add_reflection();
+        reflection->set_signal_strength(i * 0.5);
+        reflection->set_time_of_flight(i * 1e-9);
+    }
+    return sensor_view;
+}
+
+auto MakeOptions() -> osi3::tracefile::PayloadOffloadOptions {
+    osi3::tracefile::PayloadOffloadOptions options;
+    options.field_paths = {"camera_sensor_view.image_data", "lidar_sensor_view.reflection"};
+    return options;
+}
+
+TEST(PayloadOffloadTest, OffloadsAndRestoresPayloads) {
+    const auto original = MakeSensorView();
+    auto sensor_view = original;
+
+    const auto payloads = osi3::tracefile::OffloadPayloads(sensor_view, MakeOptions());
+    ASSERT_EQ(payloads.size(), 3U);
+    EXPECT_EQ(payloads[0].path, "camera_sensor_view[0].image_data");
+    EXPECT_EQ(payloads[1].path, "camera_sensor_view[1].image_data");
+    EXPECT_EQ(payloads[2].path, "lidar_sensor_view[0].reflection");
+
+    // only the payloads are removed
+    EXPECT_FALSE(sensor_view.camera_sensor_view(0).has_image_data());
+    EXPECT_EQ(sensor_view.camera_sensor_view(1).view_configuration().number_of_pixels_horizontal(), 640U);
+    EXPECT_EQ(sensor_view.lidar_sensor_view(0).reflection_size(), 0);
+    EXPECT_EQ(sensor_view.sensor_id().value(), 7U);
+    EXPECT_LT(sensor_view.ByteSizeLong(), 1024U);
+
+    for (const auto& payload : payloads) {
+        EXPECT_TRUE(osi3::tracefile::AttachPayload(sensor_view, payload.path, payload.data));
+    }
+    EXPECT_EQ(sensor_view.SerializeAsString(), original.SerializeAsString());
+}
+
+TEST(PayloadOffloadTest, KeepsPayloadsBelowMinimumSize) {
+    auto sensor_view = MakeSensorView();
+    sensor_view.mutable_camera_sensor_view(1)->set_image_data("small");
+    auto options = MakeOptions();
+    options.field_paths = {"camera_sensor_view.image_data"};
+
+    const auto payloads = osi3::tracefile::OffloadPayloads(sensor_view, options);
+    ASSERT_EQ(payloads.size(), 1U);
+    EXPECT_EQ(payloads[0].path, "camera_sensor_view[0].image_data");
+    EXPECT_EQ(sensor_view.camera_sensor_view(1).image_data(), "small");
+}
+
+TEST(PayloadOffloadTest, IgnoresPathsMissingInMessageType) {
+    osi3::GroundTruth ground_truth;
+    ground_truth.set_model_reference(std::string(2048, 'x'));
+    const auto serialized = ground_truth.SerializeAsString();
+
+    EXPECT_TRUE(osi3::tracefile::OffloadPayloads(ground_truth, MakeOptions()).empty());
+    EXPECT_EQ(ground_truth.SerializeAsString(), serialized);
+}
+
+TEST(PayloadOffloadTest, RejectsInvalidAttachments) {
+    auto sensor_view = MakeSensorView();
+    const auto payloads = osi3::tracefile::OffloadPayloads(sensor_view, MakeOptions());
+    ASSERT_FALSE(payloads.empty());
+
+    EXPECT_FALSE(osi3::tracefile::AttachPayload(sensor_view, "camera_sensor_view[5].image_data", payloads[0].data));
+    EXPECT_FALSE(osi3::tracefile::AttachPayload(sensor_view, "camera_sensor_view.image_data", payloads[0].data));
+    EXPECT_FALSE(osi3::tracefile::AttachPayload(sensor_view, "unknown_field", payloads[0].data));
+    EXPECT_FALSE(osi3::tracefile::AttachPayload(sensor_view, payloads[0].path, std::string("\x12\x10\x01", 3)));
+}
+
+TEST(PayloadOffloadTest, RestoresPayloadsOfFrameFromBatch) {
+    const auto original = MakeSensorView();
+    std::string batch;
+    for (uint64_t log_time = 1; log_time <= 3; ++log_time) {
+        auto sensor_view = original;
+        for (const auto& payload : osi3::tracefile::OffloadPayloads(sensor_view, MakeOptions())) {
+            osi3::tracefile::AppendPayloadRecord(batch, log_time, payload);
+        }
+    }
+
+    auto sensor_view = original;
+    osi3::tracefile::OffloadPayloads(sensor_view, MakeOptions());
+    ASSERT_TRUE(osi3::tracefile::AttachPayloads(sensor_view, batch, 2));
+    EXPECT_EQ(sensor_view.SerializeAsString(), original.SerializeAsString());
+
+    // frames without payloads in the batch stay unchanged, truncated batches are rejected
+    osi3::tracefile::OffloadPayloads(sensor_view, MakeOptions());
+    EXPECT_TRUE(osi3::tracefile::AttachPayloads(sensor_view, batch, 4));
+    EXPECT_FALSE(sensor_view.camera_sensor_view(0).has_image_data());
+    EXPECT_FALSE(osi3::tracefile::AttachPayloads(sensor_view, std::string_view(batch).substr(0, batch.size() - 1), 3));
+}
+
+TEST(PayloadOffloadTest, NamesAttachmentsByLogTimeRange) {
+    const auto name = osi3::tracefile::GetPayloadAttachmentName("/sensor_view", 2000000000, 3000000000);
+    EXPECT_EQ(name, "osi-payload:/sensor_view@2000000000-3000000000");
+    const auto range = osi3::tracefile::ParsePayloadAttachmentName(name, "/sensor_view");
+    ASSERT_TRUE(range.has_value());
+    EXPECT_EQ(range->first, 2000000000U);
+    EXPECT_EQ(range->second, 3000000000U);
+    EXPECT_FALSE(osi3::tracefile::ParsePayloadAttachmentName(name, "/sensor").has_value());
+    EXPECT_FALSE(osi3::tracefile::ParsePayloadAttachmentName("osi-payload:/sensor_view@2000000000", "/sensor_view").has_value());
+    EXPECT_FALSE(osi3::tracefile::ParsePayloadAttachmentName("osi-payload:/sensor_view@3-2", "/sensor_view").has_value());
+}
+
+TEST(PayloadOffloadTest, RecordsOffloadedFieldsInChannelMetadata) {
+    std::unordered_map<std::string, std::string> metadata;
+    osi3::tracefile::AddPayloadOffloadMetadata({}, metadata);
+    EXPECT_TRUE(metadata.empty());
+
+    osi3::tracefile::AddPayloadOffloadMetadata(MakeOptions(), metadata);
+    EXPECT_EQ(metadata.at("net.asam.osi.trace.channel.offloaded_fields"), "camera_sensor_view.image_data,lidar_sensor_view.reflection");
+}
+
+}  // namespace
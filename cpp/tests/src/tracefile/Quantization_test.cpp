@@ -0,0 +1,120 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/Quantization.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+
+#include "osi_groundtruth.pb.h"
+#include "osi_sensorview.pb.h"
+
+namespace {
+
+auto MakeGroundTruth() -> osi3::GroundTruth {
+    osi3::GroundTruth ground_truth;
+    ground_truth.mutable_timestamp()->set_seconds(3);
+    auto* base = ground_truth.add_moving_object()->mutable_base();
+    base->mutable_position()->set_x(123.456789123);
+    base->mutable_position()->set_y(-0.000123);
+    base->mutable_orientation()->set_yaw(1.23456789);
+    base->mutable_velocity()->set_x(13.8888888);
+    base->mutable_dimension()->set_length(4.5678912);
+    return ground_truth;
+}
+
+TEST(QuantizationTest, StepIsPowerOfTwoNotExceedingPrecision) {
+    EXPECT_EQ(osi3::tracefile::GetQuantizationStep(0.001), std::ldexp(1.0, -10));
+    EXPECT_EQ(osi3::tracefile::GetQuantizationStep(0.5), 0.5);
+    EXPECT_EQ(osi3::tracefile::GetQuantizationStep(0.0), 0.0);
+    EXPECT_EQ(osi3::tracefile::GetQuantizationStep(-1.0), 0.0);
+}
+
+TEST(QuantizationTest, RoundsPositionalFieldsWithinHalfAStep) {
+    const auto original = MakeGroundTruth();
+    auto quantized = original;
+    osi3::tracefile::QuantizationOptions options;
+    options.linear_precision = 0.001;
+    options.angular_precision = 0.001;
+    osi3::tracefile::QuantizeMessage(quantized, options);
+
+    const auto& before = original.moving_object(0).base();
+    const auto& after = quantized.moving_object(0).base();
+    const double half_step = osi3::tracefile::GetQuantizationStep(0.001) / 2;
+    EXPECT_NEAR(after.position().x(), before.position().x(), half_step);
+    EXPECT_NEAR(after.position().y(), before.position().y(), half_step);
+    EXPECT_NEAR(after.orientation().yaw(), before.orientation().yaw(), half_step);
+    EXPECT_NEAR(after.velocity().x(), before.velocity().x(), half_step);
+    EXPECT_NEAR(after.dimension().length(), before.dimension().length(), half_step);
+    EXPECT_NE(after.position().x(), before.position().x());
+
+    // quantized values are multiples of the step, so their low mantissa bits are zero
+    uint64_t bits = 0;
+    const double x = after.position().x();
+    std::memcpy(&bits, &x, sizeof(bits));
+    EXPECT_EQ(bits & 0xFFFFFU, 0U);
+
+    // unset fields stay unset, non-positional fields are unchanged
+    EXPECT_FALSE(after.position().has_z());
+    EXPECT_FALSE(after.has_acceleration());
+    EXPECT_EQ(quantized.timestamp().seconds(), 3);
+}
+
+TEST(QuantizationTest, AppliesOnlyEnabledQuantities) {
+    const auto original = MakeGroundTruth();
+    auto quantized = original;
+    osi3::tracefile::QuantizationOptions options;
+    options.angular_precision = 0.01;
+    osi3::tracefile::QuantizeMessage(quantized, options);
+    EXPECT_EQ(quantized.moving_object(0).base().position().x(), original.moving_object(0).base().position().x());
+    EXPECT_NE(quantized.moving_object(0).base().orientation().yaw(), original.moving_object(0).base().orientation().yaw());
+
+    std::unordered_map<std::string, std::string> metadata;
+    osi3::tracefile::AddQuantizationMetadata(options, metadata);
+    EXPECT_EQ(metadata.count("net.asam.osi.trace.channel.quantization.linear_step"), 0U);
+    ASSERT_EQ(metadata.count("net.asam.osi.trace.channel.quantization.angular_step"), 1U);
+    EXPECT_EQ(std::stod(metadata.at("net.asam.osi.trace.channel.quantization.angular_step")), std::ldexp(1.0, -7));
+}
+
+TEST(QuantizationTest, ReachesNestedMessages) {
+    osi3::SensorView sensor_view;
+    sensor_view.mutable_global_ground_truth()->CopyFrom(MakeGroundTruth());
+    sensor_view.mutable_mounting_position()->mutable_position()->set_x(1.23456789);
+    osi3::tracefile::QuantizationOptions options;
+    options.linear_precision = 0.01;
+    osi3::tracefile::QuantizeMessage(sensor_view, options);
+    const double step = osi3::tracefile::GetQuantizationStep(0.01);
+    EXPECT_EQ(std::fmod(sensor_view.mounting_position().position().x(), step), 0.0);
+    EXPECT_EQ(std::fmod(sensor_view.global_ground_truth().moving_object(0).base().position().x(), step), 0.0);
+}
+
+TEST(QuantizationTest, KeepsNonPoseVectorsUnchanged) {
+    osi3::GroundTruth ground_truth = MakeGroundTruth();
+    ground_truth.mutable_moving_object(0)->mutable_base()->add_base_polygon()->set_x(1.23456789);
+    ground_truth.add_lane_boundary()->add_boundary_line()->mutable_position()->set_x(7.87654321);
+    osi3::tracefile::QuantizationOptions options;
+    options.linear_precision = 0.01;
+    osi3::tracefile::QuantizeMessage(ground_truth, options);
+    const double step = osi3::tracefile::GetQuantizationStep(0.01);
+    EXPECT_EQ(std::fmod(ground_truth.moving_object(0).base().position().x(), step), 0.0);
+    EXPECT_EQ(ground_truth.moving_object(0).base().base_polygon(0).x(), 1.23456789);
+    EXPECT_EQ(ground_truth.lane_boundary(0).boundary_line(0).position().x(), 7.87654321);
+}
+
+TEST(QuantizationTest, QuantizesOnlyConfiguredPoseFields) {
+    osi3::GroundTruth ground_truth = MakeGroundTruth();
+    osi3::tracefile::QuantizationOptions options;
+    options.linear_precision = 0.01;
+    options.pose_fields = {"osi3.BaseMoving.velocity", "osi3.Unknown.field"};
+    osi3::tracefile::QuantizeMessage(ground_truth, options);
+    const double step = osi3::tracefile::GetQuantizationStep(0.01);
+    EXPECT_EQ(std::fmod(ground_truth.moving_object(0).base().velocity().x(), step), 0.0);
+    EXPECT_EQ(ground_truth.moving_object(0).base().position().x(), 123.456789123);
+    EXPECT_EQ(ground_truth.moving_object(0).base().dimension().length(), 4.5678912);
+}
+
+}  // namespace
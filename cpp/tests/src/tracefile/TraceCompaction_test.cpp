@@ -0,0 +1,182 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/TraceCompaction.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "../TestUtilities.h"
+#include "osi-utilities/tracefile/reader/SingleChannelBinaryTraceFileReader.h"
+#include "osi-utilities/tracefile/writer/SingleChannelBinaryTraceFileWriter.h"
+#include "osi_groundtruth.pb.h"
+#include "osi_sensorview.pb.h"
+
+namespace {
+
+auto MakeGroundTruth(const int64_t second) -> osi3::GroundTruth {
+    osi3::GroundTruth ground_truth;
+    ground_truth.mutable_timestamp()->set_seconds(second);
+    ground_truth.mutable_host_vehicle_id()->set_value(7);
+    ground_truth.set_model_reference("scenery/highway.osgb");
+    ground_truth.set_country_code(0);  // explicitly set to its default value
+    auto* host = ground_truth.add_moving_object();
+    host->mutable_id()->set_value(7);
+    host->mutable_base()->mutable_position()->set_x(100.0);
+    host->set_model_reference("vehicles/car.osgb");
+    host->add_source_reference();
+    auto* lane_boundary = ground_truth.add_lane_boundary();
+    for (const double x : {0.0, 90.0, 110.0, 250.0}) {
+        lane_boundary->add_boundary_line()->mutable_position()->set_x(x);
+    }
+    return ground_truth;
+}
+
+// Appends a varint field with a number unknown to OSI to a serialized message
+auto AppendUnknownField(std::string serialized) -> std::string {
+    serialized += std::string("\xC0\x3E\x01", 3);  // field 1000, wire type 0, value 1
+    return serialized;
+}
+
+TEST(TraceCompactionTest, RemovesConfiguredFieldsEverywhere) {
+    auto ground_truth = MakeGroundTruth(1);
+    osi3::tracefile::CompactionOptions options;
+    options.removed_fields = {"model_reference", "osi3.MovingObject.source_reference"};
+    osi3::tracefile::CompactMessage(ground_truth, options);
+    EXPECT_FALSE(ground_truth.has_model_reference());
+    EXPECT_FALSE(ground_truth.moving_object(0).has_model_reference());
+    EXPECT_EQ(ground_truth.moving_object(0).source_reference_size(), 0);
+    EXPECT_TRUE(ground_truth.moving_object(0).base().has_position());
+}
+
+TEST(TraceCompactionTest, RemovesUnknownFieldsAndDefaultValues) {
+    osi3::GroundTruth ground_truth;
+    ASSERT_TRUE(ground_truth.ParseFromString(AppendUnknownField(MakeGroundTruth(1).SerializeAsString())));
+    ASSERT_FALSE(ground_truth.GetReflection()->GetUnknownFields(ground_truth).empty());
+    ASSERT_TRUE(ground_truth.has_country_code());
+
+    osi3::tracefile::CompactMessage(ground_truth, {});
+    EXPECT_TRUE(ground_truth.GetReflection()->GetUnknownFields(ground_truth).empty());
+    EXPECT_FALSE(ground_truth.has_country_code());
+    EXPECT_FALSE(ground_truth.lane_boundary(0).boundary_line(0).position().has_x());
+    EXPECT_TRUE(ground_truth.has_model_reference());
+
+    osi3::tracefile::CompactionOptions keep;
+    keep.remove_unknown_fields = false;
+    keep.remove_default_values = false;
+    osi3::GroundTruth kept;
+    ASSERT_TRUE(kept.ParseFromString(AppendUnknownField(MakeGroundTruth(1).SerializeAsString())));
+    osi3::tracefile::CompactMessage(kept, keep);
+    EXPECT_FALSE(kept.GetReflection()->GetUnknownFields(kept).empty());
+    EXPECT_TRUE(kept.has_country_code());
+}
+
+TEST(TraceCompactionTest, TrimsLaneBoundariesAroundHostVehicle) {
+    osi3::SensorView sensor_view;
+    *sensor_view.mutable_global_ground_truth() = MakeGroundTruth(1);
+    osi3::tracefile::CompactionOptions options;
+    options.lane_boundary_range = 20.0;
+    osi3::tracefile::CompactMessage(sensor_view, options);
+    const auto& boundary_line = sensor_view.global_ground_truth().lane_boundary(0).boundary_line();
+    ASSERT_EQ(boundary_line.size(), 2);
+    EXPECT_EQ(boundary_line.Get(0).position().x(), 90.0);
+    EXPECT_EQ(boundary_line.Get(1).position().x(), 110.0);
+}
+
+TEST(TraceCompactionTest, CompactorIsReusable) {
+    osi3::tracefile::CompactionOptions options;
+    options.removed_fields = {"model_reference"};
+    const osi3::tracefile::MessageCompactor compactor(options);
+    for (int64_t second = 0; second < 3; ++second) {
+        auto ground_truth = MakeGroundTruth(second);
+        compactor.Compact(ground_truth);
+        EXPECT_FALSE(ground_truth.has_model_reference());
+        EXPECT_FALSE(ground_truth.moving_object(0).has_model_reference());
+        EXPECT_EQ(ground_truth.timestamp().seconds(), second);
+    }
+    EXPECT_EQ(compactor.GetOptions().removed_fields.size(), 1U);
+}
+
+TEST(TraceCompactionTest, CanonicalSerializationIsStable) {
+    std::string first;
+    std::string second;
+    ASSERT_TRUE(osi3::tracefile::SerializeCanonical(MakeGroundTruth(1), first));
+    ASSERT_TRUE(osi3::tracefile::SerializeCanonical(MakeGroundTruth(1), second));
+    EXPECT_EQ(first, second);
+    osi3::GroundTruth parsed;
+    ASSERT_TRUE(parsed.ParseFromString(first));
+    EXPECT_EQ(parsed.timestamp().seconds(), 1);
+}
+
+TEST(TraceCompactionTest, CompactsTraceFile) {
+    const auto input = osi3::testing::MakeTempPath("compact_in_gt", osi3::testing::FileExtensions::kOsi);
+    const auto output = osi3::testing::MakeTempPath("compact_out_gt", osi3::testing::FileExtensions::kOsi);
+    {
+        osi3::SingleChannelBinaryTraceFileWriter writer;
+        ASSERT_TRUE(writer.Open(input));
+        for (int64_t second = 0; second < 3; ++second) {
+            ASSERT_TRUE(writer.WriteMessage(MakeGroundTruth(second)));
+        }
+        writer.Close();
+    }
+
+    osi3::tracefile::CompactionOptions options;
+    options.removed_fields = {"model_reference", "source_reference"};
+    options.message_type = osi3::ReaderTopLevelMessage::kGroundTruth;
+    const auto report = osi3::tracefile::CompactTraceFile(input, output, options);
+    EXPECT_EQ(report.frame_count, 3U);
+    EXPECT_LT(report.output_bytes, report.input_bytes);
+    // the input frames are counted as stored, without their length prefixes
+    EXPECT_EQ(report.input_bytes, std::filesystem::file_size(input) - 3 * osi3::tracefile::config::kBinaryOsiMessageLengthPrefixSize);
+
+    osi3::SingleChannelBinaryTraceFileReader reader;
+    ASSERT_TRUE(reader.Open(output, osi3::ReaderTopLevelMessage::kGroundTruth));
+    int64_t second = 0;
+    while (reader.HasNext()) {
+        const auto result = reader.ReadMessage();
+        ASSERT_TRUE(result.has_value());
+        const auto& ground_truth = static_cast<const osi3::GroundTruth&>(*result->message);
+        EXPECT_EQ(ground_truth.timestamp().seconds(), second++);
+        EXPECT_FALSE(ground_truth.has_model_reference());
+        EXPECT_EQ(ground_truth.moving_object(0).source_reference_size(), 0);
+    }
+    EXPECT_EQ(second, 3);
+    reader.Close();
+    osi3::testing::SafeRemoveTestFile(input);
+    osi3::testing::SafeRemoveTestFile(output);
+}
+
+TEST(TraceCompactionTest, KeepsExistingOutputIfCompactionFails) {
+    const auto input = osi3::testing::MakeTempPath("compact_broken_gt", osi3::testing::FileExtensions::kOsi);
+    const auto output = osi3::testing::MakeTempPath("compact_kept_gt", osi3::testing::FileExtensions::kOsi);
+    {
+        osi3::SingleChannelBinaryTraceFileWriter writer;
+        ASSERT_TRUE(writer.Open(input));
+        ASSERT_TRUE(writer.WriteMessage(MakeGroundTruth(0)));
+        writer.Close();
+        // a length prefix without its frame
+        std::ofstream file(input, std::ios::binary | std::ios::app);
+        const uint32_t size = 100;
+        file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    }
+    {
+        std::ofstream file(output, std::ios::binary);
+        file << "previous";
+    }
+
+    osi3::tracefile::CompactionOptions options;
+    options.message_type = osi3::ReaderTopLevelMessage::kGroundTruth;
+    EXPECT_THROW(osi3::tracefile::CompactTraceFile(input, output, options), std::runtime_error);
+    // the output is only replaced by a finished file, and no temporary file is left behind
+    EXPECT_EQ(std::filesystem::file_size(output), 8U);
+    EXPECT_FALSE(std::filesystem::exists(output.parent_path() / (output.stem().string() + ".partial.osi")));
+    osi3::testing::SafeRemoveTestFile(input);
+    osi3::testing::SafeRemoveTestFile(output);
+}
+
+}  // namespace
@@ -0,0 +1,135 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/TraceFileDiff.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <vector>
+
+#include "../TestUtilities.h"
+#include "osi-utilities/tracefile/writer/SingleChannelBinaryTraceFileWriter.h"
+#include "osi_groundtruth.pb.h"
+
+namespace {
+
+auto MakeFingerprint(const std::string& channel, const uint64_t log_time, const uint64_t hash, const size_t index) -> osi3::tracefile::FrameFingerprint {
+    osi3::tracefile::FrameFingerprint fingerprint;
+    fingerprint.channel_name = channel;
+    fingerprint.log_time = log_time;
+    fingerprint.hash = hash;
+    fingerprint.size = 8;
+    fingerprint.index = index;
+    fingerprint.message_type = osi3::ReaderTopLevelMessage::kGroundTruth;
+    return fingerprint;
+}
+
+TEST(TraceFileDiffTest, IdenticalFingerprints) {
+    const std::vector<osi3::tracefile::FrameFingerprint> frames = {MakeFingerprint("gt", 0, 1, 0), MakeFingerprint("gt", 100, 2, 1)};
+    const auto report = osi3::tracefile::DiffFingerprints(frames, frames);
+    EXPECT_TRUE(report.IsIdentical());
+    EXPECT_EQ(report.identical_count, 2U);
+    EXPECT_TRUE(report.entries.empty());
+}
+
+TEST(TraceFileDiffTest, DifferingMissingAndExtraFrames) {
+    const std::vector<osi3::tracefile::FrameFingerprint> reference = {MakeFingerprint("gt", 0, 1, 0), MakeFingerprint("gt", 100, 2, 1), MakeFingerprint("gt", 200, 3, 2)};
+    const std::vector<osi3::tracefile::FrameFingerprint> candidate = {MakeFingerprint("gt", 0, 1, 0), MakeFingerprint("gt", 100, 7, 1), MakeFingerprint("gt", 300, 4, 2)};
+    const auto report = osi3::tracefile::DiffFingerprints(reference, candidate);
+
+    EXPECT_FALSE(report.IsIdentical());
+    EXPECT_EQ(report.identical_count, 1U);
+    EXPECT_EQ(report.differing_count, 1U);
+    EXPECT_EQ(report.missing_count, 1U);
+    EXPECT_EQ(report.extra_count, 1U);
+    ASSERT_EQ(report.entries.size(), 3U);
+    EXPECT_EQ(report.entries[0].status, osi3::tracefile::FrameDiffStatus::kDiffering);
+    EXPECT_EQ(report.entries[0].log_time, 100U);
+    EXPECT_EQ(report.entries[1].status, osi3::tracefile::FrameDiffStatus::kMissing);
+    EXPECT_EQ(report.entries[1].reference_index, 2U);
+    EXPECT_EQ(report.entries[2].status, osi3::tracefile::FrameDiffStatus::kExtra);
+    EXPECT_EQ(report.entries[2].candidate_index, 2U);
+}
+
+TEST(TraceFileDiffTest, AlignsByChannelAndRepeatedTimestamps) {
+    const std::vector<osi3::tracefile::FrameFingerprint> reference = {MakeFingerprint("gt", 0, 1, 0), MakeFingerprint("sv", 0, 2, 1), MakeFingerprint("gt", 0, 3, 2)};
+    // Same frames, different interleaving across channels
+    const std::vector<osi3::tracefile::FrameFingerprint> candidate = {MakeFingerprint("sv", 0, 2, 0), MakeFingerprint("gt", 0, 1, 1), MakeFingerprint("gt", 0, 3, 2)};
+    const auto report = osi3::tracefile::DiffFingerprints(reference, candidate);
+    EXPECT_TRUE(report.IsIdentical());
+    EXPECT_EQ(report.identical_count, 3U);
+}
+
+class TraceFileDiffFileTest : public ::testing::Test {
+   protected:
+    std::filesystem::path reference_file_;
+    std::filesystem::path candidate_file_;
+
+    void SetUp() override {
+        reference_file_ = osi3::testing::MakeTempPath("ref_gt", osi3::testing::FileExtensions::kOsi);
+        candidate_file_ = osi3::testing::MakeTempPath("cand_gt", osi3::testing::FileExtensions::kOsi);
+    }
+
+    void TearDown() override {
+        osi3::testing::SafeRemoveTestFile(reference_file_);
+        osi3::testing::SafeRemoveTestFile(candidate_file_);
+    }
+
+    static void WriteTrace(const std::filesystem::path& path, const std::vector<uint64_t>& host_vehicle_ids) {
+        osi3::SingleChannelBinaryTraceFileWriter writer;
+        ASSERT_TRUE(writer.Open(path));
+        for (size_t i = 0; i < host_vehicle_ids.size(); ++i) {
+            osi3::GroundTruth gt;
+            gt.mutable_timestamp()->set_seconds(static_cast<int64_t>(i));
+            gt.mutable_host_vehicle_id()->set_value(host_vehicle_ids[i]);
+            ASSERT_TRUE(writer.WriteMessage(gt));
+        }
+        writer.Close();
+    }
+};
+
+TEST_F(TraceFileDiffFileTest, IdenticalTraces) {
+    WriteTrace(reference_file_, {1, 2, 3});
+    WriteTrace(candidate_file_, {1, 2, 3});
+    const auto report = osi3::tracefile::DiffTraces(reference_file_, candidate_file_);
+    EXPECT_TRUE(report.IsIdentical());
+    EXPECT_EQ(report.identical_count, 3U);
+}
+
+TEST_F(TraceFileDiffFileTest, DifferingTracesWithFieldDiff) {
+    WriteTrace(reference_file_, {1, 2, 3, 4});
+    WriteTrace(candidate_file_, {1, 5, 3});
+
+    osi3::tracefile::TraceDiffOptions options;
+    options.field_diff = true;
+    const auto report = osi3::tracefile::DiffTraces(reference_file_, candidate_file_, options);
+
+    EXPECT_EQ(report.identical_count, 2U);
+    EXPECT_EQ(report.differing_count, 1U);
+    EXPECT_EQ(report.missing_count, 1U);
+    ASSERT_EQ(report.entries.size(), 2U);
+    EXPECT_EQ(report.entries[0].status, osi3::tracefile::FrameDiffStatus::kDiffering);
+    EXPECT_NE(report.entries[0].field_diff.find("host_vehicle_id"), std::string::npos);
+    EXPECT_TRUE(report.entries[1].field_diff.empty());
+}
+
+TEST_F(TraceFileDiffFileTest, CanonicalModeMatchesRawModeForSameSerializer) {
+    WriteTrace(reference_file_, {1, 2});
+    WriteTrace(candidate_file_, {1, 3});
+
+    osi3::tracefile::TraceDiffOptions options;
+    options.mode = osi3::tracefile::FingerprintMode::kCanonical;
+    const auto report = osi3::tracefile::DiffTraces(reference_file_, candidate_file_, options);
+    EXPECT_EQ(report.identical_count, 1U);
+    EXPECT_EQ(report.differing_count, 1U);
+}
+
+TEST_F(TraceFileDiffFileTest, ThrowOnMissingFile) {
+    WriteTrace(reference_file_, {1});
+    EXPECT_THROW(osi3::tracefile::DiffTraces(reference_file_, "does_not_exist_gt_.osi"), std::runtime_error);
+}
+
+}  // namespace
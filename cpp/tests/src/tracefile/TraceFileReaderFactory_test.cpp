@@ -120,3 +120,28 @@ TEST_F(TraceFileReaderFactoryTest, FactoryThenOpenAndReadTxth) {
     reader->Close();
     osi3::testing::SafeRemoveTestFile(file_path);
 }
+
+TEST_F(TraceFileReaderFactoryTest, OpenReaderReturnsOpenedReader) {
+    const auto file_path = osi3::testing::MakeTempPath("factory_open", osi3::testing::FileExtensions::kOsi);
+    osi3::SingleChannelBinaryTraceFileWriter writer;
+    ASSERT_TRUE(writer.Open(file_path));
+    osi3::GroundTruth gt;
+    gt.mutable_timestamp()->set_seconds(7);
+    ASSERT_TRUE(writer.WriteMessage(gt));
+    writer.Close();
+
+    // Filename carries no type hint, so the type has to be passed explicitly
+    auto reader = osi3::TraceFileReaderFactory::openReader(file_path, osi3::ReaderTopLevelMessage::kGroundTruth);
+    ASSERT_NE(reader, nullptr);
+    ASSERT_TRUE(reader->HasNext());
+    const auto result = reader->ReadMessage();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->message_type, osi3::ReaderTopLevelMessage::kGroundTruth);
+    reader->Close();
+    osi3::testing::SafeRemoveTestFile(file_path);
+}
+
+TEST_F(TraceFileReaderFactoryTest, OpenReaderThrowsOnMissingFile) {
+    EXPECT_THROW(osi3::TraceFileReaderFactory::openReader("does_not_exist_gt_.osi"), std::runtime_error);
+    EXPECT_THROW(osi3::TraceFileReaderFactory::openReader("trace.xyz"), std::invalid_argument);
+}
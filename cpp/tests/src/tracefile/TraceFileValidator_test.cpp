@@ -0,0 +1,178 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/TraceFileValidator.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../TestUtilities.h"
+#include "osi-utilities/tracefile/writer/MCAPTraceFileWriter.h"
+#include "osi-utilities/tracefile/writer/SingleChannelBinaryTraceFileWriter.h"
+#include "osi_groundtruth.pb.h"
+
+namespace {
+
+auto CountIssues(const osi3::tracefile::ValidationReport& report, const std::string& check) -> size_t {
+    return static_cast<size_t>(std::count_if(report.issues.begin(), report.issues.end(), [&check](const auto& issue) { return issue.check == check; }));
+}
+
+class TraceFileValidatorTest : public ::testing::Test {
+   protected:
+    std::filesystem::path test_file_;
+
+    void TearDown() override { osi3::testing::SafeRemoveTestFile(test_file_); }
+
+    void WriteBinaryTrace(const std::vector<int64_t>& seconds) {
+        test_file_ = osi3::testing::MakeTempPath("gt", osi3::testing::FileExtensions::kOsi);
+        osi3::SingleChannelBinaryTraceFileWriter writer;
+        ASSERT_TRUE(writer.Open(test_file_));
+        for (const auto second : seconds) {
+            osi3::GroundTruth gt;
+            gt.mutable_timestamp()->set_seconds(second);
+            ASSERT_TRUE(writer.WriteMessage(gt));
+        }
+        writer.Close();
+    }
+};
+
+TEST_F(TraceFileValidatorTest, ValidBinaryTrace) {
+    WriteBinaryTrace({0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+
+    osi3::tracefile::ValidationOptions options;
+    options.worker_count = 3;
+    options.batch_size = 2;
+    const auto report = osi3::tracefile::ValidateTraceFile(test_file_, options);
+
+    EXPECT_TRUE(report.IsValid());
+    EXPECT_EQ(report.frame_count, 10U);
+    EXPECT_EQ(report.error_count, 0U);
+    // The temporary filename does not follow the naming convention
+    EXPECT_EQ(CountIssues(report, osi3::tracefile::validation_check::kFilenameConvention), 1U);
+}
+
+TEST_F(TraceFileValidatorTest, DetectsNonMonotonicTimestamps) {
+    WriteBinaryTrace({0, 2, 1, 3});
+    const auto report = osi3::tracefile::ValidateTraceFile(test_file_);
+
+    EXPECT_FALSE(report.IsValid());
+    ASSERT_EQ(CountIssues(report, osi3::tracefile::validation_check::kTimestampMonotonic), 1U);
+    const auto issue = std::find_if(report.issues.begin(), report.issues.end(),
+                                    [](const auto& entry) { return entry.check == osi3::tracefile::validation_check::kTimestampMonotonic; });
+    ASSERT_TRUE(issue->frame_index.has_value());
+    EXPECT_EQ(*issue->frame_index, 2U);
+}
+
+TEST_F(TraceFileValidatorTest, DetectsUnparseableFrames) {
+    test_file_ = osi3::testing::MakeTempPath("gt", osi3::testing::FileExtensions::kOsi);
+    {
+        std::ofstream file(test_file_, std::ios::binary);
+        osi3::GroundTruth gt;
+        gt.mutable_timestamp()->set_seconds(1);
+        const auto valid = gt.SerializeAsString();
+        const std::string invalid = "\xFF\xFF\xFF";
+        for (const auto* payload : {&valid, &invalid, &valid}) {
+            const auto size = static_cast<uint32_t>(payload->size());
+            file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+            file.write(payload->data(), size);
+        }
+    }
+
+    osi3::tracefile::ValidationOptions options;
+    options.worker_count = 2;
+    options.batch_size = 1;
+    const auto report = osi3::tracefile::ValidateTraceFile(test_file_, options);
+
+    EXPECT_FALSE(report.IsValid());
+    EXPECT_EQ(report.frame_count, 3U);
+    ASSERT_EQ(CountIssues(report, osi3::tracefile::validation_check::kMessageParse), 1U);
+}
+
+TEST_F(TraceFileValidatorTest, MissingTimestampIsWarning) {
+    test_file_ = osi3::testing::MakeTempPath("gt", osi3::testing::FileExtensions::kOsi);
+    osi3::SingleChannelBinaryTraceFileWriter writer;
+    ASSERT_TRUE(writer.Open(test_file_));
+    osi3::GroundTruth gt;
+    gt.mutable_host_vehicle_id()->set_value(1);
+    ASSERT_TRUE(writer.WriteMessage(gt));
+    writer.Close();
+
+    const auto report = osi3::tracefile::ValidateTraceFile(test_file_);
+    EXPECT_TRUE(report.IsValid());
+    EXPECT_EQ(CountIssues(report, osi3::tracefile::validation_check::kMessageTimestamp), 1U);
+}
+
+TEST_F(TraceFileValidatorTest, FilenameFrameCountMismatch) {
+    test_file_ = std::filesystem::temp_directory_path() / "20240101T120000Z_gt_3.7.0_4.25.0_5_validator_test.osi";
+    osi3::SingleChannelBinaryTraceFileWriter writer;
+    ASSERT_TRUE(writer.Open(test_file_));
+    osi3::GroundTruth gt;
+    gt.mutable_timestamp()->set_seconds(1);
+    ASSERT_TRUE(writer.WriteMessage(gt));
+    writer.Close();
+
+    const auto report = osi3::tracefile::ValidateTraceFile(test_file_);
+    EXPECT_TRUE(report.IsValid());
+    ASSERT_EQ(CountIssues(report, osi3::tracefile::validation_check::kFilenameConvention), 1U);
+    EXPECT_NE(report.issues.front().message.find("frame count"), std::string::npos);
+}
+
+TEST_F(TraceFileValidatorTest, MissingFileIsReadError) {
+    const auto report = osi3::tracefile::ValidateTraceFile("does_not_exist_gt_.osi");
+    EXPECT_FALSE(report.IsValid());
+    EXPECT_EQ(CountIssues(report, osi3::tracefile::validation_check::kRead), 1U);
+}
+
+TEST_F(TraceFileValidatorTest, MaxIssuesPerCheckSuppressesIssues) {
+    WriteBinaryTrace({5, 4, 3, 2, 1});
+
+    osi3::tracefile::ValidationOptions options;
+    options.max_issues_per_check = 2;
+    const auto report = osi3::tracefile::ValidateTraceFile(test_file_, options);
+
+    EXPECT_EQ(report.error_count, 4U);
+    EXPECT_EQ(CountIssues(report, osi3::tracefile::validation_check::kTimestampMonotonic), 2U);
+    EXPECT_EQ(report.suppressed_issue_count, 2U);
+}
+
+TEST_F(TraceFileValidatorTest, McapMetadataChecks) {
+    test_file_ = osi3::testing::MakeTempPath("mcap", osi3::testing::FileExtensions::kMcap);
+    osi3::MCAPTraceFileWriter writer;
+    ASSERT_TRUE(writer.Open(test_file_));
+    ASSERT_TRUE(writer.AddFileMetadata(osi3::MCAPTraceFileWriter::PrepareRequiredFileMetadata()));
+    writer.AddChannel("gt", osi3::GroundTruth::descriptor());
+    osi3::GroundTruth gt;
+    gt.mutable_timestamp()->set_seconds(1);
+    ASSERT_TRUE(writer.WriteMessage(gt, "gt"));
+    writer.Close();
+
+    osi3::tracefile::ValidationOptions options;
+    options.check_recommended = false;
+    const auto report = osi3::tracefile::ValidateTraceFile(test_file_, options);
+    EXPECT_TRUE(report.IsValid()) << report.ToJson();
+    EXPECT_EQ(report.frame_count, 1U);
+    EXPECT_EQ(CountIssues(report, osi3::tracefile::validation_check::kFileMetadata), 0U);
+    EXPECT_EQ(CountIssues(report, osi3::tracefile::validation_check::kChannelMetadata), 0U);
+}
+
+TEST(ValidationReportTest, ToJsonEscapesStrings) {
+    osi3::tracefile::ValidationReport report;
+    report.file_path = "dir/\"quoted\".osi";
+    report.frame_count = 2;
+    report.error_count = 1;
+    report.issues.push_back({osi3::tracefile::ValidationSeverity::kError, osi3::tracefile::validation_check::kMessageParse, "line1\nline2", "gt", 1});
+
+    const auto json = report.ToJson();
+    EXPECT_EQ(json,
+              R"({"file":"dir/\"quoted\".osi","valid":false,"frame_count":2,"error_count":1,"warning_count":0,"suppressed_issue_count":0,)"
+              R"("issues":[{"severity":"error","check":"message_parse","message":"line1\nline2","channel":"gt","frame":1}]})");
+}
+
+}  // namespace
@@ -0,0 +1,240 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/TraceSlicing.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+
+#include "../TestUtilities.h"
+#include "osi-utilities/tracefile/TraceFileConfig.h"
+#include "osi-utilities/tracefile/TraceStatistics.h"
+#include "osi-utilities/tracefile/reader/MCAPTraceFileReader.h"
+#include "osi-utilities/tracefile/reader/SingleChannelBinaryTraceFileReader.h"
+#include "osi-utilities/tracefile/writer/MCAPTraceFileWriter.h"
+#include "osi-utilities/tracefile/writer/SingleChannelBinaryTraceFileWriter.h"
+#include "osi_groundtruth.pb.h"
+#include "osi_sensorview.pb.h"
+
+namespace {
+
+constexpr int64_t kFrameCount = 10;
+
+// Timestamps in seconds of the frames of a .osi ground truth file
+auto ReadSeconds(const std::filesystem::path& path) -> std::vector<int64_t> {
+    std::vector<int64_t> seconds;
+    osi3::SingleChannelBinaryTraceFileReader reader;
+    if (!reader.Open(path, osi3::ReaderTopLevelMessage::kGroundTruth)) {
+        return seconds;
+    }
+    while (reader.HasNext()) {
+        const auto result = reader.ReadMessage();
+        if (!result.has_value()) {
+            break;
+        }
+        seconds.push_back(static_cast<const osi3::GroundTruth&>(*result->message).timestamp().seconds());
+    }
+    reader.Close();
+    return seconds;
+}
+
+class TraceSlicingTest : public ::testing::Test {
+   protected:
+    std::filesystem::path osi_file_ = osi3::testing::MakeTempPath("slice_gt", osi3::testing::FileExtensions::kOsi);
+    std::filesystem::path mcap_file_ = osi3::testing::MakeTempPath("slice", osi3::testing::FileExtensions::kMcap);
+    std::filesystem::path output_directory_ = osi3::testing::MakeTempPath("slice_parts", "dir");
+    std::vector<std::filesystem::path> outputs_;
+
+    void SetUp() override {
+        std::filesystem::create_directories(output_directory_);
+        osi3::SingleChannelBinaryTraceFileWriter writer;
+        ASSERT_TRUE(writer.Open(osi_file_));
+        for (int64_t second = 0; second < kFrameCount; ++second) {
+            ASSERT_TRUE(writer.WriteMessage(osi3::testing::MakeGroundTruth(second)));
+        }
+        writer.Close();
+    }
+
+    void TearDown() override {
+        for (const auto& path : outputs_) {
+            osi3::testing::SafeRemoveTestFile(path);
+        }
+        osi3::testing::SafeRemoveTestFile(osi_file_);
+        osi3::testing::SafeRemoveTestFile(mcap_file_);
+        std::filesystem::remove_all(output_directory_);
+    }
+
+    auto Output(const char* name, const std::string& extension) -> std::filesystem::path {
+        outputs_.push_back(osi3::testing::MakeTempPath(name, extension));
+        return outputs_.back();
+    }
+
+    void WriteMcapFile(const bool statistics = false) {
+        osi3::MCAPTraceFileWriter writer;
+        writer.SetStatisticsEnabled(statistics);
+        ASSERT_TRUE(writer.Open(mcap_file_));
+        ASSERT_TRUE(writer.AddFileMetadata(osi3::MCAPTraceFileWriter::PrepareRequiredFileMetadata()));
+        writer.AddChannel("ground_truth", osi3::GroundTruth::descriptor());
+        writer.AddChannel("sensor_view", osi3::SensorView::descriptor());
+        for (int64_t second = 0; second < kFrameCount; ++second) {
+            ASSERT_TRUE(writer.WriteMessage(osi3::testing::MakeGroundTruth(second), "ground_truth"));
+            osi3::SensorView sensor_view;
+            sensor_view.mutable_timestamp()->set_seconds(second);
+            ASSERT_TRUE(writer.WriteMessage(sensor_view, "sensor_view"));
+        }
+        const std::string attachment = "<OpenDRIVE/>";
+        ASSERT_TRUE(writer.AddAttachment("road.xodr", "application/xml", attachment.data(), attachment.size()));
+        writer.Close();
+    }
+};
+
+TEST_F(TraceSlicingTest, SlicesTimeWindowOfBinaryFile) {
+    const auto output = Output("slice_time_gt", osi3::testing::FileExtensions::kOsi);
+    osi3::tracefile::SliceRange range;
+    range.start_time = 3'000'000'000;
+    range.end_time = 6'000'000'000;
+    EXPECT_EQ(osi3::tracefile::SliceTraceFile(osi_file_, output, range), 3U);
+    EXPECT_EQ(ReadSeconds(output), (std::vector<int64_t>{3, 4, 5}));
+}
+
+TEST_F(TraceSlicingTest, SlicesFrameRangeOfBinaryFile) {
+    const auto output = Output("slice_frames_gt", osi3::testing::FileExtensions::kOsi);
+    osi3::tracefile::SliceRange range;
+    range.first_frame = 7;
+    range.start_time = 2'500'000'000;  // both must hold
+    EXPECT_EQ(osi3::tracefile::SliceTraceFile(osi_file_, output, range), 3U);
+    EXPECT_EQ(ReadSeconds(output), (std::vector<int64_t>{7, 8, 9}));
+
+    range.first_frame = 20;
+    EXPECT_EQ(osi3::tracefile::SliceTraceFile(osi_file_, output, range), 0U);
+    EXPECT_EQ(std::filesystem::file_size(output), 0U);
+}
+
+TEST_F(TraceSlicingTest, SplitsBinaryFileIntoEqualParts) {
+    const auto parts = osi3::tracefile::SplitTraceFile(osi_file_, output_directory_, 3);
+    ASSERT_EQ(parts.size(), 3U);
+    EXPECT_EQ(parts[0].filename().string(), osi_file_.stem().string() + "_part1.osi");
+    std::vector<int64_t> seconds;
+    for (const auto& part : parts) {
+        const auto part_seconds = ReadSeconds(part);
+        EXPECT_GE(part_seconds.size(), 3U);
+        seconds.insert(seconds.end(), part_seconds.begin(), part_seconds.end());
+    }
+    EXPECT_EQ(seconds.size(), static_cast<size_t>(kFrameCount));
+    EXPECT_EQ(seconds.front(), 0);
+    EXPECT_EQ(seconds.back(), kFrameCount - 1);
+}
+
+TEST_F(TraceSlicingTest, RejectsUnsupportedArguments) {
+    const auto output = Output("slice_invalid", osi3::testing::FileExtensions::kMcap);
+    EXPECT_THROW(osi3::tracefile::SliceTraceFile(osi_file_, output, {}), std::invalid_argument);
+    EXPECT_THROW(osi3::tracefile::SplitTraceFile(osi_file_, output_directory_, 0), std::invalid_argument);
+    EXPECT_THROW(osi3::tracefile::SplitTraceFileByTopic(osi_file_, output_directory_), std::invalid_argument);
+}
+
+TEST_F(TraceSlicingTest, SlicesMcapFile) {
+    WriteMcapFile();
+    const auto output = Output("slice_out", osi3::testing::FileExtensions::kMcap);
+    osi3::tracefile::SliceRange range;
+    range.start_time = 2'000'000'000;
+    range.end_frame = 8;  // frames 0..7 are the messages of seconds 0..3
+    EXPECT_EQ(osi3::tracefile::SliceTraceFile(mcap_file_, output, range), 4U);
+
+    osi3::MCAPTraceFileReader reader;
+    ASSERT_TRUE(reader.Open(output));
+    EXPECT_EQ(reader.GetAttachments().size(), 1U);
+    size_t count = 0;
+    while (reader.HasNext()) {
+        const auto result = reader.ReadMessage();
+        ASSERT_TRUE(result.has_value());
+        ++count;
+    }
+    EXPECT_EQ(count, 4U);
+    reader.Close();
+}
+
+TEST_F(TraceSlicingTest, CollectsStatisticsOfMcapSlice) {
+    WriteMcapFile(true);
+    const auto output = Output("slice_statistics", osi3::testing::FileExtensions::kMcap);
+    osi3::tracefile::SliceRange range;
+    range.start_time = 2'000'000'000;
+    range.end_time = 5'000'000'000;
+    EXPECT_EQ(osi3::tracefile::SliceTraceFile(mcap_file_, output, range), 6U);
+
+    osi3::MCAPTraceFileReader reader;
+    ASSERT_TRUE(reader.Open(output));
+    std::vector<osi3::tracefile::ChannelStatistics> statistics;
+    for (const auto& [name, metadata] : reader.GetFileMetadata()) {
+        if (name == osi3::tracefile::config::kOsiTraceStatisticsMetadataName) {
+            const auto channel = osi3::tracefile::ParseStatisticsMetadata(metadata);
+            ASSERT_TRUE(channel.has_value());
+            statistics.push_back(*channel);
+        }
+    }
+    reader.Close();
+    // one record per channel, describing the slice instead of the input
+    ASSERT_EQ(statistics.size(), 2U);
+    for (const auto& channel : statistics) {
+        EXPECT_EQ(channel.message_count, 3U) << channel.topic;
+        EXPECT_EQ(channel.min_log_time, 2'000'000'000U) << channel.topic;
+        EXPECT_EQ(channel.max_log_time, 4'000'000'000U) << channel.topic;
+    }
+    EXPECT_EQ(statistics[0].message_type, "osi3.GroundTruth");
+    EXPECT_EQ(statistics[0].max_object_count, 1U);
+}
+
+TEST_F(TraceSlicingTest, SplitsMcapFileByTopic) {
+    WriteMcapFile();
+    osi3::tracefile::SliceOptions options;
+    options.copy_attachments = false;
+    const auto files = osi3::tracefile::SplitTraceFileByTopic(mcap_file_, output_directory_, options);
+    ASSERT_EQ(files.size(), 2U);
+    EXPECT_EQ(files[0].filename().string(), mcap_file_.stem().string() + "_ground_truth.mcap");
+    for (const auto& file : files) {
+        osi3::MCAPTraceFileReader reader;
+        ASSERT_TRUE(reader.Open(file));
+        EXPECT_TRUE(reader.GetAttachments().empty());
+        EXPECT_EQ(reader.GetAvailableTopics().size(), 1U);
+        reader.Close();
+    }
+}
+
+TEST_F(TraceSlicingTest, SplitsCollidingTopicsIntoSeparateFiles) {
+    {
+        osi3::MCAPTraceFileWriter writer;
+        ASSERT_TRUE(writer.Open(mcap_file_));
+        ASSERT_TRUE(writer.AddFileMetadata(osi3::MCAPTraceFileWriter::PrepareRequiredFileMetadata()));
+        writer.AddChannel("gt/front", osi3::GroundTruth::descriptor());
+        writer.AddChannel("gt.front", osi3::GroundTruth::descriptor());
+        ASSERT_TRUE(writer.WriteMessage(osi3::testing::MakeGroundTruth(0), "gt/front"));
+        ASSERT_TRUE(writer.WriteMessage(osi3::testing::MakeGroundTruth(1), "gt.front"));
+        ASSERT_TRUE(writer.WriteMessage(osi3::testing::MakeGroundTruth(2), "gt.front"));
+        writer.Close();
+    }
+
+    const auto files = osi3::tracefile::SplitTraceFileByTopic(mcap_file_, output_directory_);
+    ASSERT_EQ(files.size(), 2U);
+    EXPECT_NE(files[0], files[1]);
+    // files are ordered by topic: "gt.front" was seen second and got the index suffix
+    EXPECT_EQ(files[0].filename().string(), mcap_file_.stem().string() + "_gt_front_2.mcap");
+    EXPECT_EQ(files[1].filename().string(), mcap_file_.stem().string() + "_gt_front.mcap");
+    size_t total = 0;
+    for (const auto& file : files) {
+        osi3::MCAPTraceFileReader reader;
+        ASSERT_TRUE(reader.Open(file));
+        EXPECT_EQ(reader.GetAvailableTopics().size(), 1U);
+        while (reader.HasNext()) {
+            ASSERT_TRUE(reader.ReadMessage().has_value());
+            ++total;
+        }
+        reader.Close();
+    }
+    EXPECT_EQ(total, 3U);
+}
+
+}  // namespace
@@ -0,0 +1,112 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/TraceStatistics.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "osi_groundtruth.pb.h"
+#include "osi_sensordata.pb.h"
+
+namespace {
+
+auto MakeGroundTruth(const int object_count, const double host_velocity_x) -> std::string {
+    osi3::GroundTruth ground_truth;
+    ground_truth.mutable_timestamp()->set_seconds(1);
+    ground_truth.mutable_host_vehicle_id()->set_value(1);
+    for (int i = 0; i < object_count; ++i) {
+        auto* moving_object = ground_truth.add_moving_object();
+        moving_object->mutable_id()->set_value(i + 1);
+        moving_object->mutable_base()->mutable_velocity()->set_x(i == 0 ? host_velocity_x : 99.0);
+        moving_object->mutable_base()->mutable_velocity()->set_y(0.0);
+    }
+    return ground_truth.SerializeAsString();
+}
+
+TEST(TraceStatisticsTest, AggregatesGroundTruthFrames) {
+    osi3::tracefile::TraceStatistics statistics;
+    statistics.AddChannel("gt", osi3::GroundTruth::descriptor());
+    const auto slow = MakeGroundTruth(2, 10.0);
+    const auto fast = MakeGroundTruth(5, 40.0);
+    statistics.Observe("gt", 3000, slow);
+    statistics.Observe("gt", 1000, fast);
+    statistics.Observe("unknown", 0, fast);
+
+    ASSERT_EQ(statistics.GetChannels().size(), 1U);
+    const auto& channel = statistics.GetChannels()[0];
+    EXPECT_EQ(channel.topic, "gt");
+    EXPECT_EQ(channel.message_type, "osi3.GroundTruth");
+    EXPECT_EQ(channel.message_count, 2U);
+    EXPECT_EQ(channel.min_log_time, 1000U);
+    EXPECT_EQ(channel.max_log_time, 3000U);
+    EXPECT_EQ(channel.total_size, slow.size() + fast.size());
+    EXPECT_EQ(channel.min_size, slow.size());
+    EXPECT_EQ(channel.max_size, fast.size());
+    EXPECT_EQ(channel.min_object_count, 2U);
+    EXPECT_EQ(channel.max_object_count, 5U);
+    EXPECT_EQ(channel.host_speed_count, 2U);
+    EXPECT_DOUBLE_EQ(channel.min_host_speed, 10.0);
+    EXPECT_DOUBLE_EQ(channel.max_host_speed, 40.0);
+    EXPECT_DOUBLE_EQ(channel.MeanHostSpeed(), 25.0);
+
+    uint64_t histogram_frames = 0;
+    for (const auto count : channel.size_histogram) {
+        histogram_frames += count;
+    }
+    EXPECT_EQ(histogram_frames, 2U);
+}
+
+TEST(TraceStatisticsTest, SizeHistogramUsesPowerOfTwoBuckets) {
+    osi3::tracefile::TraceStatistics statistics;
+    statistics.AddChannel("sd", osi3::SensorData::descriptor());
+    statistics.Observe("sd", 0, std::string());
+    statistics.Observe("sd", 0, std::string(1, '\0'));
+    statistics.Observe("sd", 0, std::string(1023, '\0'));
+    statistics.Observe("sd", 0, std::string(1024, '\0'));
+
+    const auto& channel = statistics.GetChannels()[0];
+    EXPECT_EQ(channel.size_histogram[0], 2U);
+    EXPECT_EQ(channel.size_histogram[9], 1U);
+    EXPECT_EQ(channel.size_histogram[10], 1U);
+    // object statistics are only collected for GroundTruth
+    EXPECT_EQ(channel.object_count_frames, 0U);
+    EXPECT_EQ(channel.host_speed_count, 0U);
+}
+
+TEST(TraceStatisticsTest, MetadataRoundTrip) {
+    osi3::tracefile::TraceStatistics statistics;
+    statistics.AddChannel("gt", osi3::GroundTruth::descriptor());
+    statistics.Observe("gt", 5, MakeGroundTruth(3, 36.5));
+    statistics.Observe("gt", 7, MakeGroundTruth(1, 12.25));
+    const auto& original = statistics.GetChannels()[0];
+
+    const auto metadata = osi3::tracefile::ToMetadata(original);
+    EXPECT_EQ(metadata.at("message_count"), "2");
+    EXPECT_EQ(metadata.at("max_object_count"), "3");
+    EXPECT_EQ(metadata.at("max_host_speed"), "36.5");
+
+    const auto parsed = osi3::tracefile::ParseStatisticsMetadata(metadata);
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(parsed->topic, original.topic);
+    EXPECT_EQ(parsed->message_count, original.message_count);
+    EXPECT_EQ(parsed->min_log_time, original.min_log_time);
+    EXPECT_EQ(parsed->max_log_time, original.max_log_time);
+    EXPECT_EQ(parsed->min_size, original.min_size);
+    EXPECT_EQ(parsed->size_histogram, original.size_histogram);
+    EXPECT_EQ(parsed->min_object_count, original.min_object_count);
+    EXPECT_EQ(parsed->host_speed_count, original.host_speed_count);
+    EXPECT_DOUBLE_EQ(parsed->MeanHostSpeed(), original.MeanHostSpeed());
+}
+
+TEST(TraceStatisticsTest, RejectsIncompleteMetadata) {
+    EXPECT_FALSE(osi3::tracefile::ParseStatisticsMetadata({{"topic", "gt"}}).has_value());
+    EXPECT_FALSE(osi3::tracefile::ParseStatisticsMetadata({{"topic", "gt"}, {"message_type", "osi3.GroundTruth"}, {"message_count", "2"}}).has_value());
+    EXPECT_FALSE(osi3::tracefile::ParseStatisticsMetadata({{"topic", "gt"}, {"message_type", "osi3.GroundTruth"}, {"message_count", "0"}, {"size_histogram", "1024"}}).has_value());
+    EXPECT_TRUE(osi3::tracefile::ParseStatisticsMetadata({{"topic", "gt"}, {"message_type", "osi3.GroundTruth"}, {"message_count", "0"}}).has_value());
+}
+
+}  // namespace
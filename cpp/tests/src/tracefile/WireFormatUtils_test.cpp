@@ -0,0 +1,162 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/WireFormatUtils.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "osi_groundtruth.pb.h"
+#include "osi_sensorview.pb.h"
+
+namespace {
+
+auto TimestampFieldNumber(const google::protobuf::Descriptor* descriptor) -> uint32_t { return static_cast<uint32_t>(descriptor->FindFieldByName("timestamp")->number()); }
+
+TEST(WireFormatUtilsTest, ScanTopLevelFields) {
+    osi3::GroundTruth gt;
+    gt.mutable_timestamp()->set_seconds(5);
+    gt.mutable_host_vehicle_id()->set_value(42);
+    gt.add_moving_object()->mutable_id()->set_value(1);
+    gt.add_moving_object()->mutable_id()->set_value(2);
+    const auto serialized = gt.SerializeAsString();
+
+    osi3::tracefile::WireFieldReader reader(serialized);
+    osi3::tracefile::WireField field;
+    int moving_objects = 0;
+    int field_count = 0;
+    while (reader.Next(field)) {
+        ++field_count;
+        EXPECT_EQ(field.type, osi3::tracefile::WireType::kLengthDelimited);
+        if (field.number == static_cast<uint32_t>(osi3::GroundTruth::kMovingObjectFieldNumber)) {
+            osi3::MovingObject moving_object;
+            ASSERT_TRUE(moving_object.ParseFromArray(field.payload.data(), static_cast<int>(field.payload.size())));
+            EXPECT_EQ(moving_object.id().value(), static_cast<uint64_t>(++moving_objects));
+        }
+    }
+    EXPECT_FALSE(reader.HasError());
+    EXPECT_EQ(field_count, 4);
+    EXPECT_EQ(moving_objects, 2);
+    EXPECT_EQ(reader.Position(), serialized.size());
+}
+
+TEST(WireFormatUtilsTest, ScanVarintField) {
+    osi3::Identifier id;
+    id.set_value(300);
+    const auto serialized = id.SerializeAsString();
+
+    osi3::tracefile::WireFieldReader reader(serialized);
+    osi3::tracefile::WireField field;
+    ASSERT_TRUE(reader.Next(field));
+    EXPECT_EQ(field.type, osi3::tracefile::WireType::kVarint);
+    EXPECT_EQ(field.value, 300U);
+    EXPECT_EQ(field.begin, 0U);
+    EXPECT_EQ(field.end, serialized.size());
+    EXPECT_FALSE(reader.Next(field));
+    EXPECT_FALSE(reader.HasError());
+}
+
+TEST(WireFormatUtilsTest, TruncatedMessageIsReportedAsError) {
+    osi3::GroundTruth gt;
+    gt.mutable_timestamp()->set_seconds(5);
+    gt.mutable_host_vehicle_id()->set_value(42);
+    auto serialized = gt.SerializeAsString();
+    serialized.pop_back();
+
+    osi3::tracefile::WireFieldReader reader(serialized);
+    osi3::tracefile::WireField field;
+    while (reader.Next(field)) {
+    }
+    EXPECT_TRUE(reader.HasError());
+    EXPECT_FALSE(osi3::tracefile::FindLengthDelimitedField(serialized, 1).has_value());
+}
+
+TEST(WireFormatUtilsTest, FindLengthDelimitedFieldReturnsPayload) {
+    osi3::GroundTruth gt;
+    gt.mutable_host_vehicle_id()->set_value(42);
+    const auto serialized = gt.SerializeAsString();
+
+    const auto payload = osi3::tracefile::FindLengthDelimitedField(serialized, static_cast<uint32_t>(osi3::GroundTruth::kHostVehicleIdFieldNumber));
+    ASSERT_TRUE(payload.has_value());
+    EXPECT_EQ(std::string(*payload), gt.host_vehicle_id().SerializeAsString());
+    EXPECT_FALSE(osi3::tracefile::FindLengthDelimitedField(serialized, static_cast<uint32_t>(osi3::GroundTruth::kTimestampFieldNumber)).has_value());
+}
+
+TEST(WireFormatUtilsTest, PeekTimestampNanoseconds) {
+    osi3::GroundTruth gt;
+    gt.mutable_timestamp()->set_seconds(12);
+    gt.mutable_timestamp()->set_nanos(345);
+    gt.add_moving_object()->mutable_id()->set_value(1);
+
+    const auto log_time = osi3::tracefile::PeekTimestampNanoseconds(gt.SerializeAsString(), TimestampFieldNumber(osi3::GroundTruth::descriptor()));
+    ASSERT_TRUE(log_time.has_value());
+    EXPECT_EQ(*log_time, 12'000'000'345ULL);
+}
+
+TEST(WireFormatUtilsTest, PeekTimestampNanosecondsUsesMessageSpecificFieldNumber) {
+    osi3::SensorView sv;
+    sv.mutable_timestamp()->set_seconds(3);
+    sv.mutable_global_ground_truth()->mutable_timestamp()->set_seconds(99);
+
+    const auto log_time = osi3::tracefile::PeekTimestampNanoseconds(sv.SerializeAsString(), TimestampFieldNumber(osi3::SensorView::descriptor()));
+    ASSERT_TRUE(log_time.has_value());
+    EXPECT_EQ(*log_time, 3'000'000'000ULL);
+}
+
+TEST(WireFormatUtilsTest, PeekTimestampNanosecondsRejectsNegativeSeconds) {
+    osi3::GroundTruth gt;
+    gt.mutable_timestamp()->set_seconds(-1);
+    EXPECT_FALSE(osi3::tracefile::PeekTimestampNanoseconds(gt.SerializeAsString(), TimestampFieldNumber(osi3::GroundTruth::descriptor())).has_value());
+}
+
+TEST(WireFormatUtilsTest, PeekTimestampNanosecondsWithoutTimestamp) {
+    osi3::GroundTruth gt;
+    gt.mutable_host_vehicle_id()->set_value(1);
+    EXPECT_FALSE(osi3::tracefile::PeekTimestampNanoseconds(gt.SerializeAsString(), TimestampFieldNumber(osi3::GroundTruth::descriptor())).has_value());
+}
+
+TEST(WireFormatUtilsTest, PeekTimestampNanosecondsMergesOccurrences) {
+    osi3::GroundTruth first;
+    first.mutable_timestamp()->set_seconds(3);
+    first.mutable_timestamp()->set_nanos(9);
+    first.mutable_host_vehicle_id()->set_value(12);
+    osi3::GroundTruth second;
+    second.mutable_timestamp()->set_nanos(7);
+    second.mutable_host_vehicle_id();
+    const auto serialized = first.SerializeAsString() + second.SerializeAsString();
+    osi3::GroundTruth merged;
+    ASSERT_TRUE(merged.ParseFromString(serialized));
+    ASSERT_EQ(merged.timestamp().seconds(), 3);
+    ASSERT_EQ(merged.timestamp().nanos(), 7);
+
+    const auto log_time = osi3::tracefile::PeekTimestampNanoseconds(serialized, TimestampFieldNumber(osi3::GroundTruth::descriptor()));
+    ASSERT_TRUE(log_time.has_value());
+    EXPECT_EQ(*log_time, 3000000007ULL);
+
+    std::string merge_buffer;
+    const auto identifier = osi3::tracefile::FindMergedMessageField(serialized, static_cast<uint32_t>(osi3::GroundTruth::kHostVehicleIdFieldNumber), merge_buffer);
+    ASSERT_TRUE(identifier.has_value());
+    osi3::Identifier parsed;
+    ASSERT_TRUE(parsed.ParseFromArray(identifier->data(), static_cast<int>(identifier->size())));
+    EXPECT_EQ(parsed.value(), merged.host_vehicle_id().value());
+}
+
+TEST(WireFormatUtilsTest, AppendLengthDelimitedFieldEmbedsPayload) {
+    osi3::Identifier identifier;
+    identifier.set_value(300);
+    std::string serialized;
+    osi3::tracefile::AppendLengthDelimitedField(serialized, static_cast<uint32_t>(osi3::GroundTruth::kHostVehicleIdFieldNumber), identifier.SerializeAsString());
+
+    osi3::GroundTruth ground_truth;
+    ASSERT_TRUE(ground_truth.ParseFromString(serialized));
+    EXPECT_EQ(ground_truth.host_vehicle_id().value(), 300U);
+
+    std::string varint;
+    osi3::tracefile::AppendVarint(varint, 300);
+    EXPECT_EQ(varint, std::string("\xAC\x02", 2));
+}
+
+}  // namespace
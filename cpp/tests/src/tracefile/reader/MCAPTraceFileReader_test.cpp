@@ -323,6 +323,25 @@ TEST_F(McapTraceFileReaderTest, SetTopicsWithEmptySetClearsFilterAndRestartsIter
     EXPECT_FALSE(reader_.ReadMessage().has_value());
 }
 
+TEST_F(McapTraceFileReaderTest, SetReadOptionsRestartsIterationInTimeWindow) {
+    ASSERT_TRUE(reader_.Open(test_file_));
+    reader_.SetSkipIncompatibleMessages(true);
+
+    mcap::ReadMessageOptions window;
+    window.startTime = 1'000'000'000;
+    window.endTime = 2'000'000'000;
+    reader_.SetReadOptions(window);
+    auto in_window = reader_.ReadMessage();
+    ASSERT_TRUE(in_window.has_value());
+    EXPECT_EQ(in_window->channel_name, "sv");
+    EXPECT_FALSE(reader_.ReadMessage().has_value());
+
+    reader_.SetReadOptions({});
+    auto first_result = reader_.ReadMessage();
+    ASSERT_TRUE(first_result.has_value());
+    EXPECT_EQ(first_result->channel_name, "gt");
+}
+
 TEST_F(McapTraceFileReaderTest, GetAvailableTopics) {
     ASSERT_TRUE(reader_.Open(test_file_));
 
@@ -575,3 +594,109 @@ TEST(ReadStatusAndFormatEnumTest, ReadStatusValues) {
 TEST(TypeAliasTest, MultiTraceFileReaderIsAlias) {
     static_assert(std::is_same_v<osi3::MultiTraceFileReader, osi3::MCAPTraceFileReader>, "MultiTraceFileReader must alias MCAPTraceFileReader");
 }
+
+TEST_F(McapTraceFileReaderTest, ReadRawMessageReturnsSerializedBytes) {
+    ASSERT_TRUE(reader_.Open(test_file_));
+    reader_.SetSkipIncompatibleMessages(true);
+
+    auto result1 = reader_.ReadRawMessage();
+    ASSERT_TRUE(result1.has_value());
+    EXPECT_EQ(result1->status, osi3::ReadStatus::kOk);
+    EXPECT_EQ(result1->channel_name, "gt");
+    EXPECT_EQ(result1->message_type, osi3::ReaderTopLevelMessage::kGroundTruth);
+    EXPECT_EQ(result1->log_time, 456U);
+    osi3::GroundTruth ground_truth;
+    ASSERT_TRUE(ground_truth.ParseFromArray(result1->data, static_cast<int>(result1->size)));
+    EXPECT_EQ(ground_truth.timestamp().nanos(), 456);
+
+    // The bytes stay valid until the next HasNext() call
+    ASSERT_TRUE(reader_.HasNext());
+    auto result2 = reader_.ReadRawMessage();
+    ASSERT_TRUE(result2.has_value());
+    EXPECT_EQ(result2->channel_name, "sv");
+    EXPECT_EQ(result2->message_type, osi3::ReaderTopLevelMessage::kSensorView);
+
+    // JSON message is skipped
+    EXPECT_FALSE(reader_.ReadRawMessage().has_value());
+}
+
+TEST_F(McapTraceFileReaderTest, ReadRawMessageReportsIncompatibleMessages) {
+    ASSERT_TRUE(reader_.Open(test_file_));
+    reader_.SetSkipIncompatibleMessages(false);
+    reader_.SetLogIncompatibleMessages(false);
+
+    ASSERT_TRUE(reader_.ReadRawMessage().has_value());
+    ASSERT_TRUE(reader_.ReadRawMessage().has_value());
+    auto result3 = reader_.ReadRawMessage();
+    ASSERT_TRUE(result3.has_value());
+    EXPECT_EQ(result3->status, osi3::ReadStatus::kIncompatible);
+    EXPECT_EQ(result3->data, nullptr);
+    EXPECT_EQ(result3->channel_name, "json_topic");
+    EXPECT_FALSE(reader_.HasNext());
+}
+
+TEST_F(McapTraceFileReaderTest, ReadRawMessageAndReadMessageCanBeMixed) {
+    ASSERT_TRUE(reader_.Open(test_file_));
+    reader_.SetSkipIncompatibleMessages(true);
+
+    auto raw = reader_.ReadRawMessage();
+    ASSERT_TRUE(raw.has_value());
+    EXPECT_EQ(raw->channel_name, "gt");
+
+    auto decoded = reader_.ReadMessage();
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->channel_name, "sv");
+}
+
+TEST_F(McapTraceFileReaderTest, ReadAttachmentsOnDemand) {
+    const auto attachment_file = osi3::testing::MakeTempPath("mcap_attachment_road", osi3::testing::FileExtensions::kTxth);
+    const auto trace_file = osi3::testing::MakeTempPath("mcap_attachments", osi3::testing::FileExtensions::kMcap);
+    const std::string road_network = "<OpenDRIVE><header revMajor=\"1\" revMinor=\"8\"/></OpenDRIVE>";
+    { std::ofstream(attachment_file, std::ios::binary) << road_network; }
+    osi3::SensorViewConfiguration sensor_view_configuration;
+    sensor_view_configuration.mutable_sensor_id()->set_value(42);
+
+    osi3::MCAPTraceFileWriter writer;
+    EXPECT_FALSE(writer.AddAttachment("sensor_view_configuration", sensor_view_configuration));
+    ASSERT_TRUE(writer.Open(trace_file));
+    ASSERT_TRUE(writer.AddFileMetadata(osi3::MCAPTraceFileWriter::PrepareRequiredFileMetadata()));
+    writer.AddChannel("gt", osi3::GroundTruth::descriptor());
+    ASSERT_TRUE(writer.AddAttachment("sensor_view_configuration", sensor_view_configuration, 7));
+    ASSERT_TRUE(writer.AddAttachmentFromFile(attachment_file, "application/xml"));
+    EXPECT_FALSE(writer.AddAttachmentFromFile("nonexistent.xodr", "application/xml"));
+    osi3::GroundTruth ground_truth;
+    ground_truth.mutable_timestamp()->set_seconds(1);
+    ASSERT_TRUE(writer.WriteMessage(ground_truth, "gt"));
+    writer.Close();
+
+    osi3::MCAPTraceFileReader reader;
+    EXPECT_TRUE(reader.GetAttachments().empty());
+    ASSERT_TRUE(reader.Open(trace_file));
+    const auto attachments = reader.GetAttachments();
+    ASSERT_EQ(attachments.size(), 2U);
+    const auto road_name = attachment_file.filename().string();
+    const auto road_it = std::find_if(attachments.begin(), attachments.end(), [&](const auto& attachment) { return attachment.name == road_name; });
+    ASSERT_NE(road_it, attachments.end());
+    EXPECT_EQ(road_it->media_type, "application/xml");
+    EXPECT_EQ(road_it->data_size, road_network.size());
+
+    // message iteration is not affected by reading attachments in between
+    ASSERT_TRUE(reader.HasNext());
+    EXPECT_EQ(reader.ReadAttachment(*road_it), road_network);
+    const auto configuration = reader.ReadAttachmentMessage<osi3::SensorViewConfiguration>("sensor_view_configuration");
+    ASSERT_TRUE(configuration.has_value());
+    EXPECT_EQ(configuration->sensor_id().value(), 42U);
+    const auto result = reader.ReadMessage();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->channel_name, "gt");
+    EXPECT_FALSE(reader.ReadAttachment("nonexistent").has_value());
+
+    const auto configuration_it = std::find_if(attachments.begin(), attachments.end(), [](const auto& attachment) { return attachment.name == "sensor_view_configuration"; });
+    ASSERT_NE(configuration_it, attachments.end());
+    EXPECT_EQ(configuration_it->media_type, "application/protobuf; proto=osi3.SensorViewConfiguration");
+    EXPECT_EQ(configuration_it->log_time, 7U);
+
+    reader.Close();
+    osi3::testing::SafeRemoveTestFile(trace_file);
+    osi3::testing::SafeRemoveTestFile(attachment_file);
+}
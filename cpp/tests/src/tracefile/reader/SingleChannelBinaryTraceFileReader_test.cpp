@@ -249,3 +249,197 @@ TEST_F(SingleChannelBinaryTraceFileReaderTest, OpenWithMismatchedMessageType) {
     EXPECT_TRUE(reader_.Open(test_file_gt_, osi3::ReaderTopLevelMessage::kSensorView));
     reader_.Close();
 }
+
+TEST_F(SingleChannelBinaryTraceFileReaderTest, ReadRawMessageReturnsSerializedBytes) {
+    ASSERT_TRUE(reader_.Open(test_file_gt_));
+    ASSERT_TRUE(reader_.HasNext());
+    const auto result = reader_.ReadRawMessage();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->status, osi3::ReadStatus::kOk);
+    EXPECT_EQ(result->message_type, osi3::ReaderTopLevelMessage::kGroundTruth);
+    EXPECT_EQ(result->log_time, 123000000456ULL);
+    ASSERT_NE(result->data, nullptr);
+
+    osi3::GroundTruth ground_truth;
+    ASSERT_TRUE(ground_truth.ParseFromArray(result->data, static_cast<int>(result->size)));
+    EXPECT_EQ(ground_truth.timestamp().seconds(), 123);
+    EXPECT_FALSE(reader_.HasNext());
+}
+
+TEST_F(SingleChannelBinaryTraceFileReaderTest, ReadRawMessageWithoutTimestampHasZeroLogTime) {
+    const auto no_timestamp_file = osi3::testing::MakeTempPath("no_ts_gt", osi3::testing::FileExtensions::kOsi);
+    {
+        std::ofstream file(no_timestamp_file, std::ios::binary);
+        osi3::GroundTruth gt;
+        gt.mutable_host_vehicle_id()->set_value(7);
+        std::string serialized = gt.SerializeAsString();
+        uint32_t size = serialized.size();
+        file.write(reinterpret_cast<char*>(&size), sizeof(size));
+        file.write(serialized.data(), size);
+    }
+
+    ASSERT_TRUE(reader_.Open(no_timestamp_file, osi3::ReaderTopLevelMessage::kGroundTruth));
+    const auto result = reader_.ReadRawMessage();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->status, osi3::ReadStatus::kOk);
+    EXPECT_EQ(result->log_time, 0U);
+    reader_.Close();
+    osi3::testing::SafeRemoveTestFile(no_timestamp_file);
+}
+
+TEST_F(SingleChannelBinaryTraceFileReaderTest, ReadRawMessageReturnsNulloptWhenEmpty) {
+    ASSERT_TRUE(reader_.Open(test_file_sv_));
+    ASSERT_TRUE(reader_.ReadRawMessage().has_value());
+    EXPECT_FALSE(reader_.ReadRawMessage().has_value());
+}
+
+TEST_F(SingleChannelBinaryTraceFileReaderTest, ReadMessageSetsLogTime) {
+    ASSERT_TRUE(reader_.Open(test_file_gt_));
+    const auto result = reader_.ReadMessage();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->log_time, 123000000456ULL);
+    EXPECT_TRUE(result->serialized_message.empty());
+}
+
+TEST_F(SingleChannelBinaryTraceFileReaderTest, LazyDecodingDefersParsing) {
+    reader_.SetLazyDecoding(true);
+    ASSERT_TRUE(reader_.Open(test_file_gt_));
+    auto result = reader_.ReadMessage();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->status, osi3::ReadStatus::kOk);
+    EXPECT_EQ(result->message_type, osi3::ReaderTopLevelMessage::kGroundTruth);
+    EXPECT_EQ(result->log_time, 123000000456ULL);
+    EXPECT_FALSE(result->IsDecoded());
+    EXPECT_FALSE(result->serialized_message.empty());
+
+    EXPECT_EQ(result->DecodeAs<osi3::SensorView>(), nullptr);
+    const auto* ground_truth = result->DecodeAs<osi3::GroundTruth>();
+    ASSERT_NE(ground_truth, nullptr);
+    EXPECT_TRUE(result->IsDecoded());
+    EXPECT_EQ(ground_truth->timestamp().nanos(), 456);
+    // repeated accesses return the cached message
+    EXPECT_EQ(result->Decode(), ground_truth);
+    EXPECT_FALSE(reader_.HasNext());
+}
+
+TEST_F(SingleChannelBinaryTraceFileReaderTest, LazyDecodingReportsInvalidBytesOnAccess) {
+    osi3::ReadResult result;
+    result.message_type = osi3::ReaderTopLevelMessage::kGroundTruth;
+    result.serialized_message = "\xFF\xFF\xFF";
+    EXPECT_EQ(result.Decode(), nullptr);
+    EXPECT_EQ(result.status, osi3::ReadStatus::kError);
+    EXPECT_FALSE(result.error_message.empty());
+}
+
+TEST_F(SingleChannelBinaryTraceFileReaderTest, StreamingParseReadsMessagesLargerThanChunk) {
+    const auto large_file = osi3::testing::MakeTempPath("large_gt", osi3::testing::FileExtensions::kOsi);
+    const std::string payload(3 * osi3::tracefile::config::kStreamingParseChunkSize + 17, 'x');
+    {
+        std::ofstream file(large_file, std::ios::binary);
+        for (int i = 0; i < 3; ++i) {
+            osi3::GroundTruth gt;
+            gt.mutable_timestamp()->set_seconds(i);
+            gt.set_model_reference(payload);
+            gt.add_moving_object()->mutable_id()->set_value(i);
+            std::string serialized = gt.SerializeAsString();
+            uint32_t size = serialized.size();
+            file.write(reinterpret_cast<char*>(&size), sizeof(size));
+            file.write(serialized.data(), size);
+        }
+    }
+
+    reader_.SetStreamingParse(true);
+    ASSERT_TRUE(reader_.Open(large_file));
+    int count = 0;
+    while (reader_.HasNext()) {
+        const auto result = reader_.ReadMessage();
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result->status, osi3::ReadStatus::kOk);
+        EXPECT_EQ(result->log_time, static_cast<uint64_t>(count) * 1000000000ULL);
+        const auto* gt = dynamic_cast<osi3::GroundTruth*>(result->message.get());
+        ASSERT_NE(gt, nullptr);
+        EXPECT_EQ(gt->model_reference(), payload);
+        ASSERT_EQ(gt->moving_object_size(), 1);
+        EXPECT_EQ(gt->moving_object(0).id().value(), static_cast<uint64_t>(count));
+        ++count;
+    }
+    EXPECT_EQ(count, 3);
+    reader_.Close();
+    osi3::testing::SafeRemoveTestFile(large_file);
+}
+
+TEST_F(SingleChannelBinaryTraceFileReaderTest, StreamingParseMergesTimestampsAcrossChunks) {
+    const auto merged_file = osi3::testing::MakeTempPath("merged_gt", osi3::testing::FileExtensions::kOsi);
+    {
+        // concatenated messages merge, so the timestamp occurs again behind a payload spanning several chunks
+        osi3::GroundTruth first;
+        first.mutable_timestamp()->set_seconds(1);
+        first.set_model_reference(std::string(2 * osi3::tracefile::config::kStreamingParseChunkSize, 'x'));
+        osi3::GroundTruth second;
+        second.mutable_timestamp()->set_nanos(7);
+        const std::string serialized = first.SerializeAsString() + second.SerializeAsString();
+        std::ofstream file(merged_file, std::ios::binary);
+        uint32_t size = serialized.size();
+        file.write(reinterpret_cast<char*>(&size), sizeof(size));
+        file.write(serialized.data(), size);
+    }
+
+    reader_.SetStreamingParse(true);
+    ASSERT_TRUE(reader_.Open(merged_file));
+    const auto result = reader_.ReadMessage();
+    ASSERT_TRUE(result.has_value());
+    const auto* gt = dynamic_cast<osi3::GroundTruth*>(result->message.get());
+    ASSERT_NE(gt, nullptr);
+    EXPECT_EQ(gt->timestamp().seconds(), 1);
+    EXPECT_EQ(gt->timestamp().nanos(), 7);
+    // the wire peek merges the occurrences like the parser, matching the non-streaming reader
+    EXPECT_EQ(result->log_time, 1000000007ULL);
+    reader_.Close();
+    osi3::testing::SafeRemoveTestFile(merged_file);
+}
+
+TEST_F(SingleChannelBinaryTraceFileReaderTest, StreamingParseSkipsInvalidMessage) {
+    const auto invalid_file = osi3::testing::MakeTempPath("invalid_gt", osi3::testing::FileExtensions::kOsi);
+    {
+        std::ofstream file(invalid_file, std::ios::binary);
+        const std::string garbage = "\xFF\xFF\xFF\xFF";
+        uint32_t size = garbage.size();
+        file.write(reinterpret_cast<char*>(&size), sizeof(size));
+        file.write(garbage.data(), size);
+        osi3::GroundTruth gt;
+        gt.mutable_timestamp()->set_seconds(5);
+        std::string serialized = gt.SerializeAsString();
+        size = serialized.size();
+        file.write(reinterpret_cast<char*>(&size), sizeof(size));
+        file.write(serialized.data(), size);
+    }
+
+    reader_.SetStreamingParse(true);
+    ASSERT_TRUE(reader_.Open(invalid_file));
+    EXPECT_THROW(reader_.ReadMessage(), std::runtime_error);
+    // the reader stays aligned to the frame boundaries
+    const auto result = reader_.ReadMessage();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->log_time, 5000000000ULL);
+    reader_.Close();
+    osi3::testing::SafeRemoveTestFile(invalid_file);
+}
+
+TEST_F(SingleChannelBinaryTraceFileReaderTest, StreamingParseDetectsTruncatedMessage) {
+    const auto truncated_file = osi3::testing::MakeTempPath("truncated_gt", osi3::testing::FileExtensions::kOsi);
+    {
+        std::ofstream file(truncated_file, std::ios::binary);
+        osi3::GroundTruth gt;
+        gt.mutable_timestamp()->set_seconds(1);
+        std::string serialized = gt.SerializeAsString();
+        uint32_t size = serialized.size() + 10;
+        file.write(reinterpret_cast<char*>(&size), sizeof(size));
+        file.write(serialized.data(), static_cast<std::streamsize>(serialized.size()));
+    }
+
+    reader_.SetStreamingParse(true);
+    ASSERT_TRUE(reader_.Open(truncated_file));
+    EXPECT_THROW(reader_.ReadMessage(), std::runtime_error);
+    reader_.Close();
+    osi3::testing::SafeRemoveTestFile(truncated_file);
+}
@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/writer/MCAPCheckpoint.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <mcap/reader.hpp>
+#include <string>
+
+#include "../../TestUtilities.h"
+#include "osi-utilities/tracefile/writer/MCAPTraceFileWriter.h"
+#include "osi_groundtruth.pb.h"
+
+namespace {
+
+class MCAPCheckpointTest : public ::testing::Test {
+   protected:
+    std::filesystem::path test_file_ = osi3::testing::MakeTempPath("checkpoint", osi3::testing::FileExtensions::kMcap);
+    std::filesystem::path crashed_file_ = osi3::testing::MakeTempPath("checkpoint_crashed", osi3::testing::FileExtensions::kMcap);
+
+    void TearDown() override {
+        for (const auto& path : {test_file_, crashed_file_}) {
+            osi3::testing::SafeRemoveTestFile(path);
+            osi3::testing::SafeRemoveTestFile(osi3::tracefile::GetCheckpointJournalPath(path));
+        }
+    }
+
+    // Copies the trace file and its journal as they are on disk, like after a crash of the recorder
+    void SimulateCrash() const {
+        std::filesystem::copy_file(test_file_, crashed_file_, std::filesystem::copy_options::overwrite_existing);
+        std::filesystem::copy_file(osi3::tracefile::GetCheckpointJournalPath(test_file_), osi3::tracefile::GetCheckpointJournalPath(crashed_file_),
+                                   std::filesystem::copy_options::overwrite_existing);
+    }
+};
+
+TEST_F(MCAPCheckpointTest, JournalPath) {
+    EXPECT_EQ(osi3::tracefile::GetCheckpointJournalPath("trace.mcap"), std::filesystem::path("trace.mcap.journal"));
+}
+
+TEST_F(MCAPCheckpointTest, RecoversUpToLastCheckpoint) {
+    osi3::MCAPTraceFileWriter writer;
+    osi3::McapCheckpointOptions options;
+    options.interval_bytes = 1;  // checkpoint after every message
+    writer.SetCheckpointOptions(options);
+    ASSERT_TRUE(writer.Open(test_file_));
+    ASSERT_TRUE(writer.AddFileMetadata(osi3::MCAPTraceFileWriter::PrepareRequiredFileMetadata()));
+    EXPECT_TRUE(std::filesystem::exists(osi3::tracefile::GetCheckpointJournalPath(test_file_)));
+    for (int64_t second = 1; second <= 5; ++second) {
+        ASSERT_TRUE(writer.WriteMessage(osi3::testing::MakeGroundTruth(second), "gt"));
+    }
+    SimulateCrash();
+    ASSERT_TRUE(writer.WriteMessage(osi3::testing::MakeGroundTruth(6), "gt"));
+    writer.Close();
+    EXPECT_FALSE(std::filesystem::exists(osi3::tracefile::GetCheckpointJournalPath(test_file_)));
+
+    ASSERT_TRUE(osi3::tracefile::RecoverMcapTraceFile(crashed_file_));
+    EXPECT_FALSE(std::filesystem::exists(osi3::tracefile::GetCheckpointJournalPath(crashed_file_)));
+
+    mcap::McapReader reader;
+    ASSERT_TRUE(reader.open(crashed_file_.string()).ok());
+    ASSERT_TRUE(reader.readSummary(mcap::ReadSummaryMethod::NoFallbackScan).ok());
+    ASSERT_TRUE(reader.statistics().has_value());
+    EXPECT_EQ(reader.statistics()->messageCount, 5U);
+    EXPECT_EQ(reader.chunkIndexes().size(), 5U);
+    EXPECT_EQ(reader.metadataIndexes().count("net.asam.osi.trace"), 1U);
+    ASSERT_EQ(reader.channels().size(), 1U);
+    EXPECT_EQ(reader.channels().begin()->second->topic, "gt");
+
+    int64_t second = 0;
+    for (const auto& view : reader.readMessages()) {
+        osi3::GroundTruth ground_truth;
+        ASSERT_TRUE(ground_truth.ParseFromArray(view.message.data, static_cast<int>(view.message.dataSize)));
+        EXPECT_EQ(ground_truth.timestamp().seconds(), ++second);
+    }
+    EXPECT_EQ(second, 5);
+}
+
+TEST_F(MCAPCheckpointTest, ManualCheckpoint) {
+    osi3::MCAPTraceFileWriter writer;
+    osi3::McapCheckpointOptions options;
+    options.interval = std::chrono::hours(1);
+    writer.SetCheckpointOptions(options);
+    ASSERT_TRUE(writer.Open(test_file_));
+    ASSERT_TRUE(writer.AddFileMetadata(osi3::MCAPTraceFileWriter::PrepareRequiredFileMetadata()));
+    ASSERT_TRUE(writer.WriteMessage(osi3::testing::MakeGroundTruth(1), "gt"));
+    ASSERT_TRUE(writer.WriteMessage(osi3::testing::MakeGroundTruth(2), "gt"));
+    ASSERT_TRUE(writer.Checkpoint());
+    ASSERT_TRUE(writer.WriteMessage(osi3::testing::MakeGroundTruth(3), "gt"));
+    SimulateCrash();
+    writer.Close();
+
+    ASSERT_TRUE(osi3::tracefile::RecoverMcapTraceFile(crashed_file_));
+    mcap::McapReader reader;
+    ASSERT_TRUE(reader.open(crashed_file_.string()).ok());
+    ASSERT_TRUE(reader.readSummary(mcap::ReadSummaryMethod::NoFallbackScan).ok());
+    EXPECT_EQ(reader.statistics()->messageCount, 2U);
+}
+
+TEST_F(MCAPCheckpointTest, FailedCheckpointKeepsJournal) {
+    if (!std::filesystem::exists("/dev/full")) {
+        GTEST_SKIP() << "/dev/full is not available";
+    }
+    std::filesystem::create_symlink("/dev/full", test_file_);
+    osi3::MCAPTraceFileWriter writer;
+    osi3::McapCheckpointOptions options;
+    options.interval_bytes = 1;
+    writer.SetCheckpointOptions(options);
+    ASSERT_TRUE(writer.Open(test_file_));
+    ASSERT_TRUE(writer.AddFileMetadata(osi3::MCAPTraceFileWriter::PrepareRequiredFileMetadata()));
+    // the checkpoint due after the message cannot flush the file
+    EXPECT_FALSE(writer.WriteMessage(osi3::testing::MakeGroundTruth(1), "gt"));
+    writer.Close();
+    EXPECT_TRUE(writer.CloseFailed());
+    // the file is incomplete, so the journal stays for recovery
+    EXPECT_TRUE(std::filesystem::exists(osi3::tracefile::GetCheckpointJournalPath(test_file_)));
+}
+
+TEST_F(MCAPCheckpointTest, CompleteFileIsLeftUnchanged) {
+    {
+        osi3::MCAPTraceFileWriter writer;
+        ASSERT_TRUE(writer.Open(test_file_));
+        ASSERT_TRUE(writer.AddFileMetadata(osi3::MCAPTraceFileWriter::PrepareRequiredFileMetadata()));
+        ASSERT_TRUE(writer.WriteMessage(osi3::testing::MakeGroundTruth(1), "gt"));
+        osi3::McapCheckpointOptions options;
+        options.interval_bytes = 1;
+        writer.SetCheckpointOptions(options);
+        // checkpoints are only enabled by the next Open()
+        EXPECT_FALSE(writer.Checkpoint());
+    }
+    EXPECT_FALSE(std::filesystem::exists(osi3::tracefile::GetCheckpointJournalPath(test_file_)));
+    EXPECT_FALSE(osi3::tracefile::RecoverMcapTraceFile(test_file_));
+
+    osi3::MCAPTraceFileWriter writer;
+    osi3::McapCheckpointOptions options;
+    options.interval_bytes = 1;
+    writer.SetCheckpointOptions(options);
+    ASSERT_TRUE(writer.Open(crashed_file_));
+    ASSERT_TRUE(writer.AddFileMetadata(osi3::MCAPTraceFileWriter::PrepareRequiredFileMetadata()));
+    ASSERT_TRUE(writer.WriteMessage(osi3::testing::MakeGroundTruth(1), "gt"));
+    // keep the journal of a properly closed file, e.g. when the recorder died while removing it
+    const auto journal_path = osi3::tracefile::GetCheckpointJournalPath(crashed_file_);
+    const auto kept_journal = osi3::testing::MakeTempPath("checkpoint_journal", osi3::testing::FileExtensions::kMcap);
+    std::filesystem::copy_file(journal_path, kept_journal);
+    writer.Close();
+    std::filesystem::rename(kept_journal, journal_path);
+
+    const auto size = std::filesystem::file_size(crashed_file_);
+    ASSERT_TRUE(osi3::tracefile::RecoverMcapTraceFile(crashed_file_));
+    EXPECT_EQ(std::filesystem::file_size(crashed_file_), size);
+    EXPECT_FALSE(std::filesystem::exists(journal_path));
+}
+
+TEST_F(MCAPCheckpointTest, RejectsInvalidJournal) {
+    { std::ofstream(test_file_, std::ios::binary) << "\x89MCAP0\r\n"; }
+    { std::ofstream(osi3::tracefile::GetCheckpointJournalPath(test_file_), std::ios::binary) << "not a journal"; }
+    EXPECT_FALSE(osi3::tracefile::RecoverMcapTraceFile(test_file_));
+    EXPECT_EQ(std::filesystem::file_size(test_file_), 8U);
+}
+
+}  // namespace
@@ -15,8 +15,10 @@
 #include <type_traits>
 
 #include "../../TestUtilities.h"
+#include "osi-utilities/tracefile/reader/MCAPTraceFileReader.h"
 #include "osi_groundtruth.pb.h"
 #include "osi_sensordata.pb.h"
+#include "osi_sensorview.pb.h"
 
 class MCAPTraceFileWriterTest : public ::testing::Test {
    protected:
@@ -87,6 +89,68 @@ TEST_F(MCAPTraceFileWriterTest, WriteMessage) {
     EXPECT_TRUE(writer_.WriteMessage(ground_truth, topic));
 }
 
+TEST_F(MCAPTraceFileWriterTest, WriteRawMessage) {
+    ASSERT_TRUE(writer_.Open(test_file_));
+
+    osi3::GroundTruth ground_truth;
+    ground_truth.mutable_timestamp()->set_seconds(123);
+    ground_truth.mutable_timestamp()->set_nanos(456);
+    const auto serialized = ground_truth.SerializeAsString();
+
+    // Topic and required metadata are auto-registered
+    EXPECT_TRUE(writer_.WriteRawMessage(serialized.data(), serialized.size(), osi3::GroundTruth::descriptor(), "/ground_truth"));
+    writer_.Close();
+
+    std::ifstream file(test_file_, std::ios::binary);
+    mcap::McapReader mcap_reader;
+    ASSERT_TRUE(mcap_reader.open(file).ok());
+    size_t message_count = 0;
+    for (const auto& view : mcap_reader.readMessages()) {
+        EXPECT_EQ(view.channel->topic, "/ground_truth");
+        EXPECT_EQ(view.message.logTime, 123000000456U);
+        EXPECT_EQ(std::string(reinterpret_cast<const char*>(view.message.data), view.message.dataSize), serialized);
+        ++message_count;
+    }
+    EXPECT_EQ(message_count, 1U);
+    mcap_reader.close();
+}
+
+TEST_F(MCAPTraceFileWriterTest, WriteMessagesLargerThanRetainedBufferLimit) {
+    ASSERT_TRUE(writer_.Open(test_file_));
+    AddRequiredMetadata();
+    writer_.SetRetainedBufferLimit(1024);
+    writer_.SetCompaction(osi3::tracefile::CompactionOptions{});
+    writer_.AddChannel("/ground_truth", osi3::GroundTruth::descriptor());
+
+    osi3::GroundTruth ground_truth;
+    ground_truth.set_model_reference(std::string(4096, 'm'));
+    for (int64_t second = 0; second < 3; ++second) {
+        ground_truth.mutable_timestamp()->set_seconds(second);
+        EXPECT_TRUE(writer_.WriteMessage(ground_truth, "/ground_truth"));
+    }
+    writer_.Close();
+
+    std::ifstream file(test_file_, std::ios::binary);
+    mcap::McapReader mcap_reader;
+    ASSERT_TRUE(mcap_reader.open(file).ok());
+    int64_t second = 0;
+    for (const auto& view : mcap_reader.readMessages()) {
+        osi3::GroundTruth read_ground_truth;
+        ASSERT_TRUE(read_ground_truth.ParseFromArray(view.message.data, static_cast<int>(view.message.dataSize)));
+        EXPECT_EQ(read_ground_truth.timestamp().seconds(), second++);
+        EXPECT_EQ(read_ground_truth.model_reference().size(), 4096U);
+    }
+    EXPECT_EQ(second, 3);
+    mcap_reader.close();
+}
+
+TEST_F(MCAPTraceFileWriterTest, WriteRawMessageWithoutTimestamp) {
+    ASSERT_TRUE(writer_.Open(test_file_));
+    const auto serialized = osi3::GroundTruth().SerializeAsString();
+    EXPECT_FALSE(writer_.WriteRawMessage(serialized.data(), serialized.size(), osi3::GroundTruth::descriptor(), "/ground_truth"));
+    EXPECT_FALSE(writer_.WriteRawMessage(serialized.data(), serialized.size(), osi3::GroundTruth::descriptor(), ""));
+}
+
 TEST_F(MCAPTraceFileWriterTest, TryWriteWithoutReqMetaData) {
     ASSERT_TRUE(writer_.Open(test_file_));
     // Create test message
@@ -339,6 +403,238 @@ TEST_F(MCAPTraceFileWriterTest, AddChannelAutoProtobufVersion) {
     mcap_reader.close();
 }
 
+TEST_F(MCAPTraceFileWriterTest, WriteQuantizedMessages) {
+    osi3::tracefile::QuantizationOptions quantization;
+    quantization.linear_precision = 0.001;
+    quantization.angular_precision = 0.001;
+    writer_.SetQuantization(quantization);
+    ASSERT_TRUE(writer_.Open(test_file_));
+    AddRequiredMetadata();
+
+    osi3::GroundTruth gt;
+    gt.mutable_timestamp()->set_seconds(1);
+    auto* base = gt.add_moving_object()->mutable_base();
+    base->mutable_position()->set_x(12.3456789);
+    base->mutable_orientation()->set_yaw(0.7853981);
+    ASSERT_TRUE(writer_.WriteMessage(static_cast<const google::protobuf::Message&>(gt), "gt"));
+    std::string serialized;
+    ASSERT_TRUE(gt.SerializeToString(&serialized));
+    ASSERT_TRUE(writer_.WriteRawMessage(serialized.data(), serialized.size(), osi3::GroundTruth::descriptor(), "gt"));
+    // the caller's message is left unchanged
+    EXPECT_EQ(gt.moving_object(0).base().position().x(), 12.3456789);
+    writer_.Close();
+
+    std::ifstream file(test_file_, std::ios::binary);
+    mcap::McapReader mcap_reader;
+    ASSERT_TRUE(mcap_reader.open(file).ok());
+    ASSERT_TRUE(mcap_reader.readSummary(mcap::ReadSummaryMethod::AllowFallbackScan).ok());
+    ASSERT_EQ(mcap_reader.channels().size(), 1U);
+    const auto& metadata = mcap_reader.channels().begin()->second->metadata;
+    ASSERT_EQ(metadata.count("net.asam.osi.trace.channel.quantization.linear_step"), 1U);
+    EXPECT_EQ(std::stod(metadata.at("net.asam.osi.trace.channel.quantization.linear_step")), osi3::tracefile::GetQuantizationStep(0.001));
+    EXPECT_EQ(metadata.count("net.asam.osi.trace.channel.quantization.angular_step"), 1U);
+
+    size_t messages = 0;
+    for (const auto& view : mcap_reader.readMessages()) {
+        osi3::GroundTruth read;
+        ASSERT_TRUE(read.ParseFromArray(view.message.data, static_cast<int>(view.message.dataSize)));
+        EXPECT_NEAR(read.moving_object(0).base().position().x(), 12.3456789, 0.0005);
+        EXPECT_NE(read.moving_object(0).base().position().x(), 12.3456789);
+        EXPECT_NEAR(read.moving_object(0).base().orientation().yaw(), 0.7853981, 0.0005);
+        ++messages;
+    }
+    EXPECT_EQ(messages, 2U);
+    mcap_reader.close();
+}
+
+TEST_F(MCAPTraceFileWriterTest, WriteCompactedMessages) {
+    osi3::tracefile::CompactionOptions compaction;
+    compaction.removed_fields = {"model_reference"};
+    writer_.SetCompaction(compaction);
+    ASSERT_TRUE(writer_.Open(test_file_));
+    AddRequiredMetadata();
+
+    osi3::GroundTruth gt;
+    gt.mutable_timestamp()->set_seconds(1);
+    gt.set_model_reference("scenery/highway.osgb");
+    ASSERT_TRUE(writer_.WriteMessage(static_cast<const google::protobuf::Message&>(gt), "gt"));
+    EXPECT_TRUE(gt.has_model_reference());
+    writer_.Close();
+
+    std::ifstream file(test_file_, std::ios::binary);
+    mcap::McapReader mcap_reader;
+    ASSERT_TRUE(mcap_reader.open(file).ok());
+    size_t messages = 0;
+    for (const auto& view : mcap_reader.readMessages()) {
+        osi3::GroundTruth read;
+        ASSERT_TRUE(read.ParseFromArray(view.message.data, static_cast<int>(view.message.dataSize)));
+        EXPECT_FALSE(read.has_model_reference());
+        EXPECT_EQ(read.timestamp().seconds(), 1);
+        ++messages;
+    }
+    EXPECT_EQ(messages, 1U);
+    mcap_reader.close();
+}
+
+TEST_F(MCAPTraceFileWriterTest, WriteOffloadedPayloads) {
+    osi3::tracefile::PayloadOffloadOptions offload;
+    offload.field_paths = {"camera_sensor_view.image_data"};
+    writer_.SetPayloadOffload(offload);
+    ASSERT_TRUE(writer_.Open(test_file_));
+    AddRequiredMetadata();
+
+    osi3::SensorView sensor_view;
+    sensor_view.mutable_timestamp()->set_seconds(1);
+    sensor_view.add_camera_sensor_view()->set_image_data(std::string(8192, 'i'));
+    ASSERT_TRUE(writer_.WriteMessage(static_cast<const google::protobuf::Message&>(sensor_view), "sv"));
+    EXPECT_TRUE(sensor_view.camera_sensor_view(0).has_image_data());
+    writer_.Close();
+
+    osi3::MCAPTraceFileReader reader;
+    ASSERT_TRUE(reader.Open(test_file_));
+    const auto attachments = reader.GetAttachments();
+    ASSERT_EQ(attachments.size(), 1U);
+    EXPECT_EQ(attachments[0].name, osi3::tracefile::GetPayloadAttachmentName("sv", 1000000000, 1000000000));
+    EXPECT_EQ(reader.GetChannelMetadata("sv")->at("net.asam.osi.trace.channel.offloaded_fields"), "camera_sensor_view.image_data");
+
+    auto result = reader.ReadMessage();
+    ASSERT_TRUE(result.has_value());
+    const auto* read = dynamic_cast<const osi3::SensorView*>(result->message.get());
+    ASSERT_NE(read, nullptr);
+    EXPECT_FALSE(read->camera_sensor_view(0).has_image_data());
+    ASSERT_TRUE(reader.AttachOffloadedPayloads(*result));
+    EXPECT_EQ(read->camera_sensor_view(0).image_data(), std::string(8192, 'i'));
+    reader.Close();
+}
+
+TEST_F(MCAPTraceFileWriterTest, WriteOffloadedPayloadsInBatches) {
+    osi3::tracefile::PayloadOffloadOptions offload;
+    offload.field_paths = {"camera_sensor_view.image_data"};
+    offload.batch_size = 5 * 8192;
+    writer_.SetPayloadOffload(offload);
+    ASSERT_TRUE(writer_.Open(test_file_));
+    AddRequiredMetadata();
+
+    osi3::SensorView sensor_view;
+    auto* camera = sensor_view.add_camera_sensor_view();
+    for (int second = 0; second < 12; ++second) {
+        sensor_view.mutable_timestamp()->set_seconds(second);
+        camera->set_image_data(std::string(8192, static_cast<char>('a' + second)));
+        ASSERT_TRUE(writer_.WriteMessage(static_cast<const google::protobuf::Message&>(sensor_view), "sv"));
+    }
+    writer_.Close();
+
+    // every attachment closes the current chunk, so batching keeps the chunks at one per batch
+    std::ifstream file(test_file_, std::ios::binary);
+    mcap::McapReader mcap_reader;
+    ASSERT_TRUE(mcap_reader.open(file).ok());
+    ASSERT_TRUE(mcap_reader.readSummary(mcap::ReadSummaryMethod::AllowFallbackScan).ok());
+    EXPECT_EQ(mcap_reader.attachmentIndexes().size(), 3U);
+    EXPECT_LE(mcap_reader.chunkIndexes().size(), 3U);
+    EXPECT_EQ(mcap_reader.attachmentIndexes().count(osi3::tracefile::GetPayloadAttachmentName("sv", 5000000000, 9000000000)), 1U);
+    mcap_reader.close();
+
+    osi3::MCAPTraceFileReader reader;
+    ASSERT_TRUE(reader.Open(test_file_));
+    for (int second = 0; second < 12; ++second) {
+        auto result = reader.ReadMessage();
+        ASSERT_TRUE(result.has_value());
+        ASSERT_TRUE(reader.AttachOffloadedPayloads(*result));
+        const auto* read = dynamic_cast<const osi3::SensorView*>(result->message.get());
+        ASSERT_NE(read, nullptr);
+        EXPECT_EQ(read->camera_sensor_view(0).image_data(), std::string(8192, static_cast<char>('a' + second)));
+    }
+    reader.Close();
+}
+
+TEST_F(MCAPTraceFileWriterTest, WriteStatisticsOnClose) {
+    writer_.SetStatisticsEnabled(true);
+    ASSERT_TRUE(writer_.Open(test_file_));
+    AddRequiredMetadata();
+    writer_.AddChannel("gt", osi3::GroundTruth::descriptor());
+
+    osi3::GroundTruth gt;
+    gt.mutable_host_vehicle_id()->set_value(1);
+    auto* host = gt.add_moving_object();
+    host->mutable_id()->set_value(1);
+    host->mutable_base()->mutable_velocity()->set_x(38.0);
+    for (int second = 1; second <= 3; ++second) {
+        gt.mutable_timestamp()->set_seconds(second);
+        ASSERT_TRUE(writer_.WriteMessage(gt, "gt"));
+    }
+    ASSERT_NE(writer_.GetStatistics(), nullptr);
+    const auto& channels = writer_.GetStatistics()->GetChannels();
+    ASSERT_EQ(channels.size(), 1U);
+    EXPECT_EQ(channels[0].message_count, 3U);
+    EXPECT_EQ(channels[0].max_log_time, 3000000000U);
+    EXPECT_DOUBLE_EQ(channels[0].max_host_speed, 38.0);
+    writer_.Close();
+
+    osi3::MCAPTraceFileReader reader;
+    ASSERT_TRUE(reader.Open(test_file_));
+    std::optional<osi3::tracefile::ChannelStatistics> statistics;
+    for (const auto& [name, metadata] : reader.GetFileMetadata()) {
+        if (name == osi3::tracefile::config::kOsiTraceStatisticsMetadataName) {
+            statistics = osi3::tracefile::ParseStatisticsMetadata(metadata);
+        }
+    }
+    ASSERT_TRUE(statistics.has_value());
+    EXPECT_EQ(statistics->topic, "gt");
+    EXPECT_EQ(statistics->message_count, 3U);
+    EXPECT_EQ(statistics->min_log_time, 1000000000U);
+    EXPECT_DOUBLE_EQ(statistics->MeanHostSpeed(), 38.0);
+    reader.Close();
+}
+
+TEST_F(MCAPTraceFileWriterTest, WritePreviewChannel) {
+    osi3::McapPreviewOptions preview;
+    preview.source_topic = "gt";
+    preview.batch_size = 2;
+    writer_.SetPreviewOptions(preview);
+    ASSERT_TRUE(writer_.Open(test_file_));
+    AddRequiredMetadata();
+    writer_.AddChannel("gt", osi3::GroundTruth::descriptor());
+
+    osi3::GroundTruth gt;
+    gt.add_moving_object()->mutable_id()->set_value(1);
+    gt.add_stationary_object()->mutable_id()->set_value(2);
+    gt.add_lane()->mutable_id()->set_value(3);
+    for (int frame = 0; frame < 35; ++frame) {
+        gt.mutable_timestamp()->set_seconds(frame / 10);
+        gt.mutable_timestamp()->set_nanos((frame % 10) * 100000000);
+        ASSERT_TRUE(writer_.WriteMessage(gt, "gt"));
+    }
+    writer_.Close();
+
+    osi3::MCAPTraceFileReader reader;
+    ASSERT_TRUE(reader.Open(test_file_));
+    const auto channel_metadata = reader.GetChannelMetadata("gt/preview");
+    ASSERT_TRUE(channel_metadata.has_value());
+    EXPECT_EQ(channel_metadata->at(osi3::tracefile::config::kOsiChannelPreviewSourceKey), "gt");
+    EXPECT_EQ(channel_metadata->at(osi3::tracefile::config::kOsiChannelPreviewIntervalKey), "1000000000");
+
+    reader.SetTopics({"gt/preview"});
+    std::vector<int64_t> seconds;
+    while (reader.HasNext()) {
+        const auto result = reader.ReadMessage();
+        ASSERT_TRUE(result.has_value());
+        const auto* read = dynamic_cast<const osi3::GroundTruth*>(result->message.get());
+        ASSERT_NE(read, nullptr);
+        EXPECT_EQ(read->moving_object_size(), 1);
+        EXPECT_EQ(read->stationary_object_size(), 0);
+        EXPECT_EQ(read->lane_size(), 0);
+        EXPECT_EQ(read->timestamp().nanos(), 0);
+        seconds.push_back(read->timestamp().seconds());
+    }
+    EXPECT_EQ(seconds, (std::vector<int64_t>{0, 1, 2, 3}));
+    reader.Close();
+}
+
+TEST_F(MCAPTraceFileWriterTest, PreviewWithoutSourceTopicFailsToOpen) {
+    writer_.SetPreviewOptions(osi3::McapPreviewOptions{});
+    EXPECT_FALSE(writer_.Open(test_file_));
+}
+
 TEST(MultiTraceFileWriterAliasTest, AliasResolvesToCorrectType) {
     static_assert(std::is_same_v<osi3::MultiTraceFileWriter, osi3::MCAPTraceFileWriter>, "MultiTraceFileWriter must alias MCAPTraceFileWriter");
 }
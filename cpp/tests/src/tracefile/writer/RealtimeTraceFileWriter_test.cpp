@@ -0,0 +1,232 @@
+//
+// Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "osi-utilities/tracefile/writer/RealtimeTraceFileWriter.h"
+
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../../TestUtilities.h"
+#include "osi-utilities/tracefile/reader/SingleChannelBinaryTraceFileReader.h"
+#include "osi-utilities/tracefile/writer/SingleChannelBinaryTraceFileWriter.h"
+#include "osi_groundtruth.pb.h"
+#include "osi_sensorview.pb.h"
+
+namespace {
+
+// Records the frames in memory; Stall() blocks the background thread like a slow device
+class RecordingWriter final : public osi3::TraceFileWriter {
+   public:
+    struct Frame {
+        std::string data;
+        std::string topic;
+    };
+
+    bool Open(const std::filesystem::path& /*file_path*/) override { return true; }
+    bool WriteMessage(const google::protobuf::Message& message, const std::string& topic) override {
+        return WriteRawMessage(message.SerializeAsString().data(), message.ByteSizeLong(), message.GetDescriptor(), topic);
+    }
+    bool WriteRawMessage(const char* data, const size_t size, const google::protobuf::Descriptor* /*descriptor*/, const std::string& topic) override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        released_.wait(lock, [this] { return !stalled_; });
+        frames_.push_back({std::string(data, size), topic});
+        return true;
+    }
+    void Close() override {}
+
+    void Stall() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stalled_ = true;
+    }
+    void Release() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stalled_ = false;
+        }
+        released_.notify_all();
+    }
+    auto Frames() -> std::vector<Frame> {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return frames_;
+    }
+
+   private:
+    std::mutex mutex_;
+    std::condition_variable released_;
+    bool stalled_ = false;
+    std::vector<Frame> frames_;
+};
+
+class RealtimeTraceFileWriterTest : public ::testing::Test {
+   protected:
+    std::filesystem::path test_file_ = osi3::testing::MakeTempPath("realtime_gt", osi3::testing::FileExtensions::kOsi);
+    RecordingWriter* recording_ = nullptr;
+
+    void TearDown() override { osi3::testing::SafeRemoveTestFile(test_file_); }
+
+    auto MakeRecordingWriter(const osi3::RealtimeWriterOptions& options) -> std::unique_ptr<osi3::RealtimeTraceFileWriter> {
+        auto writer = std::make_unique<RecordingWriter>();
+        recording_ = writer.get();
+        return std::make_unique<osi3::RealtimeTraceFileWriter>(std::move(writer), options);
+    }
+};
+
+TEST_F(RealtimeTraceFileWriterTest, BinaryRoundTrip) {
+    {
+        osi3::RealtimeTraceFileWriter writer(std::make_unique<osi3::SingleChannelBinaryTraceFileWriter>());
+        ASSERT_TRUE(writer.Open(test_file_));
+        for (int64_t second = 0; second < 100; ++second) {
+            ASSERT_TRUE(writer.WriteMessage(osi3::testing::MakeGroundTruth(second)));
+        }
+        writer.Close();
+        const auto statistics = writer.GetStatistics();
+        EXPECT_EQ(statistics.frames_written, 100U);
+        EXPECT_EQ(statistics.frames_dropped_full + statistics.frames_dropped_degraded + statistics.frames_dropped_oversize, 0U);
+        EXPECT_GT(statistics.max_buffer_usage, 0U);
+    }
+
+    osi3::SingleChannelBinaryTraceFileReader reader;
+    ASSERT_TRUE(reader.Open(test_file_));
+    int64_t second = 0;
+    while (reader.HasNext()) {
+        const auto result = reader.ReadMessage();
+        ASSERT_TRUE(result.has_value());
+        const auto* ground_truth = dynamic_cast<const osi3::GroundTruth*>(result->message.get());
+        ASSERT_NE(ground_truth, nullptr);
+        EXPECT_EQ(ground_truth->timestamp().seconds(), second);
+        ++second;
+    }
+    EXPECT_EQ(second, 100);
+}
+
+TEST_F(RealtimeTraceFileWriterTest, WrapsAroundSmallBuffer) {
+    osi3::RealtimeWriterOptions options;
+    options.buffer_size = 200;
+    options.max_wait = std::chrono::seconds(10);
+    auto writer = MakeRecordingWriter(options);
+    ASSERT_TRUE(writer->Open(test_file_));
+
+    std::vector<std::string> expected;
+    for (int64_t second = 0; second < 500; ++second) {
+        // frames of varying size so that the padding at the end of the buffer varies
+        const auto frame = std::string(static_cast<size_t>(second % 37), 'x') + std::to_string(second);
+        ASSERT_TRUE(writer->WriteRawMessage(frame.data(), frame.size(), osi3::GroundTruth::descriptor(), "gt"));
+        expected.push_back(frame);
+    }
+    writer->Flush();
+    const auto frames = recording_->Frames();
+    ASSERT_EQ(frames.size(), expected.size());
+    for (size_t i = 0; i < frames.size(); ++i) {
+        EXPECT_EQ(frames[i].data, expected[i]);
+        EXPECT_EQ(frames[i].topic, "gt");
+    }
+    writer->Close();
+    EXPECT_LE(writer->GetStatistics().max_buffer_usage, 200U);
+}
+
+TEST_F(RealtimeTraceFileWriterTest, DropsFramesWhenBufferIsFull) {
+    osi3::RealtimeWriterOptions options;
+    options.buffer_size = 1024;
+    options.max_wait = std::chrono::microseconds(100);
+    auto writer = MakeRecordingWriter(options);
+    ASSERT_TRUE(writer->Open(test_file_));
+    recording_->Stall();
+
+    const std::string frame(100, 'x');
+    size_t accepted = 0;
+    for (int i = 0; i < 50; ++i) {
+        accepted += writer->WriteRawMessage(frame.data(), frame.size(), osi3::GroundTruth::descriptor(), "gt") ? 1U : 0U;
+    }
+    auto statistics = writer->GetStatistics();
+    EXPECT_LT(accepted, 50U);
+    EXPECT_EQ(statistics.frames_dropped_full, 50U - accepted);
+    EXPECT_EQ(statistics.dropped_per_topic["gt"], 50U - accepted);
+    EXPECT_LT(statistics.max_write_time, std::chrono::seconds(1));
+
+    recording_->Release();
+    writer->Close();
+    statistics = writer->GetStatistics();
+    EXPECT_EQ(statistics.frames_written, accepted);
+    EXPECT_EQ(recording_->Frames().size(), accepted);
+}
+
+TEST_F(RealtimeTraceFileWriterTest, ShedsDroppableTopicsFirst) {
+    osi3::RealtimeWriterOptions options;
+    options.buffer_size = 1024;
+    options.degrade_threshold = 0.5;
+    auto writer = MakeRecordingWriter(options);
+    ASSERT_TRUE(writer->AddTopic("gt", osi3::GroundTruth::descriptor()));
+    ASSERT_TRUE(writer->AddTopic("preview", osi3::GroundTruth::descriptor(), true));
+    ASSERT_TRUE(writer->Open(test_file_));
+    recording_->Stall();
+
+    const std::string frame(100, 'x');
+    // the first frame may already be taken by the stalled background thread
+    for (int i = 0; i < 6; ++i) {
+        ASSERT_TRUE(writer->WriteRawMessage(frame.data(), frame.size(), osi3::GroundTruth::descriptor(), "gt"));
+    }
+    EXPECT_FALSE(writer->WriteRawMessage(frame.data(), frame.size(), osi3::GroundTruth::descriptor(), "preview"));
+    EXPECT_TRUE(writer->WriteRawMessage(frame.data(), frame.size(), osi3::GroundTruth::descriptor(), "gt"));
+
+    const auto statistics = writer->GetStatistics();
+    EXPECT_EQ(statistics.frames_dropped_degraded, 1U);
+    EXPECT_EQ(statistics.frames_dropped_full, 0U);
+    EXPECT_EQ(statistics.dropped_per_topic.count("gt"), 0U);
+    EXPECT_EQ(statistics.dropped_per_topic.at("preview"), 1U);
+    recording_->Release();
+}
+
+TEST_F(RealtimeTraceFileWriterTest, DropsOversizeFrames) {
+    osi3::RealtimeWriterOptions options;
+    options.buffer_size = 64;
+    auto writer = MakeRecordingWriter(options);
+    ASSERT_TRUE(writer->Open(test_file_));
+
+    const std::string frame(100, 'x');
+    EXPECT_FALSE(writer->WriteRawMessage(frame.data(), frame.size(), osi3::GroundTruth::descriptor(), "gt"));
+    EXPECT_TRUE(writer->WriteMessage(osi3::testing::MakeGroundTruth(1), "gt"));
+    writer->Close();
+
+    const auto statistics = writer->GetStatistics();
+    EXPECT_EQ(statistics.frames_dropped_oversize, 1U);
+    EXPECT_EQ(statistics.frames_written, 1U);
+    ASSERT_EQ(recording_->Frames().size(), 1U);
+    EXPECT_EQ(recording_->Frames()[0].data, osi3::testing::MakeGroundTruth(1).SerializeAsString());
+}
+
+TEST_F(RealtimeTraceFileWriterTest, TopicLimitsAndMessageTypes) {
+    osi3::RealtimeWriterOptions options;
+    options.max_topics = 1;
+    auto writer = MakeRecordingWriter(options);
+    ASSERT_TRUE(writer->AddTopic("gt", osi3::GroundTruth::descriptor()));
+    EXPECT_FALSE(writer->AddTopic("gt", osi3::SensorView::descriptor()));
+    EXPECT_FALSE(writer->AddTopic("other", osi3::GroundTruth::descriptor()));
+
+    EXPECT_FALSE(writer->WriteMessage(osi3::testing::MakeGroundTruth(1), "gt"));
+    ASSERT_TRUE(writer->Open(test_file_));
+    EXPECT_FALSE(writer->WriteMessage(osi3::testing::MakeGroundTruth(1), "other"));
+    EXPECT_TRUE(writer->WriteMessage(osi3::testing::MakeGroundTruth(1), "gt"));
+    EXPECT_FALSE(writer->Open(test_file_));
+}
+
+TEST_F(RealtimeTraceFileWriterTest, RejectsInvalidOptions) {
+    EXPECT_THROW(osi3::RealtimeTraceFileWriter(nullptr), std::invalid_argument);
+    osi3::RealtimeWriterOptions options;
+    options.degrade_threshold = 1.5;
+    EXPECT_THROW(osi3::RealtimeTraceFileWriter(std::make_unique<RecordingWriter>(), options), std::invalid_argument);
+    options = {};
+    options.buffer_size = 0;
+    EXPECT_THROW(osi3::RealtimeTraceFileWriter(std::make_unique<RecordingWriter>(), options), std::invalid_argument);
+    options.buffer_size = static_cast<size_t>(UINT32_MAX) + 1;
+    EXPECT_THROW(osi3::RealtimeTraceFileWriter(std::make_unique<RecordingWriter>(), options), std::invalid_argument);
+}
+
+}  // namespace
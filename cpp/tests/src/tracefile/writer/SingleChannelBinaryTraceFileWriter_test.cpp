@@ -107,12 +107,76 @@ TEST_F(SingleChannelBinaryTraceFileWriterTest, ReopenFile) {
     EXPECT_TRUE(writer_.Open(test_file_gt_));
 }
 
+TEST_F(SingleChannelBinaryTraceFileWriterTest, ReportsFailedClose) {
+    std::error_code error;
+    std::filesystem::create_symlink("/dev/full", test_file_gt_, error);
+    if (error || !std::filesystem::exists("/dev/full")) {
+        GTEST_SKIP() << "/dev/full is not available";
+    }
+    ASSERT_TRUE(writer_.Open(test_file_gt_));
+    EXPECT_FALSE(writer_.CloseFailed());
+    osi3::GroundTruth ground_truth;
+    ground_truth.mutable_timestamp()->set_seconds(1);
+    EXPECT_TRUE(writer_.WriteMessage(ground_truth));
+    // the buffered message is only written by Close(), which runs out of space
+    writer_.Close();
+    EXPECT_TRUE(writer_.CloseFailed());
+}
+
 TEST_F(SingleChannelBinaryTraceFileWriterTest, WriteEmptyMessage) {
     ASSERT_TRUE(writer_.Open(test_file_gt_));
     const osi3::GroundTruth empty_gt;
     EXPECT_TRUE(writer_.WriteMessage(empty_gt));
 }
 
+TEST_F(SingleChannelBinaryTraceFileWriterTest, WriteRawMessage) {
+    ASSERT_TRUE(writer_.Open(test_file_gt_));
+
+    osi3::GroundTruth ground_truth;
+    ground_truth.mutable_timestamp()->set_seconds(123);
+    const auto serialized = ground_truth.SerializeAsString();
+
+    EXPECT_TRUE(writer_.WriteRawMessage(serialized.data(), serialized.size(), osi3::GroundTruth::descriptor()));
+    writer_.Close();
+
+    std::ifstream file(test_file_gt_, std::ios::binary);
+    uint32_t size = 0;
+    file.read(reinterpret_cast<char*>(&size), sizeof(size));
+    std::string buffer(size, '\0');
+    file.read(buffer.data(), size);
+    EXPECT_EQ(buffer, serialized);
+}
+
+TEST_F(SingleChannelBinaryTraceFileWriterTest, WriteRawMessageToClosedFile) {
+    const std::string serialized;
+    EXPECT_FALSE(writer_.WriteRawMessage(serialized.data(), serialized.size(), osi3::GroundTruth::descriptor()));
+}
+
+TEST_F(SingleChannelBinaryTraceFileWriterTest, WriteMessageLargerThanSerializationChunk) {
+    ASSERT_TRUE(writer_.Open(test_file_gt_));
+
+    osi3::GroundTruth ground_truth;
+    ground_truth.mutable_timestamp()->set_seconds(7);
+    ground_truth.set_model_reference(std::string(3 * osi3::tracefile::config::kStreamingSerializeChunkSize + 5, 'm'));
+    for (int i = 0; i < 100; ++i) {
+        ground_truth.add_moving_object()->mutable_id()->set_value(i);
+    }
+    EXPECT_TRUE(writer_.WriteMessage(ground_truth));
+    EXPECT_TRUE(writer_.WriteMessage(static_cast<const google::protobuf::Message&>(ground_truth)));
+    writer_.Close();
+
+    std::ifstream file(test_file_gt_, std::ios::binary);
+    for (int i = 0; i < 2; ++i) {
+        uint32_t size = 0;
+        file.read(reinterpret_cast<char*>(&size), sizeof(size));
+        ASSERT_EQ(size, ground_truth.ByteSizeLong());
+        std::string buffer(size, '\0');
+        file.read(buffer.data(), size);
+        EXPECT_EQ(buffer, ground_truth.SerializeAsString());
+    }
+    EXPECT_EQ(file.peek(), std::ifstream::traits_type::eof());
+}
+
 TEST(SingleTraceFileWriterAliasTest, AliasResolvesToCorrectType) {
     static_assert(std::is_same_v<osi3::SingleTraceFileWriter, osi3::SingleChannelBinaryTraceFileWriter>, "SingleTraceFileWriter must alias SingleChannelBinaryTraceFileWriter");
 }
@@ -107,6 +107,23 @@ TEST_F(TxthTraceFileWriterTest, MultipleMessages) {
     EXPECT_TRUE(content.find("seconds: 222") != std::string::npos);
 }
 
+TEST_F(TxthTraceFileWriterTest, WriteRawMessageParsesBytes) {
+    ASSERT_TRUE(writer_.Open(test_file_gt_));
+
+    osi3::GroundTruth ground_truth;
+    ground_truth.mutable_timestamp()->set_seconds(333);
+    const auto serialized = ground_truth.SerializeAsString();
+    EXPECT_TRUE(writer_.WriteRawMessage(serialized.data(), serialized.size(), osi3::GroundTruth::descriptor()));
+    EXPECT_FALSE(writer_.WriteRawMessage("\xFF\xFF", 2, osi3::GroundTruth::descriptor()));
+    EXPECT_FALSE(writer_.WriteRawMessage(serialized.data(), serialized.size(), nullptr));
+
+    writer_.Close();
+
+    std::ifstream file(test_file_gt_);
+    const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_TRUE(content.find("seconds: 333") != std::string::npos);
+}
+
 TEST_F(TxthTraceFileWriterTest, CloseAndReopenFile) {
     ASSERT_TRUE(writer_.Open(test_file_gt_));
     writer_.Close();
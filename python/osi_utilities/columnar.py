@@ -0,0 +1,164 @@
+# SPDX-License-Identifier: MPL-2.0
+# SPDX-FileCopyrightText: Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+
+"""Columnar export of object states as NumPy arrays.
+
+Each function returns a ``dict`` mapping column names to equally long 1-D NumPy
+arrays, with one row per object and frame (ready for ``pandas.DataFrame(columns)``).
+Values of unset sub-messages (e.g. a missing velocity) are NaN.
+
+With the ``osi_utilities_native`` extension installed, the whole trace is read and
+decoded in C++ and the arrays are filled without creating Python objects per
+message or object. Otherwise the trace is read with the Python readers.
+"""
+
+from __future__ import annotations
+
+import math
+from pathlib import Path
+from typing import Any
+
+from osi_utilities._types import MessageType, ReadStatus
+from osi_utilities.timestamp import timestamp_to_nanoseconds
+from osi_utilities.tracefile import _native
+from osi_utilities.tracefile.configure import create_reader
+
+_BASE_MOVING_COLUMNS: tuple[str, ...] = (
+    "position_x",
+    "position_y",
+    "position_z",
+    "orientation_roll",
+    "orientation_pitch",
+    "orientation_yaw",
+    "velocity_x",
+    "velocity_y",
+    "velocity_z",
+    "dimension_length",
+    "dimension_width",
+    "dimension_height",
+)
+
+MOVING_OBJECT_COLUMNS: tuple[str, ...] = ("frame_index", "timestamp", "id", *_BASE_MOVING_COLUMNS)
+DETECTED_OBJECT_COLUMNS: tuple[str, ...] = (
+    "frame_index",
+    "timestamp",
+    "id",
+    "existence_probability",
+    *_BASE_MOVING_COLUMNS,
+)
+
+_INTEGER_COLUMNS: frozenset[str] = frozenset({"frame_index", "timestamp", "id"})
+
+
+def read_moving_objects(
+    path: str | Path,
+    topics: list[str] | None = None,
+    message_type: MessageType | None = None,
+    backend: str | None = None,
+) -> dict[str, Any]:
+    """Extract the moving objects of all GroundTruth frames of a trace file.
+
+    Args:
+        path: Path to the trace file (.osi or .mcap).
+        topics: MCAP topics to read (default: all GroundTruth channels).
+        message_type: Message type of .osi files if not stated in the filename.
+        backend: ``"auto"``, ``"python"`` or ``"native"``; ``None`` uses ``OSI_UTILITIES_BACKEND``,
+            falling back to ``"auto"``.
+
+    Returns:
+        Columns ``MOVING_OBJECT_COLUMNS`` as NumPy arrays.
+    """
+    return _read_columns(path, topics, message_type, backend, MessageType.GROUND_TRUTH)
+
+
+def read_detected_objects(
+    path: str | Path,
+    topics: list[str] | None = None,
+    message_type: MessageType | None = None,
+    backend: str | None = None,
+) -> dict[str, Any]:
+    """Extract the detected moving objects of all SensorData frames of a trace file.
+
+    The ``id`` column holds the first tracking id of an object (0 if it has none).
+
+    Args:
+        path: Path to the trace file (.osi or .mcap).
+        topics: MCAP topics to read (default: all SensorData channels).
+        message_type: Message type of .osi files if not stated in the filename.
+        backend: ``"auto"``, ``"python"`` or ``"native"``; ``None`` uses ``OSI_UTILITIES_BACKEND``,
+            falling back to ``"auto"``.
+
+    Returns:
+        Columns ``DETECTED_OBJECT_COLUMNS`` as NumPy arrays.
+    """
+    return _read_columns(path, topics, message_type, backend, MessageType.SENSOR_DATA)
+
+
+def _read_columns(
+    path: str | Path,
+    topics: list[str] | None,
+    message_type: MessageType | None,
+    backend: str | None,
+    frame_type: MessageType,
+) -> dict[str, Any]:
+    try:
+        import numpy as np
+    except ImportError as e:
+        raise ImportError("The columnar export requires NumPy: pip install asam-osi-utilities[numpy]") from e
+
+    path = Path(path)
+    if _native.use_native_backend(backend, default="auto"):
+        extract = (
+            _native.native.extract_moving_objects
+            if frame_type == MessageType.GROUND_TRUTH
+            else _native.native.extract_detected_objects
+        )
+        return extract(path, topics or [], message_type.value if message_type is not None else "")
+
+    column_names = MOVING_OBJECT_COLUMNS if frame_type == MessageType.GROUND_TRUTH else DETECTED_OBJECT_COLUMNS
+    columns: dict[str, list] = {name: [] for name in column_names}
+    reader = create_reader(path)
+    if message_type is not None and hasattr(reader, "set_message_type"):
+        reader.set_message_type(message_type)
+    with reader:
+        if not reader.open(path):
+            raise RuntimeError(f"Failed to open trace file: {path}")
+        if topics and hasattr(reader, "set_topics"):
+            reader.set_topics(topics)
+        frame_index = 0
+        for result in reader:
+            if result.status == ReadStatus.ERROR:
+                raise RuntimeError(f"Failed to read frame {frame_index}: {result.error_message}")
+            if result.status != ReadStatus.OK or result.message_type != frame_type:
+                continue
+            timestamp = timestamp_to_nanoseconds(result.message)
+            for obj in result.message.moving_object:
+                columns["frame_index"].append(frame_index)
+                columns["timestamp"].append(timestamp)
+                if frame_type == MessageType.GROUND_TRUTH:
+                    columns["id"].append(obj.id.value)
+                else:
+                    columns["id"].append(obj.header.tracking_id[0].value if obj.header.tracking_id else 0)
+                    columns["existence_probability"].append(
+                        obj.header.existence_probability if obj.header.HasField("existence_probability") else math.nan
+                    )
+                _append_base_moving(obj.base, columns)
+            frame_index += 1
+
+    return {
+        name: np.asarray(values, dtype=np.uint64 if name in _INTEGER_COLUMNS else np.float64)
+        for name, values in columns.items()
+    }
+
+
+def _append_base_moving(base: Any, columns: dict[str, list]) -> None:
+    for message_field, fields in (
+        ("position", ("x", "y", "z")),
+        ("orientation", ("roll", "pitch", "yaw")),
+        ("velocity", ("x", "y", "z")),
+        ("dimension", ("length", "width", "height")),
+    ):
+        has_field = base.HasField(message_field)
+        value = getattr(base, message_field)
+        for field in fields:
+            columns[f"{message_field}_{field}"].append(getattr(value, field) if has_field else math.nan)
@@ -0,0 +1,78 @@
+# SPDX-License-Identifier: MPL-2.0
+# SPDX-FileCopyrightText: Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+
+"""Optional native backend for the trace file readers and writers.
+
+The ``osi_utilities_native`` extension module is built from the C++ library with
+``-DBUILD_PYTHON_BINDINGS=ON``. When it is selected, the binary and MCAP readers
+and writers delegate file I/O, framing and MCAP chunk (de)compression to C++ (with
+the GIL released) and only parse or serialize the frames with the ``osi3`` Python
+classes.
+
+The backend is chosen per reader or writer with the ``backend`` argument. Its default is
+taken from the ``OSI_UTILITIES_BACKEND`` environment variable, so existing code
+can opt in without changes (e.g. ``OSI_UTILITIES_BACKEND=auto``).
+"""
+
+from __future__ import annotations
+
+import os
+from types import ModuleType
+
+from osi_utilities._types import ReadStatus
+
+native: ModuleType | None
+try:
+    import osi_utilities_native as native
+except ImportError:
+    native = None
+
+BACKENDS: tuple[str, ...] = ("auto", "python", "native")
+BACKEND_ENVIRONMENT_VARIABLE: str = "OSI_UTILITIES_BACKEND"
+DEFAULT_BACKEND: str = "python"
+
+
+def native_available() -> bool:
+    """Return True if the native extension module is importable."""
+    return native is not None
+
+
+def use_native_backend(backend: str | None, default: str = DEFAULT_BACKEND) -> bool:
+    """Resolve a reader or writer ``backend`` argument.
+
+    Args:
+        backend: ``"auto"`` (native if available), ``"python"`` or ``"native"``.
+            ``None`` uses ``OSI_UTILITIES_BACKEND``, falling back to ``default``.
+        default: Backend used if neither ``backend`` nor the environment variable is set.
+
+    Returns:
+        True if the native backend should be used.
+
+    Raises:
+        ValueError: For an unknown backend name.
+        ImportError: If ``"native"`` is requested but the extension is not installed.
+    """
+    if backend is None:
+        backend = os.environ.get(BACKEND_ENVIRONMENT_VARIABLE, default)
+    if backend not in BACKENDS:
+        raise ValueError(f"Unsupported backend '{backend}'. Expected one of: {', '.join(BACKENDS)}.")
+    if backend == "python":
+        return False
+    if native is None:
+        if backend == "native":
+            raise ImportError(
+                "Native backend requested, but the osi_utilities_native extension module is not installed. "
+                "Build it with -DBUILD_PYTHON_BINDINGS=ON."
+            )
+        return False
+    return True
+
+
+def to_read_status(status: int) -> ReadStatus:
+    """Convert a native read status code to ReadStatus."""
+    assert native is not None
+    if status == native.READ_STATUS_OK:
+        return ReadStatus.OK
+    if status == native.READ_STATUS_INCOMPATIBLE:
+        return ReadStatus.INCOMPATIBLE
+    return ReadStatus.ERROR
@@ -24,6 +24,7 @@ from osi_utilities.message_types import (
     get_message_class,
     schema_name_to_message_type,
 )
+from osi_utilities.tracefile import _native
 from osi_utilities.tracefile.readers.base import TraceReader
 
 logger = logging.getLogger(__name__)
@@ -44,6 +45,15 @@ class MultiTraceReader(TraceReader):
 
     Logging behavior for incompatible messages is controlled independently by
     ``set_log_incompatible_messages(...)``.
+
+    Backend:
+
+    - With ``backend="auto"`` or ``"native"`` and the ``precompiled`` decoder
+      mode, the message stream is read by the native C++ reader of the
+      ``osi_utilities_native`` extension. Summary and metadata access always
+      use the Python MCAP reader.
+    - The default backend is taken from the ``OSI_UTILITIES_BACKEND``
+      environment variable (``"python"`` if unset).
     """
 
     def __init__(
@@ -51,6 +61,7 @@ class MultiTraceReader(TraceReader):
         decoder_mode: str = "precompiled",
         skip_incompatible_messages: bool = True,
         log_incompatible_messages: bool = True,
+        backend: str | None = None,
     ) -> None:
         self._file: IO[bytes] | None = None
         self._path: Path | None = None
@@ -65,6 +76,8 @@ class MultiTraceReader(TraceReader):
         self._set_decoder_mode(decoder_mode)
         self._peeked_result: ReadResult | None = None
         self._peek_exhausted = False
+        self._use_native = _native.use_native_backend(backend)
+        self._native_reader = None
 
         self._decoder_factory = DecoderFactory()
         self._mcap_contained_decoders: dict[int, object] = {}
@@ -110,6 +123,8 @@ class MultiTraceReader(TraceReader):
             self._summary = self._reader.get_summary()
             self._mcap_contained_decoders.clear()
             self._precompiled_message_classes.clear()
+            if self._use_native and self._decoder_mode == "precompiled":
+                self._open_native(path)
             self._start_iteration()
             return True
         except (OSError, McapError) as e:
@@ -119,6 +134,19 @@ class MultiTraceReader(TraceReader):
                 self._file = None
             return False
 
+    def _open_native(self, path: Path) -> None:
+        """Open the message stream with the native C++ reader.
+
+        Incompatible messages are surfaced by the native reader and handled here,
+        so skipping and logging behave as with the Python backend.
+        """
+        native_reader = _native.native.MCAPReader()
+        native_reader.set_skip_incompatible_messages(False)
+        native_reader.set_log_incompatible_messages(False)
+        if not native_reader.open(path):
+            raise OSError("native MCAP reader could not open the file")
+        self._native_reader = native_reader
+
     def set_topics(self, topics: list[str]) -> None:
         """Filter reading to specific topics.
 
@@ -179,6 +207,9 @@ class MultiTraceReader(TraceReader):
         if self._peek_exhausted:
             return None
 
+        if self._native_reader is not None:
+            return self._read_message_native()
+
         if self._message_iterator is None:
             return None
 
@@ -280,6 +311,68 @@ class MultiTraceReader(TraceReader):
                 status=ReadStatus.OK,
             )
 
+    def _read_message_native(self) -> ReadResult | None:
+        """Read the next message through the native C++ reader."""
+        while True:
+            try:
+                raw = self._native_reader.read_raw()
+            except RuntimeError as exc:
+                self._native_reader.close()
+                self._native_reader = None
+                return ReadResult(
+                    message=None,
+                    message_type=MessageType.UNKNOWN,
+                    status=ReadStatus.ERROR,
+                    error_message=f"Failed while reading MCAP message stream: {exc}",
+                )
+            if raw is None:
+                return None
+
+            data, type_name, topic, _, status, error_message = raw
+            if _native.to_read_status(status) != ReadStatus.OK:
+                result = self._handle_incompatible(
+                    channel_name=topic,
+                    message_type=MessageType.UNKNOWN,
+                    error_message=f"{error_message} on channel '{topic}'.",
+                )
+                if result is None:
+                    continue
+                return result
+
+            try:
+                msg_type = MessageType(type_name)
+                expected_message_type = self._topic_message_types.get(topic)
+                if expected_message_type is not None and msg_type != expected_message_type:
+                    msg = (
+                        f"Message type mismatch on channel '{topic}'"
+                        f" (expected: '{expected_message_type}', actual: '{msg_type}')."
+                    )
+                    result = self._handle_incompatible(channel_name=topic, message_type=msg_type, error_message=msg)
+                    if result is None:
+                        continue
+                    return result
+
+                message = get_message_class(msg_type)()
+                message.ParseFromString(data)
+            except Exception as exc:  # noqa: BLE001 - protobuf parser raises broad exceptions
+                return ReadResult(
+                    message=None,
+                    message_type=MessageType.UNKNOWN,
+                    channel_name=topic,
+                    status=ReadStatus.ERROR,
+                    error_message=f"Failed to decode precompiled protobuf message on channel '{topic}': {exc}",
+                )
+            finally:
+                # The view points into the native reader's current chunk, which the next call releases
+                data.release()
+
+            return ReadResult(
+                message=message,
+                message_type=msg_type,
+                channel_name=topic,
+                status=ReadStatus.OK,
+            )
+
     def _decode_message(
         self,
         *,
@@ -384,6 +477,9 @@ class MultiTraceReader(TraceReader):
 
     def close(self) -> None:
         """Close the MCAP file."""
+        if self._native_reader is not None:
+            self._native_reader.close()
+            self._native_reader = None
         self._message_iterator = None
         self._peeked_result = None
         self._peek_exhausted = False
@@ -475,5 +571,7 @@ class MultiTraceReader(TraceReader):
         """(Re)start the raw message iterator."""
         self._peeked_result = None
         self._peek_exhausted = False
-        if self._reader is not None:
+        if self._native_reader is not None:
+            self._native_reader.set_topics(self._topics or [])
+        elif self._reader is not None:
             self._message_iterator = iter(self._reader.iter_messages(topics=self._topics))
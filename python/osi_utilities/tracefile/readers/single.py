@@ -19,6 +19,7 @@ from osi_utilities.filename import infer_message_type_from_filename
 from osi_utilities.message_types import (
     get_message_class,
 )
+from osi_utilities.tracefile import _native
 from osi_utilities.tracefile._config import (
     BINARY_MESSAGE_LENGTH_PREFIX_SIZE,
     MAX_EXPECTED_MESSAGE_SIZE,
@@ -34,10 +35,22 @@ class SingleTraceReader(TraceReader):
     Each message is stored as: [4-byte LE length][serialized protobuf bytes]
 
     The message type can be specified explicitly or inferred from the filename.
+
+    With ``backend="auto"`` or ``"native"``, reading is delegated to the native
+    C++ reader of the ``osi_utilities_native`` extension; messages are still
+    returned as ``osi3`` Python protobuf objects. The default backend is taken
+    from the ``OSI_UTILITIES_BACKEND`` environment variable (``"python"`` if unset).
     """
 
-    def __init__(self, enable_message_type_inference: bool = True) -> None:
-        """Initialize the single-channel trace file reader."""
+    def __init__(self, enable_message_type_inference: bool = True, backend: str | None = None) -> None:
+        """Initialize the single-channel trace file reader.
+
+        Args:
+            enable_message_type_inference: Infer the message type from the filename if not set.
+            backend: ``"auto"``, ``"python"``, ``"native"`` or None, see ``SingleTraceReader``.
+        """
+        self._use_native = _native.use_native_backend(backend)
+        self._native_reader = None
         self._enable_message_type_inference = enable_message_type_inference
         self._message_type: MessageType | None = MessageType.UNKNOWN if self._enable_message_type_inference else None
         self._file: IO[bytes] | None = None
@@ -57,7 +70,7 @@ class SingleTraceReader(TraceReader):
         Returns:
             True on success, False on failure.
         """
-        if self._file is not None:
+        if self._file is not None or self._native_reader is not None:
             logger.error("Reader is already open. Call close() before re-opening.")
             return False
 
@@ -78,6 +91,9 @@ class SingleTraceReader(TraceReader):
             logger.error("Failed to get message class: %s", e)
             return False
 
+        if self._use_native and _native.native.is_supported_message_type(self._message_type.value):
+            return self._open_native(path)
+
         try:
             self._file = open(path, "rb")  # noqa: SIM115
         except OSError as e:
@@ -98,6 +114,9 @@ class SingleTraceReader(TraceReader):
         Returns:
             ReadResult on success, None if no more messages.
         """
+        if self._native_reader is not None:
+            return self._read_message_native()
+
         if self._file is None or self._message_class is None:
             return None
 
@@ -159,6 +178,9 @@ class SingleTraceReader(TraceReader):
 
     def close(self) -> None:
         """Close the trace file."""
+        if self._native_reader is not None:
+            self._native_reader.close()
+            self._native_reader = None
         if self._file is not None:
             self._file.close()
             self._file = None
@@ -171,6 +193,64 @@ class SingleTraceReader(TraceReader):
         """The message type being read."""
         return self._message_type
 
+    def _open_native(self, path: Path) -> bool:
+        """Open the file with the native C++ reader."""
+        native_reader = _native.native.BinaryReader()
+        if not native_reader.open(path, self._message_type.value):
+            logger.error("Failed to open file '%s'", path)
+            return False
+        self._native_reader = native_reader
+        self._has_next = native_reader.has_next()
+        return True
+
+    def _read_message_native(self) -> ReadResult | None:
+        """Read the next message through the native C++ reader."""
+        try:
+            raw = self._native_reader.read_raw()
+        except RuntimeError as e:
+            self._has_next = False
+            return ReadResult(
+                message=None,
+                message_type=self._message_type,
+                status=ReadStatus.ERROR,
+                error_message=str(e),
+            )
+        if raw is None:
+            self._has_next = False
+            return None
+
+        data, _, _, _, status, error_message = raw
+        if _native.to_read_status(status) != ReadStatus.OK:
+            self._has_next = False
+            return ReadResult(
+                message=None,
+                message_type=self._message_type,
+                status=_native.to_read_status(status),
+                error_message=error_message,
+            )
+
+        message = self._message_class()
+        try:
+            message.ParseFromString(data)
+        except Exception as e:
+            self._has_next = False
+            return ReadResult(
+                message=None,
+                message_type=self._message_type,
+                status=ReadStatus.ERROR,
+                error_message=f"Failed to deserialize protobuf message ({data.nbytes} bytes): {e}",
+            )
+        finally:
+            # The view points into the native read buffer, which the next call reuses
+            data.release()
+
+        self._has_next = self._native_reader.has_next()
+        return ReadResult(
+            message=message,
+            message_type=self._message_type,
+            status=ReadStatus.OK,
+        )
+
     def _peek_has_data(self) -> bool:
         """Check if there is more data without consuming it."""
         if self._file is None:
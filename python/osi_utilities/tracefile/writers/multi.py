@@ -32,6 +32,7 @@ from osi_utilities.tracefile._config import (
     OSI_TRACE_RECOMMENDED_METADATA_KEYS,
     OSI_TRACE_REQUIRED_METADATA_KEYS,
 )
+from osi_utilities.tracefile import _native
 from osi_utilities.tracefile._mcap_utils import build_file_descriptor_set
 from osi_utilities.tracefile.writers.base import TraceWriter
 
@@ -94,9 +95,23 @@ class MultiTraceWriter(TraceWriter):
 
     Supports multi-channel writing with schema registration,
     OSI-compliant file/channel metadata, and FileDescriptorSet-based schemas.
+
+    With ``backend="auto"`` or ``"native"``, file I/O, chunking and compression are
+    delegated to the native C++ writer of the ``osi_utilities_native`` extension;
+    messages are still serialized with the ``osi3`` Python classes. Files whose
+    ``net.asam.osi.trace`` metadata lacks required keys, which the native writer
+    rejects, are written in Python. The default backend is taken from the
+    ``OSI_UTILITIES_BACKEND`` environment variable (``"python"`` if unset).
     """
 
-    def __init__(self) -> None:
+    def __init__(self, backend: str | None = None) -> None:
+        """Initialize the multi-channel trace file writer.
+
+        Args:
+            backend: ``"auto"``, ``"python"``, ``"native"`` or None, see ``MultiTraceWriter``.
+        """
+        self._use_native = _native.use_native_backend(backend)
+        self._native_writer = None
         self._file: IO[bytes] | None = None
         self._mcap_writer: McapRawWriter | None = None
         self._path: Path | None = None
@@ -126,7 +141,7 @@ class MultiTraceWriter(TraceWriter):
         Returns:
             True on success, False on failure.
         """
-        if self._file is not None:
+        if self._file is not None or self._native_writer is not None:
             logger.error("Opening file '%s', writer has already a file opened", path)
             return False
 
@@ -157,6 +172,11 @@ class MultiTraceWriter(TraceWriter):
             )
             return False
 
+        file_metadata = metadata if metadata is not None else prepare_required_file_metadata()
+        if self._use_native and not OSI_TRACE_REQUIRED_METADATA_KEYS - file_metadata.keys():
+            native_compression = compression_lower if compression is not None else ""
+            return self._open_native(path, file_metadata, native_compression, effective_chunk_size)
+
         try:
             self._file = open(path, "wb")  # noqa: SIM115
             writer_kwargs: dict[str, object] = {"chunk_size": effective_chunk_size}
@@ -166,7 +186,6 @@ class MultiTraceWriter(TraceWriter):
             self._mcap_writer.start(library="osi-utilities-python")
             self._path = path
 
-            file_metadata = metadata if metadata is not None else prepare_required_file_metadata()
             _validate_file_metadata(file_metadata)
             self._mcap_writer.add_metadata(name=OSI_TRACE_METADATA_NAME, data=file_metadata)
 
@@ -198,7 +217,7 @@ class MultiTraceWriter(TraceWriter):
         Raises:
             RuntimeError: If writer is not open or topic already exists.
         """
-        if self._mcap_writer is None:
+        if self._mcap_writer is None and self._native_writer is None:
             raise RuntimeError("Writer is not open")
         if topic in self._active_channels:
             raise RuntimeError(f"Channel with topic '{topic}' already exists")
@@ -210,6 +229,15 @@ class MultiTraceWriter(TraceWriter):
         if "net.asam.osi.trace.channel.protobuf_version" not in channel_meta:
             channel_meta["net.asam.osi.trace.channel.protobuf_version"] = google.protobuf.__version__
 
+        if self._native_writer is not None:
+            message_type = message_class.DESCRIPTOR.name
+            if not _native.native.is_supported_message_type(message_type):
+                raise RuntimeError(f"Message type '{message_type}' is not supported by the native writer")
+            channel_id = self._native_writer.add_channel(topic, message_type, channel_meta)
+            self._active_channels[topic] = channel_id
+            self._channel_metadata[topic] = channel_meta
+            return channel_id
+
         schema_name = f"osi3.{message_class.DESCRIPTOR.name}"
 
         # Reuse schema if already registered
@@ -244,7 +272,7 @@ class MultiTraceWriter(TraceWriter):
         Returns:
             True on success, False on failure.
         """
-        if self._mcap_writer is None:
+        if self._mcap_writer is None and self._native_writer is None:
             logger.error("Writer is not open")
             return False
 
@@ -262,6 +290,9 @@ class MultiTraceWriter(TraceWriter):
             logger.error("Topic '%s' not found. Available: %s", topic, list(self._active_channels.keys()))
             return False
 
+        if self._native_writer is not None:
+            return self._write_message_native(message, topic)
+
         try:
             data = message.SerializeToString()
             log_time = timestamp_to_nanoseconds(message)
@@ -287,14 +318,30 @@ class MultiTraceWriter(TraceWriter):
         Returns:
             True on success.
         """
+        if self._native_writer is not None:
+            return self._native_writer.add_file_metadata(name, data)
         if self._mcap_writer is None:
             return False
         self._mcap_writer.add_metadata(name=name, data=data)
         return True
 
     def close(self) -> None:
-        """Finalize and close the MCAP file."""
+        """Finalize and close the MCAP file.
+
+        Raises:
+            OSError: If the native writer failed to flush the end of the file.
+        """
         try:
+            if self._native_writer is not None:
+                native_writer = self._native_writer
+                self._native_writer = None
+                native_writer.close()
+                logger.info(
+                    "Wrote %d messages to channels [%s] in '%s'",
+                    self._written_count,
+                    ", ".join(self._active_channels.keys()),
+                    self._path,
+                )
             if self._mcap_writer is not None:
                 self._mcap_writer.finish()
                 logger.info(
@@ -315,6 +362,35 @@ class MultiTraceWriter(TraceWriter):
             self._channel_metadata.clear()
             self._schema_cache.clear()
 
+    def _open_native(self, path: Path, file_metadata: dict[str, str], compression: str, chunk_size: int) -> bool:
+        """Open the file with the native C++ writer."""
+        native_writer = _native.native.MCAPWriter()
+        if not native_writer.open(path, compression, chunk_size):
+            logger.error("Failed to open MCAP file '%s' for writing", path)
+            return False
+        _validate_file_metadata(file_metadata)
+        if not native_writer.add_file_metadata(OSI_TRACE_METADATA_NAME, file_metadata):
+            logger.error("Failed to write '%s' metadata to '%s'", OSI_TRACE_METADATA_NAME, path)
+            native_writer.close()
+            return False
+        self._native_writer = native_writer
+        self._path = path
+        self._written_count = 0
+        return True
+
+    def _write_message_native(self, message: Message, topic: str) -> bool:
+        """Write a message through the native C++ writer."""
+        try:
+            data = message.SerializeToString()
+        except EncodeError as e:
+            logger.error("Failed to write message to topic '%s': %s", topic, e)
+            return False
+        if not self._native_writer.write(data, message.DESCRIPTOR.name, topic):
+            logger.error("Failed to write message to topic '%s'", topic)
+            return False
+        self._written_count += 1
+        return True
+
     @property
     def written_count(self) -> int:
         return self._written_count
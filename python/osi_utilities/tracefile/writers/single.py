@@ -16,6 +16,7 @@ from typing import IO
 
 from google.protobuf.message import EncodeError, Message
 
+from osi_utilities.tracefile import _native
 from osi_utilities.tracefile.writers.base import TraceWriter
 
 logger = logging.getLogger(__name__)
@@ -25,9 +26,21 @@ class SingleTraceWriter(TraceWriter):
     """Writer for single-channel binary OSI trace files (.osi).
 
     Each message is stored as: [4-byte LE length][serialized protobuf bytes]
+
+    With ``backend="auto"`` or ``"native"``, file I/O and framing are delegated to the
+    native C++ writer of the ``osi_utilities_native`` extension; messages are still
+    serialized with the ``osi3`` Python classes. The default backend is taken from the
+    ``OSI_UTILITIES_BACKEND`` environment variable (``"python"`` if unset).
     """
 
-    def __init__(self) -> None:
+    def __init__(self, backend: str | None = None) -> None:
+        """Initialize the single-channel trace file writer.
+
+        Args:
+            backend: ``"auto"``, ``"python"``, ``"native"`` or None, see ``SingleTraceWriter``.
+        """
+        self._use_native = _native.use_native_backend(backend)
+        self._native_writer = None
         self._file: IO[bytes] | None = None
         self._path: Path | None = None
         self._written_count = 0
@@ -42,7 +55,7 @@ class SingleTraceWriter(TraceWriter):
         Returns:
             True on success, False on failure.
         """
-        if self._file is not None:
+        if self._file is not None or self._native_writer is not None:
             logger.error("Opening file '%s', writer has already a file opened", path)
             return False
 
@@ -50,6 +63,16 @@ class SingleTraceWriter(TraceWriter):
             logger.error("Binary trace files must have .osi extension, got '%s'", path.suffix)
             return False
 
+        if self._use_native:
+            native_writer = _native.native.BinaryWriter()
+            if not native_writer.open(path):
+                logger.error("Failed to open file '%s' for writing", path)
+                return False
+            self._native_writer = native_writer
+            self._path = path
+            self._written_count = 0
+            return True
+
         try:
             self._file = open(path, "wb")  # noqa: SIM115
             self._path = path
@@ -69,6 +92,9 @@ class SingleTraceWriter(TraceWriter):
         Returns:
             True on success, False on failure.
         """
+        if self._native_writer is not None:
+            return self._write_message_native(message)
+
         if self._file is None:
             logger.error("Writer is not open")
             return False
@@ -84,12 +110,38 @@ class SingleTraceWriter(TraceWriter):
             return False
 
     def close(self) -> None:
-        """Close the trace file."""
+        """Close the trace file.
+
+        Raises:
+            OSError: If the native writer failed to flush the end of the file.
+        """
+        if self._native_writer is not None:
+            native_writer = self._native_writer
+            self._native_writer = None
+            native_writer.close()
+            logger.info("Wrote %d messages to '%s'", self._written_count, self._path)
         if self._file is not None:
             self._file.close()
             logger.info("Wrote %d messages to '%s'", self._written_count, self._path)
             self._file = None
 
+    def _write_message_native(self, message: Message) -> bool:
+        """Write a message through the native C++ writer."""
+        message_type = message.DESCRIPTOR.name
+        if not _native.native.is_supported_message_type(message_type):
+            logger.error("Message type '%s' is not supported by the native writer", message_type)
+            return False
+        try:
+            data = message.SerializeToString()
+        except EncodeError as e:
+            logger.error("Failed to write message: %s", e)
+            return False
+        if not self._native_writer.write(data, message_type):
+            logger.error("Failed to write message")
+            return False
+        self._written_count += 1
+        return True
+
     @property
     def written_count(self) -> int:
         """Number of messages written so far."""
@@ -0,0 +1,102 @@
+# SPDX-License-Identifier: MPL-2.0
+# SPDX-FileCopyrightText: Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+
+"""Tests for the columnar NumPy export."""
+
+from __future__ import annotations
+
+import tempfile
+from pathlib import Path
+
+import pytest
+from osi3.osi_groundtruth_pb2 import GroundTruth
+from osi3.osi_sensordata_pb2 import SensorData
+
+from osi_utilities import MultiTraceWriter, SingleTraceWriter
+from osi_utilities.columnar import (
+    DETECTED_OBJECT_COLUMNS,
+    MOVING_OBJECT_COLUMNS,
+    read_detected_objects,
+    read_moving_objects,
+)
+from osi_utilities.tracefile import _native
+
+np = pytest.importorskip("numpy")
+
+BACKENDS = [
+    "python",
+    pytest.param("native", marks=pytest.mark.skipif(not _native.native_available(), reason="no native module")),
+]
+
+
+def _make_ground_truth(index: int, object_count: int) -> GroundTruth:
+    gt = GroundTruth()
+    gt.timestamp.seconds = index
+    for i in range(object_count):
+        obj = gt.moving_object.add()
+        obj.id.value = i + 1
+        obj.base.position.x = float(index)
+        obj.base.position.y = float(i)
+        obj.base.dimension.length = 4.5
+    return gt
+
+
+@pytest.fixture()
+def tmp_dir():
+    with tempfile.TemporaryDirectory() as d:
+        yield Path(d)
+
+
+@pytest.mark.parametrize("backend", BACKENDS)
+class TestColumnarExport:
+    def test_moving_objects_from_binary(self, tmp_dir: Path, backend: str):
+        path = tmp_dir / "columnar_gt.osi"
+        with SingleTraceWriter() as writer:
+            assert writer.open(path)
+            for i in range(4):
+                assert writer.write_message(_make_ground_truth(i, i))
+
+        columns = read_moving_objects(path, backend=backend)
+
+        assert set(columns) == set(MOVING_OBJECT_COLUMNS)
+        assert all(len(values) == 6 for values in columns.values())
+        assert columns["id"].dtype == np.uint64
+        assert columns["frame_index"].tolist() == [1, 2, 2, 3, 3, 3]
+        assert columns["timestamp"][-1] == 3_000_000_000
+        assert columns["position_x"][-1] == 3.0
+        assert columns["dimension_length"][0] == 4.5
+        assert np.isnan(columns["velocity_x"]).all()
+
+    def test_topic_filter(self, tmp_dir: Path, backend: str):
+        path = tmp_dir / "columnar.mcap"
+        with MultiTraceWriter() as writer:
+            assert writer.open(path)
+            writer.add_channel("gt_a", GroundTruth)
+            writer.add_channel("gt_b", GroundTruth)
+            assert writer.write_message(_make_ground_truth(1, 1), "gt_a")
+            assert writer.write_message(_make_ground_truth(1, 3), "gt_b")
+
+        assert len(read_moving_objects(path, backend=backend)["id"]) == 4
+        assert len(read_moving_objects(path, topics=["gt_b"], backend=backend)["id"]) == 3
+
+    def test_detected_objects(self, tmp_dir: Path, backend: str):
+        path = tmp_dir / "columnar_sd.osi"
+        sensor_data = SensorData()
+        sensor_data.timestamp.seconds = 1
+        tracked = sensor_data.moving_object.add()
+        tracked.header.tracking_id.add().value = 42
+        tracked.header.existence_probability = 0.9
+        tracked.base.position.x = 10.0
+        sensor_data.moving_object.add()
+        with SingleTraceWriter() as writer:
+            assert writer.open(path)
+            assert writer.write_message(sensor_data)
+
+        columns = read_detected_objects(path, backend=backend)
+
+        assert set(columns) == set(DETECTED_OBJECT_COLUMNS)
+        assert columns["id"].tolist() == [42, 0]
+        assert columns["existence_probability"][0] == pytest.approx(0.9)
+        assert np.isnan(columns["existence_probability"][1])
+        assert columns["position_x"][0] == 10.0
+        assert np.isnan(columns["position_x"][1])
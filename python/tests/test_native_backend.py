@@ -0,0 +1,256 @@
+# SPDX-License-Identifier: MPL-2.0
+# SPDX-FileCopyrightText: Copyright (c) 2026, Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+
+"""Tests for the optional native reader backend."""
+
+from __future__ import annotations
+
+import os
+import struct
+import tempfile
+from pathlib import Path
+
+import pytest
+from osi3.osi_groundtruth_pb2 import GroundTruth
+from osi3.osi_sensorview_pb2 import SensorView
+
+from osi_utilities import (
+    MessageType,
+    MultiTraceReader,
+    MultiTraceWriter,
+    ReadStatus,
+    SingleTraceReader,
+    SingleTraceWriter,
+)
+from osi_utilities.tracefile import _native
+
+# Set in CI jobs that build the extension module, so that a missing module fails instead of skipping
+REQUIRE_NATIVE_ENVIRONMENT_VARIABLE = "OSI_UTILITIES_REQUIRE_NATIVE"
+native_required = bool(os.environ.get(REQUIRE_NATIVE_ENVIRONMENT_VARIABLE))
+requires_native = pytest.mark.skipif(
+    not _native.native_available() and not native_required, reason="osi_utilities_native is not installed"
+)
+
+
+def _make_ground_truth(index: int = 0) -> GroundTruth:
+    gt = GroundTruth()
+    gt.timestamp.seconds = index
+    gt.timestamp.nanos = index * 1000
+    return gt
+
+
+@pytest.fixture()
+def tmp_dir():
+    with tempfile.TemporaryDirectory() as d:
+        yield Path(d)
+
+
+# ===========================================================================
+# Backend selection
+# ===========================================================================
+
+
+class TestBackendSelection:
+    def test_unknown_backend(self):
+        with pytest.raises(ValueError, match="Unsupported backend"):
+            SingleTraceReader(backend="cython")
+        with pytest.raises(ValueError, match="Unsupported backend"):
+            MultiTraceReader(backend="cython")
+
+    def test_python_backend(self):
+        assert not _native.use_native_backend("python")
+
+    def test_default_from_environment(self, monkeypatch: pytest.MonkeyPatch):
+        monkeypatch.delenv(_native.BACKEND_ENVIRONMENT_VARIABLE, raising=False)
+        assert not _native.use_native_backend(None)
+        monkeypatch.setenv(_native.BACKEND_ENVIRONMENT_VARIABLE, "auto")
+        assert _native.use_native_backend(None) == _native.native_available()
+
+    @pytest.mark.skipif(not native_required, reason=f"{REQUIRE_NATIVE_ENVIRONMENT_VARIABLE} is not set")
+    def test_native_backend_installed(self):
+        assert _native.native_available(), "osi_utilities_native is required but cannot be imported"
+
+    @pytest.mark.skipif(_native.native_available(), reason="osi_utilities_native is installed")
+    def test_native_backend_missing(self):
+        assert not _native.use_native_backend("auto")
+        with pytest.raises(ImportError, match="BUILD_PYTHON_BINDINGS"):
+            SingleTraceReader(backend="native")
+
+
+# ===========================================================================
+# Native readers
+# ===========================================================================
+
+
+@requires_native
+class TestNativeSingleTraceReader:
+    def test_matches_python_backend(self, tmp_dir: Path):
+        path = tmp_dir / "native_gt.osi"
+        with SingleTraceWriter() as writer:
+            assert writer.open(path)
+            for i in range(5):
+                assert writer.write_message(_make_ground_truth(i))
+
+        with SingleTraceReader(backend="python") as reader:
+            assert reader.open(path)
+            expected = [r.message for r in reader]
+        with SingleTraceReader(backend="native") as reader:
+            assert reader.open(path)
+            results = list(reader)
+
+        assert [r.status for r in results] == [ReadStatus.OK] * 5
+        assert [r.message for r in results] == expected
+        assert all(r.message_type == MessageType.GROUND_TRUTH for r in results)
+
+    def test_read_raw_returns_read_only_view(self, tmp_dir: Path):
+        path = tmp_dir / "raw_gt.osi"
+        with SingleTraceWriter() as writer:
+            assert writer.open(path)
+            for i in range(2):
+                assert writer.write_message(_make_ground_truth(i))
+
+        reader = _native.native.BinaryReader()
+        assert reader.open(path, "GroundTruth")
+        first = reader.read_raw()
+        # the view aliases the reader buffer, so it is only valid until the next read
+        assert isinstance(first[0], memoryview)
+        assert first[0].readonly
+        assert first[0] == _make_ground_truth(0).SerializeToString()
+        assert first[1] == "GroundTruth"
+        first[0].release()
+        second = reader.read_raw()
+        assert second[0] == _make_ground_truth(1).SerializeToString()
+        assert reader.read_raw() is None
+        reader.close()
+
+    def test_truncated_body(self, tmp_dir: Path):
+        path = tmp_dir / "truncated_gt.osi"
+        path.write_bytes(struct.pack("<I", 100) + b"\x00" * 10)
+
+        with SingleTraceReader(backend="native") as reader:
+            assert reader.open(path)
+            result = reader.read_message()
+            assert result is not None
+            assert result.status == ReadStatus.ERROR
+            assert not reader.has_next()
+
+
+@requires_native
+class TestNativeMultiTraceReader:
+    @pytest.fixture()
+    def mcap_path(self, tmp_dir: Path) -> Path:
+        path = tmp_dir / "native.mcap"
+        with MultiTraceWriter() as writer:
+            assert writer.open(path)
+            writer.add_channel("gt", GroundTruth)
+            writer.add_channel("sv", SensorView)
+            for i in range(3):
+                assert writer.write_message(_make_ground_truth(i), "gt")
+                sv = SensorView()
+                sv.timestamp.seconds = i
+                assert writer.write_message(sv, "sv")
+        return path
+
+    def test_matches_python_backend(self, mcap_path: Path):
+        with MultiTraceReader(backend="python") as reader:
+            assert reader.open(mcap_path)
+            expected = [(r.channel_name, r.message_type, r.message) for r in reader]
+        with MultiTraceReader(backend="native") as reader:
+            assert reader.open(mcap_path)
+            results = [(r.channel_name, r.message_type, r.message) for r in reader]
+
+        assert results == expected
+
+    def test_topic_filter(self, mcap_path: Path):
+        with MultiTraceReader(backend="native") as reader:
+            assert reader.open(mcap_path)
+            reader.set_topics(["sv"])
+            results = list(reader)
+            assert len(results) == 3
+            assert all(r.channel_name == "sv" for r in results)
+
+    def test_message_type_mismatch(self, mcap_path: Path):
+        with MultiTraceReader(backend="native", skip_incompatible_messages=False) as reader:
+            assert reader.open(mcap_path)
+            reader.set_topic_message_types({"sv": MessageType.GROUND_TRUTH})
+            statuses = {r.channel_name: r.status for r in reader}
+            assert statuses == {"gt": ReadStatus.OK, "sv": ReadStatus.INCOMPATIBLE}
+
+    def test_metadata_access(self, mcap_path: Path):
+        with MultiTraceReader(backend="native") as reader:
+            assert reader.open(mcap_path)
+            assert set(reader.get_available_topics()) == {"gt", "sv"}
+            assert any(m["name"] == "net.asam.osi.trace" for m in reader.get_file_metadata())
+
+
+# ===========================================================================
+# Native writers
+# ===========================================================================
+
+
+@requires_native
+class TestNativeWriters:
+    def test_binary_writer(self, tmp_dir: Path):
+        path = tmp_dir / "native_writer_gt.osi"
+        writer = _native.native.BinaryWriter()
+        assert writer.open(path)
+        for i in range(3):
+            assert writer.write(_make_ground_truth(i).SerializeToString(), "GroundTruth")
+        writer.close()
+
+        with SingleTraceReader(backend="python") as reader:
+            assert reader.open(path)
+            assert [r.message.timestamp.seconds for r in reader] == [0, 1, 2]
+
+    def test_mcap_writer(self, tmp_dir: Path):
+        path = tmp_dir / "native_writer.mcap"
+        writer = _native.native.MCAPWriter()
+        assert writer.open(path)
+        writer.add_channel("gt", "GroundTruth")
+        for i in range(3):
+            assert writer.write(_make_ground_truth(i).SerializeToString(), "GroundTruth", "gt")
+        writer.close()
+
+        with MultiTraceReader(backend="python") as reader:
+            assert reader.open(path)
+            assert [r.message.timestamp.seconds for r in reader] == [0, 1, 2]
+
+    def test_trace_writers_dispatch_to_native(self, tmp_dir: Path):
+        binary_path = tmp_dir / "dispatch_gt.osi"
+        with SingleTraceWriter(backend="native") as writer:
+            assert writer.open(binary_path)
+            assert writer._native_writer is not None
+            for i in range(3):
+                assert writer.write_message(_make_ground_truth(i))
+        mcap_path = tmp_dir / "dispatch.mcap"
+        with MultiTraceWriter(backend="native") as writer:
+            assert writer.open(mcap_path, compression="lz4")
+            assert writer._native_writer is not None
+            writer.add_channel("gt", GroundTruth)
+            for i in range(3):
+                assert writer.write_message(_make_ground_truth(i), "gt")
+
+        with SingleTraceReader(backend="python") as reader:
+            assert reader.open(binary_path)
+            assert [r.message for r in reader] == [_make_ground_truth(i) for i in range(3)]
+        with MultiTraceReader(backend="python") as reader:
+            assert reader.open(mcap_path)
+            assert [(r.channel_name, r.message) for r in reader] == [("gt", _make_ground_truth(i)) for i in range(3)]
+
+    def test_close_raises_if_final_flush_failed(self, tmp_dir: Path):
+        if not Path("/dev/full").exists():
+            pytest.skip("/dev/full is not available")
+        path = tmp_dir / "full.osi"
+        path.symlink_to("/dev/full")
+        writer = SingleTraceWriter(backend="native")
+        assert writer.open(path)
+        assert writer.write_message(_make_ground_truth())
+        with pytest.raises(OSError):
+            writer.close()
+
+    def test_unknown_message_type(self, tmp_dir: Path):
+        writer = _native.native.BinaryWriter()
+        assert writer.open(tmp_dir / "unknown.osi")
+        with pytest.raises(ValueError, match="Unsupported OSI message type"):
+            writer.write(b"", "NotAMessage")
+        writer.close()